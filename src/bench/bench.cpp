@@ -0,0 +1,705 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : bench.cpp
+// Date : October 19, 2026
+// Description : Micro-benchmarks
+//
+// Times small, hot pieces of each core in isolation (memory reads, instruction decoding, rendering, mixing, etc)
+// Everything runs on synthetic in-memory data, so no ROMs, BIOS files, or firmware are needed
+// Results are written as JSON so runs from different revisions can be compared directly
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <filesystem>
+
+#include "gba/core.h"
+#include "dmg/core.h"
+#include "nds/core.h"
+#include "common/config.h"
+#include "common/util.h"
+#include "common/audio_mix.h"
+#include "common/info.h"
+#include "common/profiler.h"
+
+#include <SDL_main.h>
+
+//Keeps the compiler from discarding benchmarked work
+volatile u32 bench_sink = 0;
+
+class gbe_bench
+{
+	public:
+
+	struct bench_result
+	{
+		std::string name;
+		u64 iterations;
+		double ns_per_op;
+		double total_ns;
+
+		//Hardware counters per operation for the fastest run, when enabled
+		bool has_hw;
+		double hw_per_op[profiler::HW_COUNTER_COUNT];
+	};
+
+	std::vector<bench_result> results;
+	std::string filter;
+	u32 runs;
+	u32 min_time;
+	bool use_hw_counters;
+
+	gbe_bench();
+
+	void run(std::string name, u32 ops_per_call, std::function<void(u64)> func);
+	bool write_json(std::string filename);
+
+	void bench_util();
+	void bench_audio();
+	void bench_gba();
+	void bench_dmg();
+	void bench_nds();
+
+	private:
+
+	bool is_selected(std::string name);
+	bool any_selected(const std::vector<std::string> &names);
+	void setup_agb_lcd(AGB_core &core);
+	void setup_ntr_poly(NTR_core &core);
+	std::vector<u8> make_bps_patch(const std::vector<u8> &source, std::vector<u8> &target);
+	void put_bps_num(std::vector<u8> &patch, u64 number);
+};
+
+/****** Benchmark constructor ******/
+gbe_bench::gbe_bench()
+{
+	filter = "";
+	runs = 5;
+	min_time = 100;
+	use_hw_counters = false;
+}
+
+/****** Checks whether a benchmark was selected by the current filter ******/
+bool gbe_bench::is_selected(std::string name)
+{
+	return (filter.empty()) || (name.find(filter) != std::string::npos);
+}
+
+/****** Checks whether any benchmark of a group was selected by the current filter ******/
+bool gbe_bench::any_selected(const std::vector<std::string> &names)
+{
+	for(u32 x = 0; x < names.size(); x++)
+	{
+		if(is_selected(names[x])) { return true; }
+	}
+
+	return false;
+}
+
+/****** Times a benchmark, keeping the fastest of several runs ******/
+void gbe_bench::run(std::string name, u32 ops_per_call, std::function<void(u64)> func)
+{
+	if(!is_selected(name)) { return; }
+
+	typedef std::chrono::steady_clock bench_clock;
+
+	//Grow the iteration count until one run takes long enough to time reliably
+	u64 iterations = 1;
+	double elapsed = 0.0;
+
+	while(true)
+	{
+		auto start = bench_clock::now();
+		func(iterations);
+		elapsed = std::chrono::duration<double, std::nano>(bench_clock::now() - start).count();
+
+		if((elapsed >= (min_time * 1000000.0)) || (iterations >= 0x40000000)) { break; }
+
+		//Jump close to the target once there's a usable measurement
+		if(elapsed > 1000000.0)
+		{
+			u64 next = u64(iterations * ((min_time * 1000000.0) / elapsed) * 1.1) + 1;
+			iterations = (next > (iterations * 2)) ? next : (iterations * 2);
+		}
+
+		else { iterations *= 2; }
+	}
+
+	u64 hw_start[profiler::HW_COUNTER_COUNT];
+	u64 hw_end[profiler::HW_COUNTER_COUNT];
+	u64 hw_best[profiler::HW_COUNTER_COUNT] = { 0, 0, 0, 0 };
+
+	//Counters are not read while calibrating, so only later runs count when they are enabled
+	double best = (use_hw_counters) ? 0.0 : elapsed;
+	u32 timed_runs = ((use_hw_counters) && (runs < 2)) ? 2 : runs;
+
+	for(u32 x = 1; x < timed_runs; x++)
+	{
+		if(use_hw_counters) { profiler::read_hw_counters(hw_start); }
+
+		auto start = bench_clock::now();
+		func(iterations);
+		elapsed = std::chrono::duration<double, std::nano>(bench_clock::now() - start).count();
+
+		if(use_hw_counters) { profiler::read_hw_counters(hw_end); }
+
+		if((best == 0.0) || (elapsed < best))
+		{
+			best = elapsed;
+
+			for(u32 y = 0; (y < profiler::HW_COUNTER_COUNT) && (use_hw_counters); y++)
+			{
+				hw_best[y] = (hw_end[y] > hw_start[y]) ? (hw_end[y] - hw_start[y]) : 0;
+			}
+		}
+	}
+
+	bench_result result;
+	result.name = name;
+	result.iterations = iterations * ops_per_call;
+	result.ns_per_op = best / result.iterations;
+	result.total_ns = best;
+	result.has_hw = use_hw_counters;
+
+	for(u32 x = 0; x < profiler::HW_COUNTER_COUNT; x++) { result.hw_per_op[x] = double(hw_best[x]) / result.iterations; }
+
+	results.push_back(result);
+
+	std::cout<<"BENCH::" << name << " - " << std::fixed << std::setprecision(3) << result.ns_per_op << " ns/op";
+
+	if(result.has_hw)
+	{
+		double cycles = result.hw_per_op[profiler::HW_CYCLES];
+		double ipc = (cycles > 0.0) ? (result.hw_per_op[profiler::HW_INSTRUCTIONS] / cycles) : 0.0;
+
+		std::cout<<", " << cycles << " cycles/op, " << result.hw_per_op[profiler::HW_INSTRUCTIONS] << " instructions/op, IPC " << std::setprecision(2) << ipc;
+		std::cout<<", " << std::setprecision(3) << result.hw_per_op[profiler::HW_BRANCH_MISSES] << " branch misses/op, " << result.hw_per_op[profiler::HW_CACHE_MISSES] << " cache misses/op";
+	}
+
+	std::cout<<"\n";
+}
+
+/****** Writes all results to a JSON file ******/
+bool gbe_bench::write_json(std::string filename)
+{
+	std::ostringstream json;
+
+	json << "{\n";
+	json << "\t\"revision\": \"" << gbe_info::get_hash() << "\",\n";
+	json << "\t\"runs\": " << runs << ",\n";
+	json << "\t\"benchmarks\": [\n";
+
+	for(u32 x = 0; x < results.size(); x++)
+	{
+		json << "\t\t{ ";
+		json << "\"name\": \"" << results[x].name << "\", ";
+		json << "\"iterations\": " << results[x].iterations << ", ";
+		json << std::fixed << std::setprecision(3);
+		json << "\"ns_per_op\": " << results[x].ns_per_op << ", ";
+		json << "\"total_ns\": " << results[x].total_ns;
+
+		if(results[x].has_hw)
+		{
+			json << ", \"cycles_per_op\": " << results[x].hw_per_op[profiler::HW_CYCLES];
+			json << ", \"instructions_per_op\": " << results[x].hw_per_op[profiler::HW_INSTRUCTIONS];
+			json << ", \"branch_misses_per_op\": " << results[x].hw_per_op[profiler::HW_BRANCH_MISSES];
+			json << ", \"cache_misses_per_op\": " << results[x].hw_per_op[profiler::HW_CACHE_MISSES];
+		}
+
+		json << " }" << ((x + 1) < results.size() ? ",\n" : "\n");
+	}
+
+	json << "\t]\n";
+	json << "}\n";
+
+	if(filename == "-")
+	{
+		std::cout<<json.str();
+		return true;
+	}
+
+	std::ofstream file(filename.c_str(), std::ios::trunc);
+
+	if(!file.is_open())
+	{
+		std::cout<<"BENCH::Error - Could not write results to " << filename << "\n";
+		return false;
+	}
+
+	file << json.str();
+	file.close();
+
+	std::cout<<"BENCH::Wrote results to " << filename << "\n";
+	return true;
+}
+
+/****** Appends a variable-length number to BPS patch data ******/
+void gbe_bench::put_bps_num(std::vector<u8> &patch, u64 number)
+{
+	while(true)
+	{
+		u8 patch_byte = number & 0x7F;
+		number >>= 7;
+
+		if(!number)
+		{
+			patch.push_back(patch_byte | 0x80);
+			return;
+		}
+
+		patch.push_back(patch_byte);
+		number--;
+	}
+}
+
+/****** Builds a BPS patch that mixes every command type over a source buffer ******/
+std::vector<u8> gbe_bench::make_bps_patch(const std::vector<u8> &source, std::vector<u8> &target)
+{
+	std::vector<u8> patch = { 0x42, 0x50, 0x53, 0x31 };
+	u32 size = source.size();
+
+	put_bps_num(patch, size);
+	put_bps_num(patch, size);
+	put_bps_num(patch, 0);
+
+	target = source;
+	u32 pos = 0;
+	s64 target_offset = 0;
+
+	//Every 4KB chunk keeps most source data, replaces 64 bytes, then repeats earlier target data
+	while(pos < size)
+	{
+		u32 len = ((size - pos) < 0xF80) ? (size - pos) : 0xF80;
+		put_bps_num(patch, ((len - 1) << 2) | 0x0);
+		pos += len;
+
+		if(pos >= size) { break; }
+
+		len = ((size - pos) < 0x40) ? (size - pos) : 0x40;
+		put_bps_num(patch, ((len - 1) << 2) | 0x1);
+
+		for(u32 x = 0; x < len; x++)
+		{
+			u8 value = (pos * 7) + x;
+			patch.push_back(value);
+			target[pos++] = value;
+		}
+
+		if(pos >= size) { break; }
+
+		//Target Copy of the 64 bytes just written - Offsets are relative to the end of the last copy
+		len = ((size - pos) < 0x40) ? (size - pos) : 0x40;
+		put_bps_num(patch, ((len - 1) << 2) | 0x3);
+
+		s64 relative = s64(pos - 0x40) - target_offset;
+		put_bps_num(patch, (u64(relative < 0 ? -relative : relative) << 1) | (relative < 0 ? 1 : 0));
+
+		for(u32 x = 0; x < len; x++) { target[pos + x] = target[pos - 0x40 + x]; }
+
+		target_offset = (pos - 0x40) + len;
+		pos += len;
+	}
+
+	u32 source_crc = util::get_crc32((u8*)source.data(), size);
+	u32 target_crc = util::get_crc32(target.data(), size);
+
+	for(u32 x = 0; x < 4; x++) { patch.push_back(source_crc >> (x * 8)); }
+	for(u32 x = 0; x < 4; x++) { patch.push_back(target_crc >> (x * 8)); }
+
+	u32 patch_crc = util::get_crc32(patch.data(), patch.size());
+	for(u32 x = 0; x < 4; x++) { patch.push_back(patch_crc >> (x * 8)); }
+
+	return patch;
+}
+
+/****** Benchmarks shared utility functions ******/
+void gbe_bench::bench_util()
+{
+	std::vector<u8> data(0x100000);
+	for(u32 x = 0; x < data.size(); x++) { data[x] = (x * 0x9E3779B1) >> 24; }
+
+	run("util::get_crc32 (1MB)", 1, [&](u64 count)
+	{
+		for(u64 x = 0; x < count; x++) { bench_sink += util::get_crc32(data.data(), data.size()); }
+	});
+
+	if(!is_selected("util::patch_bps (1MB)")) { return; }
+
+	//The patch targets a copy of the source, so applying it repeatedly always gives the same result
+	std::vector<u8> target;
+	std::vector<u8> patch = make_bps_patch(data, target);
+	std::string patch_file = (std::filesystem::temp_directory_path() / "gbe_bench_patch.bps").string();
+
+	std::ofstream file(patch_file.c_str(), std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<char*> (patch.data()), patch.size());
+	file.close();
+
+	std::vector<u8> mem_map = data;
+
+	run("util::patch_bps (1MB)", 1, [&](u64 count)
+	{
+		for(u64 x = 0; x < count; x++) { util::patch_bps(patch_file, mem_map, 0, mem_map.size()); }
+	});
+
+	if(mem_map != target) { std::cout<<"BENCH::Warning - BPS patch produced unexpected data\n"; }
+
+	std::filesystem::remove(patch_file);
+}
+
+/****** Benchmarks the shared audio mixer ******/
+void gbe_bench::bench_audio()
+{
+	const u32 length = 2048;
+
+	audio_mix::mix_buffers buffers;
+	audio_mix::reserve(buffers, 4, length);
+
+	for(u32 x = 0; x < 4; x++)
+	{
+		for(u32 y = 0; y < length; y++) { buffers.channel[x][y] = ((y * (x + 3) * 97) & 0xFFFF) - 0x8000; }
+	}
+
+	std::vector<s16> out(length * 2);
+	s32 gain = audio_mix::to_gain(0.25);
+
+	run("audio_mix::add (4 channels)", length, [&](u64 count)
+	{
+		for(u64 x = 0; x < count; x++)
+		{
+			audio_mix::clear(buffers.left.data(), length);
+			for(u32 y = 0; y < 4; y++) { audio_mix::add(buffers.left.data(), buffers.channel[y].data(), gain, length); }
+		}
+
+		bench_sink += buffers.left[length - 1];
+	});
+
+	audio_mix::clear(buffers.right.data(), length);
+	for(u32 y = 0; y < 4; y++) { audio_mix::add(buffers.right.data(), buffers.channel[y].data(), gain, length); }
+
+	run("audio_mix::store_stereo", length, [&](u64 count)
+	{
+		for(u64 x = 0; x < count; x++) { audio_mix::store_stereo(out.data(), buffers.left.data(), buffers.right.data(), length); }
+		bench_sink += out[0];
+	});
+}
+
+/****** Sets up Mode 0 with a scrolling tiled BG and a row of sprites ******/
+void gbe_bench::setup_agb_lcd(AGB_core &core)
+{
+	AGB_MMU &mem = core.core_mmu;
+	AGB_LCD &lcd = core.core_cpu.controllers.video;
+
+	//Palettes - BG and OBJ
+	for(u32 x = 0; x < 512; x++) { mem.write_u16(0x5000000 + (x << 1), (x * 0x1234) & 0x7FFF); }
+
+	//BG tiles at 0x6000000, map at 0x600C000
+	for(u32 x = 0; x < 0x4000; x++) { mem.write_u8(0x6000000 + x, (x * 13) ^ (x >> 5)); }
+
+	for(u32 x = 0; x < 1024; x++)
+	{
+		u16 entry = (x % 512) | ((x & 0x3) << 10) | (((x >> 5) & 0xF) << 12);
+		mem.write_u16(0x600C000 + (x << 1), entry);
+	}
+
+	//OBJ tiles and 16 32x32 sprites spread across the screen
+	for(u32 x = 0; x < 0x2000; x++) { mem.write_u8(0x6010000 + x, (x * 29) ^ (x >> 3)); }
+
+	for(u32 x = 0; x < 16; x++)
+	{
+		mem.write_u16(0x7000000 + (x << 3), (x * 9) & 0xFF);
+		mem.write_u16(0x7000002 + (x << 3), ((x * 15) & 0x1FF) | 0x8000 | ((x & 0x1) << 12));
+		mem.write_u16(0x7000004 + (x << 3), (x * 16) | ((x & 0x3) << 10) | ((x & 0xF) << 12));
+	}
+
+	mem.write_u16(BG0CNT, 0x1801);
+	mem.write_u16(BG0HOFS, 3);
+	mem.write_u16(BG0VOFS, 5);
+	mem.write_u16(DISPCNT, 0x1140);
+
+	lcd.vram = &mem.memory_map[0x6000000];
+	lcd.update_oam();
+	lcd.update_palettes();
+}
+
+/****** Benchmarks GBA components ******/
+void gbe_bench::bench_gba()
+{
+	//Skip building the core unless one of its benchmarks was selected
+	if(!any_selected({ "gba::AGB_MMU::read_u32 (EWRAM)", "gba::AGB_MMU::read_u32 (ROM)", "gba::ARM7::decode (ARM)",
+		"gba::ARM7::decode (THUMB)", "gba::AGB_LCD::render_scanline (1 line)" })) { return; }
+
+	AGB_core core;
+	AGB_MMU &mem = core.core_mmu;
+	ARM7 &cpu = core.core_cpu;
+
+	//Synthetic ROM
+	for(u32 x = 0; x < 0x100000; x++) { mem.memory_map[0x8000000 + x] = (x * 31) ^ (x >> 8); }
+	for(u32 x = 0; x < 0x40000; x++) { mem.memory_map[0x2000000 + x] = x ^ (x >> 9); }
+
+	run("gba::AGB_MMU::read_u32 (EWRAM)", 4096, [&](u64 count)
+	{
+		u32 sum = 0;
+
+		for(u64 x = 0; x < count; x++)
+		{
+			for(u32 y = 0; y < 0x4000; y += 4) { sum += mem.read_u32(0x2000000 + y); }
+		}
+
+		bench_sink += sum;
+	});
+
+	run("gba::AGB_MMU::read_u32 (ROM)", 4096, [&](u64 count)
+	{
+		u32 sum = 0;
+
+		for(u64 x = 0; x < count; x++)
+		{
+			for(u32 y = 0; y < 0x4000; y += 4) { sum += mem.read_u32(0x8000000 + y); }
+		}
+
+		bench_sink += sum;
+	});
+
+	//A mix of common data processing, load/store, branch, and multiply instructions
+	const u32 arm_code[16] =
+	{
+		0xE3A00001, 0xE0811002, 0xE5910004, 0xE8BD8010,
+		0xEA000010, 0xE12FFF1E, 0xE0000291, 0xEF000005,
+		0xE10F0000, 0xE1D000B2, 0xE1A00000, 0xE2533001,
+		0x1AFFFFFD, 0xE92D4010, 0xE0802193, 0xE7910102,
+	};
+
+	const u16 thumb_code[16] =
+	{
+		0x2001, 0x1840, 0x6808, 0xB510,
+		0xBD10, 0xE7FE, 0x4770, 0xF000,
+		0xF800, 0xD0FE, 0x4348, 0x8800,
+		0x9001, 0xA002, 0xC803, 0xDF05,
+	};
+
+	cpu.pipeline_pointer = 0;
+	u8 pipeline_id = (cpu.pipeline_pointer + 2) % 3;
+
+	cpu.arm_mode = ARM7::ARM;
+
+	run("gba::ARM7::decode (ARM)", 4096, [&](u64 count)
+	{
+		u32 sum = 0;
+
+		for(u64 x = 0; x < count; x++)
+		{
+			for(u32 y = 0; y < 4096; y++)
+			{
+				cpu.instruction_pipeline[pipeline_id] = arm_code[y & 0xF];
+				cpu.instruction_operation[pipeline_id] = ARM7::UNDEFINED;
+				cpu.decode();
+				sum += cpu.instruction_operation[pipeline_id];
+			}
+		}
+
+		bench_sink += sum;
+	});
+
+	cpu.arm_mode = ARM7::THUMB;
+
+	run("gba::ARM7::decode (THUMB)", 4096, [&](u64 count)
+	{
+		u32 sum = 0;
+
+		for(u64 x = 0; x < count; x++)
+		{
+			for(u32 y = 0; y < 4096; y++)
+			{
+				cpu.instruction_pipeline[pipeline_id] = thumb_code[y & 0xF];
+				cpu.instruction_operation[pipeline_id] = ARM7::UNDEFINED;
+				cpu.decode();
+				sum += cpu.instruction_operation[pipeline_id];
+			}
+		}
+
+		bench_sink += sum;
+	});
+
+	cpu.arm_mode = ARM7::ARM;
+
+	if(!is_selected("gba::AGB_LCD::render_scanline (1 line)")) { return; }
+
+	//Render on this thread so only the renderer itself is measured
+	bool threaded_render = config::gba_threaded_render;
+	config::gba_threaded_render = false;
+
+	setup_agb_lcd(core);
+	AGB_LCD &lcd = cpu.controllers.video;
+
+	run("gba::AGB_LCD::render_scanline (1 line)", 1, [&](u64 count)
+	{
+		for(u64 x = 0; x < count; x++)
+		{
+			lcd.current_scanline = x % 160;
+			lcd.line_target = &lcd.screen_buffer[240 * lcd.current_scanline];
+			lcd.update_obj_render_list();
+			lcd.render_line();
+		}
+
+		bench_sink += lcd.screen_buffer[0];
+	});
+
+	config::gba_threaded_render = threaded_render;
+}
+
+/****** Benchmarks DMG/GBC components ******/
+void gbe_bench::bench_dmg()
+{
+	//Skip building the core unless one of its benchmarks was selected
+	if(!any_selected({ "dmg::SM83::exec_op" })) { return; }
+
+	DMG_core core;
+	DMG_MMU &mem = core.core_mmu;
+	SM83 &cpu = core.core_cpu;
+
+	mem.cart.mbc_type = DMG_MMU::ROM_ONLY;
+	mem.in_bios = false;
+
+	//LD HL, 0xC000, then loop forever over ALU ops, a store to WRAM, a CB-prefixed op, and a jump
+	const u8 program[] = { 0x21, 0x00, 0xC0, 0x3C, 0x04, 0x80, 0xA8, 0x77, 0x2C, 0xCB, 0x37, 0x18, 0xF6 };
+	for(u32 x = 0; x < sizeof(program); x++) { mem.memory_map[0x150 + x] = program[x]; }
+
+	cpu.reg.pc = 0x150;
+
+	run("dmg::SM83::exec_op", 4096, [&](u64 count)
+	{
+		for(u64 x = 0; x < count; x++)
+		{
+			for(u32 y = 0; y < 4096; y++)
+			{
+				cpu.opcode = mem.read_u8(cpu.reg.pc++);
+				cpu.exec_op(cpu.opcode);
+				cpu.cycles = 0;
+			}
+		}
+
+		bench_sink += cpu.reg.a;
+	});
+}
+
+/****** Sets up a large textured polygon that covers half the 3D screen ******/
+void gbe_bench::setup_ntr_poly(NTR_core &core)
+{
+	NTR_MMU &mem = core.core_mmu;
+	NTR_LCD &lcd = core.core_cpu_nds9.controllers.video;
+
+	//64x64 direct color texture in VRAM bank A, mapped as texture slot 0
+	for(u32 x = 0; x < (64 * 64); x++)
+	{
+		u16 color = ((x * 0x2345) & 0x7FFF) | ((x & 0x7) ? 0x8000 : 0);
+		mem.memory_map[0x6800000 + (x << 1)] = color & 0xFF;
+		mem.memory_map[0x6800001 + (x << 1)] = color >> 8;
+	}
+
+	mem.vram_tex_slot[0] = 0x6800000;
+
+	lcd.lcd_3D_stat.buffer_id = 0;
+	lcd.lcd_3D_stat.poly_min_x = 64;
+	lcd.lcd_3D_stat.poly_max_x = 192;
+
+	//The texture repeats twice across and down the polygon
+	for(u32 x = 0; x < 256; x++)
+	{
+		lcd.lcd_3D_stat.hi_fill[x] = 32;
+		lcd.lcd_3D_stat.lo_fill[x] = 160;
+		lcd.lcd_3D_stat.hi_overflow[x] = 0;
+		lcd.lcd_3D_stat.lo_overflow[x] = 0;
+		lcd.lcd_3D_stat.hi_line_z[x] = 0.0;
+		lcd.lcd_3D_stat.lo_line_z[x] = 0.0;
+		lcd.lcd_3D_stat.hi_tx[x] = s32(x) - 64;
+		lcd.lcd_3D_stat.lo_tx[x] = s32(x) - 64;
+		lcd.lcd_3D_stat.hi_ty[x] = 0;
+		lcd.lcd_3D_stat.lo_ty[x] = 128;
+	}
+
+	lcd.lcd_3D_stat.tex_format = 7;
+	lcd.lcd_3D_stat.tex_offset = 0;
+	lcd.lcd_3D_stat.tex_src_width = 64;
+	lcd.lcd_3D_stat.tex_src_height = 64;
+	lcd.lcd_3D_stat.repeat_tex_x = true;
+	lcd.lcd_3D_stat.repeat_tex_y = true;
+	lcd.lcd_3D_stat.flip_tex_x = false;
+	lcd.lcd_3D_stat.flip_tex_y = false;
+
+	//Opaque, unblended polygon that always passes the depth test
+	lcd.lcd_3D_stat.poly_alpha = 31;
+	lcd.lcd_3D_stat.poly_mode = 0;
+	lcd.lcd_3D_stat.poly_id = 0;
+	lcd.lcd_3D_stat.poly_new_depth = false;
+	lcd.lcd_3D_stat.poly_depth_test = true;
+	lcd.lcd_3D_stat.vertex_color = 0xFFFCFCFC;
+	lcd.lcd_3D_stat.edge_marking = false;
+}
+
+/****** Benchmarks NDS components ******/
+void gbe_bench::bench_nds()
+{
+	//Skip building the core unless one of its benchmarks was selected
+	if(!any_selected({ "nds::NTR_LCD::fill_poly_textured (128x128)" })) { return; }
+
+	NTR_core core;
+	NTR_LCD &lcd = core.core_cpu_nds9.controllers.video;
+
+	setup_ntr_poly(core);
+
+	run("nds::NTR_LCD::fill_poly_textured (128x128)", 1, [&](u64 count)
+	{
+		for(u64 x = 0; x < count; x++) { lcd.fill_poly_textured(); }
+		bench_sink += lcd.gx_screen_buffer[1][(64 * 256) + 128];
+	});
+}
+
+int main(int argc, char* args[])
+{
+	gbe_bench bench;
+	std::string out_file = "gbe_bench.json";
+
+	for(int x = 1; x < argc; x++)
+	{
+		std::string arg = args[x];
+
+		if((arg == "--filter") && ((x + 1) < argc)) { bench.filter = args[++x]; }
+		else if((arg == "--out") && ((x + 1) < argc)) { out_file = args[++x]; }
+		else if((arg == "--runs") && ((x + 1) < argc)) { util::from_str(args[++x], bench.runs); }
+		else if((arg == "--min-time") && ((x + 1) < argc)) { util::from_str(args[++x], bench.min_time); }
+		else if(arg == "--perf-counters") { bench.use_hw_counters = true; }
+
+		else
+		{
+			std::cout<<"Usage: gbe_bench [--filter name] [--out file.json | -] [--runs n] [--min-time ms] [--perf-counters]\n";
+			return ((arg == "--help") || (arg == "-h")) ? 0 : 1;
+		}
+	}
+
+	if(!bench.runs) { bench.runs = 1; }
+
+	//Benchmarks run on this thread, so counters opened here cover them - Unavailable counters read as 0
+	if((bench.use_hw_counters) && (!profiler::open_hw_counters())) { bench.use_hw_counters = false; }
+
+	//Cores are never started, so no windows, audio devices, or input handling are opened
+	config::sdl_render = false;
+
+	bench.bench_util();
+	bench.bench_audio();
+	bench.bench_gba();
+	bench.bench_dmg();
+	bench.bench_nds();
+
+	if(bench.results.empty())
+	{
+		std::cout<<"BENCH::No benchmarks matched filter " << bench.filter << "\n";
+		return 1;
+	}
+
+	return (bench.write_json(out_file)) ? 0 : 1;
+}
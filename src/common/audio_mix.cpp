@@ -0,0 +1,164 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : audio_mix.cpp
+// Date : October 19, 2026
+// Description : Shared software audio mixer
+//
+// Fixed-point mixing and panning used by every core's SDL audio callback
+// Channel buffers are allocated once up front so the audio thread never touches the heap
+// Mixing uses 8-bit fractional gains and SSE2 when available
+
+#include <cmath>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "audio_mix.h"
+
+namespace audio_mix
+{
+
+/****** Converts a floating-point volume ratio into a fixed-point gain ******/
+s32 to_gain(double ratio)
+{
+	s32 gain = std::round(ratio * UNITY_GAIN);
+
+	//Gains must fit in 16-bits for SIMD multiplies
+	if(gain > 32767) { gain = 32767; }
+	else if(gain < -32768) { gain = -32768; }
+
+	return gain;
+}
+
+/****** Grows scratch buffers if necessary - Only allocates when a larger length is requested ******/
+void reserve(mix_buffers &buffers, u32 channel_count, u32 length)
+{
+	if(channel_count > 16) { channel_count = 16; }
+
+	for(u32 x = 0; x < channel_count; x++)
+	{
+		if(buffers.channel[x].size() < length) { buffers.channel[x].resize(length, 0); }
+	}
+
+	if(buffers.left.size() < length) { buffers.left.resize(length, 0); }
+	if(buffers.right.size() < length) { buffers.right.resize(length, 0); }
+}
+
+/****** Zeroes an accumulation buffer ******/
+void clear(s32* acc, u32 length)
+{
+	for(u32 x = 0; x < length; x++) { acc[x] = 0; }
+}
+
+/****** Adds a channel's samples scaled by a fixed-point gain to an accumulation buffer ******/
+void add(s32* acc, const s16* in, s32 gain, u32 length)
+{
+	u32 x = 0;
+
+	#ifdef __SSE2__
+	__m128i g = _mm_set1_epi16(gain);
+
+	//Widening 16x16 -> 32-bit multiply, 8 samples at a time
+	for(; (x + 8) <= length; x += 8)
+	{
+		__m128i samples = _mm_loadu_si128((const __m128i*)(in + x));
+		__m128i lo = _mm_mullo_epi16(samples, g);
+		__m128i hi = _mm_mulhi_epi16(samples, g);
+
+		__m128i acc_0 = _mm_loadu_si128((const __m128i*)(acc + x));
+		__m128i acc_1 = _mm_loadu_si128((const __m128i*)(acc + x + 4));
+
+		acc_0 = _mm_add_epi32(acc_0, _mm_unpacklo_epi16(lo, hi));
+		acc_1 = _mm_add_epi32(acc_1, _mm_unpackhi_epi16(lo, hi));
+
+		_mm_storeu_si128((__m128i*)(acc + x), acc_0);
+		_mm_storeu_si128((__m128i*)(acc + x + 4), acc_1);
+	}
+	#endif
+
+	for(; x < length; x++) { acc[x] += (in[x] * gain); }
+}
+
+/****** Adds a constant level (e.g. a muted channel's silence) scaled by a fixed-point gain ******/
+void add_dc(s32* acc, s16 value, s32 gain, u32 length)
+{
+	s32 level = value * gain;
+	for(u32 x = 0; x < length; x++) { acc[x] += level; }
+}
+
+/****** Converts an accumulation buffer back to saturated 16-bit output ******/
+//Shifts beyond GAIN_SHIFT apply a final power-of-two attenuation (e.g. dividing by the channel count) without costing gain precision
+void store_mono(s16* out, const s32* acc, u32 length, u32 step, u8 shift)
+{
+	u32 x = 0;
+
+	#ifdef __SSE2__
+	if(step == 1)
+	{
+		__m128i count = _mm_cvtsi32_si128(shift);
+
+		for(; (x + 8) <= length; x += 8)
+		{
+			__m128i acc_0 = _mm_sra_epi32(_mm_loadu_si128((const __m128i*)(acc + x)), count);
+			__m128i acc_1 = _mm_sra_epi32(_mm_loadu_si128((const __m128i*)(acc + x + 4)), count);
+			_mm_storeu_si128((__m128i*)(out + x), _mm_packs_epi32(acc_0, acc_1));
+		}
+	}
+	#endif
+
+	for(; x < length; x++)
+	{
+		s32 sample = acc[(x * step) + (step - 1)] >> shift;
+
+		if(sample > 32767) { sample = 32767; }
+		else if(sample < -32768) { sample = -32768; }
+
+		out[x] = sample;
+	}
+}
+
+/****** Interleaves left and right accumulation buffers into saturated 16-bit stereo output ******/
+void store_stereo(s16* out, const s32* left, const s32* right, u32 length, u32 step)
+{
+	u32 x = 0;
+
+	#ifdef __SSE2__
+	if(step == 1)
+	{
+		for(; (x + 8) <= length; x += 8)
+		{
+			__m128i l_0 = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(left + x)), GAIN_SHIFT);
+			__m128i l_1 = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(left + x + 4)), GAIN_SHIFT);
+			__m128i r_0 = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(right + x)), GAIN_SHIFT);
+			__m128i r_1 = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(right + x + 4)), GAIN_SHIFT);
+
+			__m128i l = _mm_packs_epi32(l_0, l_1);
+			__m128i r = _mm_packs_epi32(r_0, r_1);
+
+			_mm_storeu_si128((__m128i*)(out + (x * 2)), _mm_unpacklo_epi16(l, r));
+			_mm_storeu_si128((__m128i*)(out + (x * 2) + 8), _mm_unpackhi_epi16(l, r));
+		}
+	}
+	#endif
+
+	for(; x < length; x++)
+	{
+		u32 index = (x * step) + (step - 1);
+		s32 l = left[index] >> GAIN_SHIFT;
+		s32 r = right[index] >> GAIN_SHIFT;
+
+		if(l > 32767) { l = 32767; }
+		else if(l < -32768) { l = -32768; }
+
+		if(r > 32767) { r = 32767; }
+		else if(r < -32768) { r = -32768; }
+
+		out[x * 2] = l;
+		out[(x * 2) + 1] = r;
+	}
+}
+
+}
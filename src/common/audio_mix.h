@@ -0,0 +1,45 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : audio_mix.h
+// Date : October 19, 2026
+// Description : Shared software audio mixer
+//
+// Fixed-point mixing and panning used by every core's SDL audio callback
+// Channel buffers are allocated once up front so the audio thread never touches the heap
+// Mixing uses 8-bit fractional gains and SSE2 when available
+
+#ifndef GBE_AUDIO_MIX
+#define GBE_AUDIO_MIX
+
+#include <vector>
+
+#include "common.h"
+
+namespace audio_mix
+{
+	//Gains are fixed-point with 8 fractional bits, 0x100 == 1.0
+	const u8 GAIN_SHIFT = 8;
+	const s32 UNITY_GAIN = (1 << GAIN_SHIFT);
+
+	//Per-core scratch buffers for one callback
+	struct mix_buffers
+	{
+		std::vector<s16> channel[16];
+		std::vector<s32> left;
+		std::vector<s32> right;
+	};
+
+	s32 to_gain(double ratio);
+	void reserve(mix_buffers &buffers, u32 channel_count, u32 length);
+
+	void clear(s32* acc, u32 length);
+	void add(s32* acc, const s16* in, s32 gain, u32 length);
+	void add_dc(s32* acc, s16 value, s32 gain, u32 length);
+
+	void store_mono(s16* out, const s32* acc, u32 length, u32 step = 1, u8 shift = GAIN_SHIFT);
+	void store_stereo(s16* out, const s32* left, const s32* right, u32 length, u32 step = 1);
+}
+
+#endif // GBE_AUDIO_MIX
@@ -17,6 +17,8 @@
 #include "config.h"
 #include "util.h"
 #include "info.h"
+#include "rom_archive.h"
+#include "rom_cache.h"
 
 namespace config
 {
@@ -82,6 +84,15 @@ namespace config
 	//Default NDS touch mode (light pressure)
 	u8 touch_mode = 0;
 
+	//Render GBA scanlines on a separate thread
+	bool gba_threaded_render = true;
+
+	//Render NDS Engine A and Engine B on separate threads
+	bool nds_threaded_2d = true;
+
+	//Cycles the NDS9 or NDS7 may run ahead of the other before switching
+	u32 nds_sync_quantum = 32;
+
 	//Hotkey bindings
 	//Turbo = TAB
 	u32 hotkey_turbo = SDLK_TAB;
@@ -131,6 +142,15 @@ namespace config
 	u8 scaling_factor = 1;
 	u8 old_scaling_factor = 1;
 
+	//Software filters (no OpenGL)
+	u8 sw_scaler = 0;
+	u8 sw_color_filter = 0;
+	bool sw_lcd_grid = false;
+	u8 sw_filter_threads = 0;
+
+	//Skip presenting lines or frames that have not changed since the last frame
+	bool skip_unchanged_frames = true;
+
 	std::stringstream title;
 
 	//Cheats - Gameshark and Game Genie (DMG-GBC), Gameshark - GBA
@@ -179,6 +199,11 @@ namespace config
 	//Max FPS
 	u16 max_fps = 0;
 
+	//Frame skipping - Frames skipped per drawn frame, normally and during turbo
+	u8 frame_skip = 0;
+	u8 turbo_frame_skip = 4;
+	bool auto_frame_skip = false;
+
 	//Legacy save size
 	bool use_legacy_save_size = false;
 
@@ -312,6 +337,21 @@ namespace config
 	std::string osd_message = "";
 	u32 osd_count = 0;
 	u8 osd_alpha = 0xFF;
+
+	//Memory access tracing settings
+	bool use_mem_trace = false;
+	u32 mem_trace_size = 0x100000;
+
+	//Frame-time profiler settings
+	bool use_profiler = false;
+	bool use_hw_counters = false;
+
+	//Background battery save settings - Delay is in milliseconds
+	bool use_save_flush = true;
+	u32 save_flush_delay = 1000;
+
+	//Block-compressed ROM cache size - In KB
+	u32 rom_cache_size = 16384;
 }
 
 /****** Reset DMG default colors ******/
@@ -642,9 +682,10 @@ void validate_system_type()
 		return;
 	}
 
-	//Determine Gameboy type based on file name
+	//Determine Gameboy type based on file name - Compressed ROMs use the name of the ROM inside
 	//Note, DMG and GBC games are automatically detected in the Gameboy MMU, so only check for GBA types here
-	std::size_t dot = config::rom_file.find_last_of(".");
+	std::string rom_name = rom_archive::get_rom_filename(config::rom_file);
+	std::size_t dot = rom_name.find_last_of(".");
 	
 	if(dot == std::string::npos)
 	{
@@ -652,7 +693,7 @@ void validate_system_type()
 		return;
 	}
 
-	std::string ext = config::rom_file.substr(dot);
+	std::string ext = rom_name.substr(dot);
 
 	//Convert extension to lower-case ASCII
 	for(u32 x = 0; x < ext.length(); x++)
@@ -698,12 +739,13 @@ u8 get_system_type_from_file(std::string filename)
 		return config::gb_type;
 	}
 
-	//Determine Gameboy type based on file name
-	std::size_t dot = filename.find_last_of(".");
+	//Determine Gameboy type based on file name - Compressed ROMs use the name of the ROM inside
+	std::string rom_name = rom_archive::get_rom_filename(filename);
+	std::size_t dot = rom_name.find_last_of(".");
 
 	if(dot == std::string::npos) { return 0; }
 
-	std::string ext = filename.substr(dot);
+	std::string ext = rom_name.substr(dot);
 	
 	//Convert extension to lower-case ASCII
 	for(u32 x = 0; x < ext.length(); x++)
@@ -733,28 +775,21 @@ u8 get_system_type_from_file(std::string filename)
 	//For Auto or GBC mode, determine what the CGB Flag is
 	if((gb_type == SYS_AUTO) || (gb_type == SYS_GBC) || (gb_type == SYS_SGB) || (gb_type == SYS_SGB2))
 	{
-		std::ifstream test_stream(filename.c_str(), std::ios::binary);
-		
-		if(test_stream.is_open())
-		{
-			u8 color_byte;
-			u8 sgb_byte;
+		//Header flags come from the ROM cache, compressed ROMs only need their header decompressed
+		rom_cache::rom_info info;
 
-			test_stream.seekg(0x143);
-			test_stream.read((char*)&color_byte, 1);
+		if(rom_cache::get_header(filename, rom_cache::HEADER_DMG, info))
+		{
+			u8 color_byte = info.cgb_flag;
+			u8 sgb_byte = info.sgb_flag;
 
 			//If GBC compatible, use GBC mode. Otherwise, use DMG mode
 			if((color_byte == 0xC0) || (color_byte == 0x80)) { gb_type = SYS_GBC; }
 			else { gb_type = SYS_DMG; }
 
-			test_stream.seekg(0x146);
-			test_stream.read((char*)&sgb_byte, 1);
-
 			//If SGB compatible, use it if SGB set as the system
 			if((sgb_byte == 0x3) && (config::gb_type == SYS_SGB)) { gb_type = SYS_SGB; }
 			else if((sgb_byte == 0x3) && (config::gb_type == SYS_SGB2)) { gb_type = SYS_SGB2; }
-
-			test_stream.close();
 		}
 	}
 
@@ -861,6 +896,25 @@ bool parse_cli_args()
 				}
 			}
 
+			//Set frame skip
+			else if((config::cli_args[x] == "-fs") || (config::cli_args[x] == "--frame-skip"))
+			{
+				if((++x) == config::cli_args.size()) { std::cout<<"GBE::Error - No frame skip value set\n"; }
+
+				else
+				{
+					u32 output = 0;
+					util::from_str(config::cli_args[x], output);
+					config::frame_skip = (output > 9) ? 9 : output;
+				}
+			}
+
+			//Only skip frames when running behind
+			else if(config::cli_args[x] == "--auto-frame-skip") { config::auto_frame_skip = true; }
+
+			//Always present every frame, even unchanged ones
+			else if(config::cli_args[x] == "--present-all-frames") { config::skip_unchanged_frames = false; }
+
 			//Override default audio driver
 			else if((config::cli_args[x] == "-ad") || (config::cli_args[x] == "--audio-driver"))
 			{
@@ -1057,6 +1111,15 @@ bool parse_cli_args()
 			//Use legacy save size for DMG/GBC games if necessary
 			else if(config::cli_args[x] == "--use-legacy-save-size") { config::use_legacy_save_size = true; }
 
+			//Start memory access tracing at boot
+			else if(config::cli_args[x] == "--trace-mem") { config::use_mem_trace = true; }
+
+			//Start frame-time profiling at boot
+			else if(config::cli_args[x] == "--profile") { config::use_profiler = true; }
+
+			//Record hardware performance counters while profiling
+			else if(config::cli_args[x] == "--perf-counters") { config::use_hw_counters = true; }
+
 			//Print Help
 			else if((config::cli_args[x] == "-h") || (config::cli_args[x] == "--help")) 
 			{
@@ -1115,8 +1178,14 @@ bool parse_cli_args()
 				std::cout<<"--save-import [FILE]\n\tImport save from specified file\n\n";
 				std::cout<<"--save-export [FILE]\n\tExport save to specified file\n\n";
 				std::cout<<"--use-legacy-save-size\n\tUse old 128KB save format from older GBE+ versions\n\n";
+				std::cout<<"--trace-mem\n\tRecord memory accesses from boot. Press F10 to stop and save the trace\n\n";
+				std::cout<<"--profile\n\tProfile frame times from boot. Press F11 (F6 on NDS) to stop and save a Chrome trace\n\n";
+				std::cout<<"--perf-counters\n\tAdd CPU cycles, instructions, branch misses, and cache misses to profiles (Linux only)\n\n";
 				std::cout<<"-ad [DRIVER], --audio-driver [DRIVER]\n\tSelects a specific audio driver for GBE+\n\n";
 				std::cout<<"-mf [FRAMERATE], --max-fps [FRAMERATE]\n\tSets the maximum frames per-second\n\n";
+				std::cout<<"-fs [FRAMES], --frame-skip [FRAMES]\n\tSkips drawing up to 9 frames for every frame drawn\n\n";
+				std::cout<<"--auto-frame-skip\n\tOnly skip frames when emulation falls behind real time\n\n";
+				std::cout<<"--present-all-frames\n\tPresent every frame, even when nothing on screen has changed\n\n";
 				std::cout<<"--slot2-gba [FILE]\n\tSets Slot-2 of NDS core to use a specified GBA ROM file\n\n"; 
 				std::cout<<"-h, --help\n\tPrint these help messages\n\n";
 				return false;
@@ -1264,6 +1333,18 @@ bool parse_ini_file(std::string filename)
 		//OSD alpha transparency
 		if(!parse_ini_number(ini_item, "#osd_alpha", config::osd_alpha, ini_opts, x, 0, 255)) { return false; }
 
+		//Memory trace size
+		if(!parse_ini_number(ini_item, "#mem_trace_size", config::mem_trace_size, ini_opts, x, 0x100, 0x10000000)) { return false; }
+
+		//Write battery saves in the background
+		if(!parse_ini_bool(ini_item, "#use_save_flush", config::use_save_flush, ini_opts, x)) { return false; }
+
+		//Background battery save delay
+		if(!parse_ini_number(ini_item, "#save_flush_delay", config::save_flush_delay, ini_opts, x, 0, 60000)) { return false; }
+
+		//Block-compressed ROM cache size
+		if(!parse_ini_number(ini_item, "#rom_cache_size", config::rom_cache_size, ini_opts, x, 128, 0x100000)) { return false; }
+
 		//DMG BIOS path
 		parse_ini_str(ini_item, "#dmg_bios_path", config::dmg_bios_path, ini_opts, x);
 
@@ -1344,6 +1425,15 @@ bool parse_ini_file(std::string filename)
 		//Max FPS
 		if(!parse_ini_number(ini_item, "#max_fps", config::max_fps, ini_opts, x, 0, 65535)) { return false; }
 
+		//Frame skip
+		if(!parse_ini_number(ini_item, "#frame_skip", config::frame_skip, ini_opts, x, 0, 9)) { return false; }
+
+		//Turbo frame skip
+		if(!parse_ini_number(ini_item, "#turbo_frame_skip", config::turbo_frame_skip, ini_opts, x, 0, 30)) { return false; }
+
+		//Automatic frame skip
+		if(!parse_ini_bool(ini_item, "#auto_frame_skip", config::auto_frame_skip, ini_opts, x)) { return false; }
+
 		//Use gamepad dead zone
 		if(!parse_ini_number(ini_item, "#dead_zone", config::dead_zone, ini_opts, x, 0, 32767)) { return false; }
 
@@ -1396,6 +1486,21 @@ bool parse_ini_file(std::string filename)
 		if(!parse_ini_number(ini_item, "#scaling_factor", config::scaling_factor, ini_opts, x, 1, 10)) { return false; }
 		if(ini_item == "#scaling_factor") { config::old_scaling_factor = config::scaling_factor; }
 
+		//Software scaler
+		if(!parse_ini_number(ini_item, "#sw_scaler", config::sw_scaler, ini_opts, x, 0, 4)) { return false; }
+
+		//Software color filter
+		if(!parse_ini_number(ini_item, "#sw_color_filter", config::sw_color_filter, ini_opts, x, 0, 2)) { return false; }
+
+		//Software LCD grid
+		if(!parse_ini_bool(ini_item, "#sw_lcd_grid", config::sw_lcd_grid, ini_opts, x)) { return false; }
+
+		//Software filter threads
+		if(!parse_ini_number(ini_item, "#sw_filter_threads", config::sw_filter_threads, ini_opts, x, 0, 8)) { return false; }
+
+		//Skip unchanged frames
+		if(!parse_ini_bool(ini_item, "#skip_unchanged_frames", config::skip_unchanged_frames, ini_opts, x)) { return false; }
+
 		//Maintain aspect ratio
 		if(!parse_ini_bool(ini_item, "#maintain_aspect_ratio", config::maintain_aspect_ratio, ini_opts, x)) { return false; }
 
@@ -1717,6 +1822,15 @@ bool parse_ini_file(std::string filename)
 		//NDS touch mode
 		if(!parse_ini_number(ini_item, "#nds_touch_mode", config::touch_mode, ini_opts, x, 0, 0xFFFFFFFF)) { return false; }
 
+		//GBA threaded rendering
+		if(!parse_ini_bool(ini_item, "#gba_threaded_render", config::gba_threaded_render, ini_opts, x)) { return false; }
+
+		//NDS threaded 2D rendering
+		if(!parse_ini_bool(ini_item, "#nds_threaded_2d", config::nds_threaded_2d, ini_opts, x)) { return false; }
+
+		//NDS CPU sync quantum
+		if(!parse_ini_number(ini_item, "#nds_sync_quantum", config::nds_sync_quantum, ini_opts, x, 0, 4096)) { return false; }
+
 		//NDS virtual cursor enable
 		if(!parse_ini_bool(ini_item, "#virtual_cursor_enable", config::vc_enable, ini_opts, x)) { return false; }
 
@@ -2080,6 +2194,9 @@ bool load_ini_file(std::string filename)
 		if(!result) { return false; }
 	}
 
+	//The ROM cache lives next to gbe.ini, so it can only be read once its location is known
+	if(util::get_filename_from_path(filename) == "gbe.ini") { rom_cache::open(); }
+
 	//After the location of the data directory is known, set path of temporary media file and karaoke file
 	config::temp_media_file = config::data_path + "gbe_plus_temp_media";
 	config::temp_karaoke_file = config::data_path + "gbe_plus_karaoke";
@@ -2271,6 +2388,39 @@ bool save_ini_file()
 			output_lines[line_pos] = "[#use_osd:" + val + "]";
 		}
 
+		//Memory trace size
+		else if(ini_item == "#mem_trace_size")
+		{
+			line_pos = output_count[x];
+
+			output_lines[line_pos] = "[#mem_trace_size:" + util::to_str(config::mem_trace_size) + "]";
+		}
+
+		//Write battery saves in the background
+		else if(ini_item == "#use_save_flush")
+		{
+			line_pos = output_count[x];
+			std::string val = (config::use_save_flush) ? "1" : "0";
+
+			output_lines[line_pos] = "[#use_save_flush:" + val + "]";
+		}
+
+		//Background battery save delay
+		else if(ini_item == "#save_flush_delay")
+		{
+			line_pos = output_count[x];
+
+			output_lines[line_pos] = "[#save_flush_delay:" + util::to_str(config::save_flush_delay) + "]";
+		}
+
+		//Block-compressed ROM cache size
+		else if(ini_item == "#rom_cache_size")
+		{
+			line_pos = output_count[x];
+
+			output_lines[line_pos] = "[#rom_cache_size:" + util::to_str(config::rom_cache_size) + "]";
+		}
+
 		//DMG BIOS path
 		else if(ini_item == "#dmg_bios_path")
 		{
@@ -2551,6 +2701,48 @@ bool save_ini_file()
 			output_lines[line_pos] = "[#scaling_factor:" + util::to_str(config::scaling_factor) + "]";
 		}
 
+		//Software scaler
+		else if(ini_item == "#sw_scaler")
+		{
+			line_pos = output_count[x];
+
+			output_lines[line_pos] = "[#sw_scaler:" + util::to_str(config::sw_scaler) + "]";
+		}
+
+		//Software color filter
+		else if(ini_item == "#sw_color_filter")
+		{
+			line_pos = output_count[x];
+
+			output_lines[line_pos] = "[#sw_color_filter:" + util::to_str(config::sw_color_filter) + "]";
+		}
+
+		//Software LCD grid
+		else if(ini_item == "#sw_lcd_grid")
+		{
+			line_pos = output_count[x];
+			std::string val = (config::sw_lcd_grid) ? "1" : "0";
+
+			output_lines[line_pos] = "[#sw_lcd_grid:" + val + "]";
+		}
+
+		//Software filter threads
+		else if(ini_item == "#sw_filter_threads")
+		{
+			line_pos = output_count[x];
+
+			output_lines[line_pos] = "[#sw_filter_threads:" + util::to_str(config::sw_filter_threads) + "]";
+		}
+
+		//Skip unchanged frames
+		else if(ini_item == "#skip_unchanged_frames")
+		{
+			line_pos = output_count[x];
+			std::string val = (config::skip_unchanged_frames) ? "1" : "0";
+
+			output_lines[line_pos] = "[#skip_unchanged_frames:" + val + "]";
+		}
+
 		//Maintain aspect ratio
 		else if(ini_item == "#maintain_aspect_ratio")
 		{
@@ -2643,6 +2835,31 @@ bool save_ini_file()
 			output_lines[line_pos] = "[#max_fps:" + util::to_str(config::max_fps) + "]";
 		}
 
+		//Frame skip
+		else if(ini_item == "#frame_skip")
+		{
+			line_pos = output_count[x];
+
+			output_lines[line_pos] = "[#frame_skip:" + util::to_str(config::frame_skip) + "]";
+		}
+
+		//Turbo frame skip
+		else if(ini_item == "#turbo_frame_skip")
+		{
+			line_pos = output_count[x];
+
+			output_lines[line_pos] = "[#turbo_frame_skip:" + util::to_str(config::turbo_frame_skip) + "]";
+		}
+
+		//Automatic frame skip
+		else if(ini_item == "#auto_frame_skip")
+		{
+			line_pos = output_count[x];
+			std::string val = (config::auto_frame_skip) ? "1" : "0";
+
+			output_lines[line_pos] = "[#auto_frame_skip:" + val + "]";
+		}
+
 		//Keyboard controls
 		else if(ini_item == "#gbe_key_controls")
 		{
@@ -2917,6 +3134,33 @@ bool save_ini_file()
 			output_lines[line_pos] = "[#nds_touch_mode:" + val + "]";
 		}
 
+		//GBA threaded rendering
+		else if(ini_item == "#gba_threaded_render")
+		{
+			line_pos = output_count[x];
+			std::string val = (config::gba_threaded_render) ? "1" : "0";
+
+			output_lines[line_pos] = "[#gba_threaded_render:" + val + "]";
+		}
+
+		//NDS threaded 2D rendering
+		else if(ini_item == "#nds_threaded_2d")
+		{
+			line_pos = output_count[x];
+			std::string val = (config::nds_threaded_2d) ? "1" : "0";
+
+			output_lines[line_pos] = "[#nds_threaded_2d:" + val + "]";
+		}
+
+		//NDS CPU sync quantum
+		else if(ini_item == "#nds_sync_quantum")
+		{
+			line_pos = output_count[x];
+			std::string val = util::to_str(config::nds_sync_quantum);
+
+			output_lines[line_pos] = "[#nds_sync_quantum:" + val + "]";
+		}
+
 		//NDS virtual cursor enable
 		else if(ini_item == "#virtual_cursor_enable")
 		{
@@ -3286,8 +3530,16 @@ bool generate_ini_file()
 	ini_contents += "[#vertex_shader]\n\n";
 	ini_contents += "[#fragment_shader]\n\n";
 	ini_contents += "[#scaling_factor]\n\n";
+	ini_contents += "[#sw_scaler]\n\n";
+	ini_contents += "[#sw_color_filter]\n\n";
+	ini_contents += "[#sw_lcd_grid]\n\n";
+	ini_contents += "[#sw_filter_threads]\n\n";
+	ini_contents += "[#skip_unchanged_frames]\n\n";
 	ini_contents += "[#maintain_aspect_ratio]\n\n";
 	ini_contents += "[#max_fps]\n\n";
+	ini_contents += "[#frame_skip]\n\n";
+	ini_contents += "[#turbo_frame_skip]\n\n";
+	ini_contents += "[#auto_frame_skip]\n\n";
 	ini_contents += "[#rtc_offset]\n\n";
 	ini_contents += "[#oc_flags]\n\n";
 	ini_contents += "[#dead_zone]\n\n";
@@ -3300,6 +3552,10 @@ bool generate_ini_file()
 	ini_contents += "[#override_audio_driver]\n\n";
 	ini_contents += "[#use_osd]\n\n";
 	ini_contents += "[#osd_alpha]\n\n";
+	ini_contents += "[#mem_trace_size]\n\n";
+	ini_contents += "[#use_save_flush]\n\n";
+	ini_contents += "[#save_flush_delay]\n\n";
+	ini_contents += "[#rom_cache_size]\n\n";
 	ini_contents += "[#sample_rate]\n\n";
 	ini_contents += "[#sample_size]\n\n";
 	ini_contents += "[#gbe_key_controls]\n\n";
@@ -3331,6 +3587,9 @@ bool generate_ini_file()
 	ini_contents += "[#campho_web_port]\n\n";
 	ini_contents += "[#ir_db_index]\n\n";
 	ini_contents += "[#nds_touch_mode]\n\n";
+	ini_contents += "[#gba_threaded_render]\n\n";
+	ini_contents += "[#nds_threaded_2d]\n\n";
+	ini_contents += "[#nds_sync_quantum]\n\n";
 	ini_contents += "[#virtual_cursor_enable]\n\n";
 	ini_contents += "[#virtual_cursor_file]\n\n";
 	ini_contents += "[#virtual_cursor_opacity]\n\n";
@@ -3508,16 +3767,10 @@ void get_firmware_hashes()
 std::string get_game_ini_filename()
 {
 	std::string result = "";
-	std::ifstream file(config::rom_file.c_str(), std::ios::binary);
-	std::vector<u8> temp_buffer;
-
-	if(!file.is_open()) { return result; }
-
-	u32 file_size = util::get_file_size(config::rom_file);
-	if(!file_size) { return result; }
 
-	temp_buffer.resize(file_size, 0x00);
-	file.read(reinterpret_cast<char*> (&temp_buffer[0]), file_size);
+	//Header fields come from the ROM cache, only the header is read for new ROMs
+	rom_cache::rom_info info;
+	if(!rom_cache::get_header(config::rom_file, rom_cache::get_header_type(config::gb_type), info)) { return result; }
 	
 	//Generate .ini file as system code + "_" + Game Title (from ROM header)
 	switch(config::gb_type)
@@ -3530,83 +3783,22 @@ std::string get_game_ini_filename()
 		case SYS_GBC:
 		case SYS_SGB:
 		case SYS_SGB2:
-			result = "DMG_";
-
-			if(file_size >= 0x143)
-			{
-				for(u32 x = 0; x < 16; x++)
-				{
-					u8 chr = temp_buffer[0x134 + x];
-					result += chr;
-				}
-			}
-
+			result = "DMG_" + info.title;
 			break;
 		
 		case SYS_GBA:
 			result = "AGB_";
-
-			if(file_size >= 0xB0)
-			{
-				for(u32 x = 0; x < 12; x++)
-				{
-					u8 chr = temp_buffer[0xA0 + x];
-					result += chr;
-				}
-
-				result += "_";
-
-				for(u32 x = 0; x < 4; x++)
-				{
-					u8 chr = temp_buffer[0xAC + x];
-					result += chr;
-				}
-			}
-
+			if(!info.title.empty()) { result += info.title + "_" + info.game_code; }
 			break;
 
 		case SYS_NDS:
 			result = "NTR_";
-
-			if(file_size >= 0x10)
-			{
-				for(u32 x = 0; x < 12; x++)
-				{
-					u8 chr = temp_buffer[x];
-					result += chr;
-				}
-
-				result += "_";
-
-				for(u32 x = 0; x < 4; x++)
-				{
-					u8 chr = temp_buffer[0x0C + x];
-					result += chr;
-				}
-			}
-
+			if(!info.title.empty()) { result += info.title + "_" + info.game_code; }
 			break;
 
 		case SYS_MIN:
 			result = "MIN_";
-
-			if(file_size >= 0x21BC)
-			{
-				for(u32 x = 0; x < 12; x++)
-				{
-					u8 chr = temp_buffer[0x21B0 + x];
-					result += chr;
-				}
-
-				result += "_";
-
-				for(u32 x = 0; x < 4; x++)
-				{
-					u8 chr = temp_buffer[0x21AC + x];
-					result += chr;
-				}
-			}
-
+			if(!info.title.empty()) { result += info.title + "_" + info.game_code; }
 			break;
 	}
 
@@ -219,6 +219,9 @@ namespace config
 	extern int touch_zone_y[10];
 	extern int touch_zone_pad[10];
 	extern u8 touch_mode;
+	extern bool gba_threaded_render;
+	extern bool nds_threaded_2d;
+	extern u32 nds_sync_quantum;
 
 	extern u32 hotkey_turbo;
 	extern u32 hotkey_mute;
@@ -254,6 +257,11 @@ namespace config
 	extern bool turbo;
 	extern u8 scaling_factor;
 	extern u8 old_scaling_factor;
+	extern u8 sw_scaler;
+	extern u8 sw_color_filter;
+	extern bool sw_lcd_grid;
+	extern u8 sw_filter_threads;
+	extern bool skip_unchanged_frames;
 	extern std::stringstream title;
 	extern u8 gb_type;
 	extern bool gba_enhance;
@@ -314,6 +322,9 @@ namespace config
 	extern bool maintain_aspect_ratio;
 	extern u8 lcd_config;
 	extern u16 max_fps;
+	extern u8 frame_skip;
+	extern u8 turbo_frame_skip;
+	extern bool auto_frame_skip;
 
 	extern u32 DMG_BG_PAL[4];
 	extern u32 DMG_OBJ_PAL[4][2];
@@ -362,6 +373,17 @@ namespace config
 	extern u32 osd_count;
 	extern u8 osd_alpha;
 
+	extern bool use_mem_trace;
+	extern u32 mem_trace_size;
+
+	extern bool use_profiler;
+	extern bool use_hw_counters;
+
+	extern bool use_save_flush;
+	extern u32 save_flush_delay;
+
+	extern u32 rom_cache_size;
+
 	extern bool use_external_interfaces;
 
 	extern bool vc_enable;
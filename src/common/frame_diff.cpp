@@ -0,0 +1,96 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : frame_diff.cpp
+// Date : October 19, 2026
+// Description : Per-scanline change detection for presented frames
+//
+// Hashes every line of a finished frame and compares it against the last presented frame
+// Lets the SDL renderers skip copying, uploading, and presenting lines or whole frames that did not change
+
+#include <cstring>
+
+#include "frame_diff.h"
+#include "config.h"
+
+namespace frame_diff
+{
+	//Bumped whenever the window contents may have been lost, e.g. resizing or exposing the window
+	u32 generation = 1;
+
+/****** Forces the next update of every renderer to treat all lines as changed ******/
+void invalidate()
+{
+	generation++;
+}
+
+/****** Hashes a single line of pixels, 2 pixels at a time ******/
+u64 hash_line(const u32* pixels, u32 width)
+{
+	u64 hash = 0xCBF29CE484222325ULL;
+	u32 x = 0;
+
+	for(; (x + 2) <= width; x += 2)
+	{
+		u64 value = 0;
+		memcpy(&value, pixels + x, 8);
+
+		hash ^= value;
+		hash *= 0x100000001B3ULL;
+		hash ^= (hash >> 29);
+	}
+
+	if(x < width)
+	{
+		hash ^= pixels[x];
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+/****** Compares a finished frame against the last one - Returns the number of changed lines ******/
+u32 update(line_state &state, const u32* pixels, u32 width, u32 height)
+{
+	bool force = (!config::skip_unchanged_frames) || (state.hashes.size() != height) || (state.generation != generation);
+
+	state.first_dirty = height;
+	state.last_dirty = 0;
+
+	//Present everything when change detection is disabled or previous contents are unusable
+	if(force)
+	{
+		state.hashes.assign(height, 0);
+		state.generation = generation;
+		state.first_dirty = 0;
+		state.last_dirty = (height) ? (height - 1) : 0;
+
+		if(config::skip_unchanged_frames)
+		{
+			for(u32 y = 0; y < height; y++) { state.hashes[y] = hash_line(pixels + (y * width), width); }
+		}
+
+		return height;
+	}
+
+	u32 dirty_count = 0;
+
+	for(u32 y = 0; y < height; y++)
+	{
+		u64 hash = hash_line(pixels + (y * width), width);
+
+		if(hash != state.hashes[y])
+		{
+			state.hashes[y] = hash;
+			dirty_count++;
+
+			if(y < state.first_dirty) { state.first_dirty = y; }
+			state.last_dirty = y;
+		}
+	}
+
+	return dirty_count;
+}
+
+}
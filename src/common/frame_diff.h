@@ -0,0 +1,34 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : frame_diff.h
+// Date : October 19, 2026
+// Description : Per-scanline change detection for presented frames
+//
+// Hashes every line of a finished frame and compares it against the last presented frame
+// Lets the SDL renderers skip copying, uploading, and presenting lines or whole frames that did not change
+
+#ifndef GBE_FRAME_DIFF
+#define GBE_FRAME_DIFF
+
+#include <vector>
+
+#include "common.h"
+
+namespace frame_diff
+{
+	//Per-renderer hashes of the last presented frame
+	struct line_state
+	{
+		std::vector<u64> hashes;
+		u32 generation;
+		u32 first_dirty;
+		u32 last_dirty;
+	};
+
+	void invalidate();
+	u32 update(line_state &state, const u32* pixels, u32 width, u32 height);
+}
+
+#endif // GBE_FRAME_DIFF
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <cmath>
 #include <ctime>
+#include <cstring>
 
 #ifndef GL3_PROTOTYPES
 #define GL3_PROTOTYPES 1
@@ -27,6 +28,7 @@
 
 #include "config.h"
 #include "gx_util.h"
+#include "frame_diff.h"
 
 /****** OpenGL Matrix Constructor ******/
 gx_matrix::gx_matrix()
@@ -144,6 +146,9 @@ namespace gl_data
 {
 	SDL_GLContext gl_context;
 	GLuint lcd_texture;
+	GLuint pixel_buffers[3];
+	u32 pixel_buffer_index;
+	u32 texture_width, texture_height;
 	GLuint program_id;
 	GLuint vertex_buffer_object, vertex_array_object, element_buffer_object;
 	GLfloat x_scale, y_scale;
@@ -151,6 +156,52 @@ namespace gl_data
 	u32 external_data_usage;
 };
 
+/****** Uploads a frame to a texture through a ring of pixel unpack buffers ******/
+void gx_upload_texture(GLuint texture, GLuint* pixel_buffers, u32 &buffer_index, u32 &texture_width, u32 &texture_height, const void* pixels, u32 width, u32 height)
+{
+	glBindTexture(GL_TEXTURE_2D, texture);
+
+	//Only allocate texture storage when the screen size changes, every other frame just updates it
+	if((width != texture_width) || (height != texture_height))
+	{
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		texture_width = width;
+		texture_height = height;
+	}
+
+	if(!pixel_buffers[0]) { glGenBuffers(3, pixel_buffers); }
+
+	//Rotate buffers so the driver can still be reading an older frame while this one is written
+	buffer_index = (buffer_index + 1) % 3;
+	u32 size = width * height * 4;
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixel_buffers[buffer_index]);
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+
+	void* mapped_pixels = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+	//Copy straight into the mapped buffer, then let the GPU pull it into the texture
+	if(mapped_pixels != nullptr)
+	{
+		memcpy(mapped_pixels, pixels, size);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+
+	//Fall back to a direct upload if the buffer could not be mapped
+	else
+	{
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_BGRA, GL_UNSIGNED_BYTE, pixels);
+	}
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 /****** Loads and compiles GLSL vertex and fragment shaders ******/
 GLuint gx_load_shader(std::string vertex_shader_file, std::string fragment_shader_file, u32 &ext_data_usage)
 {
@@ -285,6 +336,9 @@ bool gx_init_opengl()
 {
 	#ifdef GBE_OGL
 
+	//A new context has nothing drawn yet, so present the next frame in full
+	frame_diff::invalidate();
+
 	//Calculate new temporary scaling factor
 	float max_width = (float)config::win_width / config::sys_width;
 	float max_height = (float)config::win_height / config::sys_height;
@@ -327,6 +381,8 @@ bool gx_init_opengl()
 	glDeleteVertexArrays(1, &gl_data::vertex_array_object);
 	glDeleteBuffers(1, &gl_data::vertex_buffer_object);
 	glDeleteBuffers(1, &gl_data::element_buffer_object);
+	glDeleteBuffers(3, gl_data::pixel_buffers);
+	glDeleteTextures(1, &gl_data::lcd_texture);
 
 	//Define vertices and texture coordinates for the screen texture
     	GLfloat vertices[] =
@@ -370,9 +426,13 @@ bool gx_init_opengl()
 	//Unbind vertex array object
 	glBindVertexArray(0);
 
-	//Generate the screen texture
+	//Generate the screen texture - Storage and pixel buffers are created on the first upload
 	glGenTextures(1, &gl_data::lcd_texture);
 
+	for(u32 x = 0; x < 3; x++) { gl_data::pixel_buffers[x] = 0; }
+	gl_data::pixel_buffer_index = 0;
+	gl_data::texture_width = gl_data::texture_height = 0;
+
 	gl_data::external_data_usage = 0;
 
 	//Load the shader
@@ -393,6 +453,12 @@ bool gx_init_opengl()
 
 //OpenGL render for cores
 void gx_blit_opengl(SDL_Window *window, SDL_Surface* final_screen)
+{
+	gx_blit_opengl(window, (u32*)final_screen->pixels);
+}
+
+/****** OpenGL render for cores - Uploads directly from a core's screen buffer ******/
+void gx_blit_opengl(SDL_Window *window, const u32* pixels)
 {
 	#ifdef GBE_OGL
 
@@ -423,14 +489,8 @@ void gx_blit_opengl(SDL_Window *window, SDL_Surface* final_screen)
 		default: break;
 	}
 
-	//Bind screen texture, then generate texture from lcd pixels
-	glBindTexture(GL_TEXTURE_2D, gl_data::lcd_texture);
-
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, config::sys_width, config::sys_height, 0, GL_BGRA, GL_UNSIGNED_BYTE, final_screen->pixels);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-	glBindTexture(GL_TEXTURE_2D, 0);
+	//Stream lcd pixels into the screen texture
+	gx_upload_texture(gl_data::lcd_texture, gl_data::pixel_buffers, gl_data::pixel_buffer_index, gl_data::texture_width, gl_data::texture_height, pixels, config::sys_width, config::sys_height);
 
     	glClearColor(0,0,0,0);
     	glClear(GL_COLOR_BUFFER_BIT);
@@ -56,6 +56,9 @@ namespace gl_data
 {
 	extern SDL_GLContext gl_context;
 	extern GLuint lcd_texture;
+	extern GLuint pixel_buffers[3];
+	extern u32 pixel_buffer_index;
+	extern u32 texture_width, texture_height;
 	extern GLuint program_id;
 	extern GLuint vertex_buffer_object, vertex_array_object, element_buffer_object;
 	extern GLfloat x_scale, y_scale;
@@ -66,6 +69,9 @@ namespace gl_data
 //GLSL vertex and fragment shader loader
 GLuint gx_load_shader(std::string vertex_shader_file, std::string fragment_shader_file, u32 &external_data_usage);
 
+//Streaming texture upload
+void gx_upload_texture(GLuint texture, GLuint* pixel_buffers, u32 &buffer_index, u32 &texture_width, u32 &texture_height, const void* pixels, u32 width, u32 height);
+
 #endif
 
 //Initialize OpenGL for cores
@@ -73,6 +79,7 @@ bool gx_init_opengl();
 
 //OpenGL render for cores
 void gx_blit_opengl(SDL_Window *window, SDL_Surface* final_screen);
+void gx_blit_opengl(SDL_Window *window, const u32* pixels);
 
 //2D distance
 float dist(float x1, float y1, float x2, float y2);
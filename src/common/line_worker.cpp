@@ -0,0 +1,154 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : line_worker.cpp
+// Date : October 19, 2026
+// Description : Low-latency helper thread for per-scanline work
+//
+// Runs a single job on a dedicated thread each time the emulation thread posts it
+// Handoffs happen every scanline, so the worker spins briefly before sleeping between frames
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "line_worker.h"
+#include "profiler.h"
+
+//Spin iterations before either side gives up the CPU
+const u32 LINE_WORKER_SPIN_LIMIT = 4096;
+
+/****** Hints to the CPU that the current thread is spin-waiting ******/
+static inline void cpu_relax()
+{
+	#ifdef __SSE2__
+	_mm_pause();
+	#else
+	std::this_thread::yield();
+	#endif
+}
+
+/****** Line worker constructor ******/
+line_worker::line_worker()
+{
+	request = 0;
+	complete = 0;
+	sleeping = false;
+	quit = false;
+	thread_epoch = 0;
+}
+
+/****** Line worker destructor ******/
+line_worker::~line_worker()
+{
+	stop();
+}
+
+/****** Returns true if the host has more than one hardware thread - Spin-waiting is wasted otherwise ******/
+bool line_worker::has_spare_core()
+{
+	static const bool result = (std::thread::hardware_concurrency() > 1);
+	return result;
+}
+
+/****** Starts the worker thread with the job it runs for every post ******/
+void line_worker::start(std::function<void()> job)
+{
+	stop();
+
+	current_job = job;
+	request = 0;
+	complete = 0;
+	sleeping = false;
+	quit = false;
+	thread_epoch = profiler::hw_epoch;
+
+	worker = std::thread(&line_worker::worker_main, this);
+}
+
+/****** Stops the worker thread after any posted job finishes ******/
+void line_worker::stop()
+{
+	if(!worker.joinable()) { return; }
+
+	wait();
+
+	{
+		std::lock_guard<std::mutex> lock(worker_lock);
+		quit = true;
+	}
+
+	worker_wake.notify_one();
+	worker.join();
+}
+
+/****** Returns true if the worker thread is running ******/
+bool line_worker::is_running()
+{
+	return worker.joinable();
+}
+
+/****** Asks the worker to run its job once more ******/
+void line_worker::post()
+{
+	//Hardware counters only follow threads created after they were opened, so replace a thread that predates them
+	if(thread_epoch != profiler::hw_epoch.load(std::memory_order_relaxed)) { start(current_job); }
+
+	request.store(request.load(std::memory_order_relaxed) + 1);
+
+	if(sleeping.load())
+	{
+		std::lock_guard<std::mutex> lock(worker_lock);
+		worker_wake.notify_one();
+	}
+}
+
+/****** Waits until every posted job has finished ******/
+void line_worker::wait()
+{
+	u32 target = request.load(std::memory_order_relaxed);
+	u32 spins = 0;
+
+	while(complete.load(std::memory_order_acquire) != target)
+	{
+		if(++spins < LINE_WORKER_SPIN_LIMIT) { cpu_relax(); }
+		else { std::this_thread::yield(); }
+	}
+}
+
+/****** Returns true if every posted job has finished ******/
+bool line_worker::is_idle()
+{
+	return (complete.load(std::memory_order_acquire) == request.load(std::memory_order_relaxed));
+}
+
+/****** Worker loop - Runs the job each time a new request is posted ******/
+void line_worker::worker_main()
+{
+	u32 last_request = 0;
+
+	while(true)
+	{
+		u32 spins = 0;
+
+		//Requests arrive back to back during active display, so spin briefly before sleeping through VBlank
+		while((request.load(std::memory_order_acquire) == last_request) && (!quit))
+		{
+			if(++spins < LINE_WORKER_SPIN_LIMIT) { cpu_relax(); continue; }
+
+			std::unique_lock<std::mutex> lock(worker_lock);
+			sleeping = true;
+			worker_wake.wait(lock, [&]{ return (request.load() != last_request) || (quit); });
+			sleeping = false;
+			spins = 0;
+		}
+
+		if(quit) { return; }
+
+		//Jobs are posted one at a time, the emulation thread always waits before posting again
+		last_request = request.load(std::memory_order_acquire);
+		current_job();
+		complete.store(last_request, std::memory_order_release);
+	}
+}
@@ -0,0 +1,58 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : line_worker.h
+// Date : October 19, 2026
+// Description : Low-latency helper thread for per-scanline work
+//
+// Runs a single job on a dedicated thread each time the emulation thread posts it
+// Handoffs happen every scanline, so the worker spins briefly before sleeping between frames
+
+#ifndef GBE_LINE_WORKER
+#define GBE_LINE_WORKER
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include "common.h"
+
+class line_worker
+{
+	public:
+
+	line_worker();
+	~line_worker();
+
+	void start(std::function<void()> job);
+	void stop();
+	bool is_running();
+
+	void post();
+	void wait();
+	bool is_idle();
+
+	static bool has_spare_core();
+
+	private:
+
+	void worker_main();
+
+	std::function<void()> current_job;
+	std::thread worker;
+	std::mutex worker_lock;
+	std::condition_variable worker_wake;
+
+	std::atomic<u32> request;
+	std::atomic<u32> complete;
+	std::atomic<bool> sleeping;
+	std::atomic<bool> quit;
+
+	//Hardware counter epoch when the thread was started
+	u32 thread_epoch;
+};
+
+#endif // GBE_LINE_WORKER
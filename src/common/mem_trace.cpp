@@ -0,0 +1,168 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : mem_trace.cpp
+// Date : October 18, 2026
+// Description : Runtime memory access tracing
+//
+// Records memory reads and writes from each core's MMU into a fixed-size ring buffer
+// Tracing can be switched on and off while the emulator runs, no GBE_DEBUG build needed
+// The buffer can be dumped to disk as a compact binary file for later analysis
+
+#include <iostream>
+#include <fstream>
+
+#include "mem_trace.h"
+#include "config.h"
+#include "util.h"
+
+namespace mem_trace
+{
+	bool enabled = false;
+	bool in_read = false;
+
+	std::vector<trace_entry> buffer;
+	u32 buffer_mask = 0;
+	u32 buffer_pos = 0;
+	bool buffer_wrapped = false;
+
+/****** Allocates the ring buffer and begins recording accesses ******/
+void start()
+{
+	//Round trace size up to the next power of 2 so the ring buffer can wrap with a mask
+	u32 size = 1;
+	while((size < config::mem_trace_size) && (size < 0x10000000)) { size <<= 1; }
+
+	if(buffer.size() != size)
+	{
+		buffer.clear();
+		buffer.resize(size);
+		buffer_pos = 0;
+		buffer_wrapped = false;
+	}
+
+	buffer_mask = size - 1;
+	enabled = true;
+
+	std::cout<<"GBE::Memory tracing started - " << size << " entries\n";
+}
+
+/****** Stops recording accesses, keeps contents of the ring buffer ******/
+void stop()
+{
+	enabled = false;
+	std::cout<<"GBE::Memory tracing stopped - " << get_entry_count() << " entries recorded\n";
+}
+
+/****** Starts or stops tracing. Stopping dumps the current trace to disk ******/
+void toggle()
+{
+	if(!enabled)
+	{
+		clear();
+		start();
+
+		config::osd_message = "MEM TRACE ON";
+		config::osd_count = 180;
+	}
+
+	else
+	{
+		stop();
+		dump(get_dump_filename());
+
+		config::osd_message = "MEM TRACE SAVED";
+		config::osd_count = 180;
+	}
+}
+
+/****** Discards all recorded entries ******/
+void clear()
+{
+	buffer_pos = 0;
+	buffer_wrapped = false;
+}
+
+/****** Records a single memory access ******/
+void record_access(u32 address, u8 value, u8 access)
+{
+	//Merge with the previous entry if this is an identical access
+	if(buffer_pos || buffer_wrapped)
+	{
+		trace_entry &last = buffer[(buffer_pos - 1) & buffer_mask];
+
+		if((last.address == address) && (last.value == value) && (last.access == access) && (last.count != 0xFFFF))
+		{
+			last.count++;
+			return;
+		}
+	}
+
+	trace_entry &entry = buffer[buffer_pos];
+	entry.address = address;
+	entry.value = value;
+	entry.access = access;
+	entry.count = 1;
+
+	buffer_pos = (buffer_pos + 1) & buffer_mask;
+	if(!buffer_pos) { buffer_wrapped = true; }
+}
+
+/****** Returns the number of entries currently held in the ring buffer ******/
+u32 get_entry_count()
+{
+	if(buffer.empty()) { return 0; }
+	return (buffer_wrapped) ? buffer.size() : buffer_pos;
+}
+
+/****** Writes the ring buffer to a binary file, oldest entry first ******/
+bool dump(std::string filename)
+{
+	std::ofstream file(filename.c_str(), std::ios::binary | std::ios::trunc);
+
+	if(!file.is_open())
+	{
+		std::cout<<"GBE::Error - Could not save memory trace file " << filename << "\n";
+		return false;
+	}
+
+	//Header - Magic, version, system type, entry count
+	u32 version = 1;
+	u32 system_type = config::gb_type;
+	u32 count = get_entry_count();
+
+	file.write("GBETRACE", 8);
+	file.write((char*)&version, sizeof(version));
+	file.write((char*)&system_type, sizeof(system_type));
+	file.write((char*)&count, sizeof(count));
+
+	if(count)
+	{
+		//When the buffer wrapped, the oldest entry sits at the current write position
+		u32 start_pos = (buffer_wrapped) ? buffer_pos : 0;
+		u32 first_len = count - start_pos;
+
+		file.write((char*)&buffer[start_pos], first_len * sizeof(trace_entry));
+		if(start_pos) { file.write((char*)&buffer[0], start_pos * sizeof(trace_entry)); }
+	}
+
+	file.close();
+
+	std::cout<<"GBE::Saved memory trace " << filename << "\n";
+	return true;
+}
+
+/****** Returns the filename used for memory trace dumps ******/
+std::string get_dump_filename()
+{
+	std::string hex_ticks = util::to_hex_str(SDL_GetTicks()).substr(2);
+	while(hex_ticks.length() < 8) { hex_ticks = "0" + hex_ticks; }
+
+	std::string name = util::get_filename_from_path(util::get_filename_no_ext(config::rom_file));
+	std::string path = (config::save_path.empty()) ? util::get_filename_no_ext(config::rom_file) : (config::save_path + name);
+
+	return path + "_" + hex_ticks + ".trace";
+}
+
+}
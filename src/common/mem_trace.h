@@ -0,0 +1,63 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : mem_trace.h
+// Date : October 18, 2026
+// Description : Runtime memory access tracing
+//
+// Records memory reads and writes from each core's MMU into a fixed-size ring buffer
+// Tracing can be switched on and off while the emulator runs, no GBE_DEBUG build needed
+// The buffer can be dumped to disk as a compact binary file for later analysis
+
+#ifndef GBE_MEM_TRACE
+#define GBE_MEM_TRACE
+
+#include <string>
+#include <vector>
+
+#include "common.h"
+
+namespace mem_trace
+{
+	enum access_types
+	{
+		TRACE_READ = 0x00,
+		TRACE_WRITE = 0x01,
+		TRACE_SUB_CPU = 0x02,
+	};
+
+	//Single 8-byte trace record
+	//Repeated identical accesses (e.g. polling loops) are merged by bumping the count
+	struct trace_entry
+	{
+		u32 address;
+		u8 value;
+		u8 access;
+		u16 count;
+	};
+
+	//Checked by each MMU before recording anything, only a single branch when tracing is off
+	extern bool enabled;
+
+	//Set while an MMU performs a read it is about to record, so the read itself isn't traced twice
+	extern bool in_read;
+
+	extern std::vector<trace_entry> buffer;
+	extern u32 buffer_mask;
+	extern u32 buffer_pos;
+	extern bool buffer_wrapped;
+
+	void start();
+	void stop();
+	void toggle();
+	void clear();
+
+	void record_access(u32 address, u8 value, u8 access);
+	u32 get_entry_count();
+
+	bool dump(std::string filename);
+	std::string get_dump_filename();
+}
+
+#endif // GBE_MEM_TRACE
@@ -0,0 +1,484 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : profiler.cpp
+// Date : October 19, 2026
+// Description : Frame-time profiler
+//
+// Scoped timers measure how long each emulated subsystem takes, and results are totaled once per frame
+// CPU time is whatever remains of the frame after every other subsystem on the emulation thread
+// Averages are drawn over the screen with the OSD, and recorded frames can be saved as a Chrome trace
+// On Linux, hardware performance counters for the emulation thread and its renderer threads can be recorded per frame as well
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <atomic>
+
+#ifdef __linux__
+#include <cstring>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include <SDL.h>
+
+#include "profiler.h"
+#include "config.h"
+#include "util.h"
+
+namespace profiler
+{
+	std::atomic<bool> enabled(false);
+
+	//Names used for the OSD and traces
+	const std::string section_names[PROF_SECTION_COUNT] = { "CPU", "PPU", "APU", "DMA", "SIO", "PRESENT", "IDLE", "AUDIO OUT" };
+
+	//Time collected for the current frame
+	u64 frame_ticks[PROF_SECTION_COUNT];
+	u64 frame_start = 0;
+	double ns_per_tick = 1.0;
+
+	//Audio callbacks run on SDL's audio thread
+	std::atomic<u64> audio_ticks(0);
+
+	//Recorded frames, kept in a ring buffer
+	std::vector<frame_record> frames;
+	u32 frame_pos = 0;
+	bool frames_wrapped = false;
+	u64 trace_start = 0;
+
+	u32 histogram[HISTOGRAM_SIZE];
+
+	//Averages shown on the OSD, updated every 60 frames
+	u64 overlay_sum[PROF_SECTION_COUNT];
+	u64 overlay_total_sum = 0;
+	u32 overlay_max = 0;
+	u32 overlay_count = 0;
+
+	u32 overlay_avg[PROF_SECTION_COUNT];
+	u32 overlay_total_avg = 0;
+	u32 overlay_total_max = 0;
+
+	//Hardware performance counters - Opened on the emulation thread at the first profiled frame
+	const std::string hw_names[HW_COUNTER_COUNT] = { "cycles", "instructions", "branch-misses", "cache-misses" };
+
+	int hw_fd[HW_COUNTER_COUNT] = { -1, -1, -1, -1 };
+	std::atomic<u32> hw_epoch(0);
+	u64 hw_last[HW_COUNTER_COUNT];
+	bool hw_pending = false;
+	bool hw_active = false;
+	bool hw_recorded = false;
+
+/****** Returns the current value of the high resolution timer ******/
+u64 get_ticks()
+{
+	return SDL_GetPerformanceCounter();
+}
+
+/****** Converts timer ticks to nanoseconds, capped for very long frames (e.g. while paused in the debugger) ******/
+u32 to_ns(u64 ticks)
+{
+	double ns = ticks * ns_per_tick;
+	return (ns < 4294967295.0) ? u32(ns) : 0xFFFFFFFF;
+}
+
+/****** Adds time to a section of the current frame ******/
+void add_time(u8 section, u64 ticks)
+{
+	if(section == PROF_AUDIO_OUT) { audio_ticks += ticks; }
+	else if(section < PROF_SECTION_COUNT) { frame_ticks[section] += ticks; }
+}
+
+/****** Clears all recorded frames and statistics ******/
+void clear()
+{
+	frames.clear();
+	frame_pos = 0;
+	frames_wrapped = false;
+	trace_start = 0;
+	frame_start = 0;
+
+	for(u32 x = 0; x < PROF_SECTION_COUNT; x++)
+	{
+		frame_ticks[x] = 0;
+		overlay_sum[x] = 0;
+		overlay_avg[x] = 0;
+	}
+
+	for(u32 x = 0; x < HISTOGRAM_SIZE; x++) { histogram[x] = 0; }
+
+	overlay_total_sum = 0;
+	overlay_max = 0;
+	overlay_count = 0;
+	overlay_total_avg = 0;
+	overlay_total_max = 0;
+
+	audio_ticks = 0;
+	hw_recorded = false;
+}
+
+/****** Reads the running totals of every open hardware counter ******/
+void read_hw_counters(u64* values)
+{
+	for(u32 x = 0; x < HW_COUNTER_COUNT; x++)
+	{
+		values[x] = 0;
+
+		#ifdef __linux__
+		if(hw_fd[x] < 0) { continue; }
+
+		//Value, time enabled, time running - Scale up if the kernel had to multiplex counters
+		u64 data[3];
+
+		if((read(hw_fd[x], data, sizeof(data)) == sizeof(data)) && (data[2]))
+		{
+			values[x] = (data[2] < data[1]) ? u64(double(data[0]) * data[1] / data[2]) : data[0];
+		}
+		#endif
+	}
+}
+
+/****** Opens hardware performance counters for the calling thread and threads it creates later - Linux only ******/
+bool open_hw_counters()
+{
+	close_hw_counters();
+
+	#ifdef __linux__
+	const u64 hw_configs[HW_COUNTER_COUNT] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES };
+
+	for(u32 x = 0; x < HW_COUNTER_COUNT; x++)
+	{
+		perf_event_attr attr;
+		memset(&attr, 0, sizeof(attr));
+
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.size = sizeof(attr);
+		attr.config = hw_configs[x];
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+
+		//Count this thread, on whatever CPU it runs, plus renderer threads it starts afterwards
+		//Reads include the inherited counts of every such thread
+		attr.inherit = 1;
+
+		hw_fd[x] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+
+		if(hw_fd[x] < 0) { std::cout<<"GBE::Hardware counter " << hw_names[x] << " is unavailable\n"; }
+		else { hw_active = true; }
+	}
+
+	if(hw_active)
+	{
+		read_hw_counters(hw_last);
+		hw_epoch++;
+	}
+	else { std::cout<<"GBE::Could not open any hardware counters. Check /proc/sys/kernel/perf_event_paranoid\n"; }
+
+	#else
+	std::cout<<"GBE::Hardware counters are only supported on Linux\n";
+	#endif
+
+	return hw_active;
+}
+
+/****** Closes any open hardware performance counters ******/
+void close_hw_counters()
+{
+	for(u32 x = 0; x < HW_COUNTER_COUNT; x++)
+	{
+		#ifdef __linux__
+		if(hw_fd[x] >= 0) { close(hw_fd[x]); }
+		#endif
+
+		hw_fd[x] = -1;
+	}
+
+	hw_active = false;
+}
+
+/****** Starts profiling - Timing begins with the next frame ******/
+void start()
+{
+	u64 frequency = SDL_GetPerformanceFrequency();
+	ns_per_tick = (frequency) ? (1000000000.0 / frequency) : 1.0;
+
+	frames.resize(MAX_FRAMES);
+	hw_pending = config::use_hw_counters;
+	enabled = true;
+
+	std::cout<<"GBE::Profiler started\n";
+}
+
+/****** Stops profiling ******/
+void stop()
+{
+	enabled = false;
+	frame_start = 0;
+
+	hw_pending = false;
+	close_hw_counters();
+
+	std::cout<<"GBE::Profiler stopped\n";
+}
+
+/****** Starts or stops profiling, saving a trace when stopping ******/
+void toggle()
+{
+	if(!enabled)
+	{
+		clear();
+		start();
+
+		config::osd_message = "PROFILER ON";
+		config::osd_count = 180;
+	}
+
+	else
+	{
+		stop();
+		export_trace(get_trace_filename());
+
+		config::osd_message = "PROFILE SAVED";
+		config::osd_count = 180;
+	}
+}
+
+/****** Totals all timers for the frame that just finished - Called once per frame at VBlank ******/
+void end_frame()
+{
+	if(!enabled) { return; }
+
+	u64 now = get_ticks();
+
+	//The first frame only marks where timing begins
+	if(!frame_start)
+	{
+		frame_start = now;
+		for(u32 x = 0; x < PROF_SECTION_COUNT; x++) { frame_ticks[x] = 0; }
+		audio_ticks = 0;
+
+		//Counters are per-thread, so they have to be opened from the thread running the core
+		if(hw_pending)
+		{
+			hw_pending = false;
+			open_hw_counters();
+		}
+
+		return;
+	}
+
+	if(!trace_start) { trace_start = frame_start; }
+
+	frame_record record;
+	record.start = (frame_start - trace_start) * ns_per_tick;
+	record.total = to_ns(now - frame_start);
+	frame_ticks[PROF_AUDIO_OUT] = audio_ticks.exchange(0);
+
+	//CPU time is the rest of the frame after everything else on the emulation thread
+	u64 other_ticks = 0;
+
+	for(u32 x = PROF_PPU; x < PROF_SECTION_COUNT; x++)
+	{
+		record.section[x] = to_ns(frame_ticks[x]);
+		if(x != PROF_AUDIO_OUT) { other_ticks += frame_ticks[x]; }
+		frame_ticks[x] = 0;
+	}
+
+	u64 frame_length = now - frame_start;
+	record.section[PROF_CPU] = (frame_length > other_ticks) ? to_ns(frame_length - other_ticks) : 0;
+
+	//Hardware counters only ever go up, so each frame gets the difference from the last one
+	u64 hw_now[HW_COUNTER_COUNT];
+	read_hw_counters(hw_now);
+
+	for(u32 x = 0; x < HW_COUNTER_COUNT; x++)
+	{
+		record.hw[x] = (hw_now[x] > hw_last[x]) ? (hw_now[x] - hw_last[x]) : 0;
+		hw_last[x] = hw_now[x];
+	}
+
+	if(hw_active) { hw_recorded = true; }
+
+	frames[frame_pos++] = record;
+	if(frame_pos == MAX_FRAMES) { frame_pos = 0; frames_wrapped = true; }
+
+	u32 bucket = record.total / 1000000;
+	histogram[(bucket < HISTOGRAM_SIZE) ? bucket : (HISTOGRAM_SIZE - 1)]++;
+
+	//Average the last 60 frames for the OSD
+	for(u32 x = 0; x < PROF_SECTION_COUNT; x++) { overlay_sum[x] += record.section[x]; }
+	overlay_total_sum += record.total;
+	if(record.total > overlay_max) { overlay_max = record.total; }
+
+	if(++overlay_count == 60)
+	{
+		for(u32 x = 0; x < PROF_SECTION_COUNT; x++)
+		{
+			overlay_avg[x] = (overlay_sum[x] / 60) / 1000;
+			overlay_sum[x] = 0;
+		}
+
+		overlay_total_avg = (overlay_total_sum / 60) / 1000;
+		overlay_total_max = overlay_max / 1000;
+
+		overlay_total_sum = 0;
+		overlay_max = 0;
+		overlay_count = 0;
+	}
+
+	frame_start = now;
+}
+
+/****** Draws average frame and subsystem times over the screen ******/
+void draw_overlay(std::vector<u32> &osd_surface)
+{
+	draw_overlay(osd_surface.data(), osd_surface.size());
+}
+
+/****** Draws averages for the last 60 frames over a raw surface - Lines past the bottom of small screens are clipped ******/
+void draw_overlay(u32* osd_surface, u32 size)
+{
+	if(!enabled) { return; }
+
+	//Line 0 is left for regular OSD messages
+	u8 y = 1;
+
+	draw_osd_msg("FRAME " + util::to_str(overlay_total_avg) + "US", osd_surface, 0, y++, size);
+	draw_osd_msg("MAX " + util::to_str(overlay_total_max) + "US", osd_surface, 0, y++, size);
+
+	for(u32 x = 0; x < PROF_SECTION_COUNT; x++)
+	{
+		draw_osd_msg(section_names[x] + " " + util::to_str(overlay_avg[x]) + "US", osd_surface, 0, y++, size);
+	}
+}
+
+/****** Saves recorded frames as a Chrome trace (chrome://tracing or Perfetto) ******/
+bool export_trace(std::string filename)
+{
+	u32 count = (frames_wrapped) ? MAX_FRAMES : frame_pos;
+	u32 first = (frames_wrapped) ? frame_pos : 0;
+
+	if(!count)
+	{
+		std::cout<<"GBE::No profiled frames to save\n";
+		return false;
+	}
+
+	std::ofstream file(filename.c_str(), std::ios::out | std::ios::trunc);
+
+	if(!file.is_open())
+	{
+		std::cout<<"GBE::Error - Could not write profiler trace " << filename << "\n";
+		return false;
+	}
+
+	file << std::fixed << std::setprecision(3);
+	file << "{\n\"traceEvents\": [\n";
+	file << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"GBE+\"}},\n";
+	file << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 1, \"args\": {\"name\": \"Emulation\"}}";
+
+	for(u32 x = 0; x < count; x++)
+	{
+		const frame_record &record = frames[(first + x) % MAX_FRAMES];
+		double ts = record.start / 1000.0;
+
+		//Each frame as a slice, with its subsystem breakdown as a stacked counter
+		file << ",\n{\"name\": \"Frame\", \"cat\": \"frame\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": " << ts;
+		file << ", \"dur\": " << (record.total / 1000.0) << ", \"args\": {\"frame\": " << x << "}}";
+
+		file << ",\n{\"name\": \"Subsystems (us)\", \"ph\": \"C\", \"pid\": 1, \"ts\": " << ts << ", \"args\": {";
+
+		for(u32 y = 0; y < PROF_SECTION_COUNT; y++)
+		{
+			file << (y ? ", " : "") << "\"" << section_names[y] << "\": " << (record.section[y] / 1000.0);
+		}
+
+		file << "}}";
+
+		if(!hw_recorded) { continue; }
+
+		file << ",\n{\"name\": \"Hardware counters\", \"ph\": \"C\", \"pid\": 1, \"ts\": " << ts << ", \"args\": {";
+
+		for(u32 y = 0; y < HW_COUNTER_COUNT; y++)
+		{
+			file << (y ? ", " : "") << "\"" << hw_names[y] << "\": " << record.hw[y];
+		}
+
+		double ipc = (record.hw[HW_CYCLES]) ? (double(record.hw[HW_INSTRUCTIONS]) / record.hw[HW_CYCLES]) : 0.0;
+		file << "}},\n{\"name\": \"IPC\", \"ph\": \"C\", \"pid\": 1, \"ts\": " << ts << ", \"args\": {\"ipc\": " << ipc << "}}";
+	}
+
+	//Average hardware counts per frame
+	u64 hw_total[HW_COUNTER_COUNT];
+
+	for(u32 x = 0; x < HW_COUNTER_COUNT; x++)
+	{
+		hw_total[x] = 0;
+		for(u32 y = 0; y < count; y++) { hw_total[x] += frames[(first + y) % MAX_FRAMES].hw[x]; }
+	}
+
+	file << "\n],\n\"displayTimeUnit\": \"ms\",\n";
+	file << "\"otherData\": {\"histogram_ms\": [";
+
+	for(u32 x = 0; x < HISTOGRAM_SIZE; x++) { file << (x ? ", " : "") << histogram[x]; }
+
+	file << "]";
+
+	if(hw_recorded)
+	{
+		file << ", \"hw_counters_per_frame\": {";
+		for(u32 x = 0; x < HW_COUNTER_COUNT; x++) { file << (x ? ", " : "") << "\"" << hw_names[x] << "\": " << (hw_total[x] / count); }
+		file << "}";
+	}
+
+	file << "}\n}\n";
+	file.close();
+
+	//Summarize frame times on the console as well
+	std::cout<<"GBE::Saved profiler trace " << filename << " - " << count << " frames\n";
+	std::cout<<"GBE::Frame time histogram (ms : frames)\n";
+
+	for(u32 x = 0; x < HISTOGRAM_SIZE; x++)
+	{
+		if(!histogram[x]) { continue; }
+		std::cout<<"\t" << x << ((x == (HISTOGRAM_SIZE - 1)) ? "+" : "") << " : " << histogram[x] << "\n";
+	}
+
+	//Low IPC with many cache misses points to memory, many branch misses point to dispatch and decoding
+	if(hw_recorded)
+	{
+		std::cout<<"GBE::Hardware counters (average per frame)\n";
+		for(u32 x = 0; x < HW_COUNTER_COUNT; x++) { std::cout<<"\t" << hw_names[x] << " : " << (hw_total[x] / count) << "\n"; }
+
+		if((hw_total[HW_CYCLES]) && (hw_total[HW_INSTRUCTIONS]))
+		{
+			double kilo_instructions = hw_total[HW_INSTRUCTIONS] / 1000.0;
+
+			std::cout<<std::fixed<<std::setprecision(2);
+			std::cout<<"\tIPC : " << (double(hw_total[HW_INSTRUCTIONS]) / hw_total[HW_CYCLES]) << "\n";
+			std::cout<<"\tBranch misses per 1000 instructions : " << (hw_total[HW_BRANCH_MISSES] / kilo_instructions) << "\n";
+			std::cout<<"\tCache misses per 1000 instructions : " << (hw_total[HW_CACHE_MISSES] / kilo_instructions) << "\n";
+			std::cout<<std::defaultfloat;
+		}
+	}
+
+	return true;
+}
+
+/****** Returns a unique filename for a trace, placed next to the ROM or in the save path ******/
+std::string get_trace_filename()
+{
+	std::string hex_ticks = util::to_hex_str(SDL_GetTicks()).substr(2);
+	while(hex_ticks.length() < 8) { hex_ticks = "0" + hex_ticks; }
+
+	std::string name = util::get_filename_from_path(util::get_filename_no_ext(config::rom_file));
+	std::string path = (config::save_path.empty()) ? util::get_filename_no_ext(config::rom_file) : (config::save_path + name);
+
+	return path + "_" + hex_ticks + "_profile.json";
+}
+
+}
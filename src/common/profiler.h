@@ -0,0 +1,103 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : profiler.h
+// Date : October 19, 2026
+// Description : Frame-time profiler
+//
+// Scoped timers measure how long each emulated subsystem takes, and results are totaled once per frame
+// CPU time is whatever remains of the frame after every other subsystem on the emulation thread
+// Averages are drawn over the screen with the OSD, and recorded frames can be saved as a Chrome trace
+// On Linux, hardware performance counters for the emulation thread and its renderer threads can be recorded per frame as well
+
+#ifndef GBE_PROFILER
+#define GBE_PROFILER
+
+#include <string>
+#include <vector>
+#include <atomic>
+
+#include "common.h"
+
+namespace profiler
+{
+	enum sections
+	{
+		PROF_CPU,
+		PROF_PPU,
+		PROF_APU,
+		PROF_DMA,
+		PROF_SIO,
+		PROF_PRESENT,
+		PROF_IDLE,
+		PROF_AUDIO_OUT,
+		PROF_SECTION_COUNT,
+	};
+
+	enum hw_counters
+	{
+		HW_CYCLES,
+		HW_INSTRUCTIONS,
+		HW_BRANCH_MISSES,
+		HW_CACHE_MISSES,
+		HW_COUNTER_COUNT,
+	};
+
+	//Number of frames kept for traces, about 10 minutes at 60 FPS
+	const u32 MAX_FRAMES = 36000;
+
+	//Frame time histogram uses 1ms buckets, the last one holds every slower frame
+	const u32 HISTOGRAM_SIZE = 64;
+
+	//Time spent in each section during one frame, in nanoseconds
+	struct frame_record
+	{
+		u64 start;
+		u32 total;
+		u32 section[PROF_SECTION_COUNT];
+		u64 hw[HW_COUNTER_COUNT];
+	};
+
+	//Checked by every timer before doing anything, only a single branch when profiling is off
+	//Atomic since the audio thread checks it as well
+	extern std::atomic<bool> enabled;
+
+	//Bumped each time hardware counters are opened - Helper threads started earlier restart so the counters follow them
+	extern std::atomic<u32> hw_epoch;
+
+	u64 get_ticks();
+	void add_time(u8 section, u64 ticks);
+
+	//Times everything until the end of the current scope
+	class scope
+	{
+		public:
+
+		scope(u8 section) : id(section), start_ticks((enabled) ? get_ticks() : 0) { }
+		~scope() { if(start_ticks) { add_time(id, get_ticks() - start_ticks); } }
+
+		private:
+
+		u8 id;
+		u64 start_ticks;
+	};
+
+	void start();
+	void stop();
+	void toggle();
+	void clear();
+
+	bool open_hw_counters();
+	void close_hw_counters();
+	void read_hw_counters(u64* values);
+
+	void end_frame();
+	void draw_overlay(std::vector<u32> &osd_surface);
+	void draw_overlay(u32* osd_surface, u32 size);
+
+	bool export_trace(std::string filename);
+	std::string get_trace_filename();
+}
+
+#endif // GBE_PROFILER
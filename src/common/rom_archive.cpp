@@ -0,0 +1,693 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : rom_archive.cpp
+// Date : October 19, 2026
+// Description : Compressed ROM containers
+//
+// Loads ROMs stored in .zip and .gz archives
+// Block-compressed gzip files (BGZF, as made by bgzip) can also be read randomly
+// Blocks are only decompressed when first accessed and are kept in a bounded cache
+
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+
+#ifdef GBE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "rom_archive.h"
+
+namespace rom_archive
+{
+	//ZIP archive entry chosen to load
+	struct zip_entry
+	{
+		std::string name;
+		u16 method;
+		u32 compressed_size;
+		u32 data_size;
+		u32 local_offset;
+	};
+
+	//Largest BGZF block, compressed or not
+	const u32 BGZF_MAX_BLOCK = 0x10000;
+
+/****** Reads a 16-bit little-endian value ******/
+u16 read_le16(const u8* data)
+{
+	return (data[0] | (data[1] << 8));
+}
+
+/****** Reads a 32-bit little-endian value ******/
+u32 read_le32(const u8* data)
+{
+	return (data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24));
+}
+
+/****** Reads raw bytes from a specific position in a file ******/
+bool read_bytes(std::ifstream &file, u64 offset, u8* dst, u32 length)
+{
+	file.clear();
+	file.seekg(offset);
+	file.read(reinterpret_cast<char*> (dst), length);
+
+	return (file.gcount() == length);
+}
+
+/****** Returns a file's extension in lower-case ASCII ******/
+std::string get_lower_ext(std::string filename)
+{
+	std::size_t dot = filename.find_last_of(".");
+	if(dot == std::string::npos) { return ""; }
+
+	std::string ext = filename.substr(dot);
+
+	for(u32 x = 0; x < ext.length(); x++)
+	{
+		if((ext[x] >= 0x41) && (ext[x] <= 0x5A)) { ext[x] += 0x20; }
+	}
+
+	return ext;
+}
+
+/****** Finds the ROM inside a ZIP archive - Prefers known ROM extensions, otherwise uses the first file ******/
+bool find_zip_entry(std::ifstream &file, zip_entry &entry)
+{
+	file.clear();
+	file.seekg(0, file.end);
+	u64 file_size = file.tellg();
+
+	if(file_size < 22) { return false; }
+
+	//Find the End of Central Directory record, which may be followed by a comment
+	u32 tail_size = (file_size < 0x10015) ? file_size : 0x10015;
+	std::vector<u8> tail(tail_size, 0);
+
+	if(!read_bytes(file, (file_size - tail_size), &tail[0], tail_size)) { return false; }
+
+	s32 eocd = -1;
+
+	for(s32 x = (tail_size - 22); x >= 0; x--)
+	{
+		if(read_le32(&tail[x]) == 0x06054B50) { eocd = x; break; }
+	}
+
+	if(eocd == -1) { return false; }
+
+	u16 entry_count = read_le16(&tail[eocd + 10]);
+	u32 dir_size = read_le32(&tail[eocd + 12]);
+	u32 dir_offset = read_le32(&tail[eocd + 16]);
+
+	if(!dir_size || ((u64)dir_offset + dir_size) > file_size) { return false; }
+
+	std::vector<u8> dir(dir_size, 0);
+	if(!read_bytes(file, dir_offset, &dir[0], dir_size)) { return false; }
+
+	bool found = false;
+	u32 pos = 0;
+
+	for(u32 x = 0; x < entry_count; x++)
+	{
+		if(((pos + 46) > dir_size) || (read_le32(&dir[pos]) != 0x02014B50)) { break; }
+
+		u16 name_len = read_le16(&dir[pos + 28]);
+		u16 extra_len = read_le16(&dir[pos + 30]);
+		u16 comment_len = read_le16(&dir[pos + 32]);
+
+		if((pos + 46 + name_len) > dir_size) { break; }
+
+		zip_entry current;
+		current.method = read_le16(&dir[pos + 10]);
+		current.compressed_size = read_le32(&dir[pos + 20]);
+		current.data_size = read_le32(&dir[pos + 24]);
+		current.local_offset = read_le32(&dir[pos + 42]);
+		current.name = std::string(reinterpret_cast<char*> (&dir[pos + 46]), name_len);
+
+		pos += (46 + name_len + extra_len + comment_len);
+
+		//Skip directories
+		if((current.name.empty()) || (current.name.back() == '/')) { continue; }
+
+		std::string ext = get_lower_ext(current.name);
+		bool is_rom = ((ext == ".gb") || (ext == ".gbc") || (ext == ".gba") || (ext == ".nds") || (ext == ".min"));
+
+		if((!found) || (is_rom))
+		{
+			entry = current;
+			found = true;
+		}
+
+		if(is_rom) { break; }
+	}
+
+	return found;
+}
+
+#ifdef GBE_ZLIB
+
+/****** Decompresses a file from a ZIP archive, up to a given number of bytes ******/
+bool read_zip(std::ifstream &file, std::vector<u8> &data, u32 limit)
+{
+	zip_entry entry;
+
+	if(!find_zip_entry(file, entry))
+	{
+		std::cout<<"GBE::Error - Could not find any files in ZIP archive\n";
+		return false;
+	}
+
+	//Local file headers can have different extra fields than the central directory
+	u8 local[30];
+	if((!read_bytes(file, entry.local_offset, local, 30)) || (read_le32(local) != 0x04034B50)) { return false; }
+
+	u64 data_start = entry.local_offset + 30 + read_le16(&local[26]) + read_le16(&local[28]);
+	u32 out_size = (entry.data_size < limit) ? entry.data_size : limit;
+
+	data.clear();
+	data.resize(out_size, 0);
+
+	if(!out_size) { return true; }
+
+	//Stored
+	if(entry.method == 0) { return read_bytes(file, data_start, &data[0], out_size); }
+
+	//Deflate
+	else if(entry.method == 8)
+	{
+		z_stream stream;
+		memset(&stream, 0, sizeof(stream));
+
+		if(inflateInit2(&stream, -MAX_WBITS) != Z_OK) { return false; }
+
+		std::vector<u8> in_buffer(0x10000, 0);
+		u32 in_left = entry.compressed_size;
+		u64 in_pos = data_start;
+		s32 result = Z_OK;
+
+		stream.next_out = &data[0];
+		stream.avail_out = out_size;
+
+		while((stream.avail_out) && (result != Z_STREAM_END))
+		{
+			if((!stream.avail_in) && (in_left))
+			{
+				u32 chunk = (in_left < in_buffer.size()) ? in_left : in_buffer.size();
+				if(!read_bytes(file, in_pos, &in_buffer[0], chunk)) { break; }
+
+				in_pos += chunk;
+				in_left -= chunk;
+
+				stream.next_in = &in_buffer[0];
+				stream.avail_in = chunk;
+			}
+
+			result = inflate(&stream, Z_NO_FLUSH);
+			if((result != Z_OK) && (result != Z_STREAM_END)) { break; }
+		}
+
+		inflateEnd(&stream);
+
+		if(stream.avail_out)
+		{
+			std::cout<<"GBE::Error - Could not decompress " << entry.name << " from ZIP archive\n";
+			return false;
+		}
+
+		return true;
+	}
+
+	std::cout<<"GBE::Error - Unsupported ZIP compression method " << std::dec << entry.method << "\n";
+	return false;
+}
+
+/****** Decompresses a gzip file, up to a given number of bytes ******/
+bool read_gzip(std::string filename, std::vector<u8> &data, u32 limit)
+{
+	gzFile file = gzopen(filename.c_str(), "rb");
+	if(file == NULL) { return false; }
+
+	data.clear();
+
+	std::vector<u8> buffer(0x40000, 0);
+
+	while(data.size() < limit)
+	{
+		u32 chunk = ((limit - data.size()) < buffer.size()) ? (limit - data.size()) : buffer.size();
+		s32 count = gzread(file, &buffer[0], chunk);
+
+		if(count < 0)
+		{
+			std::cout<<"GBE::Error - Could not decompress " << filename << "\n";
+			gzclose(file);
+			return false;
+		}
+
+		if(!count) { break; }
+
+		data.insert(data.end(), buffer.begin(), (buffer.begin() + count));
+	}
+
+	gzclose(file);
+	return true;
+}
+
+#endif
+
+/****** Decompresses up to a given number of bytes from any supported archive ******/
+bool read_archive(std::string filename, std::vector<u8> &data, u32 limit)
+{
+	u8 type = get_archive_type(filename);
+
+	if(type == ARCHIVE_NONE) { return false; }
+
+	#ifdef GBE_ZLIB
+
+	if(type == ARCHIVE_ZIP)
+	{
+		std::ifstream file(filename.c_str(), std::ios::binary);
+		if(!file.is_open()) { return false; }
+
+		return read_zip(file, data, limit);
+	}
+
+	return read_gzip(filename, data, limit);
+
+	#else
+
+	std::cout<<"GBE::Error - Compressed ROMs are not supported in this build (requires zlib)\n";
+	return false;
+
+	#endif
+}
+
+/****** Determines what kind of archive a file is, if any ******/
+u8 get_archive_type(std::string filename)
+{
+	std::ifstream file(filename.c_str(), std::ios::binary);
+	if(!file.is_open()) { return ARCHIVE_NONE; }
+
+	u8 header[16];
+	memset(header, 0, 16);
+
+	file.read(reinterpret_cast<char*> (header), 16);
+	if(file.gcount() < 4) { return ARCHIVE_NONE; }
+
+	//ZIP local file header
+	if(read_le32(header) == 0x04034B50) { return ARCHIVE_ZIP; }
+
+	//gzip member using deflate
+	if((header[0] == 0x1F) && (header[1] == 0x8B) && (header[2] == 0x08))
+	{
+		//BGZF uses a "BC" extra subfield holding the block size
+		if((header[3] & 0x4) && (read_le16(&header[10]) >= 6) && (header[12] == 'B') && (header[13] == 'C') && (read_le16(&header[14]) == 2))
+		{
+			return ARCHIVE_BGZF;
+		}
+
+		return ARCHIVE_GZIP;
+	}
+
+	return ARCHIVE_NONE;
+}
+
+/****** Returns true if the file is a supported archive ******/
+bool is_archive(std::string filename)
+{
+	return (get_archive_type(filename) != ARCHIVE_NONE);
+}
+
+/****** Returns the name of the ROM inside an archive, used to detect the system type ******/
+std::string get_rom_filename(std::string filename)
+{
+	u8 type = get_archive_type(filename);
+
+	if(type == ARCHIVE_ZIP)
+	{
+		std::ifstream file(filename.c_str(), std::ios::binary);
+		zip_entry entry;
+
+		if((file.is_open()) && (find_zip_entry(file, entry))) { return entry.name; }
+	}
+
+	//gzip files are named after the ROM plus .gz
+	else if((type != ARCHIVE_NONE) && (get_lower_ext(filename) == ".gz"))
+	{
+		return filename.substr(0, filename.length() - 3);
+	}
+
+	return filename;
+}
+
+/****** Returns the ROM's path without an extension, placed next to the archive - Used to find patch files ******/
+std::string get_patch_filename(std::string filename)
+{
+	std::string rom_name = get_rom_filename(filename);
+
+	//Names inside a ZIP may carry their own folders, patches always sit next to the archive itself
+	if(rom_name != filename)
+	{
+		std::size_t slash = rom_name.find_last_of("/\\");
+		if(slash != std::string::npos) { rom_name = rom_name.substr(slash + 1); }
+
+		slash = filename.find_last_of("/\\");
+		if(slash != std::string::npos) { rom_name = filename.substr(0, slash + 1) + rom_name; }
+	}
+
+	std::size_t dot = rom_name.find_last_of(".");
+	if(dot != std::string::npos) { rom_name = rom_name.substr(0, dot); }
+
+	return rom_name;
+}
+
+/****** Decompresses an entire ROM from an archive ******/
+bool extract(std::string filename, std::vector<u8> &data, u32 max_size)
+{
+	//Read one byte past the limit to catch oversized ROMs
+	u32 limit = (max_size < 0xFFFFFFFF) ? (max_size + 1) : max_size;
+
+	if(!read_archive(filename, data, limit)) { return false; }
+
+	if(data.size() > max_size)
+	{
+		std::cout<<"GBE::Error - ROM in " << filename << " is too large\n";
+		data.clear();
+		return false;
+	}
+
+	std::cout<<"GBE::Decompressed ROM from " << filename << "\n";
+	return true;
+}
+
+/****** Decompresses only the first bytes of a ROM from an archive ******/
+bool read_header(std::string filename, std::vector<u8> &data, u32 length)
+{
+	return read_archive(filename, data, length);
+}
+
+/****** Block Stream Constructor ******/
+block_stream::block_stream()
+{
+	total_size = 0;
+	total_crc = 0;
+	use_counter = 0;
+
+	current_data = nullptr;
+	current_start = 0;
+	current_size = 0;
+}
+
+/****** Block Stream Destructor ******/
+block_stream::~block_stream()
+{
+	close();
+}
+
+/****** Builds an index of every block in a BGZF file - Only block headers and trailers are read ******/
+bool block_stream::open(std::string filename, u32 cache_size)
+{
+	close();
+
+	#ifdef GBE_ZLIB
+
+	if(get_archive_type(filename) != ARCHIVE_BGZF) { return false; }
+
+	file.open(filename.c_str(), std::ios::binary);
+	if(!file.is_open()) { return false; }
+
+	file.seekg(0, file.end);
+	u64 file_size = file.tellg();
+
+	u64 offset = 0;
+	u64 data_offset = 0;
+
+	while((offset + 26) <= file_size)
+	{
+		u8 header[12];
+		if(!read_bytes(file, offset, header, 12)) { break; }
+
+		if((header[0] != 0x1F) || (header[1] != 0x8B) || (header[2] != 0x08) || (!(header[3] & 0x4)))
+		{
+			std::cout<<"GBE::Error - " << filename << " contains data that is not BGZF\n";
+			close();
+			return false;
+		}
+
+		//Look for the BC subfield holding the block size
+		u16 extra_len = read_le16(&header[10]);
+		std::vector<u8> extra(extra_len, 0);
+
+		if((!extra_len) || (!read_bytes(file, (offset + 12), &extra[0], extra_len))) { break; }
+
+		u32 block_size = 0;
+
+		for(u32 x = 0; (x + 4) <= extra_len;)
+		{
+			u16 sub_len = read_le16(&extra[x + 2]);
+
+			if((extra[x] == 'B') && (extra[x + 1] == 'C') && (sub_len == 2) && ((x + 6) <= extra_len))
+			{
+				block_size = read_le16(&extra[x + 4]) + 1;
+				break;
+			}
+
+			x += (4 + sub_len);
+		}
+
+		if((block_size < (u32)(20 + extra_len)) || ((offset + block_size) > file_size))
+		{
+			std::cout<<"GBE::Error - " << filename << " has a corrupted BGZF block\n";
+			close();
+			return false;
+		}
+
+		//CRC32 and uncompressed size are stored at the end of each block
+		u8 trailer[8];
+		if(!read_bytes(file, (offset + block_size - 8), trailer, 8)) { break; }
+
+		block_entry entry;
+		entry.file_offset = offset;
+		entry.compressed_size = block_size;
+		entry.data_offset = data_offset;
+		entry.data_size = read_le32(&trailer[4]);
+		entry.crc = read_le32(&trailer[0]);
+
+		//Empty blocks mark the end of the file
+		if(entry.data_size)
+		{
+			if((entry.data_size > BGZF_MAX_BLOCK) || ((data_offset + entry.data_size) > 0xFFFFFFFF))
+			{
+				std::cout<<"GBE::Error - " << filename << " is too large\n";
+				close();
+				return false;
+			}
+
+			index.push_back(entry);
+			data_offset += entry.data_size;
+
+			//Whole ROM CRC32 without decompressing anything
+			total_crc = crc32_combine(total_crc, entry.crc, entry.data_size);
+		}
+
+		offset += block_size;
+	}
+
+	if(index.empty())
+	{
+		std::cout<<"GBE::Error - " << filename << " contains no data\n";
+		close();
+		return false;
+	}
+
+	total_size = data_offset;
+
+	//Keep at least 2 blocks so copies across a block boundary don't thrash
+	u32 slots = cache_size / BGZF_MAX_BLOCK;
+	if(slots < 2) { slots = 2; }
+	if(slots > index.size()) { slots = index.size(); }
+
+	cache.resize(slots);
+
+	for(u32 x = 0; x < slots; x++)
+	{
+		cache[x].block = -1;
+		cache[x].last_used = 0;
+		cache[x].data.reserve(BGZF_MAX_BLOCK);
+	}
+
+	compressed.resize(BGZF_MAX_BLOCK, 0);
+
+	std::cout<<"GBE::Opened block-compressed ROM " << filename << " (" << std::dec << index.size() << " blocks, ";
+	std::cout<<(slots * (BGZF_MAX_BLOCK / 1024)) << "KB cache)\n";
+
+	return true;
+
+	#else
+
+	std::cout<<"GBE::Error - Compressed ROMs are not supported in this build (requires zlib)\n";
+	return false;
+
+	#endif
+}
+
+/****** Closes the file and frees all cached blocks ******/
+void block_stream::close()
+{
+	if(file.is_open()) { file.close(); }
+
+	index.clear();
+	cache.clear();
+	compressed.clear();
+
+	total_size = 0;
+	total_crc = 0;
+	use_counter = 0;
+
+	current_data = nullptr;
+	current_start = 0;
+	current_size = 0;
+}
+
+/****** Returns true if a BGZF file is currently open ******/
+bool block_stream::is_open() const
+{
+	return !index.empty();
+}
+
+/****** Returns the uncompressed size of the ROM ******/
+u32 block_stream::size() const
+{
+	return total_size;
+}
+
+/****** Returns the CRC32 of the whole uncompressed ROM ******/
+u32 block_stream::get_crc32() const
+{
+	return total_crc;
+}
+
+/****** Copies a range of bytes, decompressing blocks as necessary ******/
+void block_stream::read(u32 address, u8* dst, u32 length)
+{
+	while(length)
+	{
+		//Out of bounds reads return open bus
+		if(address >= total_size)
+		{
+			memset(dst, 0xFF, length);
+			return;
+		}
+
+		//Make sure the block holding this address is current, then copy as much of it as possible
+		read_u8(address);
+
+		//Unreadable blocks return open bus
+		if(current_data == nullptr)
+		{
+			memset(dst, 0xFF, length);
+			return;
+		}
+
+		u32 offset = address - current_start;
+		u32 chunk = current_size - offset;
+		if(chunk > length) { chunk = length; }
+
+		memcpy(dst, (current_data + offset), chunk);
+
+		dst += chunk;
+		address += chunk;
+		length -= chunk;
+	}
+}
+
+/****** Reads 1 byte from a block that is not current, loading it into the cache if needed ******/
+u8 block_stream::read_u8_slow(u32 address)
+{
+	if(address >= total_size) { return 0xFF; }
+
+	//Find the block holding this address
+	auto next = std::upper_bound(index.begin(), index.end(), address, [](u32 addr, const block_entry &entry) { return addr < entry.data_offset; });
+	s32 block = (next - index.begin()) - 1;
+
+	use_counter++;
+
+	//Use a cached copy if available, otherwise replace the least recently used block
+	u32 slot = 0;
+	bool hit = false;
+
+	for(u32 x = 0; x < cache.size(); x++)
+	{
+		if(cache[x].block == block) { slot = x; hit = true; break; }
+		if(cache[x].last_used < cache[slot].last_used) { slot = x; }
+	}
+
+	//Blocks that fail to load are not made current, so the next read tries again
+	if((!hit) && (!load_block(block, cache[slot])))
+	{
+		current_data = nullptr;
+		current_start = 0;
+		current_size = 0;
+		return 0xFF;
+	}
+
+	cache[slot].last_used = use_counter;
+
+	current_data = &cache[slot].data[0];
+	current_start = index[block].data_offset;
+	current_size = index[block].data_size;
+
+	return current_data[address - current_start];
+}
+
+/****** Decompresses a single block into a cache entry ******/
+bool block_stream::load_block(u32 block, cache_entry &entry)
+{
+	const block_entry &info = index[block];
+
+	//Only tag the entry with this block once it holds valid data, so failed reads are retried
+	entry.block = -1;
+	entry.data.assign(info.data_size, 0xFF);
+
+	#ifdef GBE_ZLIB
+
+	if(!read_bytes(file, info.file_offset, &compressed[0], info.compressed_size))
+	{
+		std::cout<<"GBE::Error - Could not read ROM block " << std::dec << block << "\n";
+		return false;
+	}
+
+	//Raw deflate data sits between the header plus extra fields and the 8-byte trailer
+	u32 header_size = 12 + read_le16(&compressed[10]);
+
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+
+	if(inflateInit2(&stream, -MAX_WBITS) != Z_OK) { return false; }
+
+	stream.next_in = &compressed[header_size];
+	stream.avail_in = info.compressed_size - header_size - 8;
+	stream.next_out = &entry.data[0];
+	stream.avail_out = info.data_size;
+
+	s32 result = inflate(&stream, Z_FINISH);
+	inflateEnd(&stream);
+
+	if((result != Z_STREAM_END) || (crc32(0, &entry.data[0], info.data_size) != info.crc))
+	{
+		std::cout<<"GBE::Error - ROM block " << std::dec << block << " is corrupted\n";
+		return false;
+	}
+
+	entry.block = block;
+	return true;
+
+	#else
+
+	return false;
+
+	#endif
+}
+
+}
@@ -0,0 +1,102 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : rom_archive.h
+// Date : October 19, 2026
+// Description : Compressed ROM containers
+//
+// Loads ROMs stored in .zip and .gz archives
+// Block-compressed gzip files (BGZF, as made by bgzip) can also be read randomly
+// Blocks are only decompressed when first accessed and are kept in a bounded cache
+
+#ifndef GBE_ROM_ARCHIVE
+#define GBE_ROM_ARCHIVE
+
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include "common.h"
+
+namespace rom_archive
+{
+	enum archive_types
+	{
+		ARCHIVE_NONE,
+		ARCHIVE_GZIP,
+		ARCHIVE_BGZF,
+		ARCHIVE_ZIP,
+	};
+
+	u8 get_archive_type(std::string filename);
+	bool is_archive(std::string filename);
+
+	std::string get_rom_filename(std::string filename);
+	std::string get_patch_filename(std::string filename);
+
+	bool extract(std::string filename, std::vector<u8> &data, u32 max_size);
+	bool read_header(std::string filename, std::vector<u8> &data, u32 length);
+
+	//Random access to BGZF files
+	class block_stream
+	{
+		public:
+
+		block_stream();
+		~block_stream();
+
+		bool open(std::string filename, u32 cache_size);
+		void close();
+		bool is_open() const;
+
+		u32 size() const;
+		u32 get_crc32() const;
+
+		void read(u32 address, u8* dst, u32 length);
+
+		/****** Reads 1 byte, decompressing its block if necessary ******/
+		inline u8 read_u8(u32 address)
+		{
+			u32 offset = address - current_start;
+			if(offset < current_size) { return current_data[offset]; }
+			return read_u8_slow(address);
+		}
+
+		private:
+
+		struct block_entry
+		{
+			u64 file_offset;
+			u32 compressed_size;
+			u32 data_offset;
+			u32 data_size;
+			u32 crc;
+		};
+
+		struct cache_entry
+		{
+			s32 block;
+			u32 last_used;
+			std::vector<u8> data;
+		};
+
+		u8 read_u8_slow(u32 address);
+		bool load_block(u32 block, cache_entry &entry);
+
+		std::ifstream file;
+		std::vector<block_entry> index;
+		std::vector<cache_entry> cache;
+		std::vector<u8> compressed;
+
+		u32 total_size;
+		u32 total_crc;
+		u32 use_counter;
+
+		const u8* current_data;
+		u32 current_start;
+		u32 current_size;
+	};
+}
+
+#endif // GBE_ROM_ARCHIVE
@@ -0,0 +1,362 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : rom_cache.cpp
+// Date : October 19, 2026
+// Description : ROM metadata cache
+//
+// Remembers header fields and CRC32s of ROMs that have been loaded before
+// Entries are keyed by path, file size, and modification time, so they are found without reading the ROM
+// The cache file is bounded, least recently used entries are dropped first
+// The file is read once the config folder is known, and written back once when the program exits
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdlib>
+
+#include "rom_cache.h"
+#include "rom_archive.h"
+#include "config.h"
+#include "util.h"
+
+namespace rom_cache
+{
+	//Every known ROM - Lookups made before the cache file is opened only live in memory until then
+	std::unordered_map<std::string, rom_info> entries;
+	std::string cache_filename = "";
+	bool file_opened = false;
+	bool entries_changed = false;
+	u32 use_counter = 0;
+
+/****** Converts raw bytes to a hex string, "-" when empty ******/
+std::string to_byte_str(const std::string &input)
+{
+	if(input.empty()) { return "-"; }
+
+	std::string result = "";
+	const char* digits = "0123456789ABCDEF";
+
+	for(u32 x = 0; x < input.length(); x++)
+	{
+		u8 chr = input[x];
+		result += digits[chr >> 4];
+		result += digits[chr & 0xF];
+	}
+
+	return result;
+}
+
+/****** Converts a hex string back to raw bytes ******/
+bool from_byte_str(const std::string &input, std::string &result)
+{
+	result = "";
+	if(input == "-") { return true; }
+	if(input.length() & 0x1) { return false; }
+
+	for(u32 x = 0; x < input.length(); x += 2)
+	{
+		u32 chr = 0;
+		if(!util::from_hex_str(input.substr(x, 2), chr)) { return false; }
+		result += char(chr);
+	}
+
+	return true;
+}
+
+/****** Loads all entries from the cache file ******/
+void load_entries()
+{
+	std::ifstream file(cache_filename.c_str(), std::ios::in);
+	if(!file.is_open()) { return; }
+
+	std::string input_line = "";
+
+	//Each line = CRC32, file size, modification time, last use, header type, CGB flag, SGB flag, title, game code, full path
+	while(getline(file, input_line))
+	{
+		std::istringstream line_stream(input_line);
+		std::string crc_str, title_str, code_str, cgb_str, sgb_str;
+		u32 header_type = 0;
+		u32 cgb_flag = 0;
+		u32 sgb_flag = 0;
+
+		rom_info info;
+
+		if(!(line_stream >> crc_str >> info.file_size >> info.mod_time >> info.last_used >> header_type >> cgb_str >> sgb_str >> title_str >> code_str)) { continue; }
+
+		line_stream.get();
+		getline(line_stream, info.path);
+
+		if((info.path.empty()) || (header_type > HEADER_MIN)) { continue; }
+		if((!util::from_hex_str(cgb_str, cgb_flag)) || (!util::from_hex_str(sgb_str, sgb_flag))) { continue; }
+		if((!from_byte_str(title_str, info.title)) || (!from_byte_str(code_str, info.game_code))) { continue; }
+
+		info.header_type = header_type;
+		info.cgb_flag = cgb_flag;
+		info.sgb_flag = sgb_flag;
+		info.has_crc32 = (crc_str != "-");
+		info.crc32 = 0;
+
+		if((info.has_crc32) && (!util::from_hex_str(crc_str, info.crc32))) { continue; }
+
+		if(info.last_used >= use_counter) { use_counter = info.last_used + 1; }
+
+		//ROMs looked up before the file was opened are newer than anything stored
+		if(entries.find(info.path) == entries.end()) { entries[info.path] = info; }
+	}
+
+	file.close();
+}
+
+/****** Writes the most recently used entries back to the cache file ******/
+void save_entries()
+{
+	if((!file_opened) || (!entries_changed)) { return; }
+	entries_changed = false;
+
+	std::vector<const rom_info*> sorted;
+	for(auto &entry : entries) { sorted.push_back(&entry.second); }
+
+	std::sort(sorted.begin(), sorted.end(), [](const rom_info* a, const rom_info* b) { return a->last_used > b->last_used; });
+
+	//Drop the least recently used ROMs once the cache is full
+	while(sorted.size() > MAX_ENTRIES)
+	{
+		std::string path = sorted.back()->path;
+		sorted.pop_back();
+		entries.erase(path);
+	}
+
+	std::ofstream file(cache_filename.c_str(), std::ios::out | std::ios::trunc);
+	if(!file.is_open()) { return; }
+
+	for(u32 x = 0; x < sorted.size(); x++)
+	{
+		const rom_info &info = *sorted[x];
+
+		file << ((info.has_crc32) ? util::to_hex_str(info.crc32).substr(2) : std::string("-")) << " ";
+		file << info.file_size << " " << info.mod_time << " " << info.last_used << " " << u32(info.header_type) << " ";
+		file << util::to_hex_str(info.cgb_flag).substr(2) << " " << util::to_hex_str(info.sgb_flag).substr(2) << " ";
+		file << to_byte_str(info.title) << " " << to_byte_str(info.game_code) << " " << info.path << "\n";
+	}
+
+	file.close();
+}
+
+/****** Opens the cache file in the config folder - Called once the config folder is known ******/
+void open()
+{
+	if(file_opened) { return; }
+
+	file_opened = true;
+	cache_filename = config::cfg_path + "rom_cache.txt";
+
+	//Entries already in memory come from lookups made before this point
+	std::vector<std::string> early_entries;
+	for(auto &entry : entries) { early_entries.push_back(entry.first); }
+
+	load_entries();
+
+	//Make early lookups the most recently used ones, and make sure they get saved
+	for(u32 x = 0; x < early_entries.size(); x++)
+	{
+		entries[early_entries[x]].last_used = use_counter++;
+		entries_changed = true;
+	}
+
+	//Write the cache back once when the program exits, not after every lookup
+	std::atexit(save_entries);
+}
+
+/****** Gets the size and modification time used to key a file ******/
+bool get_file_stamp(std::string filename, u32 &file_size, s64 &mod_time)
+{
+	try
+	{
+		file_size = std::filesystem::file_size(filename);
+		mod_time = std::filesystem::last_write_time(filename).time_since_epoch().count();
+	}
+
+	catch(std::filesystem::filesystem_error& error)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+/****** Returns which header layout a system uses ******/
+u8 get_header_type(u8 system_type)
+{
+	switch(system_type)
+	{
+		case SYS_GBA: return HEADER_AGB;
+		case SYS_NDS: return HEADER_NTR;
+		case SYS_MIN: return HEADER_MIN;
+		default: return HEADER_DMG;
+	}
+}
+
+/****** Copies a range of header bytes, empty if the ROM is too short ******/
+std::string get_header_bytes(const u8* data, u32 length, u32 offset, u32 count, u32 min_length)
+{
+	if(length < min_length) { return ""; }
+	return std::string((const char*)&data[offset], count);
+}
+
+/****** Parses the title, game code, and flags from ROM data ******/
+void parse_header(const u8* data, u32 length, u8 header_type, rom_info &info)
+{
+	info.header_type = header_type;
+	info.title = "";
+	info.game_code = "";
+	info.cgb_flag = (length > 0x143) ? data[0x143] : 0;
+	info.sgb_flag = (length > 0x146) ? data[0x146] : 0;
+
+	switch(header_type)
+	{
+		case HEADER_DMG:
+			info.title = get_header_bytes(data, length, 0x134, 16, 0x144);
+			break;
+
+		case HEADER_AGB:
+			info.title = get_header_bytes(data, length, 0xA0, 12, 0xB0);
+			info.game_code = get_header_bytes(data, length, 0xAC, 4, 0xB0);
+			break;
+
+		case HEADER_NTR:
+			info.title = get_header_bytes(data, length, 0x00, 12, 0x10);
+			info.game_code = get_header_bytes(data, length, 0x0C, 4, 0x10);
+			break;
+
+		case HEADER_MIN:
+			info.title = get_header_bytes(data, length, 0x21B0, 12, 0x21BC);
+			info.game_code = get_header_bytes(data, length, 0x21AC, 4, 0x21BC);
+			break;
+	}
+}
+
+/****** Returns cached header fields for a ROM, reading only its header when not cached ******/
+bool get_header(std::string filename, u8 header_type, rom_info &info)
+{
+	u32 file_size = 0;
+	s64 mod_time = 0;
+	bool can_cache = get_file_stamp(filename, file_size, mod_time);
+
+	if(can_cache)
+	{
+		auto entry = entries.find(filename);
+
+		if((entry != entries.end()) && (entry->second.file_size == file_size) && (entry->second.mod_time == mod_time))
+		{
+			entry->second.last_used = use_counter++;
+			entries_changed = true;
+
+			if(entry->second.header_type == header_type)
+			{
+				info = entry->second;
+				return true;
+			}
+		}
+	}
+
+	//Not cached, read just the header - Compressed ROMs only need their header decompressed
+	std::vector<u8> header;
+
+	if(rom_archive::is_archive(filename))
+	{
+		if(!rom_archive::read_header(filename, header, HEADER_SIZE)) { return false; }
+	}
+
+	else
+	{
+		std::ifstream file(filename.c_str(), std::ios::binary);
+		if(!file.is_open()) { return false; }
+
+		header.resize(HEADER_SIZE, 0);
+		file.read((char*)&header[0], HEADER_SIZE);
+		header.resize(file.gcount());
+		file.close();
+	}
+
+	if(header.empty()) { return false; }
+
+	rom_info new_info;
+	new_info.path = filename;
+	new_info.file_size = file_size;
+	new_info.mod_time = mod_time;
+	new_info.last_used = use_counter++;
+	new_info.has_crc32 = false;
+	new_info.crc32 = 0;
+
+	parse_header(&header[0], header.size(), header_type, new_info);
+
+	if(can_cache)
+	{
+		//Keep a CRC32 that is still valid when only the header layout changed
+		auto entry = entries.find(filename);
+
+		if((entry != entries.end()) && (entry->second.file_size == file_size) && (entry->second.mod_time == mod_time))
+		{
+			new_info.has_crc32 = entry->second.has_crc32;
+			new_info.crc32 = entry->second.crc32;
+		}
+
+		entries[filename] = new_info;
+		entries_changed = true;
+	}
+
+	info = new_info;
+	return true;
+}
+
+/****** Returns the CRC32 of loaded ROM data, skipping the calculation for previously seen files ******/
+u32 get_crc32(std::string filename, u8* data, u32 length)
+{
+	//Patched ROM data no longer matches the file on disk, always calculate it
+	if(config::use_patches) { return util::get_crc32(data, length); }
+
+	u32 file_size = 0;
+	s64 mod_time = 0;
+
+	if(!get_file_stamp(filename, file_size, mod_time)) { return util::get_crc32(data, length); }
+
+	auto entry = entries.find(filename);
+	bool is_current = (entry != entries.end()) && (entry->second.file_size == file_size) && (entry->second.mod_time == mod_time);
+
+	if((is_current) && (entry->second.has_crc32))
+	{
+		entry->second.last_used = use_counter++;
+		entries_changed = true;
+		return entry->second.crc32;
+	}
+
+	u32 result = util::get_crc32(data, length);
+
+	//The ROM is already in memory, so its header can be cached along with the CRC32
+	if(!is_current)
+	{
+		rom_info new_info;
+		new_info.path = filename;
+		new_info.file_size = file_size;
+		new_info.mod_time = mod_time;
+
+		parse_header(data, length, get_header_type(config::gb_type), new_info);
+		entries[filename] = new_info;
+	}
+
+	rom_info &info = entries[filename];
+	info.last_used = use_counter++;
+	info.has_crc32 = true;
+	info.crc32 = result;
+
+	entries_changed = true;
+	return result;
+}
+
+}
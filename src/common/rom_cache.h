@@ -0,0 +1,64 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : rom_cache.h
+// Date : October 19, 2026
+// Description : ROM metadata cache
+//
+// Remembers header fields and CRC32s of ROMs that have been loaded before
+// Entries are keyed by path, file size, and modification time, so they are found without reading the ROM
+// The cache file is bounded, least recently used entries are dropped first
+// The file is read once the config folder is known, and written back once when the program exits
+
+#ifndef GBE_ROM_CACHE
+#define GBE_ROM_CACHE
+
+#include <string>
+#include <vector>
+
+#include "common.h"
+
+namespace rom_cache
+{
+	//Maximum number of ROMs remembered in rom_cache.txt
+	const u32 MAX_ENTRIES = 256;
+
+	//Bytes needed to parse every supported header, the highest is the Pokemon Mini title at 0x21BC
+	const u32 HEADER_SIZE = 0x2200;
+
+	enum header_types
+	{
+		HEADER_DMG,
+		HEADER_AGB,
+		HEADER_NTR,
+		HEADER_MIN,
+	};
+
+	struct rom_info
+	{
+		std::string path;
+		u32 file_size;
+		s64 mod_time;
+		u32 last_used;
+
+		//Header fields, raw bytes from the ROM
+		u8 header_type;
+		u8 cgb_flag;
+		u8 sgb_flag;
+		std::string title;
+		std::string game_code;
+
+		bool has_crc32;
+		u32 crc32;
+	};
+
+	void open();
+
+	bool get_header(std::string filename, u8 header_type, rom_info &info);
+	u32 get_crc32(std::string filename, u8* data, u32 length);
+
+	u8 get_header_type(u8 system_type);
+}
+
+#endif // GBE_ROM_CACHE
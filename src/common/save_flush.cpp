@@ -0,0 +1,278 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : save_flush.cpp
+// Date : October 19, 2026
+// Description : Background battery save writer
+//
+// Keeps a copy of the current battery save and tracks which blocks of it games have changed
+// Once a game stops writing, changed blocks are copied on the emulation thread and a worker thread writes the file
+// Files are written to a temporary file first and then renamed, so a power loss never leaves a partial save
+
+#include <iostream>
+#include <cstdio>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "save_flush.h"
+#include "config.h"
+#include "util.h"
+
+namespace save_flush
+{
+	bool pending = false;
+
+	bool active = false;
+	std::string save_filename = "";
+	read_func save_reader;
+
+	//Emulation thread copy of the save and its changed blocks
+	std::vector<u8> shadow;
+	std::vector<u8> dirty_blocks;
+	std::vector<u8> compare_buffer;
+	u32 first_write = 0;
+	u32 last_write = 0;
+
+	//Longest time changes wait while a game keeps writing, in milliseconds
+	const u32 MAX_FLUSH_DEFER = 5000;
+
+	//Worker thread state
+	std::thread writer;
+	std::mutex writer_lock;
+	std::condition_variable writer_wake;
+	std::vector<u8> write_buffer;
+	bool write_requested = false;
+	bool writer_quit = false;
+
+/****** Writes save data to a temporary file, then replaces the old save with it ******/
+bool write_file(std::string filename, const std::vector<u8> &data)
+{
+	std::string temp_filename = filename + ".tmp";
+	FILE* file = std::fopen(temp_filename.c_str(), "wb");
+
+	if(file == NULL)
+	{
+		std::cout<<"GBE::Error - Could not write save data file " << temp_filename << "\n";
+		return false;
+	}
+
+	bool result = (std::fwrite(data.data(), 1, data.size(), file) == data.size());
+	if(std::fflush(file) != 0) { result = false; }
+
+	//Make sure data actually reaches the disk before the old save is replaced
+	#ifdef _WIN32
+	if(_commit(_fileno(file)) != 0) { result = false; }
+	#else
+	if(fsync(fileno(file)) != 0) { result = false; }
+	#endif
+
+	std::fclose(file);
+
+	if(!result)
+	{
+		std::cout<<"GBE::Error - Could not write save data file " << temp_filename << "\n";
+		std::remove(temp_filename.c_str());
+		return false;
+	}
+
+	//Windows will not rename over an existing file, but can replace it in one step
+	//The old save is never removed first, so it survives if the replacement fails
+	#ifdef _WIN32
+	bool replaced = (MoveFileExA(temp_filename.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0);
+	#else
+	bool replaced = (std::rename(temp_filename.c_str(), filename.c_str()) == 0);
+	#endif
+
+	if(!replaced)
+	{
+		std::cout<<"GBE::Error - Could not replace save data file " << filename << ", new data left in " << temp_filename << "\n";
+		return false;
+	}
+
+	std::cout<<"GBE::Wrote save data file " << filename << "\n";
+	return true;
+}
+
+/****** Worker thread - Writes save data whenever the emulation thread hands over a new copy ******/
+void writer_main()
+{
+	std::vector<u8> data;
+	std::string filename;
+
+	while(true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(writer_lock);
+			writer_wake.wait(lock, [] { return write_requested || writer_quit; });
+
+			//Finish any outstanding write before quitting
+			if(!write_requested) { return; }
+
+			data.swap(write_buffer);
+			filename = save_filename;
+			write_requested = false;
+		}
+
+		write_file(filename, data);
+	}
+}
+
+/****** Begins background saving for a save file of a given size ******/
+void start(std::string filename, u32 size, read_func reader)
+{
+	if(active) { stop(); }
+
+	save_filename = get_backup_filename(filename);
+	save_reader = reader;
+
+	//Every block starts out dirty so the first write produces a complete file
+	shadow.assign(size, 0);
+	dirty_blocks.assign((size + BLOCK_SIZE - 1) / BLOCK_SIZE, 1);
+	compare_buffer.assign(BLOCK_SIZE, 0);
+
+	write_buffer.clear();
+	write_requested = false;
+	writer_quit = false;
+	pending = false;
+
+	writer = std::thread(writer_main);
+	active = true;
+}
+
+/****** Writes any remaining changes and shuts down the worker thread ******/
+void stop()
+{
+	if(!active) { return; }
+
+	if(pending) { flush(); }
+
+	{
+		std::lock_guard<std::mutex> lock(writer_lock);
+		writer_quit = true;
+	}
+
+	writer_wake.notify_one();
+	writer.join();
+
+	active = false;
+	pending = false;
+	save_reader = nullptr;
+}
+
+/****** Returns whether background saving is currently running ******/
+bool is_active()
+{
+	return active;
+}
+
+/****** Returns the size of the save currently handled, 0 if none ******/
+u32 get_size()
+{
+	return (active) ? shadow.size() : 0;
+}
+
+/****** Marks a range of save data as changed - Must be called after emulated memory is written ******/
+void mark_dirty(u32 offset, u32 length)
+{
+	if((!active) || (!length) || (offset >= shadow.size())) { return; }
+
+	u32 last = offset + length - 1;
+	if(last >= shadow.size()) { last = shadow.size() - 1; }
+
+	bool changed = false;
+
+	for(u32 x = (offset / BLOCK_SIZE); x <= (last / BLOCK_SIZE); x++)
+	{
+		if(dirty_blocks[x]) { changed = true; continue; }
+
+		//Clean blocks still match the shadow copy, so writes that store the same data can be ignored
+		u32 start = (x == (offset / BLOCK_SIZE)) ? offset : (x * BLOCK_SIZE);
+		u32 end = (x == (last / BLOCK_SIZE)) ? last : ((x * BLOCK_SIZE) + BLOCK_SIZE - 1);
+		u32 size = end - start + 1;
+
+		save_reader(start, &compare_buffer[0], size);
+
+		for(u32 y = 0; y < size; y++)
+		{
+			if(compare_buffer[y] != shadow[start + y])
+			{
+				dirty_blocks[x] = 1;
+				changed = true;
+				break;
+			}
+		}
+	}
+
+	if(!changed) { return; }
+
+	last_write = SDL_GetTicks();
+	if(!pending) { first_write = last_write; }
+	pending = true;
+}
+
+/****** Hands changes over to the worker thread once the game has stopped writing for a while ******/
+void update()
+{
+	if(!pending) { return; }
+
+	u32 current_time = SDL_GetTicks();
+	u32 max_defer = (config::save_flush_delay > MAX_FLUSH_DEFER) ? config::save_flush_delay : MAX_FLUSH_DEFER;
+
+	//Games that never stop writing still get their changes saved every so often
+	if(((current_time - last_write) < config::save_flush_delay) && ((current_time - first_write) < max_defer)) { return; }
+
+	flush();
+}
+
+/****** Copies changed blocks and hands the save over to the worker thread immediately ******/
+void flush()
+{
+	if((!active) || (!pending)) { return; }
+
+	//Only changed blocks are pulled from emulated memory
+	for(u32 x = 0; x < dirty_blocks.size(); x++)
+	{
+		if(!dirty_blocks[x]) { continue; }
+
+		u32 offset = x * BLOCK_SIZE;
+		u32 length = ((offset + BLOCK_SIZE) > shadow.size()) ? (shadow.size() - offset) : BLOCK_SIZE;
+
+		save_reader(offset, &shadow[offset], length);
+		dirty_blocks[x] = 0;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(writer_lock);
+		write_buffer = shadow;
+		write_requested = true;
+	}
+
+	writer_wake.notify_one();
+	pending = false;
+}
+
+/****** Returns the filename a save is written to, accounting for save paths and exports ******/
+std::string get_backup_filename(std::string filename)
+{
+	//Use config save path if applicable
+	if(!config::save_path.empty())
+	{
+		 filename = config::save_path + util::get_filename_from_path(filename);
+	}
+
+	//Export save if applicable
+	if(!config::save_export_path.empty()) { filename = config::save_export_path; }
+
+	return filename;
+}
+
+}
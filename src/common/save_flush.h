@@ -0,0 +1,45 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : save_flush.h
+// Date : October 19, 2026
+// Description : Background battery save writer
+//
+// Keeps a copy of the current battery save and tracks which blocks of it games have changed
+// Once a game stops writing, changed blocks are copied on the emulation thread and a worker thread writes the file
+// Files are written to a temporary file first and then renamed, so a power loss never leaves a partial save
+
+#ifndef GBE_SAVE_FLUSH
+#define GBE_SAVE_FLUSH
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "common.h"
+
+namespace save_flush
+{
+	//Save data is tracked in blocks of this many bytes
+	const u32 BLOCK_SIZE = 0x200;
+
+	//Copies part of the emulated save memory into a buffer - Always called on the emulation thread
+	typedef std::function<void(u32 offset, u8* dst, u32 length)> read_func;
+
+	//Set whenever changed save data is waiting to be written
+	extern bool pending;
+
+	void start(std::string filename, u32 size, read_func reader);
+	void stop();
+	bool is_active();
+	u32 get_size();
+
+	void mark_dirty(u32 offset, u32 length);
+	void update();
+	void flush();
+
+	std::string get_backup_filename(std::string filename);
+}
+
+#endif // GBE_SAVE_FLUSH
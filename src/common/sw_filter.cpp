@@ -0,0 +1,571 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : sw_filter.cpp
+// Date : October 19, 2026
+// Description : Software post-processing filters
+//
+// CPU versions of the upscaling, color correction, and LCD effects otherwise done with GLSL shaders
+// Used by each core's SDL software renderer when OpenGL is disabled or unavailable
+// Frames are split into bands of rows and processed across several worker threads
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "sw_filter.h"
+#include "config.h"
+
+namespace sw_filter
+{
+
+//Fixed pool of worker threads - Each job is split into equal bands of rows, the calling thread takes the first band
+class band_pool
+{
+	public:
+
+	~band_pool() { stop(); }
+
+	void start(u32 count);
+	void stop();
+	void run(u32 rows, const std::function<void(u32, u32)> &job);
+
+	u32 thread_count = 1;
+
+	private:
+
+	void worker_main(u32 index, u32 first_job);
+
+	std::vector<std::thread> workers;
+	std::mutex job_lock;
+	std::condition_variable job_ready;
+	std::condition_variable job_done;
+
+	const std::function<void(u32, u32)>* current_job = nullptr;
+	u32 job_rows = 0;
+	u32 job_bands = 0;
+	u32 job_id = 0;
+	u32 jobs_left = 0;
+	bool quit = false;
+};
+
+band_pool pool;
+
+//Color correction lookup table, indexed by RGB555
+std::vector<u32> color_lut;
+u8 color_lut_type = COLOR_NONE;
+
+//Intermediate buffers
+std::vector<u32> color_buffer;
+std::vector<u32> scale_buffer;
+
+/****** Starts worker threads - Count includes the calling thread ******/
+void band_pool::start(u32 count)
+{
+	stop();
+
+	if(!count) { count = 1; }
+	thread_count = count;
+	quit = false;
+
+	for(u32 x = 1; x < count; x++) { workers.push_back(std::thread(&band_pool::worker_main, this, x, job_id)); }
+}
+
+/****** Stops and joins all worker threads ******/
+void band_pool::stop()
+{
+	if(workers.empty()) { return; }
+
+	{
+		std::lock_guard<std::mutex> lock(job_lock);
+		quit = true;
+	}
+
+	job_ready.notify_all();
+
+	for(u32 x = 0; x < workers.size(); x++) { workers[x].join(); }
+
+	workers.clear();
+	thread_count = 1;
+}
+
+/****** Runs a job over a range of rows, returns once every band is finished ******/
+void band_pool::run(u32 rows, const std::function<void(u32, u32)> &job)
+{
+	//Not worth waking other threads for tiny jobs
+	if((workers.empty()) || (rows < (thread_count * 4)))
+	{
+		job(0, rows);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(job_lock);
+		current_job = &job;
+		job_rows = rows;
+		job_bands = thread_count;
+		jobs_left = workers.size();
+		job_id++;
+	}
+
+	job_ready.notify_all();
+
+	job(0, rows / thread_count);
+
+	std::unique_lock<std::mutex> lock(job_lock);
+	job_done.wait(lock, [this]{ return (jobs_left == 0); });
+}
+
+/****** Worker thread loop - Waits for a new job, processes its band, then signals completion ******/
+void band_pool::worker_main(u32 index, u32 first_job)
+{
+	u32 last_job = first_job;
+
+	while(true)
+	{
+		std::unique_lock<std::mutex> lock(job_lock);
+		job_ready.wait(lock, [this, last_job]{ return (quit || (job_id != last_job)); });
+
+		if(quit) { return; }
+
+		last_job = job_id;
+		const std::function<void(u32, u32)>* job = current_job;
+		u32 start = (job_rows * index) / job_bands;
+		u32 end = (job_rows * (index + 1)) / job_bands;
+
+		lock.unlock();
+
+		(*job)(start, end);
+
+		lock.lock();
+		if(--jobs_left == 0) { job_done.notify_one(); }
+	}
+}
+
+/****** Returns true if any software filter should be applied ******/
+bool is_enabled()
+{
+	if(config::use_opengl) { return false; }
+	return ((config::sw_scaler != SCALER_NONE) || (config::sw_color_filter != COLOR_NONE) || (config::sw_lcd_grid));
+}
+
+/****** Returns the output size multiplier for the current filters ******/
+u32 get_scale()
+{
+	if(!is_enabled()) { return 1; }
+
+	switch(config::sw_scaler)
+	{
+		case SCALER_SCALE2X: return 2;
+		case SCALER_SCALE3X: return 3;
+		case SCALER_2XBR: return 2;
+		case SCALER_4XBR: return 4;
+	}
+
+	//LCD grid needs room for the grid lines
+	return (config::sw_lcd_grid) ? 3 : 1;
+}
+
+/****** Averages two colors ******/
+inline u32 blend_half(u32 color_1, u32 color_2)
+{
+	return ((color_1 & 0xFEFEFEFE) >> 1) + ((color_2 & 0xFEFEFEFE) >> 1) + (color_1 & color_2 & 0x01010101);
+}
+
+/****** Darkens a color by 1/4 for LCD grid lines, alpha untouched ******/
+inline u32 darken(u32 color)
+{
+	return color - ((color >> 2) & 0x3F3F3F);
+}
+
+/****** Weighted YUV distance between two colors, same as the 2xBR shader ******/
+inline u32 color_dist(u32 color_1, u32 color_2)
+{
+	s32 r = std::abs((s32)((color_1 >> 16) & 0xFF) - (s32)((color_2 >> 16) & 0xFF));
+	s32 g = std::abs((s32)((color_1 >> 8) & 0xFF) - (s32)((color_2 >> 8) & 0xFF));
+	s32 b = std::abs((s32)(color_1 & 0xFF) - (s32)(color_2 & 0xFF));
+
+	s32 y = std::abs((299 * r) + (587 * g) + (114 * b));
+	s32 u = std::abs((-169 * r) - (331 * g) + (500 * b));
+	s32 v = std::abs((500 * r) - (419 * g) - (81 * b));
+
+	return (y * 48) + (u * 7) + (v * 6);
+}
+
+/****** Builds the RGB555 color correction table ******/
+void build_color_lut(u8 type)
+{
+	color_lut.resize(0x8000);
+	color_lut_type = type;
+
+	for(u32 index = 0; index < 0x8000; index++)
+	{
+		u32 r = (index >> 10) & 0x1F;
+		u32 g = (index >> 5) & 0x1F;
+		u32 b = index & 0x1F;
+
+		double out_r = 0.0;
+		double out_g = 0.0;
+		double out_b = 0.0;
+
+		//GBA gamma - Color correction formula courtesy of Talarubi and byuu
+		if(type == COLOR_GBA_GAMMA)
+		{
+			double lr = std::pow((r / 31.0), 4.0);
+			double lg = std::pow((g / 31.0), 4.0);
+			double lb = std::pow((b / 31.0), 4.0);
+
+			out_r = std::pow((((50.0 * lg) + (255.0 * lr)) / 255.0), (1.0 / 2.2));
+			out_g = std::pow((((30.0 * lb) + (230.0 * lg) + (10.0 * lr)) / 255.0), (1.0 / 2.2));
+			out_b = std::pow((((220.0 * lb) + (10.0 * lg) + (50.0 * lr)) / 255.0), (1.0 / 2.2));
+		}
+
+		//GBC gamma - Color correction formula courtesy of byuu
+		else
+		{
+			u32 rf = (r * 26) + (g * 4) + (b * 2);
+			u32 gf = (g * 24) + (b * 8);
+			u32 bf = (r * 6) + (g * 4) + (b * 22);
+
+			out_r = ((rf > 960) ? 960 : rf) / 4 / 255.0;
+			out_g = ((gf > 960) ? 960 : gf) / 4 / 255.0;
+			out_b = ((bf > 960) ? 960 : bf) / 4 / 255.0;
+		}
+
+		if(out_r > 1.0) { out_r = 1.0; }
+		if(out_g > 1.0) { out_g = 1.0; }
+		if(out_b > 1.0) { out_b = 1.0; }
+
+		u32 final_r = std::round(out_r * 255.0);
+		u32 final_g = std::round(out_g * 255.0);
+		u32 final_b = std::round(out_b * 255.0);
+
+		color_lut[index] = 0xFF000000 | (final_r << 16) | (final_g << 8) | final_b;
+	}
+}
+
+/****** Applies color correction to a band of rows ******/
+void color_rows(const u32* src, u32* dst, u32 width, u32 y_start, u32 y_end)
+{
+	for(u32 pos = (y_start * width), end = (y_end * width); pos < end; pos++)
+	{
+		u32 color = src[pos];
+		dst[pos] = color_lut[((color >> 9) & 0x7C00) | ((color >> 6) & 0x3E0) | ((color >> 3) & 0x1F)];
+	}
+}
+
+/****** Draws LCD grid lines over a band of scaled rows - First row and column of each source pixel are darkened ******/
+void grid_rows(u32* dst, u32 pitch, u32 width, u32 scale, u32 y_start, u32 y_end)
+{
+	for(u32 y = y_start; y < y_end; y++)
+	{
+		u32* out = dst + (y * pitch);
+		u32 x = 0;
+
+		//Horizontal line
+		if((y % scale) == 0)
+		{
+			#ifdef __SSE2__
+			__m128i mask = _mm_set1_epi32(0x3F3F3F);
+
+			for(; (x + 4) <= width; x += 4)
+			{
+				__m128i pixels = _mm_loadu_si128((__m128i*)(out + x));
+				pixels = _mm_sub_epi32(pixels, _mm_and_si128(_mm_srli_epi32(pixels, 2), mask));
+				_mm_storeu_si128((__m128i*)(out + x), pixels);
+			}
+			#endif
+
+			for(; x < width; x++) { out[x] = darken(out[x]); }
+		}
+
+		//Vertical lines
+		else
+		{
+			for(; x < width; x += scale) { out[x] = darken(out[x]); }
+		}
+	}
+}
+
+/****** Nearest-neighbor scaling for a band of rows ******/
+void nearest_rows(const u32* src, u32 width, u32* dst, u32 pitch, u32 scale, u32 y_start, u32 y_end)
+{
+	for(u32 y = y_start; y < y_end; y++)
+	{
+		const u32* in = src + (y * width);
+		u32* out = dst + (y * scale * pitch);
+
+		if(scale == 1) { memcpy(out, in, width * 4); continue; }
+
+		for(u32 x = 0, out_x = 0; x < width; x++)
+		{
+			for(u32 s = 0; s < scale; s++) { out[out_x++] = in[x]; }
+		}
+
+		for(u32 s = 1; s < scale; s++) { memcpy(out + (s * pitch), out, width * scale * 4); }
+	}
+}
+
+/****** Scale2x for a band of rows ******/
+void scale2x_rows(const u32* src, u32 width, u32 height, u32* dst, u32 pitch, u32 y_start, u32 y_end)
+{
+	for(u32 y = y_start; y < y_end; y++)
+	{
+		const u32* row = src + (y * width);
+		const u32* above = (y) ? (row - width) : row;
+		const u32* below = ((y + 1) < height) ? (row + width) : row;
+
+		u32* out_0 = dst + (y * 2 * pitch);
+		u32* out_1 = out_0 + pitch;
+
+		u32 x = 0;
+
+		//Edge and leftover pixels
+		auto scale_pixel = [&](u32 pos)
+		{
+			u32 b = above[pos];
+			u32 h = below[pos];
+			u32 d = (pos) ? row[pos - 1] : row[pos];
+			u32 e = row[pos];
+			u32 f = ((pos + 1) < width) ? row[pos + 1] : row[pos];
+
+			u32 e0 = e, e1 = e, e2 = e, e3 = e;
+
+			if((b != h) && (d != f))
+			{
+				if(d == b) { e0 = d; }
+				if(b == f) { e1 = f; }
+				if(d == h) { e2 = d; }
+				if(h == f) { e3 = f; }
+			}
+
+			out_0[pos * 2] = e0;
+			out_0[(pos * 2) + 1] = e1;
+			out_1[pos * 2] = e2;
+			out_1[(pos * 2) + 1] = e3;
+		};
+
+		scale_pixel(x++);
+
+		#ifdef __SSE2__
+		//4 pixels at a time, all 4 output quadrants are chosen with compare masks
+		for(; (x + 5) <= width; x += 4)
+		{
+			__m128i e = _mm_loadu_si128((const __m128i*)(row + x));
+			__m128i b = _mm_loadu_si128((const __m128i*)(above + x));
+			__m128i h = _mm_loadu_si128((const __m128i*)(below + x));
+			__m128i d = _mm_loadu_si128((const __m128i*)(row + x - 1));
+			__m128i f = _mm_loadu_si128((const __m128i*)(row + x + 1));
+
+			__m128i all = _mm_cmpeq_epi32(e, e);
+			__m128i cond = _mm_andnot_si128(_mm_cmpeq_epi32(b, h), _mm_andnot_si128(_mm_cmpeq_epi32(d, f), all));
+
+			__m128i m0 = _mm_and_si128(cond, _mm_cmpeq_epi32(d, b));
+			__m128i m1 = _mm_and_si128(cond, _mm_cmpeq_epi32(b, f));
+			__m128i m2 = _mm_and_si128(cond, _mm_cmpeq_epi32(d, h));
+			__m128i m3 = _mm_and_si128(cond, _mm_cmpeq_epi32(h, f));
+
+			__m128i e0 = _mm_or_si128(_mm_and_si128(m0, d), _mm_andnot_si128(m0, e));
+			__m128i e1 = _mm_or_si128(_mm_and_si128(m1, f), _mm_andnot_si128(m1, e));
+			__m128i e2 = _mm_or_si128(_mm_and_si128(m2, d), _mm_andnot_si128(m2, e));
+			__m128i e3 = _mm_or_si128(_mm_and_si128(m3, f), _mm_andnot_si128(m3, e));
+
+			_mm_storeu_si128((__m128i*)(out_0 + (x * 2)), _mm_unpacklo_epi32(e0, e1));
+			_mm_storeu_si128((__m128i*)(out_0 + (x * 2) + 4), _mm_unpackhi_epi32(e0, e1));
+			_mm_storeu_si128((__m128i*)(out_1 + (x * 2)), _mm_unpacklo_epi32(e2, e3));
+			_mm_storeu_si128((__m128i*)(out_1 + (x * 2) + 4), _mm_unpackhi_epi32(e2, e3));
+		}
+		#endif
+
+		for(; x < width; x++) { scale_pixel(x); }
+	}
+}
+
+/****** Scale3x for a band of rows ******/
+void scale3x_rows(const u32* src, u32 width, u32 height, u32* dst, u32 pitch, u32 y_start, u32 y_end)
+{
+	for(u32 y = y_start; y < y_end; y++)
+	{
+		const u32* row = src + (y * width);
+		const u32* above = (y) ? (row - width) : row;
+		const u32* below = ((y + 1) < height) ? (row + width) : row;
+
+		u32* out_0 = dst + (y * 3 * pitch);
+		u32* out_1 = out_0 + pitch;
+		u32* out_2 = out_1 + pitch;
+
+		for(u32 x = 0; x < width; x++)
+		{
+			u32 left = (x) ? (x - 1) : x;
+			u32 right = ((x + 1) < width) ? (x + 1) : x;
+
+			u32 a = above[left], b = above[x], c = above[right];
+			u32 d = row[left], e = row[x], f = row[right];
+			u32 g = below[left], h = below[x], i = below[right];
+
+			u32 e0 = e, e1 = e, e2 = e, e3 = e, e5 = e, e6 = e, e7 = e, e8 = e;
+
+			if((b != h) && (d != f))
+			{
+				if(d == b) { e0 = d; }
+				if(((d == b) && (e != c)) || ((b == f) && (e != a))) { e1 = b; }
+				if(b == f) { e2 = f; }
+				if(((d == b) && (e != g)) || ((d == h) && (e != a))) { e3 = d; }
+				if(((b == f) && (e != i)) || ((h == f) && (e != c))) { e5 = f; }
+				if(d == h) { e6 = d; }
+				if(((d == h) && (e != i)) || ((h == f) && (e != g))) { e7 = h; }
+				if(h == f) { e8 = f; }
+			}
+
+			u32 out_x = x * 3;
+
+			out_0[out_x] = e0; out_0[out_x + 1] = e1; out_0[out_x + 2] = e2;
+			out_1[out_x] = e3; out_1[out_x + 1] = e; out_1[out_x + 2] = e5;
+			out_2[out_x] = e6; out_2[out_x + 1] = e7; out_2[out_x + 2] = e8;
+		}
+	}
+}
+
+/****** 2xBR for a band of rows ******/
+void xbr_rows(const u32* src, u32 width, u32 height, u32* dst, u32 pitch, u32 y_start, u32 y_end)
+{
+	//Fetches a pixel, clamping to the edges of the frame
+	auto get_pixel = [&](s32 x, s32 y) -> u32
+	{
+		if(x < 0) { x = 0; }
+		else if(x >= (s32)width) { x = width - 1; }
+
+		if(y < 0) { y = 0; }
+		else if(y >= (s32)height) { y = height - 1; }
+
+		return src[(y * width) + x];
+	};
+
+	for(u32 y = y_start; y < y_end; y++)
+	{
+		u32* out_0 = dst + (y * 2 * pitch);
+		u32* out_1 = out_0 + pitch;
+
+		for(u32 x = 0; x < width; x++)
+		{
+			s32 px = x;
+			s32 py = y;
+
+			u32 e = get_pixel(px, py);
+			u32 b = get_pixel(px, py - 1);
+			u32 d = get_pixel(px - 1, py);
+			u32 f = get_pixel(px + 1, py);
+			u32 h = get_pixel(px, py + 1);
+
+			u32 e0 = e, e1 = e, e2 = e, e3 = e;
+
+			//Every candidate color equals E in flat areas, nothing to do
+			if((b != e) || (d != e) || (f != e) || (h != e))
+			{
+				u32 a1 = get_pixel(px - 1, py - 2), b1 = get_pixel(px, py - 2), c1 = get_pixel(px + 1, py - 2);
+				u32 a0 = get_pixel(px - 2, py - 1), a = get_pixel(px - 1, py - 1), c = get_pixel(px + 1, py - 1), c4 = get_pixel(px + 2, py - 1);
+				u32 d0 = get_pixel(px - 2, py), f4 = get_pixel(px + 2, py);
+				u32 g0 = get_pixel(px - 2, py + 1), g = get_pixel(px - 1, py + 1), i = get_pixel(px + 1, py + 1), i4 = get_pixel(px + 2, py + 1);
+				u32 g5 = get_pixel(px - 1, py + 2), h5 = get_pixel(px, py + 2), i5 = get_pixel(px + 1, py + 2);
+
+				//E0
+				u32 red_weight = color_dist(e, g) + color_dist(e, c) + color_dist(a, d0) + color_dist(a, b1) + (4 * color_dist(d, b));
+				u32 blue_weight = color_dist(d, h) + color_dist(d, a0) + color_dist(b, f) + color_dist(b, a1) + (4 * color_dist(e, a));
+				if(red_weight < blue_weight) { e0 = blend_half(e, (color_dist(e, d) <= color_dist(e, b)) ? d : b); }
+
+				//E1
+				red_weight = color_dist(e, i) + color_dist(e, a) + color_dist(c, b1) + color_dist(c, f4) + (4 * color_dist(b, f));
+				blue_weight = color_dist(f, h) + color_dist(f, c4) + color_dist(d, b) + color_dist(b, c1) + (4 * color_dist(e, c));
+				if(red_weight < blue_weight) { e1 = blend_half(e, (color_dist(e, b) <= color_dist(e, f)) ? b : f); }
+
+				//E2
+				red_weight = color_dist(e, a) + color_dist(e, i) + color_dist(g, d0) + color_dist(g, h5) + (4 * color_dist(d, h));
+				blue_weight = color_dist(d, b) + color_dist(d, g0) + color_dist(f, h) + color_dist(h, g5) + (4 * color_dist(e, g));
+				if(red_weight < blue_weight) { e2 = blend_half(e, (color_dist(e, d) <= color_dist(e, h)) ? d : h); }
+
+				//E3
+				red_weight = color_dist(e, c) + color_dist(e, g) + color_dist(i, f4) + color_dist(i, h5) + (4 * color_dist(f, h));
+				blue_weight = color_dist(d, h) + color_dist(h, i5) + color_dist(f, i4) + color_dist(b, f) + (4 * color_dist(e, i));
+				if(red_weight < blue_weight) { e3 = blend_half(e, (color_dist(e, f) <= color_dist(e, h)) ? f : h); }
+			}
+
+			out_0[x * 2] = e0;
+			out_0[(x * 2) + 1] = e1;
+			out_1[x * 2] = e2;
+			out_1[(x * 2) + 1] = e3;
+		}
+	}
+}
+
+/****** Filters a frame into the destination buffer - Destination must hold (width * scale) x (height * scale) pixels ******/
+void apply(const u32* src, u32 width, u32 height, u32* dst, u32 dst_pitch)
+{
+	//Restart workers if the thread count changed
+	u32 threads = config::sw_filter_threads;
+	if(!threads) { threads = std::thread::hardware_concurrency(); }
+	if(!threads) { threads = 1; }
+	if(threads > 8) { threads = 8; }
+
+	if(threads != pool.thread_count) { pool.start(threads); }
+
+	const u32* input = src;
+	u32 scale = get_scale();
+
+	//Color correction
+	if(config::sw_color_filter != COLOR_NONE)
+	{
+		if(color_lut_type != config::sw_color_filter) { build_color_lut(config::sw_color_filter); }
+		if(color_buffer.size() < (width * height)) { color_buffer.resize(width * height); }
+
+		u32* output = color_buffer.data();
+		pool.run(height, [&](u32 y_start, u32 y_end) { color_rows(src, output, width, y_start, y_end); });
+
+		input = output;
+	}
+
+	//4xBR is 2xBR run twice
+	u32 pass_scale = scale;
+
+	if(config::sw_scaler == SCALER_4XBR)
+	{
+		u32 temp_pitch = width * 2;
+		if(scale_buffer.size() < (width * height * 4)) { scale_buffer.resize(width * height * 4); }
+
+		u32* temp = scale_buffer.data();
+		pool.run(height, [&](u32 y_start, u32 y_end) { xbr_rows(input, width, height, temp, temp_pitch, y_start, y_end); });
+
+		input = temp;
+		width *= 2;
+		height *= 2;
+		pass_scale = 2;
+	}
+
+	//Final scaling pass plus LCD grid
+	pool.run(height, [&](u32 y_start, u32 y_end)
+	{
+		switch(config::sw_scaler)
+		{
+			case SCALER_SCALE2X: scale2x_rows(input, width, height, dst, dst_pitch, y_start, y_end); break;
+			case SCALER_SCALE3X: scale3x_rows(input, width, height, dst, dst_pitch, y_start, y_end); break;
+			case SCALER_2XBR:
+			case SCALER_4XBR: xbr_rows(input, width, height, dst, dst_pitch, y_start, y_end); break;
+			default: nearest_rows(input, width, dst, dst_pitch, scale, y_start, y_end);
+		}
+
+		if((config::sw_lcd_grid) && (scale > 1))
+		{
+			grid_rows(dst, dst_pitch, width * pass_scale, scale, y_start * pass_scale, y_end * pass_scale);
+		}
+	});
+}
+
+}
@@ -0,0 +1,44 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : sw_filter.h
+// Date : October 19, 2026
+// Description : Software post-processing filters
+//
+// CPU versions of the upscaling, color correction, and LCD effects otherwise done with GLSL shaders
+// Used by each core's SDL software renderer when OpenGL is disabled or unavailable
+// Frames are split into bands of rows and processed across several worker threads
+
+#ifndef GBE_SW_FILTER
+#define GBE_SW_FILTER
+
+#include <vector>
+
+#include "common.h"
+
+namespace sw_filter
+{
+	enum scaler_types
+	{
+		SCALER_NONE = 0,
+		SCALER_SCALE2X = 1,
+		SCALER_SCALE3X = 2,
+		SCALER_2XBR = 3,
+		SCALER_4XBR = 4,
+	};
+
+	enum color_types
+	{
+		COLOR_NONE = 0,
+		COLOR_GBA_GAMMA = 1,
+		COLOR_GBC_GAMMA = 2,
+	};
+
+	bool is_enabled();
+	u32 get_scale();
+
+	void apply(const u32* src, u32 width, u32 height, u32* dst, u32 dst_pitch);
+}
+
+#endif // GBE_SW_FILTER
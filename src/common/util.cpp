@@ -38,6 +38,10 @@ u32 poly32 = 0x04C11DB7;
 //CRC lookup table
 u32 crc32_table[256];
 
+//CRC lookup tables for slicing-by-8, first table is identical to crc32_table
+u32 crc32_slice_table[8][256];
+bool crc32_table_ready = false;
+
 //UTC format LUT strings
 std::string utc_day[7] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
 
@@ -447,6 +451,9 @@ u32 reflect(u32 src, u8 bit)
 /****** Sets up the CRC lookup table ******/
 void init_crc32_table()
 {
+	//Tables never change, only build them once
+	if(crc32_table_ready) { return; }
+
 	for(int x = 0; x < 256; x++)
 	{
 		crc32_table[x] = (reflect(x, 7) << 24);
@@ -457,7 +464,20 @@ void init_crc32_table()
 		}
 
 		crc32_table[x] = reflect(crc32_table[x], 31);
+		crc32_slice_table[0][x] = crc32_table[x];
 	}
+
+	//Each extra table advances the CRC by one more byte of zeroes
+	for(int x = 0; x < 256; x++)
+	{
+		for(int y = 1; y < 8; y++)
+		{
+			u32 prev = crc32_slice_table[y - 1][x];
+			crc32_slice_table[y][x] = (prev >> 8) ^ crc32_table[prev & 0xFF];
+		}
+	}
+
+	crc32_table_ready = true;
 }
 
 /****** Return CRC32 for given data ******/
@@ -467,7 +487,23 @@ u32 get_crc32(u8* data, u32 length)
 
 	u32 crc32 = 0xFFFFFFFF;
 
-	for(int x = 0; x < length; x++)
+	//Process 8 bytes at a time using slicing-by-8
+	while(length >= 8)
+	{
+		u32 lo = crc32 ^ (data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24));
+		u32 hi = (data[4] | (data[5] << 8) | (data[6] << 16) | (data[7] << 24));
+
+		crc32 = crc32_slice_table[7][lo & 0xFF] ^ crc32_slice_table[6][(lo >> 8) & 0xFF]
+		^ crc32_slice_table[5][(lo >> 16) & 0xFF] ^ crc32_slice_table[4][lo >> 24]
+		^ crc32_slice_table[3][hi & 0xFF] ^ crc32_slice_table[2][(hi >> 8) & 0xFF]
+		^ crc32_slice_table[1][(hi >> 16) & 0xFF] ^ crc32_slice_table[0][hi >> 24];
+
+		data += 8;
+		length -= 8;
+	}
+
+	//Process any remaining bytes one at a time
+	while(length--)
 	{
 		crc32 = (crc32 >> 8) ^ crc32_table[(crc32 & 0xFF) ^ (*data)];
 		data++;
@@ -1176,6 +1212,31 @@ u32 bswap(u32 input)
 	return result;
 }
 
+/****** Decides whether the next frame should be emulated without being drawn ******/
+bool skip_next_frame(u32 &skipped_frames, bool behind)
+{
+	u32 max_skip = config::frame_skip;
+
+	//Turbo always uses its own skip rate
+	if(config::turbo) { max_skip = config::turbo_frame_skip; }
+
+	//Automatic frame skip - Only skip while emulation can't keep up with real time
+	else if(config::auto_frame_skip)
+	{
+		if(!behind) { max_skip = 0; }
+		else if(!max_skip) { max_skip = 4; }
+	}
+
+	if(skipped_frames < max_skip)
+	{
+		skipped_frames++;
+		return true;
+	}
+
+	skipped_frames = 0;
+	return false;
+}
+
 /****** Builds a .WAV header for PCM-16 audio files ******/
 void build_wav_header(std::vector<u8>& header, u32 sample_rate, u32 channels, u32 data_size)
 {
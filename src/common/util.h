@@ -118,6 +118,8 @@ namespace util
 
 	u32 bswap(u32 input);
 
+	bool skip_next_frame(u32 &skipped_frames, bool behind);
+
 	SDL_Surface* load_icon(std::string filename);
 	bool save_image(SDL_Surface* src, std::string filename);
 
@@ -130,6 +132,8 @@ namespace util
 	u64 get_bps_num(std::vector<u8>& patch_data, u64& pos);
 
 	extern u32 crc32_table[256];
+	extern u32 crc32_slice_table[8][256];
+	extern bool crc32_table_ready;
 	extern u32 poly32;
 
 	extern std::string utc_day[7];
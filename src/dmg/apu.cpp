@@ -12,6 +12,7 @@
 #include <cmath>
 
 #include "apu.h"
+#include "common/profiler.h"
 
 /****** APU Constructor ******/
 DMG_APU::DMG_APU()
@@ -109,6 +110,9 @@ bool DMG_APU::init()
     	desired_spec.callback = dmg_audio_callback;
     	desired_spec.userdata = this;
 
+	//Allocate mixing buffers up front, the audio callback should never touch the heap
+	audio_mix::reserve(mix, 4, desired_spec.samples * 4);
+
     	//Open SDL audio for desired specifications
 	if(SDL_OpenAudio(&desired_spec, nullptr) < 0) 
 	{ 
@@ -584,6 +588,8 @@ void DMG_APU::generate_channel_4_samples(s16* stream, int length)
 /****** SDL Audio Callback ******/ 
 void dmg_audio_callback(void* _apu, u8 *_stream, int _length)
 {
+	profiler::scope timer(profiler::PROF_AUDIO_OUT);
+
 	s16* stream = (s16*) _stream;
 	int length = _length/2;
 	length *= 4;
@@ -591,63 +597,50 @@ void dmg_audio_callback(void* _apu, u8 *_stream, int _length)
 	//Set correct length for stereo
 	if(config::use_stereo) { length /= 2; }
 
-	std::vector<s16> channel_1_stream(length);
-	std::vector<s16> channel_2_stream(length);
-	std::vector<s16> channel_3_stream(length);
-	std::vector<s16> channel_4_stream(length);
-
 	DMG_APU* apu_link = (DMG_APU*) _apu;
-	apu_link->generate_channel_1_samples(&channel_1_stream[0], length);
-	apu_link->generate_channel_2_samples(&channel_2_stream[0], length);
-	apu_link->generate_channel_3_samples(&channel_3_stream[0], length);
-	apu_link->generate_channel_4_samples(&channel_4_stream[0], length);
+	audio_mix::mix_buffers &mix = apu_link->mix;
+	audio_mix::reserve(mix, 4, length);
 
-	double volume_ratio = apu_link->apu_stat.channel_master_volume / 128.0;
+	apu_link->generate_channel_1_samples(&mix.channel[0][0], length);
+	apu_link->generate_channel_2_samples(&mix.channel[1][0], length);
+	apu_link->generate_channel_3_samples(&mix.channel[2][0], length);
+	apu_link->generate_channel_4_samples(&mix.channel[3][0], length);
 
-	//Custom software mixing
-	for(u32 x = 0; x < length; x++)
-	{
-		//Mono audio
-		if(!config::use_stereo)
-		{
-			s32 out_sample = channel_1_stream[x] + channel_2_stream[x] + channel_3_stream[x] + channel_4_stream[x];
-			out_sample *= volume_ratio;
-			out_sample *= apu_link->apu_stat.channel_left_volume;
-			out_sample /= 4;
+	double volume_ratio = apu_link->apu_stat.channel_master_volume / 128.0;
 
-			stream[x / 4] = out_sample;
-		}
+	//Samples are generated at 4x the output rate, only every 4th one is kept
+	u32 out_length = length / 4;
 
-		//Stereo audio
-		else
-		{
-			u32 index = (x / 4) * 2;
+	//Custom software mixing - Mono audio
+	if(!config::use_stereo)
+	{
+		s32 gain = audio_mix::to_gain(volume_ratio * apu_link->apu_stat.channel_left_volume / 4.0);
 
-			//Left sample
-			s32 ch1 = apu_link->apu_stat.channel[0].so1_output ? channel_1_stream[x] : -32768;
-			s32 ch2 = apu_link->apu_stat.channel[1].so1_output ? channel_2_stream[x] : -32768;
-			s32 ch3 = apu_link->apu_stat.channel[2].so1_output ? channel_3_stream[x] : -32768;
-			s32 ch4 = apu_link->apu_stat.channel[3].so1_output ? channel_4_stream[x] : -32768;
+		audio_mix::clear(&mix.left[0], length);
+		for(u32 x = 0; x < 4; x++) { audio_mix::add(&mix.left[0], &mix.channel[x][0], gain, length); }
 
-			s32 out_sample = ch1 + ch2 + ch3 + ch4;
-			out_sample *= volume_ratio;
-			out_sample *= apu_link->apu_stat.channel_left_volume;
-			out_sample /= 4;
+		audio_mix::store_mono(stream, &mix.left[0], out_length, 4);
+	}
 
-			stream[index] = out_sample;
+	//Custom software mixing - Stereo audio
+	else
+	{
+		s32 left_gain = audio_mix::to_gain(volume_ratio * apu_link->apu_stat.channel_left_volume / 4.0);
+		s32 right_gain = audio_mix::to_gain(volume_ratio * apu_link->apu_stat.channel_right_volume / 4.0);
 
-			//Right sample
-			ch1 = apu_link->apu_stat.channel[0].so2_output ? channel_1_stream[x] : -32768;
-			ch2 = apu_link->apu_stat.channel[1].so2_output ? channel_2_stream[x] : -32768;
-			ch3 = apu_link->apu_stat.channel[2].so2_output ? channel_3_stream[x] : -32768;
-			ch4 = apu_link->apu_stat.channel[3].so2_output ? channel_4_stream[x] : -32768;
+		audio_mix::clear(&mix.left[0], length);
+		audio_mix::clear(&mix.right[0], length);
 
-			out_sample = ch1 + ch2 + ch3 + ch4;
-			out_sample *= volume_ratio;
-			out_sample *= apu_link->apu_stat.channel_right_volume;
-			out_sample /= 4;
+		//Disabled channels output silence on that side
+		for(u32 x = 0; x < 4; x++)
+		{
+			if(apu_link->apu_stat.channel[x].so1_output) { audio_mix::add(&mix.left[0], &mix.channel[x][0], left_gain, length); }
+			else { audio_mix::add_dc(&mix.left[0], -32768, left_gain, length); }
 
-			stream[index + 1] = out_sample;
+			if(apu_link->apu_stat.channel[x].so2_output) { audio_mix::add(&mix.right[0], &mix.channel[x][0], right_gain, length); }
+			else { audio_mix::add_dc(&mix.right[0], -32768, right_gain, length); }
 		}
-	} 
+
+		audio_mix::store_stereo(stream, &mix.left[0], &mix.right[0], out_length, 4);
+	}
 }
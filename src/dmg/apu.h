@@ -15,6 +15,7 @@
 #include <SDL.h>
 #include <SDL_audio.h>
 #include "mmu.h"
+#include "common/audio_mix.h"
 
 class DMG_APU
 {
@@ -27,6 +28,9 @@ class DMG_APU
 
 	SDL_AudioSpec desired_spec;
 
+	//Preallocated mixing buffers for the audio callback
+	audio_mix::mix_buffers mix;
+
 	DMG_APU();
 	~DMG_APU();
 
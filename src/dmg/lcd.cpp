@@ -13,6 +13,8 @@
 
 #include "lcd.h"
 #include "common/util.h"
+#include "common/sw_filter.h"
+#include "common/profiler.h"
 
 /****** LCD Constructor ******/
 DMG_LCD::DMG_LCD()
@@ -59,6 +61,12 @@ void DMG_LCD::reset()
 	fps_count = 0;
 	fps_time = 0;
 
+	skip_frame = false;
+	skipped_frames = 0;
+
+	screen_diff.hashes.clear();
+	screen_diff.generation = 0;
+
 	for(u32 x = 0; x < 60; x++)
 	{
 		u16 max = (config::max_fps) ? config::max_fps : 60;
@@ -196,11 +204,12 @@ bool DMG_LCD::init()
 			}
 		}
 
-		//Set up software rendering
+		//Set up software rendering - Software filters may enlarge the output
 		else
 		{
-			u32 next_w = config::sys_width;
-			u32 next_h = config::sys_height;
+			u32 filter_scale = sw_filter::get_scale();
+			u32 next_w = config::sys_width * filter_scale;
+			u32 next_h = config::sys_height * filter_scale;
 
 			if(config::flags & SDL_WINDOW_FULLSCREEN)
 			{
@@ -223,10 +232,10 @@ bool DMG_LCD::init()
 
 			window = SDL_CreateWindow("GBE+", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, next_w, next_h, config::flags);
 			SDL_GetWindowSize(window, &config::win_width, &config::win_height);
-			config::scaling_factor = 1;
+			config::scaling_factor = filter_scale;
 
 			final_screen = SDL_GetWindowSurface(window);
-			original_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, config::sys_width, config::sys_height, 32, 0, 0, 0, 0);
+			original_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, (config::sys_width * filter_scale), (config::sys_height * filter_scale), 32, 0, 0, 0, 0);
 		}
 
 		if(final_screen == nullptr) { return false; }
@@ -240,6 +249,9 @@ bool DMG_LCD::init()
 		final_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, config::sys_width, config::sys_height, 32, 0, 0, 0, 0);
 	}
 
+	//Any new window or surface starts empty, so present the next frame in full
+	frame_diff::invalidate();
+
 	std::cout<<"LCD::Initialized\n";
 
 	return true;
@@ -710,6 +722,15 @@ void DMG_LCD::render_gbc_bg_scanline()
 	}
 }
 
+/****** Latches the Window's Y position on skipped frames, as if the Window had been rendered ******/
+void DMG_LCD::update_window_lock()
+{
+	if((lcd_stat.window_enable) && (lcd_stat.current_scanline == lcd_stat.window_y) && (lcd_stat.window_x < 160))
+	{
+		lcd_stat.lock_window_y = true;
+	}
+}
+
 /****** Renders pixels for the Window (per-scanline) - DMG version ******/
 void DMG_LCD::render_dmg_win_scanline()
 {
@@ -1227,9 +1248,13 @@ void DMG_LCD::step(int cpu_clock)
 					if(lcd_stat.oam_update) { update_oam(); }
 					else { update_obj_render_list(); }
 					
-					//Render scanline when first entering Mode 0
-					if(!config::request_resize)
+					//Render scanline when first entering Mode 0 - Skipped frames only update Window state
+					if(skip_frame) { update_window_lock(); }
+
+					else if(!config::request_resize)
 					{
+						profiler::scope timer(profiler::PROF_PPU);
+
 						if(config::gb_type != SYS_GBC) { render_dmg_scanline(); }
 						else { render_gbc_scanline(); }
 					}
@@ -1322,23 +1347,28 @@ void DMG_LCD::step(int cpu_clock)
 				if(config::osd_count)
 				{
 					config::osd_count--;
-					draw_osd_msg(config::osd_message, screen_buffer, 0, 0);
+					if(!skip_frame) { draw_osd_msg(config::osd_message, screen_buffer, 0, 0); }
 				}
 
 				//Process Power Antenna
-				if(power_antenna_osd)
+				if((power_antenna_osd) && (!skip_frame))
 				{
 					u8 x_offset = (config::sys_width / 8) - 3;
 					u8 y_offset = (config::sys_height / 8) - 1;
 					draw_osd_msg(std::string("***"), screen_buffer, x_offset, y_offset);
 				}
 
+				//Display profiler overlay
+				if((profiler::enabled) && (!skip_frame)) { profiler::draw_overlay(screen_buffer); }
+
 				//Process sewing machines
 				if(mem->g_pad->con_flags & 0x800) { mem->g_pad->con_update = true; }
 
-				//Render final screen buffer
-				if(lcd_stat.lcd_enable)
+				//Render final screen buffer - Skipped frames are never presented
+				if((lcd_stat.lcd_enable) && (!skip_frame))
 				{
+					profiler::scope timer(profiler::PROF_PRESENT);
+
 					//Copy sub-screen to screen buffer
 					if(mem->sub_screen_buffer.size())
 					{
@@ -1351,14 +1381,25 @@ void DMG_LCD::step(int cpu_clock)
 					//Use SDL
 					if(config::sdl_render)
 					{
+						//Only present lines that changed since the last frame, or nothing at all if the frame is identical
+						u32 dirty_lines = frame_diff::update(screen_diff, screen_buffer.data(), config::sys_width, config::sys_height);
+
 						//If using SDL and no OpenGL, manually stretch for fullscreen via SDL
-						if((config::flags & SDL_WINDOW_FULLSCREEN) && (!config::use_opengl))
+						if((config::flags & SDL_WINDOW_FULLSCREEN) && (!config::use_opengl) && (dirty_lines))
 						{
 							//Lock source surface
 							if(SDL_MUSTLOCK(original_screen)){ SDL_LockSurface(original_screen); }
 							u32* out_pixel_data = (u32*)original_screen->pixels;
 
-							for(int a = 0; a < screen_buffer.size(); a++) { out_pixel_data[a] = screen_buffer[a]; }
+							//Apply software filters
+							if(sw_filter::is_enabled()) { sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, original_screen->pitch >> 2); }
+
+							else
+							{
+								u32 start = screen_diff.first_dirty * config::sys_width;
+								u32 end = (screen_diff.last_dirty + 1) * config::sys_width;
+								for(u32 a = start; a < end; a++) { out_pixel_data[a] = screen_buffer[a]; }
+							}
 
 							//Unlock source surface
 							if(SDL_MUSTLOCK(original_screen)){ SDL_UnlockSurface(original_screen); }
@@ -1388,24 +1429,41 @@ void DMG_LCD::step(int cpu_clock)
 						}
 
 						//Otherwise, render normally (SDL 1:1, OpenGL handles its own stretching)
-						else
+						else if(dirty_lines)
 						{
-							//Lock source surface
-							if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
-							u32* out_pixel_data = (u32*)final_screen->pixels;
-
-							for(int a = 0; a < screen_buffer.size(); a++) { out_pixel_data[a] = screen_buffer[a]; }
+							//Display final screen buffer - OpenGL, uploaded straight from the screen buffer
+							if(config::use_opengl) { gx_blit_opengl(window, screen_buffer.data()); }
 
-							//Unlock source surface
-							if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
-		
-							//Display final screen buffer - OpenGL
-							if(config::use_opengl) { gx_blit_opengl(window, final_screen); }
-				
 							//Display final screen buffer - SDL
-							else 
+							else
 							{
-								if(SDL_UpdateWindowSurface(window) != 0)
+								//Lock source surface
+								if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
+								u32* out_pixel_data = (u32*)final_screen->pixels;
+
+								//Apply software filters - Filters sample neighboring lines, so the whole frame is presented
+								SDL_Rect dirty_rect;
+								dirty_rect.x = 0;
+								dirty_rect.w = final_screen->w;
+								dirty_rect.y = 0;
+								dirty_rect.h = final_screen->h;
+
+								if(sw_filter::is_enabled()) { sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, final_screen->pitch >> 2); }
+
+								else
+								{
+									u32 start = screen_diff.first_dirty * config::sys_width;
+									u32 end = (screen_diff.last_dirty + 1) * config::sys_width;
+									for(u32 a = start; a < end; a++) { out_pixel_data[a] = screen_buffer[a]; }
+
+									dirty_rect.y = screen_diff.first_dirty;
+									dirty_rect.h = (screen_diff.last_dirty - screen_diff.first_dirty) + 1;
+								}
+
+								//Unlock source surface
+								if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
+
+								if(SDL_UpdateWindowSurfaceRects(window, &dirty_rect, 1) != 0)
 								{
 									std::cout<<"LCD::Error - Could not blit\n";
 
@@ -1448,14 +1506,25 @@ void DMG_LCD::step(int cpu_clock)
 				}
 
 				//Limit framerate
+				bool is_behind = false;
+
 				if(!config::turbo)
 				{
+					profiler::scope timer(profiler::PROF_IDLE);
+
 					frame_current_time = SDL_GetTicks();
 					int delay = frame_delay[fps_count % 60];
 					if((frame_current_time - frame_start_time) < delay) { SDL_Delay(delay - (frame_current_time - frame_start_time));}
+					else if((frame_current_time - frame_start_time) > delay) { is_behind = true; }
 					frame_start_time = SDL_GetTicks();
 				}
 
+				//Total profiler timers for this frame
+				profiler::end_frame();
+
+				//Decide whether the next frame gets drawn
+				skip_frame = util::skip_next_frame(skipped_frames, is_behind);
+
 				//Update FPS counter + title
 				fps_count++;
 				if(((SDL_GetTicks() - fps_time) >= 1000) && (config::sdl_render)) 
@@ -16,6 +16,7 @@
 #include "mmu.h"
 
 #include "common/gx_util.h"
+#include "common/frame_diff.h"
 
 class DMG_LCD
 {
@@ -92,6 +93,13 @@ class DMG_LCD
 	int fps_time;
 	int frame_delay[60];
 
+	//Frame skipping - Timing and IRQs still run, but no pixels are composed or presented
+	bool skip_frame;
+	u32 skipped_frames;
+
+	//Line hashes of the last presented frame
+	frame_diff::line_state screen_diff;
+
 	bool try_window_rebuild;
 
 	//OAM updates
@@ -102,6 +110,9 @@ class DMG_LCD
 	void update_bg_colors();
 	void update_obj_colors();
 
+	//Window state for skipped frames
+	void update_window_lock();
+
 	//Per-scanline rendering - DMG (B/W)
 	void render_dmg_scanline();
 	void render_dmg_bg_scanline();
@@ -14,6 +14,11 @@
 
 #include "mmu.h"
 #include "common/util.h"
+#include "common/rom_cache.h"
+#include "common/mem_trace.h"
+#include "common/profiler.h"
+#include "common/save_flush.h"
+#include "common/rom_archive.h"
 
 /****** MMU Constructor ******/
 DMG_MMU::DMG_MMU() 
@@ -36,7 +41,10 @@ DMG_MMU::~DMG_MMU()
 		for(u32 x = 0; x < cart.cam_buffer.size(); x++) { random_access_bank[0][0x100 + x] = 0x0; }
 	}
 
-	save_backup(config::save_file);
+	//Background saving already has a copy of everything but the final changes
+	if(save_flush::is_active()) { save_flush::stop(); }
+	else { save_backup(config::save_file); }
+
 	memory_map.clear();
 	std::cout<<"MMU::Shutdown\n"; 
 }
@@ -146,6 +154,10 @@ void DMG_MMU::reset()
 	kiss_link.is_running = false;
 	kiss_link.mode = 0;
 
+	//Cheats are compiled again on the next VBlank
+	gs_cheat_ops.clear();
+	gs_cheat_source.clear();
+
 	if(config::ir_device == IR_GB_KISS_LINK)
 	{
 		gb_kiss_link_load_file(config::external_data_file);
@@ -245,6 +257,9 @@ bool DMG_MMU::mmu_read(u32 offset, std::string filename)
 	bank_mode &= 0x1;
 	bank_bits &= 0xF;
 
+	//Save states replace battery save data
+	mark_save_dirty(0, 0x20000);
+
 	file.close();
 	return true;
 }
@@ -314,6 +329,17 @@ u8 DMG_MMU::read_u8(u16 address)
 	debug_addr = address;
 	#endif
 
+	//Memory access tracing - Perform the read first so the returned value is recorded
+	if((mem_trace::enabled) && (!mem_trace::in_read))
+	{
+		mem_trace::in_read = true;
+		u8 value = read_u8(address);
+		mem_trace::in_read = false;
+
+		mem_trace::record_access(address, value, mem_trace::TRACE_READ);
+		return value;
+	}
+
 	//Read from BIOS
 	if(in_bios)
 	{
@@ -470,10 +496,20 @@ void DMG_MMU::write_u8(u16 address, u8 value)
 	debug_addr = address;
 	#endif
 
+	//Memory access tracing
+	if(mem_trace::enabled) { mem_trace::record_access(address, value, mem_trace::TRACE_WRITE); }
+
 	if(cart.mbc_type != ROM_ONLY) 
 	{
 		mbc_write(address, value);
-		if((address >= 0xA000) && (address <= 0xBFFF)) { return; }
+
+		if((address >= 0xA000) && (address <= 0xBFFF))
+		{
+			//MBC1 in ROM banking mode and MBC2 only ever write to the first RAM bank
+			u8 bank = ((cart.mbc_type == MBC2) || ((cart.mbc_type == MBC1) && (bank_mode == 0))) ? 0 : bank_bits;
+			if(config::use_save_flush) { mark_save_dirty((bank << 13) | (address & 0x1FFF), 1); }
+			return;
+		}
 	}
 
 	//Write to VRAM, GBC uses banking
@@ -1242,6 +1278,8 @@ void DMG_MMU::write_u8(u16 address, u8 value)
 	//DMA transfer
 	else if(address == REG_DMA) 
 	{
+		profiler::scope timer(profiler::PROF_DMA);
+
 		memory_map[address] = value;
 		u16 dma_orig = value << 8;
 		u16 dma_dest = 0xFE00;
@@ -1596,6 +1634,8 @@ void DMG_MMU::mbc_write(u16 address, u8 value)
 /****** GBC General Purpose DMA ******/
 void DMG_MMU::gdma()
 {
+	profiler::scope timer(profiler::PROF_DMA);
+
 	u16 start_addr = (memory_map[REG_HDMA1] << 8) | memory_map[REG_HDMA2];
 	u16 dest_addr = (memory_map[REG_HDMA3] << 8) | memory_map[REG_HDMA4];
 
@@ -1630,6 +1670,8 @@ void DMG_MMU::hdma()
 {
 	if(lcd_stat->hdma_line) { return; }
 
+	profiler::scope timer(profiler::PROF_DMA);
+
 	u16 start_addr = (memory_map[REG_HDMA1] << 8) | memory_map[REG_HDMA2];
 	u16 dest_addr = (memory_map[REG_HDMA3] << 8) | memory_map[REG_HDMA4];
 	u8 line_transfer_count = (memory_map[REG_HDMA5] & 0x7F);
@@ -1696,16 +1738,30 @@ bool DMG_MMU::read_file(std::string filename)
 
 	//Read ROM file into temporary buffer
 	std::vector <u8> rom_file;
-	rom_file.resize(file_size, 0x0);
+	u8* ex_mem = nullptr;
+
+	//Decompress entire ROM file
+	if(rom_archive::is_archive(filename))
+	{
+		if(!rom_archive::extract(filename, rom_file, 0x2000000)) { return false; }
+
+		file_size = rom_file.size();
+		if(!file_size) { return util::report_error(filename, util::FILE_SIZE_ZERO); }
+	}
 
 	//Read entire ROM file
-	u8* ex_mem = &rom_file[0];
-	file.read((char*)ex_mem, file_size);
+	else
+	{
+		rom_file.resize(file_size, 0x0);
+
+		ex_mem = &rom_file[0];
+		file.read((char*)ex_mem, file_size);
+	}
 
 	//Apply patches to the ROM data
 	if(config::use_patches)
 	{
-		std::string patch_file = util::get_filename_no_ext(filename);
+		std::string patch_file = rom_archive::get_patch_filename(filename);
 
 		//Attempt a IPS patch
 		bool patch_pass = util::patch_ips((patch_file + ".ips"), rom_file, 0x00, file_size);
@@ -1724,7 +1780,7 @@ bool DMG_MMU::read_file(std::string filename)
 	}
 
 	//Grab CRC32
-	u32 crc32 = util::get_crc32(&rom_file[0], file_size);
+	u32 crc32 = rom_cache::get_crc32(filename, &rom_file[0], file_size);
 
 	//Skip these steps entirely for the GB Memory Cartridge when loading a game from flash
 	if(cart.flash_stat != 0x40)
@@ -2588,6 +2644,65 @@ bool DMG_MMU::save_backup(std::string filename)
 	return true;
 }
 
+/****** Marks part of the battery save as changed so it is written in the background ******/
+void DMG_MMU::mark_save_dirty(u32 offset, u32 length)
+{
+	if(!config::use_save_flush) { return; }
+
+	//Only plain cart RAM is handled in the background
+	//RTC data, EEPROMs, MBC6 Flash, GB Camera pics, and GB Memory Cartridges are still written on exit
+	if((!cart.battery) || (cart.rtc) || (config::cart_type == DMG_GBMEM)) { return; }
+
+	switch(cart.mbc_type)
+	{
+		case ROM_ONLY:
+		case MBC6:
+		case MBC7:
+		case HUC3:
+		case GB_CAMERA:
+		case TAMA5:
+			return;
+
+		default: break;
+	}
+
+	u32 size = 0;
+
+	//Match the size save_backup() would write
+	if(config::use_legacy_save_size) { size = 0x20000; }
+	else if(cart.mbc_type == MBC2) { size = 0x200; }
+
+	else
+	{
+		switch(memory_map[ROM_RAMSIZE])
+		{
+			case 0x02: size = 0x2000; break;
+			case 0x03: size = 0x8000; break;
+			case 0x04: size = 0x20000; break;
+			case 0x05: size = 0x10000; break;
+		}
+	}
+
+	if(!size) { return; }
+
+	if(save_flush::get_size() != size)
+	{
+		save_flush::start(config::save_file, size, [this](u32 src, u8* dst, u32 len) { read_save_data(src, dst, len); });
+	}
+
+	save_flush::mark_dirty(offset, length);
+}
+
+/****** Copies battery save data into a buffer ******/
+void DMG_MMU::read_save_data(u32 offset, u8* dst, u32 length)
+{
+	for(u32 x = 0; x < length; x++)
+	{
+		u32 addr = offset + x;
+		dst[x] = random_access_bank[(addr >> 13) & 0xF][addr & 0x1FFF];
+	}
+}
+
 /****** Remaps GB Memory Cartridge and loads ROM stored in flash ******/
 void DMG_MMU::gb_mem_remap()
 {
@@ -2743,31 +2858,76 @@ void DMG_MMU::gb_mem_format_save(std::string filename)
 /****** Writes values to RAM as specified by the Gameshark code - Called by LCD during VBlank ******/
 void DMG_MMU::set_gs_cheats()
 {
+	if(gs_cheat_source != config::gs_cheats) { compile_gs_cheats(); }
+
+	u32 count = gs_cheat_ops.size();
+
+	for(u32 x = 0; x < count; x++)
+	{
+		const gs_cheat_op &op = gs_cheat_ops[x];
+
+		//GBC WRAM with an explicit bank - Temporarily switch to the cheat's WRAM bank
+		if(op.wram_bank)
+		{
+			u8 current_wram_bank = wram_bank;
+			wram_bank = op.wram_bank;
+
+			write_u8(op.addr, op.value);
+			wram_bank = current_wram_bank;
+		}
+
+		//WRAM goes through normal writes, so GBC banking and DMG echo RAM stay in sync
+		else if(op.addr >= 0xC000) { write_u8(op.addr, op.value); }
+
+		//Cart RAM goes through the MBC using the cheat's RAM bank
+		else
+		{
+			u8 current_ram_bank = bank_bits;
+			bank_bits = op.ram_bank;
+
+			write_u8(op.addr, op.value);
+			bank_bits = current_ram_bank;
+		}
+	}
+}
+
+/****** Parses the 32-bit Gameshark format into a list of writes ******/
+void DMG_MMU::compile_gs_cheats()
+{
+	gs_cheat_source = config::gs_cheats;
+	gs_cheat_ops.clear();
+
 	//Cycle through all listed cheats, parse the 32-bit cheat format
-	for(int x = 0; x < config::gs_cheats.size(); x++)
+	for(u32 x = 0; x < gs_cheat_source.size(); x++)
 	{
 		//Grab and verify memory address (Bytes 0 and 1 in that order)
-		u16 dest_addr = (config::gs_cheats[x] & 0xFF) << 8;
-		dest_addr |= ((config::gs_cheats[x] & 0xFF00) >> 8);
+		u16 dest_addr = (gs_cheat_source[x] & 0xFF) << 8;
+		dest_addr |= ((gs_cheat_source[x] & 0xFF00) >> 8);
 
 		if((dest_addr >= 0xA000) && (dest_addr <= 0xDFFF))
 		{
+			gs_cheat_op op;
+			op.addr = dest_addr;
+
 			//Grab byte from cheat code format (Byte 2)
-			u8 dest_byte = (config::gs_cheats[x] >> 16) & 0xFF;
+			op.value = (gs_cheat_source[x] >> 16) & 0xFF;
 
 			//Grab RAM bank number to write byte into (Byte 3)
-			u8 dest_ram_bank = (config::gs_cheats[x] >> 24);
+			op.ram_bank = (gs_cheat_source[x] >> 24);
+			op.wram_bank = 0;
 
-			//Make sure RAM bank does not exceed certain MBC's maximum number of allowable banks
-			if((cart.mbc_type == MBC1) || (cart.mbc_type == MBC3)) { dest_ram_bank &= 0x3; }
-			else if(cart.mbc_type == MBC5) { dest_ram_bank &= 0xF; }
+			//GBC WRAM codes 0x90 - 0x97 write to WRAM Banks 1-7 at 0xD000 - 0xDFFF, Bank 0 maps to Bank 1 like SVBK
+			if((config::gb_type == SYS_GBC) && (dest_addr >= 0xD000) && ((op.ram_bank & 0xF8) == 0x90))
+			{
+				op.wram_bank = (op.ram_bank & 0x7);
+				if(op.wram_bank == 0) { op.wram_bank = 1; }
+			}
 
-			//Write value into RAM
-			u8 current_ram_bank = bank_bits;
-			bank_bits = dest_ram_bank;
+			//Make sure RAM bank does not exceed certain MBC's maximum number of allowable banks
+			if((cart.mbc_type == MBC1) || (cart.mbc_type == MBC3)) { op.ram_bank &= 0x3; }
+			else if(cart.mbc_type == MBC5) { op.ram_bank &= 0xF; }
 
-			write_u8(dest_addr, dest_byte);
-			bank_bits = current_ram_bank;
+			gs_cheat_ops.push_back(op);
 		}
 	}
 }
@@ -196,6 +196,18 @@ class DMG_MMU
 		u8 gbf_flags;
 	} kiss_link;
 
+	//Gameshark cheats decoded once, re-decoded only when the cheat list changes
+	struct gs_cheat_op
+	{
+		u16 addr;
+		u8 value;
+		u8 ram_bank;
+		u8 wram_bank;
+	};
+
+	std::vector<gs_cheat_op> gs_cheat_ops;
+	std::vector<u32> gs_cheat_source;
+
 	bool div_reset;
 
 	dmg_core_pad* g_pad;
@@ -233,6 +245,8 @@ class DMG_MMU
 	bool read_bios(std::string filename);
 	bool save_backup(std::string filename);
 	bool load_backup(std::string filename);
+	void mark_save_dirty(u32 offset, u32 length);
+	void read_save_data(u32 offset, u8* dst, u32 length);
 
 	//Memory Bank Controller dedicated read/write operations
 	void mbc_write(u16 address, u8 value);
@@ -304,6 +318,7 @@ class DMG_MMU
 	void gb_kiss_link_reset(bool reset_gbf);
 
 	void set_gs_cheats();
+	void compile_gs_cheats();
 	void set_gg_cheats();
 
 	void set_lcd_data(dmg_lcd_data* ex_lcd_stat);
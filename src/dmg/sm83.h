@@ -7,6 +7,8 @@
 // Description : Game Boy SM83 CPU emulator
 //
 // Emulates the GB CPU in software
+// The same CPU is used by the DMG/GBC and SGB cores. It is templated on the video controller
+// and the system variant so that SGB-specific checks are resolved at compile time
 
 #ifndef GB_CPU
 #define GB_CPU
@@ -20,7 +22,8 @@
 #include "apu.h"
 #include "sio.h"
 
-class SM83
+template <class VIDEO, u8 sys_type>
+class SM83_core
 {
 	public:
 	
@@ -102,17 +105,20 @@ class SM83
 	bool double_speed;
 	bool skip_instruction;
 
+	//SGB type - 0 = SGB1, 1 = SGB2. Unused by the DMG/GBC core
+	u8 sgb_type;
+
 	//Audio-Video and other controllers
 	struct io_controllers
 	{
-		DMG_LCD video;
+		VIDEO video;
 		DMG_APU audio;
 		DMG_SIO serial_io;
 	} controllers;
 
 	//Core Functions
-	SM83();
-	~SM83();
+	SM83_core();
+	~SM83_core();
 	void reset();
 	void reset_bios();
 	void exec_op(u8 opcode);
@@ -161,4 +167,7 @@ class SM83
 	inline u8 daa();
 };
 
+//DMG/GBC variant of the CPU
+typedef SM83_core<DMG_LCD, SYS_DMG> SM83;
+
 #endif // GB_CPU
@@ -12,6 +12,7 @@
 #include <cmath>
 
 #include "apu.h"
+#include "common/profiler.h"
 
 /****** APU Constructor ******/
 AGB_APU::AGB_APU()
@@ -177,6 +178,9 @@ bool AGB_APU::init()
     	desired_spec.callback = agb_audio_callback;
     	desired_spec.userdata = this;
 
+	//Allocate mixing buffers up front, the audio callback should never touch the heap
+	audio_mix::reserve(mix, 7, desired_spec.samples);
+
     	//Open SDL audio for desired specifications
 	if(SDL_OpenAudio(&desired_spec, nullptr) < 0) 
 	{ 
@@ -636,29 +640,27 @@ void AGB_APU::generate_campho_audio_samples(s16* stream, int length)
 /****** SDL Audio Callback ******/ 
 void agb_audio_callback(void* _apu, u8 *_stream, int _length)
 {
+	profiler::scope timer(profiler::PROF_AUDIO_OUT);
+
 	s16* stream = (s16*) _stream;
 	int length = _length/2;
 
 	//Set correct length for stereo
 	if(config::use_stereo) { length /= 2; }
 
-	std::vector<s16> channel_1_stream(length);
-	std::vector<s16> channel_2_stream(length);
-	std::vector<s16> channel_3_stream(length);
-	std::vector<s16> channel_4_stream(length);
-
-	std::vector<s16> dma_a_stream(length);
-	std::vector<s16> dma_b_stream(length);
+	AGB_APU* apu_link = (AGB_APU*) _apu;
+	audio_mix::mix_buffers &mix = apu_link->mix;
+	audio_mix::reserve(mix, 7, length);
 
-	std::vector<s16> ext_stream(length);
+	s16* channel_stream[6] = { &mix.channel[0][0], &mix.channel[1][0], &mix.channel[2][0], &mix.channel[3][0], &mix.channel[4][0], &mix.channel[5][0] };
+	s16* ext_stream = &mix.channel[6][0];
 
-	AGB_APU* apu_link = (AGB_APU*) _apu;
-	apu_link->generate_channel_1_samples(&channel_1_stream[0], length);
-	apu_link->generate_channel_2_samples(&channel_2_stream[0], length);
-	apu_link->generate_channel_3_samples(&channel_3_stream[0], length);
-	apu_link->generate_channel_4_samples(&channel_4_stream[0], length);
-	apu_link->generate_dma_a_samples(&dma_a_stream[0], length);
-	apu_link->generate_dma_b_samples(&dma_b_stream[0], length);
+	apu_link->generate_channel_1_samples(channel_stream[0], length);
+	apu_link->generate_channel_2_samples(channel_stream[1], length);
+	apu_link->generate_channel_3_samples(channel_stream[2], length);
+	apu_link->generate_channel_4_samples(channel_stream[3], length);
+	apu_link->generate_dma_a_samples(channel_stream[4], length);
+	apu_link->generate_dma_b_samples(channel_stream[5], length);
 
 	double channel_ratio = apu_link->apu_stat.channel_master_volume / 128.0;
 	double dma_a_ratio = apu_link->apu_stat.dma[0].master_volume / 128.0;
@@ -667,57 +669,55 @@ void agb_audio_callback(void* _apu, u8 *_stream, int _length)
 	double ext_ratio = (apu_link->apu_stat.ext_audio.volume & 0x3F) / 63.0;
 	double emu_volume = config::volume / 128.0;
 
-	//Custom software mixing
-	for(u32 x = 0; x < length; x++)
+	//Divide final wave by total amount of channels
+	s32 dma_a_gain = audio_mix::to_gain(dma_a_ratio / 6.0);
+	s32 dma_b_gain = audio_mix::to_gain(dma_b_ratio / 6.0);
+
+	//Custom software mixing - Mono audio
+	if(!config::use_stereo)
 	{
-		//Mono audio
-		if(!config::use_stereo)
-		{
-			//Add Sound Channels 1-4 and multiply by volume ratio
-			s32 out_sample = (channel_1_stream[x] + channel_2_stream[x] + channel_3_stream[x] + channel_4_stream[x]) * channel_ratio;
+		s32 channel_gain = audio_mix::to_gain(channel_ratio / 6.0);
 
-			//Add DMA Channels A and B and multiply by volume ratio
-			out_sample += (dma_a_stream[x] * dma_a_ratio) + (dma_b_stream[x] * dma_b_ratio);
+		//Add Sound Channels 1-4 and DMA Channels A and B, each multiplied by their volume ratio
+		audio_mix::clear(&mix.left[0], length);
+		for(u32 x = 0; x < 4; x++) { audio_mix::add(&mix.left[0], channel_stream[x], channel_gain, length); }
+		audio_mix::add(&mix.left[0], channel_stream[4], dma_a_gain, length);
+		audio_mix::add(&mix.left[0], channel_stream[5], dma_b_gain, length);
 
-			//Divide final wave by total amount of channels
-			out_sample /= 6;
+		audio_mix::store_mono(stream, &mix.left[0], length);
+	}
 
-			stream[x] = out_sample;
+	//Custom software mixing - Stereo audio
+	else
+	{
+		s32 left_gain = audio_mix::to_gain(channel_ratio * apu_link->apu_stat.channel_left_volume / 6.0);
+		s32 right_gain = audio_mix::to_gain(channel_ratio * apu_link->apu_stat.channel_right_volume / 6.0);
+
+		audio_mix::clear(&mix.left[0], length);
+		audio_mix::clear(&mix.right[0], length);
+
+		//Disabled channels output silence on that side
+		for(u32 x = 0; x < 4; x++)
+		{
+			if(apu_link->apu_stat.channel[x].left_enable) { audio_mix::add(&mix.left[0], channel_stream[x], left_gain, length); }
+			else { audio_mix::add_dc(&mix.left[0], -32768, left_gain, length); }
+
+			if(apu_link->apu_stat.channel[x].right_enable) { audio_mix::add(&mix.right[0], channel_stream[x], right_gain, length); }
+			else { audio_mix::add_dc(&mix.right[0], -32768, right_gain, length); }
 		}
 
-		//Stereo audio
-		else
+		for(u32 x = 0; x < 2; x++)
 		{
-			u32 index = (x * 2);
-
-			//Left sample
-			s32 ch1 = apu_link->apu_stat.channel[0].left_enable ? channel_1_stream[x] : -32768;
-			s32 ch2 = apu_link->apu_stat.channel[1].left_enable ? channel_2_stream[x] : -32768;
-			s32 ch3 = apu_link->apu_stat.channel[2].left_enable ? channel_3_stream[x] : -32768;
-			s32 ch4 = apu_link->apu_stat.channel[3].left_enable ? channel_4_stream[x] : -32768;
-			s32 ch5 = apu_link->apu_stat.dma[0].left_enable ? dma_a_stream[x] : -32768;
-			s32 ch6 = apu_link->apu_stat.dma[1].left_enable ? dma_b_stream[x] : -32768;
-
-			s32 out_sample = (ch1 + ch2 + ch3 + ch4) * channel_ratio * apu_link->apu_stat.channel_left_volume;
-			out_sample += (ch5 * dma_a_ratio) + (ch6 * dma_b_ratio);
-			out_sample /= 6;
-
-			stream[index] = out_sample;
-
-			//Right sample
-			ch1 = apu_link->apu_stat.channel[0].right_enable ? channel_1_stream[x] : -32768;
-			ch2 = apu_link->apu_stat.channel[1].right_enable ? channel_2_stream[x] : -32768;
-			ch3 = apu_link->apu_stat.channel[2].right_enable ? channel_3_stream[x] : -32768;
-			ch4 = apu_link->apu_stat.channel[3].right_enable ? channel_4_stream[x] : -32768;
-			ch5 = apu_link->apu_stat.dma[0].right_enable ? dma_a_stream[x] : -32768;
-			ch6 = apu_link->apu_stat.dma[1].right_enable ? dma_b_stream[x] : -32768;
-
-			out_sample = (ch1 + ch2 + ch3 + ch4) * channel_ratio * apu_link->apu_stat.channel_right_volume;
-			out_sample += (ch5 * dma_a_ratio) + (ch6 * dma_b_ratio);
-			out_sample /= 6;
-
-			stream[index + 1] = out_sample;
+			s32 dma_gain = (x == 0) ? dma_a_gain : dma_b_gain;
+
+			if(apu_link->apu_stat.dma[x].left_enable) { audio_mix::add(&mix.left[0], channel_stream[4 + x], dma_gain, length); }
+			else { audio_mix::add_dc(&mix.left[0], -32768, dma_gain, length); }
+
+			if(apu_link->apu_stat.dma[x].right_enable) { audio_mix::add(&mix.right[0], channel_stream[4 + x], dma_gain, length); }
+			else { audio_mix::add_dc(&mix.right[0], -32768, dma_gain, length); }
 		}
+
+		audio_mix::store_stereo(stream, &mix.left[0], &mix.right[0], length);
 	}
 
 	//Mix in external audio if necessary
@@ -726,7 +726,7 @@ void agb_audio_callback(void* _apu, u8 *_stream, int _length)
 		//Generate raw samples (high quality)
 		if((apu_link->apu_stat.ext_audio.use_headphones) || (config::cart_type == AGB_CAMPHO) || (config::cart_type == AGB_TV_TUNER))
 		{
-			apu_link->generate_ext_audio_hi_samples(&ext_stream[0], length);
+			apu_link->generate_ext_audio_hi_samples(ext_stream, length);
 		}
 
 		//Generate GBA samples (low quality)
@@ -735,30 +735,21 @@ void agb_audio_callback(void* _apu, u8 *_stream, int _length)
 			//TODO
 		}
 
-		//Custom software mixing
-		for(u32 x = 0; x < length; x++)
-		{
-			//Mono audio
-			if(!config::use_stereo)
-			{	
-				s32 out_sample = stream[x] + (ext_stream[x] * ext_ratio * emu_volume);
-			
-				//Divide final wave by total amount of channels
-				out_sample /= 2;
+		s32 ext_gain = audio_mix::to_gain(ext_ratio * emu_volume);
 
-				stream[x] = out_sample;
-			}
+		//Stereo audio - Mono for the time being, duplicated over L/R channels
+		u32 total_samples = (config::use_stereo) ? (length * 2) : length;
+		u8 ext_shift = (config::use_stereo) ? 1 : 0;
 
-			//Stereo audio - Mono for the time being, duplicated over L/R channels
-			else
-			{
-				s32 out_sample = stream[x] + (ext_stream[x >> 1] * ext_ratio * emu_volume);
+		//Custom software mixing
+		for(u32 x = 0; x < total_samples; x++)
+		{
+			s32 out_sample = stream[x] + ((ext_stream[x >> ext_shift] * ext_gain) >> audio_mix::GAIN_SHIFT);
 			
-				//Divide final wave by total amount of channels
-				out_sample /= 2;
+			//Divide final wave by total amount of channels
+			out_sample /= 2;
 
-				stream[x] = out_sample;
-			}
+			stream[x] = out_sample;
 		}
 	}
 }
@@ -956,6 +947,8 @@ void agb_microphone_callback(void* _apu, u8 *_stream, int _length)
 /****** Fill PSG channels with audio data when buffering ******/
 void AGB_APU::buffer_channels()
 {
+	profiler::scope timer(profiler::PROF_APU);
+
 	buffer_channel_1();
 	buffer_channel_2();
 	buffer_channel_3();
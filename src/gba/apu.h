@@ -15,6 +15,7 @@
 #include <SDL.h>
 #include <SDL_audio.h>
 #include "mmu.h"
+#include "common/audio_mix.h"
 
 class AGB_APU
 {
@@ -31,6 +32,9 @@ class AGB_APU
 	//Recording buffer for microphone input
 	std::vector<s16> mic_buffer;
 
+	//Preallocated mixing buffers for the audio callback
+	audio_mix::mix_buffers mix;
+
 	AGB_APU();
 	~AGB_APU();
 
@@ -251,6 +251,8 @@ class ARM7
 	void handle_interrupt();
 
 	//DMA functions
+	void dma_transfer(u8 index);
+	bool dma_block_transfer(u8 index, u8 unit_size);
 	void dma0();
 	void dma1();
 	void dma2();
@@ -8,6 +8,7 @@
 //
 // Decrypts GSAv1 codes
 // Writes to ROM or RAM as needed by each cheat
+// Codes are compiled once into a flat list of operations that runs every VBlank
 
 #include "mmu.h"
 
@@ -37,83 +38,118 @@ void AGB_MMU::decrypt_gsa(u32 &addr, u32 &val, bool v1)
 	}
 }
 
-/****** Applies cheats when running emulation core ******/
+/****** Applies cheats when running emulation core - Called by LCD during VBlank ******/
 void AGB_MMU::set_cheats()
 {
-	for(u32 x = 0; x < cheat_bytes.size(); x += 2)
+	u32 count = cheat_ops.size();
+
+	for(u32 x = 0; x < count; x++)
 	{
-		//Grab two 32-bit values for GSA cheat
-		u32 addr = cheat_bytes[x];
-		u32 val = cheat_bytes[x + 1];
+		const gsa_cheat_op &op = cheat_ops[x];
+
+		switch(op.type)
+		{
+			//Plain WRAM is written directly
+			case GSA_RAM_WRITE_8:
+				memory_map[op.addr] = op.value;
+				break;
+
+			case GSA_RAM_WRITE_16:
+				memory_map[op.addr] = (op.value & 0xFF);
+				memory_map[op.addr + 1] = (op.value >> 8);
+				break;
+
+			case GSA_RAM_WRITE_32:
+				memory_map[op.addr] = (op.value & 0xFF);
+				memory_map[op.addr + 1] = ((op.value >> 8) & 0xFF);
+				memory_map[op.addr + 2] = ((op.value >> 16) & 0xFF);
+				memory_map[op.addr + 3] = (op.value >> 24);
+				break;
+
+			//Everything else goes through the normal handlers
+			case GSA_WRITE_8: write_u8(op.addr, op.value); break;
+			case GSA_WRITE_16: write_u16(op.addr, op.value); break;
+			case GSA_WRITE_32: write_u32(op.addr, op.value); break;
+
+			//Skip the operations belonging to the next code if the condition fails
+			case GSA_IF_EQUAL_16:
+				if(read_u16(op.addr) != op.value) { x += op.skip_count; }
+				break;
+		}
+	}
+}
 
-		//Ignore Master Enable
-		if((val & 0xFFFFFF) == 0x1DC0DE) { addr = 0xFFFFFFFF; } 
+/****** Converts decrypted GSA codes into a list of operations ******/
+void AGB_MMU::compile_cheats()
+{
+	cheat_ops.clear();
+	gsa_patch_count = 0;
 
-		process_cheats(addr, val, x);
-	}
+	u32 index = 0;
+
+	while(index < cheat_bytes.size()) { compile_cheat(index); }
 }
 
-/****** Processes specific cheat code ******/
-void AGB_MMU::process_cheats(u32 a, u32 v, u32& index)
+/****** Compiles a single GSA code, returns the number of operations added ******/
+u32 AGB_MMU::compile_cheat(u32& index)
 {
-	u16 c = 0;
+	u32 a = cheat_bytes[index];
+	u32 v = cheat_bytes[index + 1];
+	u32 start_count = cheat_ops.size();
+
+	index += 2;
+
+	//Ignore Master Enable
+	if((v & 0xFFFFFF) == 0x1DC0DE) { return 0; }
 
 	//GSA cheat commands
 	switch(a >> 28)
 	{
 		//8-bit RAM Write
 		case 0x0:
-			a &= 0xFFFFFFF;
-			v &= 0xFF;
-			write_u8(a, v);
-
+			add_cheat_write((a & 0xFFFFFFF), (v & 0xFF), 1);
 			break;
 
 		//16-bit RAM
 		case 0x1:
-			a &= 0xFFFFFFF;
-			v &= 0xFFFF;
-			write_u16(a, v);
-
+			add_cheat_write((a & 0xFFFFFFF), (v & 0xFFFF), 2);
 			break;
 
 		//32-bit RAM
 		case 0x2:
-			a &= 0xFFFFFFF;
-			write_u32(a, v);
-
+			add_cheat_write((a & 0xFFFFFFF), v, 4);
 			break;
 
-		//Write to list
+		//Write to list - Following codes hold pairs of addresses, ending with a zero address
 		case 0x3:
-			c = (a & 0xFFFF) - 1;
+			while((v != 0) && ((index + 2) <= cheat_bytes.size()))
+			{
+				u32 addr_1 = cheat_bytes[index];
+				u32 addr_2 = cheat_bytes[index + 1];
+				index += 2;
 
-			while(v != 0)
-			{			
-				if((index + 2) <= cheat_bytes.size())
-				{
-					index += 2;
-						
-					write_u32(cheat_bytes[index], v);
-					if(cheat_bytes[index + 1]) { write_u32(cheat_bytes[index + 1], v); }
-					else { v = 0; }
-				}
+				if(addr_1) { add_cheat_write(addr_1, v, 4); }
 
-				else { v = 0; }
+				if(addr_2) { add_cheat_write(addr_2, v, 4); }
+				else { break; }
 			}
 
 			break;
 
-		//ROM Patch
+		//ROM Patch - Applied directly to ROM
 		case 0x6:
 			if(gsa_patch_count < 1)
 			{
 				a &= 0xFFFFFF;
 				a <<= 1;
 				a += 0x8000000;
-				v &= 0xFFFF;
-					
-				write_u16(a, v);
+
+				if((a + 1) < memory_map.size())
+				{
+					memory_map[a] = (v & 0xFF);
+					memory_map[a + 1] = ((v >> 8) & 0xFF);
+				}
+
 				gsa_patch_count++;
 			}
 
@@ -122,18 +158,19 @@ void AGB_MMU::process_cheats(u32 a, u32 v, u32& index)
 		//IF-THEN
 		//Change Seeds
 		case 0xD:
-			if(a == 0xDEADFACE) { }
-
-			else
+			if((a != 0xDEADFACE) && (index < cheat_bytes.size()))
 			{
-				if((read_u16(a & 0xFFFFFFF) == (v & 0xFFFF)) && ((index + 2) <= cheat_bytes.size()))
-				{
-					index += 2;
-					a = cheat_bytes[index];
-					v = cheat_bytes[index + 1];
+				gsa_cheat_op op;
+				op.type = GSA_IF_EQUAL_16;
+				op.addr = (a & 0xFFFFFFF);
+				op.value = (v & 0xFFFF);
+				op.skip_count = 0;
 
-					process_cheats(a, v, index);
-				}
+				u32 if_pos = cheat_ops.size();
+				cheat_ops.push_back(op);
+
+				//The next code only runs if the condition is met
+				cheat_ops[if_pos].skip_count = compile_cheat(index);
 			}
 
 			break;
@@ -143,6 +180,36 @@ void AGB_MMU::process_cheats(u32 a, u32 v, u32& index)
 			break;
 
 		default:
-				std::cout<<"MMU::Unhandled GSA command -> 0x" << a << "\n";
+			std::cout<<"MMU::Unhandled GSA command -> 0x" << std::hex << a << "\n";
 	}
+
+	return cheat_ops.size() - start_count;
+}
+
+/****** Adds a cheat write, resolving plain WRAM addresses and mirrors ahead of time ******/
+void AGB_MMU::add_cheat_write(u32 addr, u32 value, u8 size)
+{
+	gsa_cheat_op op;
+	op.addr = addr;
+	op.value = value;
+	op.skip_count = 0;
+
+	u32 ram_addr = 0;
+
+	if((addr >> 24) == 0x2) { ram_addr = (addr & 0x203FFFF); }
+	else if((addr >> 24) == 0x3) { ram_addr = (addr & 0x3007FFF); }
+
+	//Direct writes are only used when the whole value fits in WRAM without wrapping around a mirror
+	if((ram_addr) && (get_dma_block(ram_addr, size, true) != nullptr))
+	{
+		op.addr = ram_addr;
+		op.type = (size == 1) ? GSA_RAM_WRITE_8 : ((size == 2) ? GSA_RAM_WRITE_16 : GSA_RAM_WRITE_32);
+	}
+
+	else
+	{
+		op.type = (size == 1) ? GSA_WRITE_8 : ((size == 2) ? GSA_WRITE_16 : GSA_WRITE_32);
+	}
+
+	cheat_ops.push_back(op);
 }
@@ -15,6 +15,10 @@
 #include <sstream>
 
 #include "common/util.h"
+#include "common/sw_filter.h"
+#include "common/mem_trace.h"
+#include "common/profiler.h"
+#include "common/save_flush.h"
 
 #include "core.h"
 
@@ -362,6 +366,9 @@ void AGB_core::run_core()
 	//Begin running the core
 	while(running)
 	{
+		//Write battery saves in the background once games stop writing to them
+		if((save_flush::pending) && (core_cpu.controllers.video.current_scanline == 160)) { save_flush::update(); }
+
 		//Handle SDL Events
 		if((core_cpu.controllers.video.current_scanline == 160) && SDL_PollEvent(&event))
 		{
@@ -384,6 +391,9 @@ void AGB_core::run_core()
 			//Hotplug joypad
 			else if((event.type == SDL_JOYDEVICEADDED) && (!core_pad.joy_init)) { core_pad.init(); }
 			else if((event.type == SDL_JOYDEVICEREMOVED) && (core_pad.joy_init)) { core_pad.close_joystick(); }
+
+			//Window resized, exposed, or restored - Its contents must be presented again
+			else if(event.type == SDL_WINDOWEVENT) { frame_diff::invalidate(); }
 		}
 
 		//Run the CPU
@@ -392,6 +402,8 @@ void AGB_core::run_core()
 			//Receive byte from another instance of GBE+ via netplay - Manage sync
 			if(core_cpu.controllers.serial_io.sio_stat.connected)
 			{
+				profiler::scope timer(profiler::PROF_SIO);
+
 				//Perform syncing operations when hard sync is enabled
 				if(core_cpu.controllers.serial_io.sio_stat.use_hard_sync) { hard_sync(); }
 
@@ -415,7 +427,11 @@ void AGB_core::run_core()
 			}
 
 			//Otherwise, try to run any emulate SIO devices attached to GBE+
-			else if(core_cpu.controllers.serial_io.sio_stat.emu_device_ready) { core_cpu.clock_emulated_sio_device(); }
+			else if(core_cpu.controllers.serial_io.sio_stat.emu_device_ready)
+			{
+				profiler::scope timer(profiler::PROF_SIO);
+				core_cpu.clock_emulated_sio_device();
+			}
 
 			//Check if a block transfer for an AM3 card is still pending
 			else if(core_mmu.am3.transfer_delay)
@@ -612,8 +628,10 @@ void AGB_core::handle_hotkey(SDL_Event& event)
 	//Toggle Fullscreen on F12
 	else if((event.type == SDL_KEYUP) && (event.key.keysym.sym == SDLK_F12))
 	{
-		u32 next_w = config::sys_width;
-		u32 next_h = config::sys_height;
+		//Windowed mode must match the software filter's output size
+		u32 filter_scale = (config::use_opengl) ? 1 : sw_filter::get_scale();
+		u32 next_w = config::sys_width * filter_scale;
+		u32 next_h = config::sys_height * filter_scale;
 
 		//Unset fullscreen
 		if(config::flags & SDL_WINDOW_FULLSCREEN)
@@ -707,6 +725,12 @@ void AGB_core::handle_hotkey(SDL_Event& event)
 		if((config::sdl_render) && (config::use_opengl)) { SDL_GL_SetSwapInterval(1); }
 	}
 		
+	//Start or stop memory access tracing on F10
+	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F10)) { mem_trace::toggle(); }
+
+	//Start or stop frame profiling on F11
+	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F11)) { profiler::toggle(); }
+
 	//Reset emulation on F8
 	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F8)) { reset(); }
 
@@ -739,6 +763,12 @@ void AGB_core::handle_hotkey(int input, bool pressed)
 	//Toggle turbo off
 	else if((input == config::hotkey_turbo) && (!pressed)) { config::turbo = false; }
 
+	//Start or stop memory access tracing on F10
+	else if((input == SDLK_F10) && (pressed)) { mem_trace::toggle(); }
+
+	//Start or stop frame profiling on F11
+	else if((input == SDLK_F11) && (pressed)) { profiler::toggle(); }
+
 	//Initiate various communication functions
 	//Soul Doll Adapter - Reset Soul Doll
 	else if((input == SDLK_F3) && (pressed))
@@ -9,10 +9,133 @@
 // Emulates the GBA's 4 DMA channels
 // Transfers memory to different locations
 
+#include <cstring>
+
 #include "arm7.h" 
+#include "common/mem_trace.h"
+#include "common/profiler.h"
 
 //TODO - HDMAs basically act like immediate DMAs during HBlank. In reality, if they are take longer than the HBlank period they should stop, then resume from the last position.
 
+/****** Transfers a block of 16-bit or 32-bit units for a DMA channel ******/
+void ARM7::dma_transfer(u8 index)
+{
+	profiler::scope timer(profiler::PROF_DMA);
+
+	u32 temp_value = 0;
+
+	//16-bit transfer
+	if(mem->dma[index].word_type == 0)
+	{
+		//Align addresses to half-word
+		mem->dma[index].start_address &= ~0x1;
+		mem->dma[index].destination_address &= ~0x1;
+
+		if(dma_block_transfer(index, 2)) { return; }
+
+		while(mem->dma[index].word_count != 0)
+		{
+			temp_value = mem->read_u16(mem->dma[index].start_address);
+			mem->write_u16(mem->dma[index].destination_address, temp_value);
+
+			//Update DMA Start Address
+			if(mem->dma[index].src_addr_ctrl == 0) { mem->dma[index].start_address += 2; }
+			else if(mem->dma[index].src_addr_ctrl == 1) { mem->dma[index].start_address -= 2; }
+			else if(mem->dma[index].src_addr_ctrl == 3) { mem->dma[index].start_address += 2; }
+
+			//Update DMA Destination Address
+			if(mem->dma[index].dest_addr_ctrl == 0) { mem->dma[index].destination_address += 2; }
+			else if(mem->dma[index].dest_addr_ctrl == 1) { mem->dma[index].destination_address -= 2; }
+			else if(mem->dma[index].dest_addr_ctrl == 3) { mem->dma[index].destination_address += 2; }
+
+			mem->dma[index].word_count--;
+		}
+	}
+
+	//32-bit transfer
+	else
+	{
+		//Align addresses to word
+		mem->dma[index].start_address &= ~0x3;
+		mem->dma[index].destination_address &= ~0x3;
+
+		if(dma_block_transfer(index, 4)) { return; }
+
+		while(mem->dma[index].word_count != 0)
+		{
+			temp_value = mem->read_u32(mem->dma[index].start_address);
+			mem->write_u32(mem->dma[index].destination_address, temp_value);
+
+			//Update DMA Start Address
+			if(mem->dma[index].src_addr_ctrl == 0) { mem->dma[index].start_address += 4; }
+			else if(mem->dma[index].src_addr_ctrl == 1) { mem->dma[index].start_address -= 4; }
+			else if(mem->dma[index].src_addr_ctrl == 3) { mem->dma[index].start_address += 4; }
+
+			//Update DMA Destination Address
+			if(mem->dma[index].dest_addr_ctrl == 0) { mem->dma[index].destination_address += 4; }
+			else if(mem->dma[index].dest_addr_ctrl == 1) { mem->dma[index].destination_address -= 4; }
+			else if(mem->dma[index].dest_addr_ctrl == 3) { mem->dma[index].destination_address += 4; }
+
+			mem->dma[index].word_count--;
+		}
+	}
+}
+
+/****** Copies or fills a whole DMA block at once when both ends are plain memory - Returns false if not possible ******/
+bool ARM7::dma_block_transfer(u8 index, u8 unit_size)
+{
+	//Debugging and tracing need to see every access
+	#ifdef GBE_DEBUG
+	return false;
+	#endif
+
+	if(mem_trace::enabled) { return false; }
+
+	//Decrementing addresses are rare, leave them to the per-unit path
+	u8 src_ctrl = mem->dma[index].src_addr_ctrl;
+	u8 dst_ctrl = mem->dma[index].dest_addr_ctrl;
+
+	if((src_ctrl == 1) || (dst_ctrl == 1)) { return false; }
+
+	bool src_fixed = (src_ctrl == 2);
+	bool dst_fixed = (dst_ctrl == 2);
+
+	u32 src_addr = mem->dma[index].start_address;
+	u32 dst_addr = mem->dma[index].destination_address;
+	u32 length = mem->dma[index].word_count * unit_size;
+	u32 src_length = (src_fixed) ? unit_size : length;
+	u32 dst_length = (dst_fixed) ? unit_size : length;
+
+	//Overlapping ranges depend on transfer order, use the per-unit path
+	if((src_addr < (dst_addr + dst_length)) && (dst_addr < (src_addr + src_length))) { return false; }
+
+	u8* src = mem->get_dma_block(src_addr, src_length, false);
+	if(src == nullptr) { return false; }
+
+	u8* dst = mem->get_dma_block(dst_addr, dst_length, true);
+	if(dst == nullptr) { return false; }
+
+	//Block copy
+	if(!src_fixed && !dst_fixed) { memcpy(dst, src, length); }
+
+	//Fill
+	else if(src_fixed && !dst_fixed)
+	{
+		for(u32 x = 0; x < length; x += unit_size) { memcpy(dst + x, src, unit_size); }
+	}
+
+	//Fixed destination only keeps the last unit
+	else if(dst_fixed && !src_fixed) { memcpy(dst, src + length - unit_size, unit_size); }
+	else { memcpy(dst, src, unit_size); }
+
+	if(!src_fixed) { mem->dma[index].start_address += length; }
+	if(!dst_fixed) { mem->dma[index].destination_address += length; }
+
+	mem->dma[index].word_count = 0;
+
+	return true;
+}
+
 /****** Performs DMA0 transfers ******/
 void ARM7::dma0()
 {
@@ -25,8 +148,6 @@ void ARM7::dma0()
 		mem->dma[0].word_count = mem->read_u16_fast(DMA0CNT_L);
 		mem->dma[0].word_type = (mem->read_u16_fast(DMA0CNT_H) & 0x400) ? 1 : 0;
 
-		u32 temp_value = 0;
-
 		if((mem->dma[0].control & 0x8000) == 0) { mem->dma[0].enable = false; return; }
 
 		//Check DMA Start Timings
@@ -37,57 +158,7 @@ void ARM7::dma0()
 				//Set word count of transfer to max (0x4000) if specified as zero
 				if(mem->dma[0].word_count == 0) { mem->dma[0].word_count = 0x4000; }
 
-				//16-bit transfer
-				if(mem->dma[0].word_type == 0)
-				{
-					//Align addresses to half-word
-					mem->dma[0].start_address &= ~0x1;
-					mem->dma[0].destination_address	&= ~0x1;
-
-					while(mem->dma[0].word_count != 0)
-					{
-						temp_value = mem->read_u16(mem->dma[0].start_address);
-						mem->write_u16(mem->dma[0].destination_address, temp_value);
-
-						//Update DMA0 Start Address
-						if(mem->dma[0].src_addr_ctrl == 0) { mem->dma[0].start_address += 2; }
-						else if(mem->dma[0].src_addr_ctrl == 1) { mem->dma[0].start_address -= 2; }
-						else if(mem->dma[0].src_addr_ctrl == 3) { mem->dma[0].start_address += 2; }
-
-						//Update DMA0 Destination Address
-						if(mem->dma[0].dest_addr_ctrl == 0) { mem->dma[0].destination_address += 2; }
-						else if(mem->dma[0].dest_addr_ctrl == 1) { mem->dma[0].destination_address -= 2; }
-						else if(mem->dma[0].dest_addr_ctrl == 3) { mem->dma[0].destination_address += 2; }
-
-						mem->dma[0].word_count--;
-					}
-				}
-
-				//32-bit transfer
-				else
-				{
-					//Align addresses to word
-					mem->dma[0].start_address &= ~0x3;
-					mem->dma[0].destination_address	&= ~0x3;
-
-					while(mem->dma[0].word_count != 0)
-					{
-						temp_value = mem->read_u32(mem->dma[0].start_address);
-						mem->write_u32(mem->dma[0].destination_address, temp_value);
-
-						//Update DMA0 Start Address
-						if(mem->dma[0].src_addr_ctrl == 0) { mem->dma[0].start_address += 4; }
-						else if(mem->dma[0].src_addr_ctrl == 1) { mem->dma[0].start_address -= 4; }
-						else if(mem->dma[0].src_addr_ctrl == 3) { mem->dma[0].start_address += 4; }
-
-						//Update DMA0 Destination Address
-						if(mem->dma[0].dest_addr_ctrl == 0) { mem->dma[0].destination_address += 4; }
-						else if(mem->dma[0].dest_addr_ctrl == 1) { mem->dma[0].destination_address -= 4; }
-						else if(mem->dma[0].dest_addr_ctrl == 3) { mem->dma[0].destination_address += 4; }
-
-						mem->dma[0].word_count--;
-					}
-				}
+				dma_transfer(0);
 
 				//Reload if control flags are set to 0x3
 				if(mem->dma[0].dest_addr_ctrl == 3) { mem->dma[0].destination_address = mem->dma[0].original_destination_address; };
@@ -114,57 +185,7 @@ void ARM7::dma0()
 					//Set word count of transfer to max (0x4000) if specified as zero
 					if(mem->dma[0].word_count == 0) { mem->dma[0].word_count = 0x4000; }
 
-					//16-bit transfer
-					if(mem->dma[0].word_type == 0)
-					{
-						//Align addresses to half-word
-						mem->dma[0].start_address &= ~0x1;
-						mem->dma[0].destination_address	&= ~0x1;
-
-						while(mem->dma[0].word_count != 0)
-						{
-							temp_value = mem->read_u16(mem->dma[0].start_address);
-							mem->write_u16(mem->dma[0].destination_address, temp_value);
-
-							//Update DMA0 Start Address
-							if(mem->dma[0].src_addr_ctrl == 0) { mem->dma[0].start_address += 2; }
-							else if(mem->dma[0].src_addr_ctrl == 1) { mem->dma[0].start_address -= 2; }
-							else if(mem->dma[0].src_addr_ctrl == 3) { mem->dma[0].start_address += 2; }
-
-							//Update DMA0 Destination Address
-							if(mem->dma[0].dest_addr_ctrl == 0) { mem->dma[0].destination_address += 2; }
-							else if(mem->dma[0].dest_addr_ctrl == 1) { mem->dma[0].destination_address -= 2; }
-							else if(mem->dma[0].dest_addr_ctrl == 3) { mem->dma[0].destination_address += 2; }
-
-							mem->dma[0].word_count--;
-						}
-					}
-
-					//32-bit transfer
-					else
-					{
-						//Align addresses to word
-						mem->dma[0].start_address &= ~0x3;
-						mem->dma[0].destination_address	&= ~0x3;
-
-						while(mem->dma[0].word_count != 0)
-						{
-							temp_value = mem->read_u32(mem->dma[0].start_address);
-							mem->write_u32(mem->dma[0].destination_address, temp_value);
-
-							//Update DMA0 Start Address
-							if(mem->dma[0].src_addr_ctrl == 0) { mem->dma[0].start_address += 4; }
-							else if(mem->dma[0].src_addr_ctrl == 1) { mem->dma[0].start_address -= 4; }
-							else if(mem->dma[0].src_addr_ctrl == 3) { mem->dma[0].start_address += 4; }
-
-							//Update DMA0 Destination Address
-							if(mem->dma[0].dest_addr_ctrl == 0) { mem->dma[0].destination_address += 4; }
-							else if(mem->dma[0].dest_addr_ctrl == 1) { mem->dma[0].destination_address -= 4; }
-							else if(mem->dma[0].dest_addr_ctrl == 3) { mem->dma[0].destination_address += 4; }
-
-							mem->dma[0].word_count--;
-						}
-					}
+					dma_transfer(0);
 
 					//Reload if control flags are set to 0x3
 					if(mem->dma[0].dest_addr_ctrl == 3) { mem->dma[0].destination_address = mem->dma[0].original_destination_address; };
@@ -206,8 +227,6 @@ void ARM7::dma1()
 		mem->dma[1].word_count = mem->read_u16_fast(DMA1CNT_L);
 		mem->dma[1].word_type = (mem->read_u16_fast(DMA1CNT_H) & 0x400) ? 1 : 0;
 
-		u32 temp_value = 0;
-
 		if((mem->dma[1].control & 0x8000) == 0) { mem->dma[1].enable = false; return; }
 
 		//Check DMA Start Timings
@@ -218,57 +237,7 @@ void ARM7::dma1()
 				//Set word count of transfer to max (0x4000) if specified as zero
 				if(mem->dma[1].word_count == 0) { mem->dma[1].word_count = 0x4000; }
 
-				//16-bit transfer
-				if(mem->dma[1].word_type == 0)
-				{
-					//Align addresses to half-word
-					mem->dma[1].start_address &= ~0x1;
-					mem->dma[1].destination_address	&= ~0x1;
-
-					while(mem->dma[1].word_count != 0)
-					{
-						temp_value = mem->read_u16(mem->dma[1].start_address);
-						mem->write_u16(mem->dma[1].destination_address, temp_value);
-
-						//Update DMA1 Start Address
-						if(mem->dma[1].src_addr_ctrl == 0) { mem->dma[1].start_address += 2; }
-						else if(mem->dma[1].src_addr_ctrl == 1) { mem->dma[1].start_address -= 2; }
-						else if(mem->dma[1].src_addr_ctrl == 3) { mem->dma[1].start_address += 2; }
-
-						//Update DMA1 Destination Address
-						if(mem->dma[1].dest_addr_ctrl == 0) { mem->dma[1].destination_address += 2; }
-						else if(mem->dma[1].dest_addr_ctrl == 1) { mem->dma[1].destination_address -= 2; }
-						else if(mem->dma[1].dest_addr_ctrl == 3) { mem->dma[1].destination_address += 2; }
-
-						mem->dma[1].word_count--;
-					}
-				}
-
-				//32-bit transfer
-				else
-				{
-					//Align addresses to word
-					mem->dma[1].start_address &= ~0x3;
-					mem->dma[1].destination_address	&= ~0x3;
-
-					while(mem->dma[1].word_count != 0)
-					{
-						temp_value = mem->read_u32(mem->dma[1].start_address);
-						mem->write_u32(mem->dma[1].destination_address, temp_value);
-
-						//Update DMA1 Start Address
-						if(mem->dma[1].src_addr_ctrl == 0) { mem->dma[1].start_address += 4; }
-						else if(mem->dma[1].src_addr_ctrl == 1) { mem->dma[1].start_address -= 4; }
-						else if(mem->dma[1].src_addr_ctrl == 3) { mem->dma[1].start_address += 4; }
-
-						//Update DMA1 Destination Address
-						if(mem->dma[1].dest_addr_ctrl == 0) { mem->dma[1].destination_address += 4; }
-						else if(mem->dma[1].dest_addr_ctrl == 1) { mem->dma[1].destination_address -= 4; }
-						else if(mem->dma[1].dest_addr_ctrl == 3) { mem->dma[1].destination_address += 4; }
-
-						mem->dma[1].word_count--;
-					}
-				}
+				dma_transfer(1);
 
 				//Reload if control flags are set to 0x3
 				if(mem->dma[1].dest_addr_ctrl == 3) { mem->dma[1].destination_address = mem->dma[1].original_destination_address; };
@@ -295,57 +264,7 @@ void ARM7::dma1()
 					//Set word count of transfer to max (0x4000) if specified as zero
 					if(mem->dma[1].word_count == 0) { mem->dma[1].word_count = 0x4000; }
 
-					//16-bit transfer
-					if(mem->dma[1].word_type == 0)
-					{
-						//Align addresses to half-word
-						mem->dma[1].start_address &= ~0x1;
-						mem->dma[1].destination_address	&= ~0x1;
-
-						while(mem->dma[1].word_count != 0)
-						{
-							temp_value = mem->read_u16(mem->dma[1].start_address);
-							mem->write_u16(mem->dma[1].destination_address, temp_value);
-
-							//Update DMA1 Start Address
-							if(mem->dma[1].src_addr_ctrl == 0) { mem->dma[1].start_address += 2; }
-							else if(mem->dma[1].src_addr_ctrl == 1) { mem->dma[1].start_address -= 2; }
-							else if(mem->dma[1].src_addr_ctrl == 3) { mem->dma[1].start_address += 2; }
-
-							//Update DMA1 Destination Address
-							if(mem->dma[1].dest_addr_ctrl == 0) { mem->dma[1].destination_address += 2; }
-							else if(mem->dma[1].dest_addr_ctrl == 1) { mem->dma[1].destination_address -= 2; }
-							else if(mem->dma[1].dest_addr_ctrl == 3) { mem->dma[1].destination_address += 2; }
-
-							mem->dma[1].word_count--;
-						}
-					}
-
-					//32-bit transfer
-					else
-					{
-						//Align addresses to word
-						mem->dma[1].start_address &= ~0x3;
-						mem->dma[1].destination_address	&= ~0x3;
-
-						while(mem->dma[1].word_count != 0)
-						{
-							temp_value = mem->read_u32(mem->dma[1].start_address);
-							mem->write_u32(mem->dma[1].destination_address, temp_value);
-
-							//Update DMA1 Start Address
-							if(mem->dma[1].src_addr_ctrl == 0) { mem->dma[1].start_address += 4; }
-							else if(mem->dma[1].src_addr_ctrl == 1) { mem->dma[1].start_address -= 4; }
-							else if(mem->dma[1].src_addr_ctrl == 3) { mem->dma[1].start_address += 4; }
-
-							//Update DMA1 Destination Address
-							if(mem->dma[1].dest_addr_ctrl == 0) { mem->dma[1].destination_address += 4; }
-							else if(mem->dma[1].dest_addr_ctrl == 1) { mem->dma[1].destination_address -= 4; }
-							else if(mem->dma[1].dest_addr_ctrl == 3) { mem->dma[1].destination_address += 4; }
-
-							mem->dma[1].word_count--;
-						}
-					}
+					dma_transfer(1);
 
 					//Reload if control flags are set to 0x3
 					if(mem->dma[1].dest_addr_ctrl == 3) { mem->dma[1].destination_address = mem->dma[1].original_destination_address; };
@@ -391,8 +310,6 @@ void ARM7::dma2()
 		mem->dma[2].word_count = mem->read_u16_fast(DMA2CNT_L);
 		mem->dma[2].word_type = (mem->read_u16_fast(DMA2CNT_H) & 0x400) ? 1 : 0;
 
-		u32 temp_value = 0;
-
 		if((mem->dma[2].control & 0x8000) == 0) { mem->dma[2].enable = false; return; }
 
 		//Check DMA Start Timings
@@ -403,57 +320,7 @@ void ARM7::dma2()
 				//Set word count of transfer to max (0x4000) if specified as zero
 				if(mem->dma[2].word_count == 0) { mem->dma[2].word_count = 0x4000; }
 
-				//16-bit transfer
-				if(mem->dma[2].word_type == 0)
-				{
-					//Align addresses to half-word
-					mem->dma[2].start_address &= ~0x1;
-					mem->dma[2].destination_address	&= ~0x1;
-
-					while(mem->dma[2].word_count != 0)
-					{
-						temp_value = mem->read_u16(mem->dma[2].start_address);
-						mem->write_u16(mem->dma[2].destination_address, temp_value);
-
-						//Update DMA2 Start Address
-						if(mem->dma[2].src_addr_ctrl == 0) { mem->dma[2].start_address += 2; }
-						else if(mem->dma[2].src_addr_ctrl == 1) { mem->dma[2].start_address -= 2; }
-						else if(mem->dma[2].src_addr_ctrl == 3) { mem->dma[2].start_address += 2; }
-
-						//Update DMA2 Destination Address
-						if(mem->dma[2].dest_addr_ctrl == 0) { mem->dma[2].destination_address += 2; }
-						else if(mem->dma[2].dest_addr_ctrl == 1) { mem->dma[2].destination_address -= 2; }
-						else if(mem->dma[2].dest_addr_ctrl == 3) { mem->dma[2].destination_address += 2; }
-
-						mem->dma[2].word_count--;
-					}
-				}
-
-				//32-bit transfer
-				else
-				{
-					//Align addresses to word
-					mem->dma[2].start_address &= ~0x3;
-					mem->dma[2].destination_address	&= ~0x3;
-
-					while(mem->dma[2].word_count != 0)
-					{
-						temp_value = mem->read_u32(mem->dma[2].start_address);
-						mem->write_u32(mem->dma[2].destination_address, temp_value);
-
-						//Update DMA2 Start Address
-						if(mem->dma[2].src_addr_ctrl == 0) { mem->dma[2].start_address += 4; }
-						else if(mem->dma[2].src_addr_ctrl == 1) { mem->dma[2].start_address -= 4; }
-						else if(mem->dma[2].src_addr_ctrl == 3) { mem->dma[2].start_address += 4; }
-
-						//Update DMA2 Destination Address
-						if(mem->dma[2].dest_addr_ctrl == 0) { mem->dma[2].destination_address += 4; }
-						else if(mem->dma[2].dest_addr_ctrl == 1) { mem->dma[2].destination_address -= 4; }
-						else if(mem->dma[2].dest_addr_ctrl == 3) { mem->dma[2].destination_address += 4; }
-
-						mem->dma[2].word_count--;
-					}
-				}
+				dma_transfer(2);
 
 				//Reload if control flags are set to 0x3
 				if(mem->dma[2].dest_addr_ctrl == 3) { mem->dma[2].destination_address = mem->dma[2].original_destination_address; };
@@ -480,57 +347,7 @@ void ARM7::dma2()
 					//Set word count of transfer to max (0x4000) if specified as zero
 					if(mem->dma[2].word_count == 0) { mem->dma[2].word_count = 0x4000; }
 
-					//16-bit transfer
-					if(mem->dma[2].word_type == 0)
-					{
-						//Align addresses to half-word
-						mem->dma[2].start_address &= ~0x1;
-						mem->dma[2].destination_address	&= ~0x1;
-
-						while(mem->dma[2].word_count != 0)
-						{
-							temp_value = mem->read_u16(mem->dma[2].start_address);
-							mem->write_u16(mem->dma[2].destination_address, temp_value);
-
-							//Update DMA2 Start Address
-							if(mem->dma[2].src_addr_ctrl == 0) { mem->dma[2].start_address += 2; }
-							else if(mem->dma[2].src_addr_ctrl == 1) { mem->dma[2].start_address -= 2; }
-							else if(mem->dma[2].src_addr_ctrl == 3) { mem->dma[2].start_address += 2; }
-
-							//Update DMA2 Destination Address
-							if(mem->dma[2].dest_addr_ctrl == 0) { mem->dma[2].destination_address += 2; }
-							else if(mem->dma[2].dest_addr_ctrl == 1) { mem->dma[2].destination_address -= 2; }
-							else if(mem->dma[2].dest_addr_ctrl == 3) { mem->dma[2].destination_address += 2; }
-
-							mem->dma[2].word_count--;
-						}
-					}
-
-					//32-bit transfer
-					else
-					{
-						//Align addresses to word
-						mem->dma[2].start_address &= ~0x3;
-						mem->dma[2].destination_address	&= ~0x3;
-
-						while(mem->dma[2].word_count != 0)
-						{
-							temp_value = mem->read_u32(mem->dma[2].start_address);
-							mem->write_u32(mem->dma[2].destination_address, temp_value);
-
-							//Update DMA2 Start Address
-							if(mem->dma[2].src_addr_ctrl == 0) { mem->dma[2].start_address += 4; }
-							else if(mem->dma[2].src_addr_ctrl == 1) { mem->dma[2].start_address -= 4; }
-							else if(mem->dma[2].src_addr_ctrl == 3) { mem->dma[2].start_address += 4; }
-
-							//Update DMA2 Destination Address
-							if(mem->dma[2].dest_addr_ctrl == 0) { mem->dma[2].destination_address += 4; }
-							else if(mem->dma[2].dest_addr_ctrl == 1) { mem->dma[2].destination_address -= 4; }
-							else if(mem->dma[2].dest_addr_ctrl == 3) { mem->dma[2].destination_address += 4; }
-
-							mem->dma[2].word_count--;
-						}
-					}
+					dma_transfer(2);
 
 					//Reload if control flags are set to 0x3
 					if(mem->dma[2].dest_addr_ctrl == 3) { mem->dma[2].destination_address = mem->dma[2].original_destination_address; };
@@ -576,8 +393,6 @@ void ARM7::dma3()
 		mem->dma[3].word_count = mem->read_u16_fast(DMA3CNT_L);
 		mem->dma[3].word_type = (mem->read_u16_fast(DMA3CNT_H) & 0x400) ? 1 : 0;
 
-		u32 temp_value = 0;
-
 		if((mem->dma[3].control & 0x8000) == 0) { mem->dma[3].enable = false; return; }
 
 		//Read from EEPROM
@@ -631,57 +446,7 @@ void ARM7::dma3()
 				//Set word count of transfer to max (0x10000) if specified as zero
 				if(mem->dma[3].word_count == 0) { mem->dma[3].word_count = 0x10000; }
 
-				//16-bit transfer
-				if(mem->dma[3].word_type == 0)
-				{
-					//Align addresses to half-word
-					mem->dma[3].start_address &= ~0x1;
-					mem->dma[3].destination_address	&= ~0x1;
-
-					while(mem->dma[3].word_count != 0)
-					{
-						temp_value = mem->read_u16(mem->dma[3].start_address);
-						mem->write_u16(mem->dma[3].destination_address, temp_value);
-
-						//Update DMA3 Start Address
-						if(mem->dma[3].src_addr_ctrl == 0) { mem->dma[3].start_address += 2; }
-						else if(mem->dma[3].src_addr_ctrl == 1) { mem->dma[3].start_address -= 2; }
-						else if(mem->dma[3].src_addr_ctrl == 3) { mem->dma[3].start_address += 2; }
-
-						//Update DMA3 Destination Address
-						if(mem->dma[3].dest_addr_ctrl == 0) { mem->dma[3].destination_address += 2; }
-						else if(mem->dma[3].dest_addr_ctrl == 1) { mem->dma[3].destination_address -= 2; }
-						else if(mem->dma[3].dest_addr_ctrl == 3) { mem->dma[3].destination_address += 2; }
-
-						mem->dma[3].word_count--;
-					}
-				}
-
-				//32-bit transfer
-				else
-				{
-					//Align addresses to word
-					mem->dma[3].start_address &= ~0x3;
-					mem->dma[3].destination_address	&= ~0x3;
-
-					while(mem->dma[3].word_count != 0)
-					{
-						temp_value = mem->read_u32(mem->dma[3].start_address);
-						mem->write_u32(mem->dma[3].destination_address, temp_value);
-
-						//Update DMA3 Start Address
-						if(mem->dma[3].src_addr_ctrl == 0) { mem->dma[3].start_address += 4; }
-						else if(mem->dma[3].src_addr_ctrl == 1) { mem->dma[3].start_address -= 4; }
-						else if(mem->dma[3].src_addr_ctrl == 3) { mem->dma[3].start_address += 4; }
-
-						//Update DMA3 Destination Address
-						if(mem->dma[3].dest_addr_ctrl == 0) { mem->dma[3].destination_address += 4; }
-						else if(mem->dma[3].dest_addr_ctrl == 1) { mem->dma[3].destination_address -= 4; }
-						else if(mem->dma[3].dest_addr_ctrl == 3) { mem->dma[3].destination_address += 4; }
-
-						mem->dma[3].word_count--;
-					}
-				}
+				dma_transfer(3);
 
 				//Reload if control flags are set to 0x3
 				if(mem->dma[3].dest_addr_ctrl == 3) { mem->dma[3].destination_address = mem->dma[3].original_destination_address; };
@@ -708,57 +473,7 @@ void ARM7::dma3()
 					//Set word count of transfer to max (0x10000) if specified as zero
 					if(mem->dma[3].word_count == 0) { mem->dma[3].word_count = 0x10000; }
 
-					//16-bit transfer
-					if(mem->dma[3].word_type == 0)
-					{
-						//Align addresses to half-word
-						mem->dma[3].start_address &= ~0x1;
-						mem->dma[3].destination_address	&= ~0x1;
-
-						while(mem->dma[3].word_count != 0)
-						{
-							temp_value = mem->read_u16(mem->dma[3].start_address);
-							mem->write_u16(mem->dma[3].destination_address, temp_value);
-
-							//Update DMA3 Start Address
-							if(mem->dma[3].src_addr_ctrl == 0) { mem->dma[3].start_address += 2; }
-							else if(mem->dma[3].src_addr_ctrl == 1) { mem->dma[3].start_address -= 2; }
-							else if(mem->dma[3].src_addr_ctrl == 3) { mem->dma[3].start_address += 2; }
-
-							//Update DMA0 Destination Address
-							if(mem->dma[3].dest_addr_ctrl == 0) { mem->dma[3].destination_address += 2; }
-							else if(mem->dma[3].dest_addr_ctrl == 1) { mem->dma[3].destination_address -= 2; }
-							else if(mem->dma[3].dest_addr_ctrl == 3) { mem->dma[3].destination_address += 2; }
-
-							mem->dma[3].word_count--;
-						}
-					}
-
-					//32-bit transfer
-					else
-					{
-						//Align addresses to word
-						mem->dma[3].start_address &= ~0x3;
-						mem->dma[3].destination_address	&= ~0x3;
-
-						while(mem->dma[3].word_count != 0)
-						{
-							temp_value = mem->read_u32(mem->dma[3].start_address);
-							mem->write_u32(mem->dma[3].destination_address, temp_value);
-
-							//Update DMA0 Start Address
-							if(mem->dma[3].src_addr_ctrl == 0) { mem->dma[3].start_address += 4; }
-							else if(mem->dma[3].src_addr_ctrl == 1) { mem->dma[3].start_address -= 4; }
-							else if(mem->dma[3].src_addr_ctrl == 3) { mem->dma[3].start_address += 4; }
-
-							//Update DMA0 Destination Address
-							if(mem->dma[3].dest_addr_ctrl == 0) { mem->dma[3].destination_address += 4; }
-							else if(mem->dma[3].dest_addr_ctrl == 1) { mem->dma[3].destination_address -= 4; }
-							else if(mem->dma[3].dest_addr_ctrl == 3) { mem->dma[3].destination_address += 4; }
-
-							mem->dma[3].word_count--;
-						}
-					}
+					dma_transfer(3);
 
 					//Reload if control flags are set to 0x3
 					if(mem->dma[3].dest_addr_ctrl == 3) { mem->dma[3].destination_address = mem->dma[3].original_destination_address; };
@@ -10,22 +10,40 @@
 // Responsible for blitting pixel data and limiting frame rate
 
 #include <cmath>
+#include <cstddef>
+#include <cstring>
 
 #include "lcd.h"
 #include "common/util.h"
+#include "common/sw_filter.h"
+#include "common/profiler.h"
 
 /****** LCD Constructor ******/
-AGB_LCD::AGB_LCD()
+AGB_LCD::AGB_LCD(bool is_render_only)
 {
 	window = nullptr;
+	render_lcd = nullptr;
+	render_only = is_render_only;
 	reset();
 }
 
 /****** LCD Destructor ******/
 AGB_LCD::~AGB_LCD()
 {
+	render_worker.stop();
+
+	if(render_lcd != nullptr)
+	{
+		delete render_lcd;
+		render_lcd = nullptr;
+	}
+
 	screen_buffer.clear();
 	scanline_buffer.clear();
+
+	//Render-only LCDs never own a window or GL context
+	if(render_only) { return; }
+
 	SDL_DestroyWindow(window);
 
 	#ifdef GBE_OGL
@@ -38,6 +56,17 @@ AGB_LCD::~AGB_LCD()
 /****** Reset LCD ******/
 void AGB_LCD::reset()
 {
+	//Let the render thread finish its line, it fully resyncs on the next one
+	render_worker.wait();
+
+	render_resync = true;
+	obj_sync = true;
+	pal_sync = true;
+
+	vram = nullptr;
+	blend_control = 0;
+	line_target = nullptr;
+
 	final_screen = nullptr;
 	original_screen = nullptr;
 	mem = nullptr;
@@ -56,6 +85,12 @@ void AGB_LCD::reset()
 	fps_count = 0;
 	fps_time = 0;
 
+	skip_frame = false;
+	skipped_frames = 0;
+
+	screen_diff.hashes.clear();
+	screen_diff.generation = 0;
+
 	for(u32 x = 0; x < 60; x++)
 	{
 		u16 max = (config::max_fps) ? config::max_fps : 60;
@@ -197,6 +232,14 @@ void AGB_LCD::reset()
 
 	obj_render_length = 0;
 
+	max_fullscreen_ratio = 2;
+	power_antenna_osd = false;
+
+	try_window_rebuild = false;
+
+	//Render-only LCDs leave global screen settings to the main LCD
+	if(render_only) { return; }
+
 	//Initialize system screen dimensions
 	config::sys_width = 240;
 	config::sys_height = 160;
@@ -204,11 +247,6 @@ void AGB_LCD::reset()
 	//Initialize GBA subscreen as normal
 	config::resize_mode = 0;
 	config::request_resize = false;
-
-	max_fullscreen_ratio = 2;
-	power_antenna_osd = false;
-
-	try_window_rebuild = false;
 }
 
 /****** Initialize LCD with SDL ******/
@@ -234,11 +272,12 @@ bool AGB_LCD::init()
 			}
 		}
 
-		//Set up software rendering
+		//Set up software rendering - Software filters may enlarge the output
 		else
 		{
-			u32 next_w = config::sys_width;
-			u32 next_h = config::sys_height;
+			u32 filter_scale = sw_filter::get_scale();
+			u32 next_w = config::sys_width * filter_scale;
+			u32 next_h = config::sys_height * filter_scale;
 
 			if(config::flags & SDL_WINDOW_FULLSCREEN)
 			{
@@ -262,8 +301,8 @@ bool AGB_LCD::init()
 			window = SDL_CreateWindow("GBE+", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, next_w, next_h, config::flags);
 			SDL_GetWindowSize(window, &config::win_width, &config::win_height);
 			final_screen = SDL_GetWindowSurface(window);
-			original_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, config::sys_width, config::sys_height, 32, 0, 0, 0, 0);
-			config::scaling_factor = 1;
+			original_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, (config::sys_width * filter_scale), (config::sys_height * filter_scale), 32, 0, 0, 0, 0);
+			config::scaling_factor = filter_scale;
 		}
 
 		if(final_screen == nullptr) { return false; }
@@ -277,6 +316,9 @@ bool AGB_LCD::init()
 		final_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, config::sys_width, config::sys_height, 32, 0, 0, 0, 0);
 	}
 
+	//Any new window or surface starts empty, so present the next frame in full
+	frame_diff::invalidate();
+
 	std::cout<<"LCD::Initialized\n";
 
 	return true;
@@ -420,6 +462,8 @@ void AGB_LCD::update_oam()
 
 	//Update render list for the current scanline
 	update_obj_render_list();
+
+	obj_sync = true;
 }
 
 /****** Updates the size and position of OBJs from affine transformation ******/
@@ -518,6 +562,7 @@ void AGB_LCD::update_palettes()
 	if(lcd_stat.bg_pal_update)
 	{
 		lcd_stat.bg_pal_update = false;
+		pal_sync = true;
 
 		//Cycle through all updates to BG palettes
 		for(int x = 0; x < 256; x++)
@@ -547,6 +592,7 @@ void AGB_LCD::update_palettes()
 	if(lcd_stat.obj_pal_update)
 	{
 		lcd_stat.obj_pal_update = false;
+		pal_sync = true;
 
 		//Cycle through all updates to OBJ palettes
 		for(int x = 0; x < 256; x++)
@@ -697,7 +743,7 @@ bool AGB_LCD::render_sprite_pixel()
 			if(obj[sprite_id].bit_depth == 4)
 			{
 				sprite_tile_addr += (sprite_tile_pixel >> 1);
-				raw_color = mem->memory_map[sprite_tile_addr];
+				raw_color = vram[sprite_tile_addr & 0x1FFFF];
 
 				if((sprite_tile_pixel % 2) == 0) { raw_color &= 0xF; }
 				else { raw_color >>= 4; }
@@ -722,7 +768,7 @@ bool AGB_LCD::render_sprite_pixel()
 			else
 			{
 				sprite_tile_addr += sprite_tile_pixel;
-				raw_color = mem->memory_map[sprite_tile_addr];
+				raw_color = vram[sprite_tile_addr & 0x1FFFF];
 
 				if(raw_color != 0) 
 				{
@@ -849,7 +895,8 @@ bool AGB_LCD::render_bg_mode_0(u32 bg_control)
 	u16 tile_number = lcd_stat.bg_num_lut[current_tile_pixel_x][current_tile_pixel_y];
 
 	//Grab the map's data
-	u16 map_data = mem->read_u16_fast(map_base_addr + (tile_number * 2));
+	u32 map_addr = (map_base_addr + (tile_number * 2)) & 0x1FFFF;
+	u16 map_data = vram[map_addr] | (vram[map_addr + 1] << 8);
 
 	//Look at the Tile Map #(tile_number), see what Tile # it points to
 	u16 map_entry = map_data & 0x3FF;
@@ -890,7 +937,7 @@ bool AGB_LCD::render_bg_mode_0(u32 bg_control)
 	if(lcd_stat.bg_depth[bg_id] == 4)
 	{
 		tile_addr += (current_tile_pixel >> 1);
-		u8 raw_color = mem->memory_map[tile_addr];
+		u8 raw_color = vram[tile_addr & 0x1FFFF];
 
 		if((current_tile_pixel % 2) == 0) { raw_color &= 0xF; }
 		else { raw_color >>= 4; }
@@ -906,7 +953,7 @@ bool AGB_LCD::render_bg_mode_0(u32 bg_control)
 	else
 	{
 		tile_addr += current_tile_pixel;
-		u8 raw_color = mem->memory_map[tile_addr];
+		u8 raw_color = vram[tile_addr & 0x1FFFF];
 
 		//If the bg color is transparent, abort drawing
 		if(raw_color == 0) { return false; }
@@ -966,7 +1013,7 @@ bool AGB_LCD::render_bg_mode_1(u32 bg_control)
 	u16 tile_number = ((src_y / 8) * bg_tile_size) + (src_x / 8);
 
 	//Look at the Tile Map #(tile_number), see what Tile # it points to
-	u8 map_entry = mem->memory_map[lcd_stat.bg_base_map_addr[bg_id] + tile_number];
+	u8 map_entry = vram[(lcd_stat.bg_base_map_addr[bg_id] + tile_number) & 0x1FFFF];
 
 	//Get address of Tile #(map_entry)
 	u32 tile_addr = lcd_stat.bg_base_tile_addr[bg_id] + (map_entry * 64);
@@ -975,7 +1022,7 @@ bool AGB_LCD::render_bg_mode_1(u32 bg_control)
 
 	//Grab the byte corresponding to (current_tile_pixel), render it as ARGB - 8-bit version
 	tile_addr += current_tile_pixel;
-	u8 raw_color = mem->memory_map[tile_addr];
+	u8 raw_color = vram[tile_addr & 0x1FFFF];
 
 	//If the bg color is transparent, abort drawing
 	if(raw_color == 0) { return false; }
@@ -1001,7 +1048,8 @@ bool AGB_LCD::render_bg_mode_3()
 	u16 src_y = lcd_stat.bg_affine[0].y_pos;
 
 	//Determine which byte in VRAM to read for color data
-	u16 color_bytes = mem->read_u16_fast(0x6000000 + (src_y * 480) + (src_x * 2));
+	u32 bitmap_addr = ((src_y * 480) + (src_x * 2)) & 0x1FFFF;
+	u16 color_bytes = vram[bitmap_addr] | (vram[bitmap_addr + 1] << 8);
 	last_raw_color = color_bytes;
 
 	//ARGB conversion
@@ -1035,7 +1083,7 @@ bool AGB_LCD::render_bg_mode_4()
 	//Determine which byte in VRAM to read for color data
 	u32 bitmap_entry = (lcd_stat.frame_base + (src_y * 240) + src_x);
 
-	u8 raw_color = mem->memory_map[bitmap_entry];
+	u8 raw_color = vram[bitmap_entry & 0x1FFFF];
 	if(raw_color == 0) { return false; }
 
 	scanline_buffer[scanline_pixel_counter] = pal[raw_color][0];
@@ -1059,7 +1107,8 @@ bool AGB_LCD::render_bg_mode_5()
 	u16 src_y = lcd_stat.bg_affine[0].y_pos;
 
 	//Determine which byte in VRAM to read for color data
-	u16 color_bytes = mem->read_u16_fast(lcd_stat.frame_base + (src_y * 320) + (src_x * 2));
+	u32 bitmap_addr = (lcd_stat.frame_base + (src_y * 320) + (src_x * 2)) & 0x1FFFF;
+	u16 color_bytes = vram[bitmap_addr] | (vram[bitmap_addr + 1] << 8);
 	last_raw_color = color_bytes;
 
 	//ARGB conversion
@@ -1076,6 +1125,109 @@ bool AGB_LCD::render_bg_mode_5()
 	return true;
 }
 
+/****** Renders all pixels of the current scanline and pushes them to the target screen buffer row ******/
+void AGB_LCD::render_line()
+{
+	for(u32 x = 0; x < 256; x++)
+	{
+		render_scanline();
+		if(lcd_stat.current_sfx_type != NORMAL) { apply_sfx(); }
+		scanline_pixel_counter++;
+	}
+
+	scanline_pixel_counter = 0;
+
+	//Push scanline data to final buffer - Only if Forced Blank is disabled
+	if((lcd_stat.display_control & 0x80) == 0)
+	{
+		for(u32 x = 0; x < 240; x++) { line_target[x] = scanline_buffer[x]; }
+	}
+
+	//Draw all-white during Forced Blank
+	else
+	{
+		for(u32 x = 0; x < 240; x++) { line_target[x] = 0xFFFFFFFF; }
+	}
+}
+
+/****** Returns true if scanlines should be drawn by the render thread ******/
+bool AGB_LCD::use_render_thread()
+{
+	//Debugging needs VRAM and registers to match what was drawn
+	#ifdef GBE_DEBUG
+	return false;
+	#else
+	return (config::gba_threaded_render) && (line_worker::has_spare_core());
+	#endif
+}
+
+/****** Copies everything the next scanline needs to the render-only LCD ******/
+void AGB_LCD::sync_render_lcd()
+{
+	if(render_lcd == nullptr)
+	{
+		render_lcd = new AGB_LCD(true);
+		render_lcd->vram_shadow.resize(0x20000, 0);
+		render_lcd->vram = render_lcd->vram_shadow.data();
+		render_resync = true;
+	}
+
+	if(!render_worker.is_running()) { render_worker.start([this]{ render_lcd->render_line(); }); }
+
+	//Previous line must be finished before its snapshot is overwritten
+	render_worker.wait();
+
+	//Registers - BG LUTs never change after reset, so skip them
+	memcpy(&render_lcd->lcd_stat, &lcd_stat, offsetof(agb_lcd_data, bg_flip_lut));
+	memcpy(&render_lcd->lcd_stat.bg_affine, &lcd_stat.bg_affine, sizeof(agb_lcd_data) - offsetof(agb_lcd_data, bg_affine));
+
+	//VRAM - Copy everything after a reset or save state, otherwise only blocks written since the last line
+	if(render_resync)
+	{
+		memcpy(render_lcd->vram, &mem->memory_map[0x6000000], 0x20000);
+		for(u32 x = 0; x < 0x200; x++) { mem->vram_dirty[x] = false; }
+		mem->vram_dirty_any = false;
+
+		obj_sync = true;
+		pal_sync = true;
+		render_resync = false;
+	}
+
+	else if(mem->vram_dirty_any)
+	{
+		for(u32 x = 0; x < 0x200; x++)
+		{
+			if(!mem->vram_dirty[x]) { continue; }
+
+			mem->vram_dirty[x] = false;
+			memcpy(render_lcd->vram + (x << 8), &mem->memory_map[0x6000000 + (x << 8)], 0x100);
+		}
+
+		mem->vram_dirty_any = false;
+	}
+
+	//OAM and palettes - Only after they were decoded again
+	if(obj_sync)
+	{
+		memcpy(render_lcd->obj, obj, sizeof(obj));
+		obj_sync = false;
+	}
+
+	if(pal_sync)
+	{
+		memcpy(render_lcd->pal, pal, sizeof(pal));
+		memcpy(render_lcd->raw_pal, raw_pal, sizeof(raw_pal));
+		pal_sync = false;
+	}
+
+	memcpy(render_lcd->obj_render_list, obj_render_list, sizeof(obj_render_list));
+	render_lcd->obj_render_length = obj_render_length;
+
+	render_lcd->current_scanline = current_scanline;
+	render_lcd->blend_control = blend_control;
+	render_lcd->line_target = line_target;
+}
+
 /****** Render pixels for a given scanline (per-pixel) ******/
 void AGB_LCD::render_scanline()
 {
@@ -1346,7 +1498,7 @@ u32 AGB_LCD::alpha_blend()
 	if((last_bg_priority < 4) && (!lcd_stat.sfx_target[last_bg_priority][0])) { return final_color; }
 
 	//If no 1st target is set, abort alpha blending unless semi-trasnparent OBJ
-	if(((mem->memory_map[BLDCNT] & 0x3F) == 0) && (last_obj_mode != 1)) { return final_color; }
+	if(((blend_control & 0x3F) == 0) && (last_obj_mode != 1)) { return final_color; }
 
 	//Determine which priority to start looking at to grab the 2nd target
 	u8 current_bg_priority = (last_bg_priority == 4) ? last_obj_priority : lcd_stat.bg_priority[last_bg_priority];
@@ -1415,6 +1567,8 @@ u32 AGB_LCD::alpha_blend()
 /****** Immediately draw current buffer to the screen ******/
 void AGB_LCD::update()
 {
+	render_worker.wait();
+
 	//Use SDL
 	if(config::sdl_render)
 	{
@@ -1422,10 +1576,24 @@ void AGB_LCD::update()
 		if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
 		u32* out_pixel_data = (u32*)final_screen->pixels;
 
-		for(int a = 0; a < 0x9600; a++)
+		//Apply software filters
+		if(sw_filter::is_enabled())
 		{
-			out_pixel_data[a] = screen_buffer[a];
-			if(mem->sub_screen_buffer.size()) { out_pixel_data[0x9600 + a] = mem->sub_screen_buffer[a]; }
+			if(mem->sub_screen_buffer.size())
+			{
+				for(int a = 0; a < 0x9600; a++) { screen_buffer[0x9600 + a] = mem->sub_screen_buffer[a]; }
+			}
+
+			sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, final_screen->pitch >> 2);
+		}
+
+		else
+		{
+			for(int a = 0; a < 0x9600; a++)
+			{
+				out_pixel_data[a] = screen_buffer[a];
+				if(mem->sub_screen_buffer.size()) { out_pixel_data[0x9600 + a] = mem->sub_screen_buffer[a]; }
+			}
 		}
 
 		//Unlock source surface
@@ -1490,6 +1658,7 @@ void AGB_LCD::update()
 /****** Clears the screen buffer with a given color ******/
 void AGB_LCD::clear_screen_buffer(u32 color)
 {
+	render_worker.wait();
 	for(u32 x = 0; x < 0x9600; x++) { screen_buffer[x] = color; }
 }
 
@@ -1554,46 +1723,42 @@ void AGB_LCD::step()
 		//Change mode
 		if(lcd_mode != 1) 
 		{
-			//Render scanline data
-			for(u32 x = 0; x < 256; x++) 
+			//Render scanline data - Not needed for skipped frames
+			if(!skip_frame)
 			{
-				render_scanline();
-				if(lcd_stat.current_sfx_type != NORMAL) { apply_sfx(); }
-				scanline_pixel_counter++;
+				profiler::scope timer(profiler::PROF_PPU);
+
+				blend_control = mem->memory_map[BLDCNT];
+				line_target = &screen_buffer[240 * current_scanline];
+
+				//Hand the line to the render thread, emulation carries on with HBlank
+				if(use_render_thread())
+				{
+					sync_render_lcd();
+					render_worker.post();
+				}
+
+				else
+				{
+					render_worker.wait();
+					render_resync = true;
+
+					vram = &mem->memory_map[0x6000000];
+					render_line();
+				}
 			}
 
 			//Toggle HBlank flag ON
 			mem->memory_map[DISPSTAT] |= 0x2;
 
 			lcd_mode = 1;
-			scanline_pixel_counter = 0;
 
 			//Raise HBlank interrupt
 			if(mem->memory_map[DISPSTAT] & 0x10) { mem->memory_map[REG_IF] |= 0x2; }
-
-			//Push scanline data to final buffer - Only if Forced Blank is disabled
-			if((lcd_stat.display_control & 0x80) == 0)
-			{
-				for(int x = 0, y = (240 * current_scanline); x < 240; x++, y++)
-				{
-					screen_buffer[y] = scanline_buffer[x];
-				}
-			}
-
-			//Draw all-white during Forced Blank
-			else
-			{
-				for(int x = 0, y = (240 * current_scanline); x < 240; x++, y++)
-				{
-					screen_buffer[y] = 0xFFFFFFFF;
-				}
-			}
 	
 			//Start HBlank DMA
 			mem->start_blank_dma();
 		}
-
-		if((config::use_cheats) && ((current_scanline & 0x7) == 0)) { mem->set_cheats(); }
 	}
 
 	//Mode 2 - VBlank
@@ -1608,6 +1773,12 @@ void AGB_LCD::step()
 		{
 			lcd_mode = 2;
 
+			//Make sure the render thread has finished the last line before the frame is used
+			{
+				profiler::scope timer(profiler::PROF_PPU);
+				render_worker.wait();
+			}
+
 			//Check for screen resize - CDZ sub screen
 			if((config::request_resize) && (config::resize_mode > 0))
 			{
@@ -1649,21 +1820,27 @@ void AGB_LCD::step()
 			//Raise VBlank interrupt
 			if(mem->memory_map[DISPSTAT] & 0x8) { mem->memory_map[REG_IF] |= 0x1; }
 
+			//Apply GSA cheats
+			if(config::use_cheats) { mem->set_cheats(); }
+
 			//Display any OSD messages
 			if(config::osd_count)
 			{
 				config::osd_count--;
-				draw_osd_msg(config::osd_message, screen_buffer, 0, 0);
+				if(!skip_frame) { draw_osd_msg(config::osd_message, screen_buffer, 0, 0); }
 			}
 
 			//Process Power Antenna
-			if(power_antenna_osd)
+			if((power_antenna_osd) && (!skip_frame))
 			{
 				u8 x_offset = (config::sys_width / 8) - 3;
 				u8 y_offset = (config::sys_height / 8) - 1;
 				draw_osd_msg(std::string("***"), screen_buffer, x_offset, y_offset);
 			}
 
+			//Display profiler overlay
+			if((profiler::enabled) && (!skip_frame)) { profiler::draw_overlay(screen_buffer); }
+
 			//Update subscreen per frame
 			if(mem->sub_screen_update) { mem->sub_screen_lock = false; }
 
@@ -1675,20 +1852,37 @@ void AGB_LCD::step()
 
 			if(mem->g_pad->is_gb_player) { mem->g_pad->process_gb_rumble(); }
 
-			//Use SDL
-			if(config::sdl_render)
+			//Use SDL - Skipped frames are never presented
+			if((config::sdl_render) && (!skip_frame))
 			{
+				profiler::scope timer(profiler::PROF_PRESENT);
+
+				if(mem->sub_screen_buffer.size())
+				{
+					for(int a = 0; a < 0x9600; a++) { screen_buffer[0x9600 + a] = mem->sub_screen_buffer[a]; }
+				}
+
+				//Only present lines that changed since the last frame, or nothing at all if the frame is identical
+				u32 dirty_lines = frame_diff::update(screen_diff, screen_buffer.data(), config::sys_width, config::sys_height);
+
 				//If using SDL and no OpenGL, manually stretch for fullscreen via SDL
-				if((config::flags & SDL_WINDOW_FULLSCREEN) && (!config::use_opengl))
+				if((config::flags & SDL_WINDOW_FULLSCREEN) && (!config::use_opengl) && (dirty_lines))
 				{
 					//Lock source surface
 					if(SDL_MUSTLOCK(original_screen)){ SDL_LockSurface(original_screen); }
 					u32* out_pixel_data = (u32*)original_screen->pixels;
 
-					for(int a = 0; a < 0x9600; a++)
+					//Apply software filters
+					if(sw_filter::is_enabled())
 					{
-						out_pixel_data[a] = screen_buffer[a];
-						if(mem->sub_screen_buffer.size()) { out_pixel_data[0x9600 + a] = mem->sub_screen_buffer[a]; }
+						sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, original_screen->pitch >> 2);
+					}
+
+					else
+					{
+						u32 start = screen_diff.first_dirty * config::sys_width;
+						u32 end = (screen_diff.last_dirty + 1) * config::sys_width;
+						for(u32 a = start; a < end; a++) { out_pixel_data[a] = screen_buffer[a]; }
 					}
 
 					//Unlock source surface
@@ -1719,28 +1913,44 @@ void AGB_LCD::step()
 				}
 					
 				//Otherwise, render normally (SDL 1:1, OpenGL handles its own stretching)
-				else
+				else if(dirty_lines)
 				{
-					//Lock source surface
-					if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
-					u32* out_pixel_data = (u32*)final_screen->pixels;
+					//Display final screen buffer - OpenGL, uploaded straight from the screen buffer
+					if(config::use_opengl) { gx_blit_opengl(window, screen_buffer.data()); }
 
-					for(int a = 0; a < 0x9600; a++)
-					{
-						out_pixel_data[a] = screen_buffer[a];
-						if(mem->sub_screen_buffer.size()) { out_pixel_data[0x9600 + a] = mem->sub_screen_buffer[a]; }
-					}
-
-					//Unlock source surface
-					if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
-		
-					//Display final screen buffer - OpenGL
-					if(config::use_opengl) { gx_blit_opengl(window, final_screen); }
-				
 					//Display final screen buffer - SDL
-					else 
+					else
 					{
-						if(SDL_UpdateWindowSurface(window) != 0)
+						//Lock source surface
+						if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
+						u32* out_pixel_data = (u32*)final_screen->pixels;
+
+						//Apply software filters - Filters sample neighboring lines, so the whole frame is presented
+						SDL_Rect dirty_rect;
+						dirty_rect.x = 0;
+						dirty_rect.w = final_screen->w;
+						dirty_rect.y = 0;
+						dirty_rect.h = final_screen->h;
+
+						if(sw_filter::is_enabled())
+						{
+							sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, final_screen->pitch >> 2);
+						}
+
+						else
+						{
+							u32 start = screen_diff.first_dirty * config::sys_width;
+							u32 end = (screen_diff.last_dirty + 1) * config::sys_width;
+							for(u32 a = start; a < end; a++) { out_pixel_data[a] = screen_buffer[a]; }
+
+							dirty_rect.y = screen_diff.first_dirty;
+							dirty_rect.h = (screen_diff.last_dirty - screen_diff.first_dirty) + 1;
+						}
+
+						//Unlock source surface
+						if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
+
+						if(SDL_UpdateWindowSurfaceRects(window, &dirty_rect, 1) != 0)
 						{
 							std::cout<<"LCD::Error - Could not blit\n";
 
@@ -1759,8 +1969,10 @@ void AGB_LCD::step()
 			}
 
 			//Use external rendering method (GUI)
-			else
+			else if(!skip_frame)
 			{
+				profiler::scope timer(profiler::PROF_PRESENT);
+
 				if(!config::use_opengl)
 				{
 					if(mem->sub_screen_buffer.size())
@@ -1791,14 +2003,25 @@ void AGB_LCD::step()
 			}
 
 			//Limit framerate
+			bool is_behind = false;
+
 			if(!config::turbo)
 			{
+				profiler::scope timer(profiler::PROF_IDLE);
+
 				frame_current_time = SDL_GetTicks();
 				int delay = frame_delay[fps_count % 60];
 				if((frame_current_time - frame_start_time) < delay) { SDL_Delay(delay - (frame_current_time - frame_start_time));}
+				else if((frame_current_time - frame_start_time) > delay) { is_behind = true; }
 				frame_start_time = SDL_GetTicks();
 			}
 
+			//Total profiler timers for this frame
+			profiler::end_frame();
+
+			//Decide whether the next frame gets drawn
+			skip_frame = util::skip_next_frame(skipped_frames, is_behind);
+
 			//Update FPS counter + title
 			fps_count++;
 			if(((SDL_GetTicks() - fps_time) >= 1000) && (config::sdl_render))
@@ -1968,6 +2191,8 @@ bool AGB_LCD::lcd_read(u32 offset, std::string filename)
 	
 	if(!file.is_open()) { return false; }
 
+	render_worker.wait();
+
 	//Go to offset
 	file.seekg(offset);
 
@@ -2009,6 +2234,10 @@ bool AGB_LCD::lcd_read(u32 offset, std::string filename)
 	}
 
 	file.close();
+
+	//Render thread needs a full copy of the restored state
+	render_resync = true;
+
 	return true;
 }
 
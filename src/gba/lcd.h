@@ -16,6 +16,8 @@
 #include "mmu.h"
 
 #include "common/gx_util.h"
+#include "common/frame_diff.h"
+#include "common/line_worker.h"
 
 class AGB_LCD
 {
@@ -28,7 +30,7 @@ class AGB_LCD
 	u8 current_scanline;
 
 	//Core Functions
-	AGB_LCD();
+	AGB_LCD(bool is_render_only = false);
 	~AGB_LCD();
 
 	void step();
@@ -53,6 +55,9 @@ class AGB_LCD
 	int max_fullscreen_ratio;
 	bool power_antenna_osd;
 
+	//Micro-benchmarks drive the renderers directly
+	friend class gbe_bench;
+
 	private:
 
 	void update_oam();
@@ -60,6 +65,26 @@ class AGB_LCD
 	void update_obj_affine_transformation();
 	void update_obj_render_list();
 
+	//Threaded rendering - A second, render-only LCD draws each line from a snapshot of this one
+	AGB_LCD* render_lcd;
+	line_worker render_worker;
+	bool render_only;
+	bool render_resync;
+	bool obj_sync;
+	bool pal_sync;
+
+	bool use_render_thread();
+	void sync_render_lcd();
+	void render_line();
+
+	//VRAM and BLDCNT as seen by the renderer - Either live memory or the render thread's copy
+	u8* vram;
+	std::vector<u8> vram_shadow;
+	u8 blend_control;
+
+	//Screen buffer row the current line is pushed to
+	u32* line_target;
+
 	struct oam_entries
 	{
 		//X-Y Coordinates - X (0-511), Y(0-255)
@@ -134,6 +159,13 @@ class AGB_LCD
 	int fps_time;
 	int frame_delay[60];
 
+	//Frame skipping - Timing and IRQs still run, but no pixels are composed or presented
+	bool skip_frame;
+	u32 skipped_frames;
+
+	//Line hashes of the last presented frame
+	frame_diff::line_state screen_diff;
+
 	bool try_window_rebuild;
 
 	void render_scanline();
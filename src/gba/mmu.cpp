@@ -9,9 +9,14 @@
 // Handles reading and writing bytes to memory locations
 
 #include <filesystem>
+#include <cstring>
 
 #include "mmu.h"
 #include "common/util.h"
+#include "common/rom_cache.h"
+#include "common/mem_trace.h"
+#include "common/save_flush.h"
+#include "common/rom_archive.h"
 
 /****** MMU Constructor ******/
 AGB_MMU::AGB_MMU() 
@@ -22,7 +27,10 @@ AGB_MMU::AGB_MMU()
 /****** MMU Deconstructor ******/
 AGB_MMU::~AGB_MMU() 
 { 
-	save_backup(config::save_file);
+	//Background saving only has to write what changed since its last flush
+	if(save_flush::is_active()) { save_flush::stop(); }
+	else { save_backup(config::save_file); }
+
 	memory_map.clear();
 
 	#ifdef GBE_NETPLAY
@@ -49,6 +57,8 @@ void AGB_MMU::reset()
 	memory_map.clear();
 	memory_map.resize(0x10000000, 0);
 
+	mark_vram_dirty(0x6000000, 0x20000);
+
 	eeprom.data.clear();
 	eeprom.data.resize(0x200, 0);
 	eeprom.size = 0x200;
@@ -165,6 +175,7 @@ void AGB_MMU::reset()
 	current_save_type = NONE;
 
 	cheat_bytes.clear();
+	cheat_ops.clear();
 	gsa_patch_count = 0;
 
 	sio_emu_device_ready = false;
@@ -197,6 +208,17 @@ u8 AGB_MMU::read_u8(u32 address)
 	debug_addr[address & 0x3] = address;
 	#endif
 
+	//Memory access tracing - Perform the read first so the returned value is recorded
+	if((mem_trace::enabled) && (!mem_trace::in_read))
+	{
+		mem_trace::in_read = true;
+		u8 value = read_u8(address);
+		mem_trace::in_read = false;
+
+		mem_trace::record_access(address, value, mem_trace::TRACE_READ);
+		return value;
+	}
+
 	//Check for unused memory and mirrors first
 	switch(address >> 24)
 	{
@@ -603,6 +625,9 @@ void AGB_MMU::write_u8(u32 address, u8 value)
 	debug_addr[address & 0x3] = address;
 	#endif
 
+	//Memory access tracing
+	if(mem_trace::enabled) { mem_trace::record_access(address, value, mem_trace::TRACE_WRITE); }
+
 	//Check for unused memory and mirrors first
 	switch(address >> 24)
 	{
@@ -2145,11 +2170,25 @@ void AGB_MMU::write_u8(u32 address, u8 value)
 		lcd_stat->oam_update_list[(address & 0x3FF) >> 3] = true;
 	}
 
+	//Track VRAM writes for the LCD's render thread
+	else if((address >= 0x6000000) && (address <= 0x601FFFF))
+	{
+		vram_dirty[(address >> 8) & 0x1FF] = true;
+		vram_dirty_any = true;
+	}
+
 	//Write to FLASH RAM
 	else if(((current_save_type == FLASH_64) || (current_save_type == FLASH_128)) && (flash_ram.next_write) && (address >= 0xE000000) && (address <= 0xE00FFFF))
 	{
 			flash_ram.data[flash_ram.bank][(address & 0xFFFF)] = value;
 			flash_ram.next_write = false;
+			mark_save_dirty(((flash_ram.bank & 0x1) << 16) | (address & 0xFFFF), 1);
+	}
+
+	//Track SRAM writes for background saving
+	else if((current_save_type == SRAM) && (address >= 0xE000000) && (address <= 0xE007FFF))
+	{
+		mark_save_dirty((address & 0x7FFF), 1);
 	}
 
 	if(flash_ram.write_single_byte) 
@@ -2191,6 +2230,101 @@ void AGB_MMU::write_u32_fast(u32 address, u32 value)
 	memory_map[address+3] = ((value >> 24) & 0xFF);
 }	
 
+/****** Returns direct access to a block of memory for DMA if it lies entirely within plain RAM, VRAM, or ROM ******/
+u8* AGB_MMU::get_dma_block(u32 address, u32 length, bool is_write)
+{
+	if(!length) { return nullptr; }
+
+	u32 end_address = address + length - 1;
+
+	//Block cannot cross into another region or any mirrors
+	if((address >> 24) != (end_address >> 24)) { return nullptr; }
+
+	switch(address >> 24)
+	{
+		//Slow WRAM
+		case 0x2:
+			if(end_address > 0x203FFFF) { return nullptr; }
+			break;
+
+		//Fast WRAM
+		case 0x3:
+			if(end_address > 0x3007FFF) { return nullptr; }
+			break;
+
+		//Palette RAM
+		case 0x5:
+			if(end_address > 0x50003FF) { return nullptr; }
+			break;
+
+		//VRAM
+		case 0x6:
+			if(end_address > 0x6017FFF) { return nullptr; }
+			break;
+
+		//OAM
+		case 0x7:
+			if(end_address > 0x70003FF) { return nullptr; }
+			break;
+
+		//ROM - Read-only, only for carts without extra hardware mapped here
+		case 0x8:
+		case 0x9:
+			if(is_write) { return nullptr; }
+			if((config::cart_type == AGB_AM3) || (config::cart_type == AGB_PLAY_YAN) || (config::cart_type == AGB_CAMPHO) || (config::cart_type == AGB_TV_TUNER)) { return nullptr; }
+			if((gpio.type != GPIO_DISABLED) && (address <= 0x80000C9) && (end_address >= 0x80000C4)) { return nullptr; }
+			break;
+
+		//Everything else (BIOS, I/O, save memory) must go through the normal handlers
+		default:
+			return nullptr;
+	}
+
+	//Track VRAM writes for the LCD's render thread
+	if((is_write) && ((address >> 24) == 0x6)) { mark_vram_dirty(address, length); }
+
+	//Trigger palette and OAM updates in LCD for the whole block
+	if(is_write)
+	{
+		for(u32 x = address; x <= end_address; x++)
+		{
+			if((x >= 0x5000000) && (x <= 0x50001FF))
+			{
+				lcd_stat->bg_pal_update = true;
+				lcd_stat->bg_pal_update_list[(x & 0x1FF) >> 1] = true;
+			}
+
+			else if((x >= 0x5000200) && (x <= 0x50003FF))
+			{
+				lcd_stat->obj_pal_update = true;
+				lcd_stat->obj_pal_update_list[(x & 0x1FF) >> 1] = true;
+			}
+
+			else if((x >= 0x7000000) && (x <= 0x70003FF))
+			{
+				lcd_stat->oam_update = true;
+				lcd_stat->oam_update_list[(x & 0x3FF) >> 3] = true;
+			}
+
+			else { break; }
+		}
+	}
+
+	return &memory_map[address];
+}
+
+/****** Flags a range of VRAM as written so the LCD's render thread gets a fresh copy ******/
+void AGB_MMU::mark_vram_dirty(u32 address, u32 length)
+{
+	if(!length) { return; }
+
+	u32 start = (address - 0x6000000) >> 8;
+	u32 end = (address + length - 1 - 0x6000000) >> 8;
+
+	for(u32 x = start; (x <= end) && (x < 0x200); x++) { vram_dirty[x] = true; }
+	vram_dirty_any = true;
+}
+
 /****** Read binary file to memory ******/
 bool AGB_MMU::read_file(std::string filename)
 {
@@ -2220,6 +2354,18 @@ bool AGB_MMU::read_file(std::string filename)
 	u32 file_size = (config::use_am3_folder) ? 0 : util::get_file_size(filename);
 	if(!file_size && !config::use_am3_folder) { return util::report_error(filename, util::FILE_SIZE_ZERO); }
 
+	//Compressed ROMs are decompressed up front, since the whole ROM is mapped into memory
+	std::vector<u8> archive_data;
+	bool use_archive = (!config::use_am3_folder) && (rom_archive::is_archive(filename));
+
+	if(use_archive)
+	{
+		if(!rom_archive::extract(filename, archive_data, 0x2000000)) { return false; }
+
+		file_size = archive_data.size();
+		if(!file_size) { return util::report_error(filename, util::FILE_SIZE_ZERO); }
+	}
+
 	u8* ex_mem = &memory_map[0x8000000];
 
 	//For AM3 SmartMedia card dumps, only read 1st 1KB
@@ -2255,7 +2401,9 @@ bool AGB_MMU::read_file(std::string filename)
 			am3.card_data.resize(file_size, 0x00);
 
 			u8* am_mem = &am3.card_data[0];
-			file.read((char*)am_mem, file_size);
+
+			if(use_archive) { memcpy(am_mem, &archive_data[0], file_size); }
+			else { file.read((char*)am_mem, file_size); }
 
 			//Check the FAT to grab
 			if(!check_am3_fat())
@@ -2277,12 +2425,15 @@ bool AGB_MMU::read_file(std::string filename)
 		campho.data.resize(file_size);
 
 		ex_mem = &campho.data[0];
-		file.read((char*)ex_mem, file_size);
+
+		if(use_archive) { memcpy(ex_mem, &archive_data[0], file_size); }
+		else { file.read((char*)ex_mem, file_size); }
 
 		campho_map_rom_banks();
 	}	
 
 	//Read data from the ROM file
+	else if(use_archive) { memcpy(ex_mem, &archive_data[0], file_size); }
 	else { file.read((char*)ex_mem, file_size); }
 
 	file.close();
@@ -2317,13 +2468,13 @@ bool AGB_MMU::read_file(std::string filename)
 	std::cout<<"MMU::Game Code - " << util::make_ascii_printable(game_code) << "\n";
 	std::cout<<"MMU::Maker Code - " << util::make_ascii_printable(maker_code) << "\n";
 	std::cout<<"MMU::ROM Size: " << std::dec << (file_size / 1024) << "KB\n";
-	std::cout<<"MMU::ROM CRC32: " << std::hex << util::get_crc32(&memory_map[0x8000000], file_size) << "\n";
+	std::cout<<"MMU::ROM CRC32: " << std::hex << rom_cache::get_crc32(filename, &memory_map[0x8000000], file_size) << "\n";
 	std::cout<<"MMU::" << filename << " loaded successfully. \n";
 
 	//Apply patches to the ROM data
 	if(config::use_patches)
 	{
-		std::string patch_file = util::get_filename_no_ext(filename);
+		std::string patch_file = rom_archive::get_patch_filename(filename);
 
 		//Attempt a IPS patch
 		bool patch_pass = util::patch_ips((patch_file + ".ips"), memory_map, 0x8000000, 0x2000000);
@@ -2377,6 +2528,8 @@ bool AGB_MMU::read_file(std::string filename)
 			cheat_bytes.push_back(a_result);
 			cheat_bytes.push_back(v_result);
 		}
+
+		compile_cheats();
 	}
 
 	std::string backup_file = config::save_file;
@@ -3028,6 +3181,47 @@ bool AGB_MMU::save_backup(std::string filename)
 	return true;
 }
 
+/****** Marks part of the battery save as changed so it can be written in the background ******/
+void AGB_MMU::mark_save_dirty(u32 offset, u32 length)
+{
+	if(!config::use_save_flush) { return; }
+
+	u32 size = 0;
+
+	switch(current_save_type)
+	{
+		case SRAM: size = 0x8000; break;
+		case EEPROM: size = eeprom.size; break;
+		case FLASH_64: size = 0x10000; break;
+		case FLASH_128: size = 0x20000; break;
+
+		//Other save types are still written on exit
+		default: return;
+	}
+
+	//Start background saving on the first write, or restart it if the save size changed
+	if(save_flush::get_size() != size)
+	{
+		save_flush::start(config::save_file, size, [this](u32 offset, u8* dst, u32 length) { read_save_data(offset, dst, length); });
+	}
+
+	save_flush::mark_dirty(offset, length);
+}
+
+/****** Copies part of the battery save in the same layout used by save files ******/
+void AGB_MMU::read_save_data(u32 offset, u8* dst, u32 length)
+{
+	for(u32 x = 0; x < length; x++, offset++)
+	{
+		switch(current_save_type)
+		{
+			case SRAM: dst[x] = memory_map[0xE000000 + offset]; break;
+			case EEPROM: dst[x] = eeprom.data[offset]; break;
+			default: dst[x] = flash_ram.data[(offset >> 16) & 0x1][offset & 0xFFFF]; break;
+		}
+	}
+}
+
 /****** Start the DMA channels during blanking periods ******/
 void AGB_MMU::start_blank_dma()
 {
@@ -3161,6 +3355,8 @@ void AGB_MMU::eeprom_write_data()
 		}
 	}
 
+	mark_save_dirty((eeprom.address * 8), 8);
+
 	memory_map[0xD000000] = 0x1;
 }
 
@@ -3172,6 +3368,8 @@ void AGB_MMU::flash_erase_chip()
 		flash_ram.data[0][x] = 0xFF;
 		flash_ram.data[1][x] = 0xFF; 
 	}
+
+	mark_save_dirty(0, 0x20000);
 }
 
 /****** Erase 4KB sector of FLASH RAM ******/
@@ -3181,6 +3379,8 @@ void AGB_MMU::flash_erase_sector(u32 sector)
 	{ 
 		flash_ram.data[flash_ram.bank][(x & 0xFFFF)] = 0xFF; 
 	}
+
+	mark_save_dirty(((flash_ram.bank & 0x1) << 16) | (sector & 0xFFFF), 0x1000);
 }
 
 /****** Read 8-bit data from 8M DACS FLASH cartridge or its commands ******/
@@ -3615,6 +3815,7 @@ bool AGB_MMU::mmu_read(u32 offset, std::string filename)
 	//Serialize VRAM from save state
 	ex_mem = &memory_map[0x6000000];
 	file.read((char*)ex_mem, 0x18000);
+	mark_vram_dirty(0x6000000, 0x18000);
 
 	//Serialize OAM from save state
 	ex_mem = &memory_map[0x7000000];
@@ -3679,6 +3880,10 @@ bool AGB_MMU::mmu_read(u32 offset, std::string filename)
 	}
 
 	file.close();
+
+	//Save states replace battery save data, so all of it needs to be written again
+	mark_save_dirty(0, 0x20000);
+
 	return true;
 }
 
@@ -176,6 +176,18 @@ class AGB_MMU
 		TV_TUNER_MAX_SECS = 86400,
 	};
 
+	//Precompiled GSA cheat operations
+	enum gsa_cheat_types
+	{
+		GSA_RAM_WRITE_8,
+		GSA_RAM_WRITE_16,
+		GSA_RAM_WRITE_32,
+		GSA_WRITE_8,
+		GSA_WRITE_16,
+		GSA_WRITE_32,
+		GSA_IF_EQUAL_16,
+	};
+
 	backup_types current_save_type;
 
 	std::vector <u8> memory_map;
@@ -641,6 +653,17 @@ class AGB_MMU
 	std::vector<u32> cheat_bytes;
 	u8 gsa_patch_count;
 
+	//GSA cheats decoded once after loading a ROM, applied every VBlank
+	struct gsa_cheat_op
+	{
+		gsa_cheat_types type;
+		u32 addr;
+		u32 value;
+		u32 skip_count;
+	};
+
+	std::vector<gsa_cheat_op> cheat_ops;
+
 	bool sio_emu_device_ready;
 
 	std::vector<u32> sub_screen_buffer;
@@ -675,12 +698,17 @@ class AGB_MMU
 	void write_u16_fast(u32 address, u16 value);
 	void write_u32_fast(u32 address, u32 value);
 
+	u8* get_dma_block(u32 address, u32 length, bool is_write);
+	void mark_vram_dirty(u32 address, u32 length);
+
 	bool read_file(std::string filename);
 	bool read_bios(std::string filename);
 	bool read_am3_firmware(std::string filename);
 	bool read_smid(std::string filename);
 	bool save_backup(std::string filename);
 	bool load_backup(std::string filename);
+	void mark_save_dirty(u32 offset, u32 length);
+	void read_save_data(u32 offset, u8* dst, u32 length);
 
 	void eeprom_set_addr();
 	void eeprom_read_data();
@@ -799,7 +827,9 @@ class AGB_MMU
 	//Cheat code functions
 	void decrypt_gsa(u32 &addr, u32 &val, bool v1);
 	void set_cheats();
-	void process_cheats(u32 a, u32 v, u32& index);
+	void compile_cheats();
+	u32 compile_cheat(u32& index);
+	void add_cheat_write(u32 addr, u32 value, u8 size);
 
 	void set_lcd_data(agb_lcd_data* ex_lcd_stat);
 	void set_apu_data(agb_apu_data* ex_apu_stat);
@@ -809,6 +839,10 @@ class AGB_MMU
 	AGB_GamePad* g_pad;
 	std::vector<gba_timer>* timer;
 
+	//VRAM blocks (256 bytes each) written since the LCD last copied them for its render thread
+	bool vram_dirty[0x200];
+	bool vram_dirty_any;
+
 	//Serialize data for save state loading/saving
 	bool mmu_read(u32 offset, std::string filename);
 	bool mmu_write(std::string filename);
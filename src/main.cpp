@@ -15,6 +15,8 @@
 #include "min/core.h"
 #include "common/config.h"
 #include "common/info.h"
+#include "common/mem_trace.h"
+#include "common/profiler.h"
 
 #include <SDL_main.h>
 
@@ -42,9 +44,11 @@ int main(int argc, char* args[])
 	{ 
 		std::string temp_arg = args[x];
 		config::cli_args.push_back(temp_arg);
-		parse_filenames();
 	}
 
+	//ROM file is always the first argument, only needs to be parsed once
+	if(!config::cli_args.empty()) { parse_filenames(); }
+
 	//Load .ini options
 	load_ini_file("gbe.ini");
 	load_ini_file(config::game_ini_file);
@@ -130,8 +134,28 @@ int main(int argc, char* args[])
 	//Disbale mouse cursor in SDL, it's annoying
 	SDL_ShowCursor(SDL_DISABLE);
 
+	//Start memory access tracing from boot if requested
+	if(config::use_mem_trace) { mem_trace::start(); }
+
+	//Start frame-time profiling from boot if requested
+	if(config::use_profiler) { profiler::start(); }
+
 	//Actually run the core
 	gbe_plus->run_core();
 
+	//Save any memory trace still in progress
+	if(mem_trace::enabled)
+	{
+		mem_trace::stop();
+		mem_trace::dump(mem_trace::get_dump_filename());
+	}
+
+	//Save any profile still in progress
+	if(profiler::enabled)
+	{
+		profiler::stop();
+		profiler::export_trace(profiler::get_trace_filename());
+	}
+
 	return 0;
 }  
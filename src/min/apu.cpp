@@ -12,6 +12,7 @@
 #include <cmath>
 
 #include "apu.h"
+#include "common/profiler.h"
 
 /****** APU Constructor ******/
 MIN_APU::MIN_APU()
@@ -76,6 +77,9 @@ bool MIN_APU::init()
     	desired_spec.callback = min_audio_callback;
     	desired_spec.userdata = this;
 
+	//Allocate mixing buffers up front, the audio callback should never touch the heap
+	audio_mix::reserve(mix, 1, desired_spec.samples);
+
     	//Open SDL audio for desired specifications
 	if(SDL_OpenAudio(&desired_spec, nullptr) < 0) 
 	{ 
@@ -183,24 +187,23 @@ void MIN_APU::buffer_channel()
 /****** SDL Audio Callback ******/ 
 void min_audio_callback(void* _apu, u8 *_stream, int _length)
 {
+	profiler::scope timer(profiler::PROF_AUDIO_OUT);
+
 	s16* stream = (s16*) _stream;
 	int length = _length/2;
 
-	std::vector<s16> channel_stream(length);
-
 	MIN_APU* apu_link = (MIN_APU*) _apu;
-	apu_link->generate_samples(&channel_stream[0], length);
+	audio_mix::mix_buffers &mix = apu_link->mix;
+	audio_mix::reserve(mix, 1, length);
 
-	double channel_ratio = apu_link->apu_stat.channel_master_volume / 128.0;
+	apu_link->generate_samples(&mix.channel[0][0], length);
 
-	//Custom software mixing
-	for(u32 x = 0; x < length; x++)
-	{
-		//Multiply output by volume ratio
-		s16 out_sample = channel_stream[x] * channel_ratio;
+	//Custom software mixing - Multiply output by volume ratio
+	s32 gain = audio_mix::to_gain(apu_link->apu_stat.channel_master_volume / 128.0);
 
-		stream[x] = out_sample;
-	}
+	audio_mix::clear(&mix.left[0], length);
+	audio_mix::add(&mix.left[0], &mix.channel[0][0], gain, length);
+	audio_mix::store_mono(stream, &mix.left[0], length);
 }
 
 /****** Read APU data from save state ******/
@@ -15,6 +15,8 @@
 #include <sstream>
 
 #include "common/util.h"
+#include "common/mem_trace.h"
+#include "common/profiler.h"
 
 #include "core.h"
 
@@ -535,6 +537,12 @@ void MIN_core::handle_hotkey(SDL_Event& event)
 		config::turbo = false;
 	}
 		
+	//Start or stop memory access tracing on F10
+	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F10)) { mem_trace::toggle(); }
+
+	//Start or stop frame profiling on F11
+	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F11)) { profiler::toggle(); }
+
 	//Reset emulation on F8
 	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F8)) { reset(); }
 
@@ -623,6 +631,12 @@ void MIN_core::handle_hotkey(int input, bool pressed)
 	//Toggle turbo off
 	else if((input == config::hotkey_turbo) && (!pressed)) { config::turbo = false; }
 
+	//Start or stop memory access tracing on F10
+	else if((input == SDLK_F10) && (pressed)) { mem_trace::toggle(); }
+
+	//Start or stop frame profiling on F11
+	else if((input == SDLK_F11) && (pressed)) { profiler::toggle(); }
+
 	//Switch current netplay connection on F3 
 	else if((input == SDLK_F3) && (core_mmu.ir_stat.sync_timeout == 0) && (pressed))
 	{
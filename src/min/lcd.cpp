@@ -13,6 +13,7 @@
 
 #include "lcd.h"
 #include "common/util.h"
+#include "common/profiler.h"
 
 /****** LCD Constructor ******/
 MIN_LCD::MIN_LCD()
@@ -59,6 +60,12 @@ void MIN_LCD::reset()
 	lcd_stat.force_update = false;
 	lcd_stat.sed_enabled = true;
 
+	lcd_stat.update_map = true;
+	lcd_stat.update_prc = true;
+
+	map_cache.clear();
+	map_cache.resize(0x6000, 0x00);
+
 	frame_start_time = 0;
 	frame_current_time = 0;
 	fps_count = 0;
@@ -183,17 +190,29 @@ bool MIN_LCD::init()
 void MIN_LCD::update()
 {
 	//Only render if SED1565 is enabled
-	if(lcd_stat.sed_enabled)
+	//Skip composing a new frame if GDRAM, the map, sprites, and scrolling are unchanged since the last one
+	if((lcd_stat.sed_enabled) && (lcd_stat.update_prc || lcd_stat.sed_update || lcd_stat.force_update))
 	{
+		profiler::scope timer(profiler::PROF_PPU);
+
 		//Render map
 		if(lcd_stat.enable_map || lcd_stat.force_update) { render_map(); }
 
 		//Render sprites
 		if(lcd_stat.enable_obj) { render_obj(); }
+
+		lcd_stat.update_prc = false;
 	}
 
 	//Render pixel for a new frame if necessary
-	if(new_frame || lcd_stat.sed_update) { render_frame(); }
+	if(new_frame || lcd_stat.sed_update)
+	{
+		profiler::scope timer(profiler::PROF_PPU);
+		render_frame();
+	}
+
+	//Presentation covers both SDL and external rendering
+	u64 present_ticks = (profiler::enabled) ? profiler::get_ticks() : 0;
 
 	//Use SDL
 	if(config::sdl_render)
@@ -217,6 +236,9 @@ void MIN_LCD::update()
 				draw_osd_msg(config::osd_message, out_pixel_data, 0, 0, 0x1800);
 			}
 
+			//Display profiler overlay
+			if(profiler::enabled) { profiler::draw_overlay(out_pixel_data, 0x1800); }
+
 			//Unlock source surface
 			if(SDL_MUSTLOCK(original_screen)){ SDL_UnlockSurface(original_screen); }
 		
@@ -263,6 +285,9 @@ void MIN_LCD::update()
 				draw_osd_msg(config::osd_message, out_pixel_data, 0, 0, 0x1800);
 			}
 
+			//Display profiler overlay
+			if(profiler::enabled) { profiler::draw_overlay(out_pixel_data, 0x1800); }
+
 			//Unlock source surface
 			if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
 		
@@ -304,6 +329,9 @@ void MIN_LCD::update()
 				draw_osd_msg(config::osd_message, out_pixel_data, 0, 0);
 			}
 
+			//Display profiler overlay
+			if(profiler::enabled) { profiler::draw_overlay(out_pixel_data); }
+
 			config::render_external_sw(out_pixel_data);
 		}
 
@@ -325,6 +353,9 @@ void MIN_LCD::update()
 				draw_osd_msg(config::osd_message, out_pixel_data, 0, 0, 0x1800);
 			}
 
+			//Display profiler overlay
+			if(profiler::enabled) { profiler::draw_overlay(out_pixel_data, 0x1800); }
+
 			//Unlock source surface
 			if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
 
@@ -332,15 +363,22 @@ void MIN_LCD::update()
 		}
 	}
 
+	if(present_ticks) { profiler::add_time(profiler::PROF_PRESENT, profiler::get_ticks() - present_ticks); }
+
 	//Limit framerate
 	if(!config::turbo)
 	{
+		profiler::scope timer(profiler::PROF_IDLE);
+
 		frame_current_time = SDL_GetTicks();
 		int delay = frame_delay[fps_count % 72];
 		if((frame_current_time - frame_start_time) < delay) { SDL_Delay(delay - (frame_current_time - frame_start_time));}
 		frame_start_time = SDL_GetTicks();
 	}
 
+	//Total profiler timers for this frame
+	profiler::end_frame();
+
 	//Update FPS counter + title
 	fps_count++;
 	if(((SDL_GetTicks() - fps_time) >= 1000) && (config::sdl_render))
@@ -397,17 +435,6 @@ void MIN_LCD::render_map()
 	scr_w = map_w * 8;
 	scr_h = map_h * 8;
 
-	//Create a temp map before plotting pixel data
-	std::vector <u8> temp_map;
-	temp_map.resize((scr_w * scr_h), 0x00);
-
-	u32 tile_number = 0;
-	u32 tile_addr = 0;
-	u8 tile_byte = 0;
-	u8 tile_bit = 0;
-
-	u32 start_pos = 0;
-	u32 buffer_pos = 0;
 	u32 src_pos = 0;
 
 	u32 px = 0;
@@ -416,44 +443,58 @@ void MIN_LCD::render_map()
 	u32 vx = 0;
 	u32 vy = 0;
 
-	//Cycle through all tiles in tile map an calculate ON/OFF pixels
-	for(u32 y = 0; y < map_h; y++)
+	//Decode tiles only when the tile map or tile data changed, otherwise reuse the cached map
+	if(lcd_stat.update_map)
 	{
-		for(u32 x = 0; x < map_w; x++)
-		{
-			tile_number = mem->memory_map[0x1360 + (map_w * y) + x];
-			tile_addr = lcd_stat.map_addr + (tile_number * 8);
-			tile_byte = mem->memory_map[tile_addr++];
-			tile_bit = 0;
+		u32 tile_number = 0;
+		u32 tile_addr = 0;
+		u8 tile_byte = 0;
+		u8 tile_bit = 0;
 
-			start_pos = (scr_w * y * 8) + (x * 8);
+		u32 start_pos = 0;
+		u32 buffer_pos = 0;
 
-			//Render 64 pixels for a given tile
-			for(u32 i = 0; i < 64; i++)
+		//Cycle through all tiles in tile map an calculate ON/OFF pixels
+		for(u32 y = 0; y < map_h; y++)
+		{
+			for(u32 x = 0; x < map_w; x++)
 			{
-				py = i & 0x7;
-				px = i >> 3;
+				tile_number = mem->memory_map[0x1360 + (map_w * y) + x];
+				tile_addr = lcd_stat.map_addr + (tile_number * 8);
+				tile_byte = mem->memory_map[tile_addr++];
+				tile_bit = 0;
+
+				start_pos = (scr_w * y * 8) + (x * 8);
 
-				buffer_pos = start_pos + (scr_w * py) + px;
+				//Render 64 pixels for a given tile
+				for(u32 i = 0; i < 64; i++)
+				{
+					py = i & 0x7;
+					px = i >> 3;
 
-				if(tile_byte & (1 << tile_bit)) { temp_map[buffer_pos] = 0x1; }
-				else { temp_map[buffer_pos] = 0x00; }
+					buffer_pos = start_pos + (scr_w * py) + px;
 
-				tile_bit++;
+					if(tile_byte & (1 << tile_bit)) { map_cache[buffer_pos] = 0x1; }
+					else { map_cache[buffer_pos] = 0x00; }
 
-				if(tile_bit == 8)
-				{
-					tile_bit = 0;
-					tile_byte = mem->memory_map[tile_addr++];
+					tile_bit++;
+
+					if(tile_bit == 8)
+					{
+						tile_bit = 0;
+						tile_byte = mem->memory_map[tile_addr++];
+					}
 				}
 			}
 		}
+
+		lcd_stat.update_map = false;
 	}
 
 	px = 0;
 	py = 0;
 
-	//Copy data from temp map to GDRAM
+	//Copy data from cached map to GDRAM
 	for(u32 index = 0; index < 0x300; index++)
 	{
 		u8 pix_byte = 0;
@@ -467,8 +508,8 @@ void MIN_LCD::render_map()
 		for(u32 y = 0; y < 8; y++)
 		{
 			if((vx >= scr_w) || (vy >= scr_h)) { }
-			else if(temp_map[src_pos] && !lcd_stat.invert_map) { pix_byte |= pix_mask; }
-			else if(!temp_map[src_pos] && lcd_stat.invert_map) { pix_byte |= pix_mask; }
+			else if(map_cache[src_pos] && !lcd_stat.invert_map) { pix_byte |= pix_mask; }
+			else if(!map_cache[src_pos] && lcd_stat.invert_map) { pix_byte |= pix_mask; }
 
 			pix_mask <<= 1;
 			src_pos += scr_w;
@@ -731,6 +772,10 @@ bool MIN_LCD::lcd_read(u32 offset, std::string filename)
 	file.read((char*)&lcd_stat, sizeof(lcd_stat));
 	file.read((char*)&new_frame, sizeof(new_frame));
 
+	//Rebuild the PRC map and frame from restored memory
+	lcd_stat.update_map = true;
+	lcd_stat.update_prc = true;
+
 	//Serialize screen buffers from save state
 	for(u32 x = 0; x < 0x1800; x++)
 	{
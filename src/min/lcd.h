@@ -61,6 +61,9 @@ class MIN_LCD
 	std::vector<u32> screen_buffer;
 	std::vector<u32> old_buffer;
 
+	//Decoded PRC map, only rebuilt when the tile map or its tiles change
+	std::vector<u8> map_cache;
+
 	int frame_start_time;
 	int frame_current_time;
 	int fps_count;
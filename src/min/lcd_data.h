@@ -36,6 +36,10 @@ struct min_lcd_data
 	bool enable_copy;
 	bool force_update;
 
+	//Set by the MMU when anything feeding the PRC changes
+	bool update_map;
+	bool update_prc;
+
 	bool sed_enabled;
 	bool sed_update;
 	u8 sed_contrast;
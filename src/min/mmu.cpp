@@ -9,10 +9,14 @@
 // Handles reading and writing bytes to memory locations
 // Also loads ROM and BIOS files
 
+#include <cstring>
 #include <filesystem>
 #include <ctime>
 
 #include "mmu.h"
+#include "common/mem_trace.h"
+#include "common/rom_cache.h"
+#include "common/rom_archive.h"
 
 /****** MMU Constructor ******/
 MIN_MMU::MIN_MMU() 
@@ -109,6 +113,17 @@ u8 MIN_MMU::read_u8(u32 address)
 	debug_addr = address;
 	#endif
 
+	//Memory access tracing - Perform the read first so the returned value is recorded
+	if((mem_trace::enabled) && (!mem_trace::in_read))
+	{
+		mem_trace::in_read = true;
+		u8 value = read_u8(address);
+		mem_trace::in_read = false;
+
+		mem_trace::record_access(address, value, mem_trace::TRACE_READ);
+		return value;
+	}
+
 	//Mirror Cart ROM
 	if(address >= 0x200000) { address &= 0x1FFFFF; }
 
@@ -223,8 +238,17 @@ void MIN_MMU::write_u8(u32 address, u8 value)
 	debug_addr = address;
 	#endif
 
+	//Memory access tracing
+	if(mem_trace::enabled) { mem_trace::record_access(address, value, mem_trace::TRACE_WRITE); }
+
 	//Only write to RAM and MMIO registers
-	if((address > 0xFFF)  && (address < 0x2100)) { memory_map[address] = value; }
+	if((address > 0xFFF)  && (address < 0x2100))
+	{
+		memory_map[address] = value;
+
+		//Flag PRC updates for writes to GDRAM, OAM, the tile map, or any tiles stored in RAM
+		if(address < 0x2000) { update_prc_data(address); }
+	}
 
 	//Process MMIO registers
 	switch(address & 0xFFFFFF)
@@ -599,6 +623,9 @@ void MIN_MMU::write_u8(u32 address, u8 value)
 			lcd_stat->enable_copy = (value & 0x8) ? true : false;
 			lcd_stat->map_size = (value >> 4) & 0x3;
 
+			lcd_stat->update_map = true;
+			lcd_stat->update_prc = true;
+
 			break;
 
 		//PRC Map Address
@@ -607,16 +634,20 @@ void MIN_MMU::write_u8(u32 address, u8 value)
 		case PRC_MAP_HI:
 			lcd_stat->map_addr = (memory_map[PRC_MAP_HI] << 16) | (memory_map[PRC_MAP_MID] << 8) | memory_map[PRC_MAP_LO];
 			lcd_stat->map_addr &= 0x1FFFF8;
+			lcd_stat->update_map = true;
+			lcd_stat->update_prc = true;
 			break;
 
 		//Scroll Y
 		case PRC_SY:
 			lcd_stat->scroll_y = value;
+			lcd_stat->update_prc = true;
 			break;
 
 		//Scroll X
 		case PRC_SX:
 			lcd_stat->scroll_x = value;
+			lcd_stat->update_prc = true;
 			break;
 
 		//PRC Sprite Address
@@ -625,6 +656,7 @@ void MIN_MMU::write_u8(u32 address, u8 value)
 		case PRC_SPR_HI:
 			lcd_stat->obj_addr = (memory_map[PRC_SPR_HI] << 16) | (memory_map[PRC_SPR_MID] << 8) | memory_map[PRC_SPR_LO];
 			lcd_stat->obj_addr &= 0x1FFFC0;
+			lcd_stat->update_prc = true;
 			break;
 
 		//LCD Control
@@ -697,8 +729,18 @@ bool MIN_MMU::read_file(std::string filename)
 		return false;
 	}
 
+	//Decompress entire ROM file
+	std::vector<u8> rom_file;
+	bool use_archive = rom_archive::is_archive(filename);
+
+	if(use_archive)
+	{
+		file.close();
+		if(!rom_archive::extract(filename, rom_file, 0x200000)) { return false; }
+	}
+
 	//Get the file size
-	u32 file_size = util::get_file_size(filename);
+	u32 file_size = (use_archive) ? rom_file.size() : util::get_file_size(filename);
 
 	if(file_size < 0x2100)
 	{
@@ -707,19 +749,22 @@ bool MIN_MMU::read_file(std::string filename)
 	}
 	
 	file_size -= 0x2100;
-	file.seekg(0x2100, file.beg);
-
 	u8* ex_mem = &memory_map[0x2100];
 
 	//Read data from the ROM file
-	file.read((char*)ex_mem, file_size);
+	if(use_archive) { memcpy(ex_mem, &rom_file[0x2100], file_size); }
 
-	file.close();
+	else
+	{
+		file.seekg(0x2100, file.beg);
+		file.read((char*)ex_mem, file_size);
+		file.close();
+	}
 
 	//Apply patches to the ROM data
 	if(config::use_patches)
 	{
-		std::string patch_file = util::get_filename_no_ext(filename);
+		std::string patch_file = rom_archive::get_patch_filename(filename);
 
 		//Attempt a IPS patch
 		bool patch_pass = util::patch_ips((patch_file + ".ips"), memory_map, 0x2100, file_size);
@@ -748,16 +793,13 @@ bool MIN_MMU::read_file(std::string filename)
 	std::cout<<"MMU::Game Title - " << util::make_ascii_printable(title) << "\n";
 	std::cout<<"MMU::Game Code - " << util::make_ascii_printable(game_code) << "\n";
 	std::cout<<"MMU::ROM Size: " << std::dec << (file_size / 1024) << "KB\n";
-	std::cout<<"MMU::ROM CRC32: " << std::hex << util::get_crc32(&memory_map[0x2100], file_size) << "\n";
+	std::cout<<"MMU::ROM CRC32: " << std::hex << rom_cache::get_crc32(filename, &memory_map[0x2100], file_size) << "\n";
 	std::cout<<"MMU::" << filename << " loaded successfully. \n";
 
 	//Apply patches to the ROM data
 	if(config::use_patches)
 	{
-		std::size_t dot = filename.find_last_of(".");
-		if(dot == std::string::npos) { dot = filename.size(); }
-
-		std::string patch_file = filename.substr(0, dot);
+		std::string patch_file = rom_archive::get_patch_filename(filename);
 
 		//Attempt a IPS patch
 		bool patch_pass = util::patch_ips((patch_file + ".ips"), memory_map, 0, 0x200000);
@@ -1485,6 +1527,30 @@ void MIN_MMU::process_sed1565()
 	}
 }
 
+/****** Marks the PRC map or frame as needing to be redrawn after a RAM write ******/
+void MIN_MMU::update_prc_data(u32 address)
+{
+	//GDRAM and OAM
+	if(address < 0x1360) { lcd_stat->update_prc = true; }
+
+	//Tile map
+	else if(address < 0x14E0)
+	{
+		lcd_stat->update_map = true;
+		lcd_stat->update_prc = true;
+	}
+
+	//Map tiles stored in RAM
+	if((address >= lcd_stat->map_addr) && (address < (lcd_stat->map_addr + 0x800)))
+	{
+		lcd_stat->update_map = true;
+		lcd_stat->update_prc = true;
+	}
+
+	//Sprite tiles stored in RAM
+	if((address >= lcd_stat->obj_addr) && (address < (lcd_stat->obj_addr + 0x4000))) { lcd_stat->update_prc = true; }
+}
+
 /****** Points the MMU to an lcd_data structure (FROM THE LCD ITSELF) ******/
 void MIN_MMU::set_lcd_data(min_lcd_data* ex_lcd_stat) { lcd_stat = ex_lcd_stat; }
 
@@ -170,6 +170,7 @@ class MIN_MMU
 	#endif
 
 	void set_lcd_data(min_lcd_data* ex_lcd_stat);
+	void update_prc_data(u32 address);
 	void set_apu_data(min_apu_data* ex_apu_stat);
 
 	MIN_GamePad* g_pad;
@@ -9,6 +9,8 @@
 // Emulates a S1C88 in software
 
 #include "s1c88.h"
+#include "common/mem_trace.h"
+#include "common/profiler.h"
 
 /****** S1C88 Constructor ******/
 S1C88::S1C88() 
@@ -1214,6 +1216,35 @@ s16 S1C88::comp16(u16 reg_one)
 	return result;
 } 
 
+/****** Reads a byte of the current instruction stream ******/
+inline u8 S1C88::read_code_u8(u32 address)
+{
+	#ifdef GBE_DEBUG
+	return mem->read_u8(address);
+	#else
+
+	//Mirror addresses past 2MB like the MMU does
+	address &= 0x1FFFFF;
+
+	//Only MMIO registers (or tracing) need the full MMU handler, everything else is read directly
+	if(((address & 0x1FFF00) == 0x2000) || (mem_trace::enabled)) { return mem->read_u8(address); }
+	return mem->memory_map[address];
+
+	#endif
+}
+
+/****** Fetches the next unsigned 8-bit operand and advances the extended PC ******/
+inline u8 S1C88::fetch_u8() { return read_code_u8(reg.pc_ex++); }
+
+/****** Fetches the next signed 8-bit operand and advances the extended PC ******/
+inline s8 S1C88::fetch_s8() { return (s8)read_code_u8(reg.pc_ex++); }
+
+/****** Reads the unsigned 16-bit operand at the extended PC ******/
+inline u16 S1C88::fetch_u16() { return ((read_code_u8(reg.pc_ex + 1) << 8) | read_code_u8(reg.pc_ex)); }
+
+/****** Reads the signed 16-bit operand at the extended PC ******/
+inline s16 S1C88::fetch_s16() { return (s16)fetch_u16(); }
+
 /****** Fetch, decode, and execute instruction ******/
 void S1C88::execute()
 {
@@ -1228,7 +1259,7 @@ void S1C88::execute()
 	s16 s_temp = 0;
 
 	//Read 1st byte of opcode
-	opcode = mem->read_u8(reg.pc_ex++);
+	opcode = fetch_u8();
 	reg.pc++;
 
 	//Decode (and fetch additional bytes) and execute instructions
@@ -1248,7 +1279,7 @@ void S1C88::execute()
 
 		//ADD A, #nn
 		case 0x02:
-			reg.a = add_u8(reg.a, mem->read_u8(reg.pc_ex++));
+			reg.a = add_u8(reg.a, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -1262,7 +1293,7 @@ void S1C88::execute()
 
 		//ADD A, [BR + #nn]
 		case 0x04:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			reg.a = add_u8(reg.a, temp_val);
 			system_cycles = 12;
 
@@ -1271,7 +1302,7 @@ void S1C88::execute()
 
 		//ADD A, [#nnnn]
 		case 0x05:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.a = add_u8(reg.a, mem->read_u8(temp_val));
 			system_cycles = 16;
 
@@ -1304,7 +1335,7 @@ void S1C88::execute()
 
 		//ADC A, #nn
 		case 0x0A:
-			reg.a = adc_u8(reg.a, mem->read_u8(reg.pc_ex++));
+			reg.a = adc_u8(reg.a, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -1318,7 +1349,7 @@ void S1C88::execute()
 
 		//ADC A, [BR + #nn]
 		case 0x0C:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			reg.a = adc_u8(reg.a, temp_val);
 			system_cycles = 12;
 
@@ -1327,7 +1358,7 @@ void S1C88::execute()
 
 		//ADC A, [#nnnn]
 		case 0x0D:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.a = adc_u8(reg.a, mem->read_u8(temp_val));
 			system_cycles = 16;
 
@@ -1360,7 +1391,7 @@ void S1C88::execute()
 
 		//SUB A, #nn
 		case 0x12:
-			reg.a = sub_u8(reg.a, mem->read_u8(reg.pc_ex++));
+			reg.a = sub_u8(reg.a, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -1374,7 +1405,7 @@ void S1C88::execute()
 
 		//SUB A, [BR + #nn]
 		case 0x14:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			reg.a = sub_u8(reg.a, temp_val);
 			system_cycles = 12;
 
@@ -1383,7 +1414,7 @@ void S1C88::execute()
 
 		//SUB A, [#nnnn]
 		case 0x15:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.a = sub_u8(reg.a, mem->read_u8(temp_val));
 			system_cycles = 16;
 
@@ -1416,7 +1447,7 @@ void S1C88::execute()
 
 		//SBC A, #nn
 		case 0x1A:
-			reg.a = sbc_u8(reg.a, mem->read_u8(reg.pc_ex++));
+			reg.a = sbc_u8(reg.a, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -1430,7 +1461,7 @@ void S1C88::execute()
 
 		//SBC A, [BR + #nn]
 		case 0x1C:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			reg.a = sbc_u8(reg.a, temp_val);
 			system_cycles = 12;
 
@@ -1439,7 +1470,7 @@ void S1C88::execute()
 
 		//SBC A, [#nnnn]
 		case 0x1D:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.a = sbc_u8(reg.a, mem->read_u8(temp_val));
 			system_cycles = 16;
 
@@ -1472,7 +1503,7 @@ void S1C88::execute()
 
 		//AND A, #nn
 		case 0x22:
-			reg.a = and_u8(reg.a, mem->read_u8(reg.pc_ex++));
+			reg.a = and_u8(reg.a, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -1486,7 +1517,7 @@ void S1C88::execute()
 
 		//AND A, [BR + #nn]
 		case 0x24:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			reg.a = and_u8(reg.a, temp_val);
 			system_cycles = 8;
 
@@ -1495,7 +1526,7 @@ void S1C88::execute()
 
 		//AND A, [#nnnn]
 		case 0x25:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.a = and_u8(reg.a, mem->read_u8(temp_val));
 			system_cycles = 16;
 
@@ -1528,7 +1559,7 @@ void S1C88::execute()
 
 		//OR A, #nn
 		case 0x2A:
-			reg.a = or_u8(reg.a, mem->read_u8(reg.pc_ex++));
+			reg.a = or_u8(reg.a, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -1542,7 +1573,7 @@ void S1C88::execute()
 
 		//OR A, [BR + #nn]
 		case 0x2C:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			reg.a = or_u8(reg.a, temp_val);
 			system_cycles = 8;
 
@@ -1551,7 +1582,7 @@ void S1C88::execute()
 
 		//OR A, [#nnnn]
 		case 0x2D:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.a = or_u8(reg.a, mem->read_u8(temp_val));
 			system_cycles = 16;
 
@@ -1584,7 +1615,7 @@ void S1C88::execute()
 
 		//CP A, #nn
 		case 0x32:
-			cp_u8(reg.a, mem->read_u8(reg.pc_ex++));
+			cp_u8(reg.a, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -1598,7 +1629,7 @@ void S1C88::execute()
 
 		//CP A, [BR + #nn]
 		case 0x34:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			cp_u8(reg.a, temp_val);
 			system_cycles = 12;
 
@@ -1607,7 +1638,7 @@ void S1C88::execute()
 
 		//CP A, [#nnnn]
 		case 0x35:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			cp_u8(reg.a, mem->read_u8(temp_val));
 			system_cycles = 16;
 
@@ -1640,7 +1671,7 @@ void S1C88::execute()
 
 		//XOR A, #nn
 		case 0x3A:
-			reg.a = xor_u8(reg.a, mem->read_u8(reg.pc_ex++));
+			reg.a = xor_u8(reg.a, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -1654,7 +1685,7 @@ void S1C88::execute()
 
 		//XOR A, [BR + #nn]
 		case 0x3C:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			reg.a = xor_u8(reg.a, temp_val);
 			system_cycles = 8;
 
@@ -1663,7 +1694,7 @@ void S1C88::execute()
 
 		//XOR A, [#nnnn]
 		case 0x3D:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.a = xor_u8(reg.a, mem->read_u8(temp_val));
 			system_cycles = 16;
 
@@ -1707,7 +1738,7 @@ void S1C88::execute()
 
 		//LD A, [BR + #nn]
 		case 0x44:
-			reg.a = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			reg.a = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			system_cycles = 12;
 
 			reg.pc++;
@@ -1756,7 +1787,7 @@ void S1C88::execute()
 
 		//LD B, [BR + #nn]
 		case 0x4C:
-			reg.b = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			reg.b = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			system_cycles = 12;
 
 			reg.pc++;
@@ -1805,7 +1836,7 @@ void S1C88::execute()
 
 		//LD L, [BR + #nn]
 		case 0x54:
-			reg.l = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			reg.l = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			system_cycles = 12;
 
 			reg.pc++;
@@ -1854,7 +1885,7 @@ void S1C88::execute()
 
 		//LD H, [BR + #nn]
 		case 0x5C:
-			reg.h = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			reg.h = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			system_cycles = 12;
 
 			reg.pc++;
@@ -1904,7 +1935,7 @@ void S1C88::execute()
 
 		//LD [IX], [BR + #nn]
 		case 0x64:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			mem->write_u8(reg.ix_ex, temp_val);
 			system_cycles = 16;
 
@@ -1955,7 +1986,7 @@ void S1C88::execute()
 
 		//LD [HL], [BR + #nn]
 		case 0x6C:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			mem->write_u8(reg.hl_ex, temp_val);
 			system_cycles = 16;
 
@@ -2006,7 +2037,7 @@ void S1C88::execute()
 
 		//LD [IY], [BR + #nn]
 		case 0x74:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
 			mem->write_u8(reg.iy_ex, temp_val);
 			system_cycles = 16;
 
@@ -2033,7 +2064,7 @@ void S1C88::execute()
 
 		//LD [BR + #nn], A
 		case 0x78:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
+			temp_val = (reg.br_ex << 8) | fetch_u8();
 			mem->write_u8(temp_val, reg.a);
 			system_cycles = 12;
 
@@ -2042,7 +2073,7 @@ void S1C88::execute()
 
 		//LD [BR + #nn], B
 		case 0x79:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
+			temp_val = (reg.br_ex << 8) | fetch_u8();
 			mem->write_u8(temp_val, reg.b);
 			system_cycles = 12;
 
@@ -2051,7 +2082,7 @@ void S1C88::execute()
 
 		//LD [BR + #nn], L
 		case 0x7A:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
+			temp_val = (reg.br_ex << 8) | fetch_u8();
 			mem->write_u8(temp_val, reg.l);
 			system_cycles = 12;
 
@@ -2060,7 +2091,7 @@ void S1C88::execute()
 
 		//LD [BR + #nn], H
 		case 0x7B:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
+			temp_val = (reg.br_ex << 8) | fetch_u8();
 			mem->write_u8(temp_val, reg.h);
 			system_cycles = 12;
 
@@ -2069,7 +2100,7 @@ void S1C88::execute()
 
 		//LD [BR + #nn], [HL]
 		case 0x7D:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
+			temp_val = (reg.br_ex << 8) | fetch_u8();
 			mem->write_u8(temp_val, mem->read_u8(reg.hl_ex));
 			system_cycles = 16;
 
@@ -2078,7 +2109,7 @@ void S1C88::execute()
 
 		//LD [BR + #nn], [IX]
 		case 0x7E:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
+			temp_val = (reg.br_ex << 8) | fetch_u8();
 			mem->write_u8(temp_val, mem->read_u8(reg.ix_ex));
 			system_cycles = 16;
 
@@ -2087,7 +2118,7 @@ void S1C88::execute()
 
 		//LD [BR + #nn], [IY]
 		case 0x7F:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
+			temp_val = (reg.br_ex << 8) | fetch_u8();
 			mem->write_u8(temp_val, mem->read_u8(reg.iy_ex));
 			system_cycles = 16;
 
@@ -2126,7 +2157,7 @@ void S1C88::execute()
 
 		//INC [BR + #nn]
 		case 0x85:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
+			temp_val = (reg.br_ex << 8) | fetch_u8();
 			mem->write_u8(temp_val, inc_u8(mem->read_u8(temp_val)));
 			system_cycles = 16;
 
@@ -2178,7 +2209,7 @@ void S1C88::execute()
 
 		//DEC [BR + #nn]
 		case 0x8D:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
+			temp_val = (reg.br_ex << 8) | fetch_u8();
 			mem->write_u8(temp_val, dec_u8(mem->read_u8(temp_val)));
 			system_cycles = 16;
 
@@ -2230,7 +2261,7 @@ void S1C88::execute()
 
 		//BIT [HL], #nn
 		case 0x95:
-			bit_u8(mem->read_u8(reg.hl_ex), mem->read_u8(reg.pc_ex++));
+			bit_u8(mem->read_u8(reg.hl_ex), fetch_u8());
 			system_cycles = 12;
 
 			reg.pc++;
@@ -2238,7 +2269,7 @@ void S1C88::execute()
 
 		//BIT A, #nn
 		case 0x96:
-			bit_u8(reg.a, mem->read_u8(reg.pc_ex++));
+			bit_u8(reg.a, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -2246,7 +2277,7 @@ void S1C88::execute()
 
 		//BIT B, #nn
 		case 0x97:
-			bit_u8(reg.b, mem->read_u8(reg.pc_ex++));
+			bit_u8(reg.b, fetch_u8());
 			system_cycles = 8;
 
 			reg.pc++;
@@ -2278,7 +2309,7 @@ void S1C88::execute()
 
 		//AND SC, #nn
 		case 0x9C:
-			reg.sc = and_u8(reg.sc, mem->read_u8(reg.pc_ex++));
+			reg.sc = and_u8(reg.sc, fetch_u8());
 			system_cycles = 12;
 			skip_irq = true;
 
@@ -2287,7 +2318,7 @@ void S1C88::execute()
 
 		//OR SC, #nn
 		case 0x9D:
-			reg.sc = or_u8(reg.sc, mem->read_u8(reg.pc_ex++));
+			reg.sc = or_u8(reg.sc, fetch_u8());
 			system_cycles = 12;
 			skip_irq = true;
 
@@ -2296,7 +2327,7 @@ void S1C88::execute()
 
 		//XOR SC, #nn
 		case 0x9E:
-			reg.sc = xor_u8(reg.sc, mem->read_u8(reg.pc_ex++));
+			reg.sc = xor_u8(reg.sc, fetch_u8());
 			system_cycles = 12;
 			skip_irq = true;
 
@@ -2305,7 +2336,7 @@ void S1C88::execute()
 
 		//LD SC, #nn
 		case 0x9F:
-			reg.sc = mem->read_u8(reg.pc_ex++);
+			reg.sc = fetch_u8();
 			system_cycles = 12;
 			skip_irq = true;
 
@@ -2421,7 +2452,7 @@ void S1C88::execute()
 
 		//LD A, #nn
 		case 0xB0:
-			reg.a = mem->read_u8(reg.pc_ex++);
+			reg.a = fetch_u8();
 			system_cycles = 8;
 
 			reg.pc++;
@@ -2429,7 +2460,7 @@ void S1C88::execute()
 
 		//LD B, #nn
 		case 0xB1:
-			reg.b = mem->read_u8(reg.pc_ex++);
+			reg.b = fetch_u8();
 			system_cycles = 8;
 
 			reg.pc++;
@@ -2437,7 +2468,7 @@ void S1C88::execute()
 
 		//LD L, #nn
 		case 0xB2:
-			reg.l = mem->read_u8(reg.pc_ex++);
+			reg.l = fetch_u8();
 			system_cycles = 8;
 
 			reg.pc++;
@@ -2445,7 +2476,7 @@ void S1C88::execute()
 
 		//LD H, #nn
 		case 0xB3:
-			reg.h = mem->read_u8(reg.pc_ex++);
+			reg.h = fetch_u8();
 			system_cycles = 8;
 
 			reg.pc++;
@@ -2453,7 +2484,7 @@ void S1C88::execute()
 
 		//LD BR, #nn
 		case 0xB4:
-			reg.br = mem->read_u8(reg.pc_ex++);
+			reg.br = fetch_u8();
 			system_cycles = 8;
 
 			reg.pc++;
@@ -2461,7 +2492,7 @@ void S1C88::execute()
 
 		//LD [HL], #nn
 		case 0xB5:
-			mem->write_u8(reg.hl_ex, mem->read_u8(reg.pc_ex++));
+			mem->write_u8(reg.hl_ex, fetch_u8());
 			system_cycles = 12;
 
 			reg.pc++;
@@ -2469,7 +2500,7 @@ void S1C88::execute()
 
 		//LD [IX], #nn
 		case 0xB6:
-			mem->write_u8(reg.ix_ex, mem->read_u8(reg.pc_ex++));
+			mem->write_u8(reg.ix_ex, fetch_u8());
 			system_cycles = 12;
 
 			reg.pc++;
@@ -2477,7 +2508,7 @@ void S1C88::execute()
 
 		//LD [IY], #nn
 		case 0xB7:
-			mem->write_u8(reg.iy_ex, mem->read_u8(reg.pc_ex++));
+			mem->write_u8(reg.iy_ex, fetch_u8());
 			system_cycles = 12;
 
 			reg.pc++;
@@ -2485,7 +2516,7 @@ void S1C88::execute()
 
 		//LD BA, [#nnnn]
 		case 0xB8:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.ba = mem->read_u16(temp_val);
 			system_cycles = 20;
 
@@ -2494,7 +2525,7 @@ void S1C88::execute()
 
 		//LD HL, [#nnnn]
 		case 0xB9:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.hl = mem->read_u16(temp_val);
 			system_cycles = 20;
 
@@ -2503,7 +2534,7 @@ void S1C88::execute()
 
 		//LD IX, [#nnnn]
 		case 0xBA:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.ix = mem->read_u16(temp_val);
 			system_cycles = 20;
 
@@ -2512,7 +2543,7 @@ void S1C88::execute()
 
 		//LD IY, [#nnnn]
 		case 0xBB:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.iy = mem->read_u16(temp_val);
 			system_cycles = 20;
 
@@ -2521,7 +2552,7 @@ void S1C88::execute()
 
 		//LD [#nnnn], BA
 		case 0xBC:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			mem->write_u16(temp_val, reg.ba);
 			system_cycles = 20;
 
@@ -2530,7 +2561,7 @@ void S1C88::execute()
 
 		//LD [#nnnn], HL
 		case 0xBD:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			mem->write_u16(temp_val, reg.hl);
 			system_cycles = 20;
 
@@ -2539,7 +2570,7 @@ void S1C88::execute()
 
 		//LD [#nnnn], IX
 		case 0xBE:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			mem->write_u16(temp_val, reg.ix);
 			system_cycles = 20;
 
@@ -2548,7 +2579,7 @@ void S1C88::execute()
 
 		//LD [#nnnn], IY
 		case 0xBF:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			mem->write_u16(temp_val, reg.iy);
 			system_cycles = 20;
 
@@ -2557,7 +2588,7 @@ void S1C88::execute()
 
 		//ADD BA, #nnnn
 		case 0xC0:
-			temp_val = mem->read_u16(reg.pc_ex);
+			temp_val = fetch_u16();
 			reg.ba = add_u16(reg.ba, temp_val);
 			system_cycles = 12;
 
@@ -2566,7 +2597,7 @@ void S1C88::execute()
 
 		//ADD HL, #nnnn
 		case 0xC1:
-			temp_val = mem->read_u16(reg.pc_ex);
+			temp_val = fetch_u16();
 			reg.hl = add_u16(reg.hl, temp_val);
 			system_cycles = 12;
 
@@ -2575,7 +2606,7 @@ void S1C88::execute()
 
 		//ADD IX, #nnnn
 		case 0xC2:
-			temp_val = mem->read_u16(reg.pc_ex);
+			temp_val = fetch_u16();
 			reg.ix = add_u16(reg.ix, temp_val);
 			system_cycles = 12;
 
@@ -2584,7 +2615,7 @@ void S1C88::execute()
 
 		//ADD IY, #nnnn
 		case 0xC3:
-			temp_val = mem->read_u16(reg.pc_ex);
+			temp_val = fetch_u16();
 			reg.iy = add_u16(reg.iy, temp_val);
 			system_cycles = 12;
 
@@ -2593,7 +2624,7 @@ void S1C88::execute()
 
 		//LD BA, #nnnn
 		case 0xC4:
-			reg.ba = mem->read_u16(reg.pc_ex);
+			reg.ba = fetch_u16();
 			system_cycles = 12;
 
 			reg.pc += 2;
@@ -2601,7 +2632,7 @@ void S1C88::execute()
 
 		//LD HL, #nnnn
 		case 0xC5:
-			reg.hl = mem->read_u16(reg.pc_ex);
+			reg.hl = fetch_u16();
 			system_cycles = 12;
 
 			reg.pc += 2;
@@ -2609,7 +2640,7 @@ void S1C88::execute()
 
 		//LD IX, #nnnn
 		case 0xC6:
-			reg.ix = mem->read_u16(reg.pc_ex);
+			reg.ix = fetch_u16();
 			system_cycles = 12;
 
 			reg.pc += 2;
@@ -2617,7 +2648,7 @@ void S1C88::execute()
 
 		//LD IY, #nnnn
 		case 0xC7:
-			reg.iy = mem->read_u16(reg.pc_ex);
+			reg.iy = fetch_u16();
 			system_cycles = 12;
 
 			reg.pc += 2;
@@ -2673,2661 +2704,21 @@ void S1C88::execute()
 
 		//Extend 0xCE instructions
 		case 0xCE:
-			opcode = (opcode << 8) | mem->read_u8(reg.pc_ex++);
+			opcode = (opcode << 8) | fetch_u8();
 			reg.pc++;
-
-			switch(opcode & 0xFF)
-			{
-				//ADD A, [IX + #ss]
-				case 0x00:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = add_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//ADD A, [IY + #ss]
-				case 0x01:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = add_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//ADD A, [IX + L]
-				case 0x02:
-					reg.a = add_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//ADD A, [IY + L]
-				case 0x03:
-					reg.a = add_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//ADD [HL], A
-				case 0x04:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = add_u8(temp_val, reg.a);
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 16;
-					break;
-
-				//ADD [HL], #nn
-				case 0x05:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = add_u8(temp_val, mem->read_u8(reg.pc_ex++));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//ADD [HL], [IX]
-				case 0x06:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = add_u8(temp_val, mem->read_u8(reg.ix_ex));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-					break;
-
-				//ADD [HL], [IY]
-				case 0x07:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = add_u8(temp_val, mem->read_u8(reg.iy_ex));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-					break;
-
-				//ADC A, [IX + #ss]
-				case 0x08:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = adc_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//ADC A, [IY + #ss]
-				case 0x09:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = adc_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//ADC A, [IX + L]
-				case 0x0A:
-					reg.a = adc_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//ADC A, [IY + L]
-				case 0x0B:
-					reg.a = adc_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//ADC [HL], A
-				case 0x0C:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = adc_u8(temp_val, reg.a);
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 16;
-					break;
-
-				//ADC [HL], #nn
-				case 0x0D:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = adc_u8(temp_val, mem->read_u8(reg.pc_ex++));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//ADC [HL], [IX]
-				case 0x0E:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = adc_u8(temp_val, mem->read_u8(reg.ix_ex));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-					break;
-
-				//ADC [HL], [IY]
-				case 0x0F:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = adc_u8(temp_val, mem->read_u8(reg.iy_ex));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-					break;
-
-				//SUB A, [IX + #ss]
-				case 0x10:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = sub_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//SUB A, [IY + #ss]
-				case 0x11:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = sub_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//SUB A, [IX + L]
-				case 0x12:
-					reg.a = sub_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//SUB A, [IY + L]
-				case 0x13:
-					reg.a = sub_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//SUB [HL], A
-				case 0x14:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = sub_u8(temp_val, reg.a);
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 16;
-					break;
-
-				//SUB [HL], #nn
-				case 0x15:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = sub_u8(temp_val, mem->read_u8(reg.pc_ex++));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//SUB [HL], [IX]
-				case 0x16:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = sub_u8(temp_val, mem->read_u8(reg.ix_ex));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-					break;
-
-				//SUB [HL], [IY]
-				case 0x17:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = sub_u8(temp_val, mem->read_u8(reg.iy_ex));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-					break;
-
-				//SBC A, [IX + #ss]
-				case 0x18:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = sbc_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//SBC A, [IY + #ss]
-				case 0x19:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = sbc_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//SBC A, [IX + L]
-				case 0x1A:
-					reg.a = sbc_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//SBC A, [IY + L]
-				case 0x1B:
-					reg.a = sbc_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//SBC [HL], A
-				case 0x1C:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = sbc_u8(temp_val, reg.a);
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 16;
-					break;
-
-				//SBC [HL], #nn
-				case 0x1D:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = sbc_u8(temp_val, mem->read_u8(reg.pc_ex++));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//SBC [HL], [IX]
-				case 0x1E:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = sbc_u8(temp_val, mem->read_u8(reg.ix_ex));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-					break;
-
-				//SBC [HL], [IY]
-				case 0x1F:
-					temp_val = mem->read_u8(reg.hl_ex);
-					temp_val = sbc_u8(temp_val, mem->read_u8(reg.iy_ex));
-					mem->write_u8(reg.hl_ex, temp_val);
-					system_cycles = 20;
-					break;
-
-				//AND A, [IX + #ss]
-				case 0x20:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = and_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//AND A, [IY + #ss]
-				case 0x21:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = and_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//AND A, [IX + L]
-				case 0x22:
-					reg.a = and_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//AND A, [IY + L]
-				case 0x23:
-					reg.a = and_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//AND [HL], A
-				case 0x24:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, and_u8(temp_val, reg.a));
-					system_cycles = 16;
-					break;
-
-				//AND [HL], #nn
-				case 0x25:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, and_u8(temp_val, mem->read_u8(reg.pc_ex++)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//AND [HL], [IX]
-				case 0x26:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, and_u8(temp_val, mem->read_u8(reg.ix_ex)));
-					system_cycles = 20;
-					break;
-
-				//AND [HL], [IY]
-				case 0x27:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, and_u8(temp_val, mem->read_u8(reg.iy_ex)));
-					system_cycles = 20;
-					break;
-
-				//OR A, [IX + #ss]
-				case 0x28:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = or_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//OR A, [IY + #ss]
-				case 0x29:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = or_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//OR A, [IX + L]
-				case 0x2A:
-					reg.a = or_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//OR A, [IY + L]
-				case 0x2B:
-					reg.a = or_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//OR [HL], A
-				case 0x2C:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, or_u8(temp_val, reg.a));
-					system_cycles = 16;
-					break;
-
-				//OR [HL], #nn
-				case 0x2D:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, or_u8(temp_val, mem->read_u8(reg.pc_ex++)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//OR [HL], [IX]
-				case 0x2E:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, or_u8(temp_val, mem->read_u8(reg.ix_ex)));
-					system_cycles = 20;
-					break;
-
-				//OR [HL], [IY]
-				case 0x2F:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, or_u8(temp_val, mem->read_u8(reg.iy_ex)));
-					system_cycles = 20;
-					break;
-
-				//CP A, [IX + #ss]
-				case 0x30:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					cp_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//CP A, [IY + #ss]
-				case 0x31:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					cp_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//CP A, [IX + L]
-				case 0x32:
-					cp_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//CP A, [IY + L]
-				case 0x33:
-					cp_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//CP [HL], A
-				case 0x34:
-					temp_val = mem->read_u8(reg.hl_ex);
-					cp_u8(temp_val, reg.a);
-					system_cycles = 16;
-					break;
-
-				//CP [HL], #nn
-				case 0x35:
-					temp_val = mem->read_u8(reg.hl_ex);
-					cp_u8(temp_val, mem->read_u8(reg.pc_ex++));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//CP [HL], [IX]
-				case 0x36:
-					temp_val = mem->read_u8(reg.hl_ex);
-					cp_u8(temp_val, mem->read_u8(reg.ix_ex));
-					system_cycles = 20;
-					break;
-
-				//CP [HL], [IY]
-				case 0x37:
-					temp_val = mem->read_u8(reg.hl_ex);
-					cp_u8(temp_val, mem->read_u8(reg.iy_ex));
-					system_cycles = 20;
-					break;
-
-				//XOR A, [IX + #ss]
-				case 0x38:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = xor_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//XOR A, [IY + #ss]
-				case 0x39:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = xor_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//XOR A, [IX + L]
-				case 0x3A:
-					reg.a = xor_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//XOR A, [IY + L]
-				case 0x3B:
-					reg.a = xor_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 16;
-					break;
-
-				//XOR [HL], A
-				case 0x3C:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, xor_u8(temp_val, reg.a));
-					system_cycles = 16;
-					break;
-
-				//XOR [HL], #nn
-				case 0x3D:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, xor_u8(temp_val, mem->read_u8(reg.pc_ex++)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//XOR [HL], [IX]
-				case 0x3E:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, xor_u8(temp_val, mem->read_u8(reg.ix_ex)));
-					system_cycles = 20;
-					break;
-
-				//XOR [HL], [IY]
-				case 0x3F:
-					temp_val = mem->read_u8(reg.hl_ex);
-					mem->write_u8(reg.hl_ex, xor_u8(temp_val, mem->read_u8(reg.iy_ex)));
-					system_cycles = 20;
-					break;
-
-				//LD A, [IX + #ss]
-				case 0x40:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = mem->read_u8(reg.ix_ex + s_temp);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD A, [IY + #ss]
-				case 0x41:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.a = mem->read_u8(reg.iy_ex + s_temp);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD A, [IX + L]
-				case 0x42:
-					reg.a = mem->read_u8(reg.ix_ex + comp8(reg.l));
-					system_cycles = 16;
-					break;
-
-				//LD A, [IY + L]
-				case 0x43:
-					reg.a = mem->read_u8(reg.iy_ex + comp8(reg.l));
-					system_cycles = 16;
-					break;
-
-				//LD [IX + #ss], A
-				case 0x44:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8((reg.ix_ex + s_temp), reg.a);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD [IY + #ss], A
-				case 0x45:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8((reg.iy_ex + s_temp), reg.a);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD [IX + L], A
-				case 0x46:
-					mem->write_u8((reg.ix_ex + comp8(reg.l)), reg.a);
-					system_cycles = 16;
-					break;
-
-				//LD [IY + L], A
-				case 0x47:
-					mem->write_u8((reg.iy_ex + comp8(reg.l)), reg.a);
-					system_cycles = 16;
-					break;
-
-				//LD B, [IX + #ss]
-				case 0x48:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.b = mem->read_u8(reg.ix_ex + s_temp);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD B, [IY + #ss]
-				case 0x49:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.b = mem->read_u8(reg.iy_ex + s_temp);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD B, [IX + L]
-				case 0x4A:
-					reg.b = mem->read_u8(reg.ix_ex + comp8(reg.l));
-					system_cycles = 16;
-					break;
-
-				//LD B, [IY + L]
-				case 0x4B:
-					reg.b = mem->read_u8(reg.iy_ex + comp8(reg.l));
-					system_cycles = 16;
-					break;
-
-				//LD [IX + #ss], B
-				case 0x4C:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8((reg.ix_ex + s_temp), reg.b);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD [IY + #ss], B
-				case 0x4D:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8((reg.iy_ex + s_temp), reg.b);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD [IX + L], B
-				case 0x4E:
-					mem->write_u8((reg.ix_ex + comp8(reg.l)), reg.b);
-					system_cycles = 16;
-					break;
-
-				//LD [IY + L], B
-				case 0x4F:
-					mem->write_u8((reg.iy_ex + comp8(reg.l)), reg.b);
-					system_cycles = 16;
-					break;
-
-				//LD L, [IX + #ss]
-				case 0x50:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.l = mem->read_u8(reg.ix_ex + s_temp);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD L, [IY + #ss]
-				case 0x51:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.l = mem->read_u8(reg.iy_ex + s_temp);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD L, [IX + L]
-				case 0x52:
-					reg.l = mem->read_u8(reg.ix_ex + comp8(reg.l));
-					system_cycles = 16;
-					break;
-
-				//LD L, [IY + L]
-				case 0x53:
-					reg.l = mem->read_u8(reg.iy_ex + comp8(reg.l));
-					system_cycles = 16;
-					break;
-
-				//LD [IX + #ss], L
-				case 0x54:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8((reg.ix_ex + s_temp), reg.l);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD [IY + #ss], L
-				case 0x55:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8((reg.iy_ex + s_temp), reg.l);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD [IX + L], L
-				case 0x56:
-					mem->write_u8((reg.ix_ex + comp8(reg.l)), reg.l);
-					system_cycles = 16;
-					break;
-
-				//LD [IY + L], L
-				case 0x57:
-					mem->write_u8((reg.iy_ex + comp8(reg.l)), reg.l);
-					system_cycles = 16;
-					break;
-
-				//LD H, [IX + #ss]
-				case 0x58:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.h = mem->read_u8(reg.ix_ex + s_temp);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD H, [IY + #ss]
-				case 0x59:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.h = mem->read_u8(reg.iy_ex + s_temp);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD H, [IX + L]
-				case 0x5A:
-					reg.h = mem->read_u8(reg.ix_ex + comp8(reg.l));
-					system_cycles = 16;
-					break;
-
-				//LD H, [IY + L]
-				case 0x5B:
-					reg.h = mem->read_u8(reg.iy_ex + comp8(reg.l));
-					system_cycles = 16;
-					break;
-
-				//LD [IX + #ss], H
-				case 0x5C:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8((reg.ix_ex + s_temp), reg.h);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD [IY + #ss], H
-				case 0x5D:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8((reg.iy_ex + s_temp), reg.h);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD [IX + L], H
-				case 0x5E:
-					mem->write_u8((reg.ix_ex + comp8(reg.l)), reg.h);
-					system_cycles = 16;
-					break;
-
-				//LD [IY + L], H
-				case 0x5F:
-					mem->write_u8((reg.iy_ex + comp8(reg.l)), reg.h);
-					system_cycles = 16;
-					break;
-
-				//LD [HL], [IX + #ss]
-				case 0x60:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8(reg.hl_ex, (reg.ix_ex + s_temp));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//LD [HL], [IY + #ss]
-				case 0x61:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8(reg.hl_ex, (reg.iy_ex + s_temp));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//LD [HL], [IX + L]
-				case 0x62:
-					mem->write_u8(reg.hl_ex, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 20;
-					break;
-
-				//LD [HL], [IY + L]
-				case 0x63:
-					mem->write_u8(reg.hl_ex, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 20;
-					break;
-
-				//LD [IX], [IX + #ss]
-				case 0x68:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8(reg.ix_ex, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//LD [IX], [IY + #ss]
-				case 0x69:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8(reg.ix_ex, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//LD [IX], [IX + L]
-				case 0x6A:
-					mem->write_u8(reg.ix_ex, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 20;
-					break;
-
-				//LD [IX], [IY + L]
-				case 0x6B:
-					mem->write_u8(reg.ix_ex, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 20;
-					break;
-
-				//LD [IY], [IX + #ss]
-				case 0x78:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8(reg.iy_ex, mem->read_u8(reg.ix_ex + s_temp));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//LD [IY], [IY + #ss]
-				case 0x79:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					mem->write_u8(reg.iy_ex, mem->read_u8(reg.iy_ex + s_temp));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//LD [IY], [IX + L]
-				case 0x7A:
-					mem->write_u8(reg.iy_ex, mem->read_u8(reg.ix_ex + comp8(reg.l)));
-					system_cycles = 20;
-					break;
-
-				//LD [IY], [IY + L]
-				case 0x7B:
-					mem->write_u8(reg.iy_ex, mem->read_u8(reg.iy_ex + comp8(reg.l)));
-					system_cycles = 20;
-					break;
-
-				//SLA A
-				case 0x80:
-					reg.a = sla_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//SLA B
-				case 0x81:
-					reg.b = sla_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//SLA [BR + #nn]
-				case 0x82:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, sla_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//SLA [HL]
-				case 0x83:
-					mem->write_u8(reg.hl_ex, sla_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//SLL A
-				case 0x84:
-					reg.a = sll_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//SLL B
-				case 0x85:
-					reg.b = sll_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//SLL [BR + #nn]
-				case 0x86:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, sll_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//SLL [HL]
-				case 0x87:
-					mem->write_u8(reg.hl_ex, sll_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//SRA A
-				case 0x88:
-					reg.a = sra_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//SRA B
-				case 0x89:
-					reg.b = sra_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//SRA [BR + #nn]
-				case 0x8A:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, sra_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//SRA [HL]
-				case 0x8B:
-					mem->write_u8(reg.hl_ex, sra_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//SRL A
-				case 0x8C:
-					reg.a = srl_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//SRL B
-				case 0x8D:
-					reg.b = srl_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//SRL [BR + #nn]
-				case 0x8E:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, srl_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//SRL [HL]
-				case 0x8F:
-					mem->write_u8(reg.hl_ex, srl_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//RL A
-				case 0x90:
-					reg.a = rl_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//RL B
-				case 0x91:
-					reg.b = rl_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//RL [BR + #nn]
-				case 0x92:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, rl_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//RL [HL]
-				case 0x93:
-					mem->write_u8(reg.hl_ex, rl_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//RLC A
-				case 0x94:
-					reg.a = rlc_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//RLC B
-				case 0x95:
-					reg.b = rlc_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//RLC [BR + #nn]
-				case 0x96:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, rlc_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//RLC [HL]
-				case 0x97:
-					mem->write_u8(reg.hl_ex, rlc_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//RR A
-				case 0x98:
-					reg.a = rr_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//RR B
-				case 0x99:
-					reg.b = rr_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//RR [BR + #nn]
-				case 0x9A:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, rr_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//RR [HL]
-				case 0x9B:
-					mem->write_u8(reg.hl_ex, rr_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//RRC A
-				case 0x9C:
-					reg.a = rrc_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//RRC B
-				case 0x9D:
-					reg.b = rrc_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//RRC [BR + #nn]
-				case 0x9E:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, rrc_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//RRC [HL]
-				case 0x9F:
-					mem->write_u8(reg.hl_ex, rrc_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//CPL A
-				case 0xA0:
-					reg.a = cpl_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//CPL B
-				case 0xA1:
-					reg.b = cpl_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//CPL [BR + #nn]
-				case 0xA2:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, cpl_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//CPL [HL]
-				case 0xA3:
-					mem->write_u8(reg.hl_ex, cpl_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//NEG A
-				case 0xA4:
-					reg.a = neg_u8(reg.a);
-					system_cycles = 12;
-					break;
-
-				//NEG B
-				case 0xA5:
-					reg.b = neg_u8(reg.b);
-					system_cycles = 12;
-					break;
-
-				//NEG [BR + #nn]
-				case 0xA6:
-					temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-					mem->write_u8(temp_val, neg_u8(mem->read_u8(temp_val)));
-					system_cycles = 20;
-
-					reg.pc++;
-					break;
-
-				//NEG [HL]
-				case 0xA7:
-					mem->write_u8(reg.hl_ex, neg_u8(mem->read_u8(reg.hl_ex)));
-					system_cycles = 16;
-					break;
-
-				//SEP
-				case 0xA8:
-					reg.b = (reg.a & 0x80) ? 0xFF : 0x00;
-					system_cycles = 12;
-					break;
-
-				//HALT
-				case 0xAE:
-					halt = true;
-					system_cycles = 12;
-					break;
-
-				//AND B, #nn
-				case 0xB0:
-					reg.b = and_u8(reg.b, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//AND L, #nn
-				case 0xB1:
-					reg.l = and_u8(reg.l, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//AND H, #nn
-				case 0xB2:
-					reg.h = and_u8(reg.h, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//OR B, #nn
-				case 0xB4:
-					reg.b = or_u8(reg.b, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//OR L, #nn
-				case 0xB5:
-					reg.l = or_u8(reg.l, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//OR H, #nn
-				case 0xB6:
-					reg.h = or_u8(reg.h, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//XOR B, #nn
-				case 0xB8:
-					reg.b = xor_u8(reg.b, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//XOR L, #nn
-				case 0xB9:
-					reg.l = xor_u8(reg.l, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//XOR H, #nn
-				case 0xBA:
-					reg.h = xor_u8(reg.h, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//CP B, #nn
-				case 0xBC:
-					cp_u8(reg.b, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//CP L, #nn
-				case 0xBD:
-					cp_u8(reg.l, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//CP H, #nn
-				case 0xBE:
-					cp_u8(reg.h, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//CP BR, #nn
-				case 0xBF:
-					cp_u8(reg.br, mem->read_u8(reg.pc_ex++));
-					system_cycles = 12;
-
-					reg.pc++;
-					break;
-
-				//LD A, BR
-				case 0xC0:
-					reg.a = reg.br;
-					system_cycles = 8;
-					break;
-
-				//LD A, SC
-				case 0xC1:
-					reg.a = reg.sc;
-					system_cycles = 8;
-					break;
-
-				//LD BR, A
-				case 0xC2:
-					reg.br = reg.a;
-					system_cycles = 8;
-					break;
-
-				//LD SC, A
-				case 0xC3:
-					reg.sc = reg.a;
-					system_cycles = 12;
-					skip_irq = true;
-					break;
-
-				//LD NB, #nn
-				case 0xC4:
-					reg.nb = mem->read_u8(reg.pc_ex++);
-					system_cycles = 16;
-					skip_irq = true;
-
-					reg.pc++;
-					break;
-
-				//LD EP, #nn
-				case 0xC5:
-					reg.ep = mem->read_u8(reg.pc_ex++);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD XP, #nn
-				case 0xC6:
-					reg.xp = mem->read_u8(reg.pc_ex++);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD YP, #nn
-				case 0xC7:
-					reg.yp = mem->read_u8(reg.pc_ex++);
-					system_cycles = 16;
-
-					reg.pc++;
-					break;
-
-				//LD A, NB
-				case 0xC8:
-					reg.a = reg.nb;
-					system_cycles = 8;
-					break;
-
-				//LD A, EP
-				case 0xC9:
-					reg.a = reg.ep;
-					system_cycles = 8;
-					break;
-
-				//LD A, XP
-				case 0xCA:
-					reg.a = reg.xp;
-					system_cycles = 8;
-					break;
-
-				//LD A, YP
-				case 0xCB:
-					reg.a = reg.yp;
-					system_cycles = 8;
-					break;
-
-				//LD NB, A
-				case 0xCC:
-					reg.nb = reg.a;
-					system_cycles = 12;
-					skip_irq = true;
-					break;
-
-				//LD EP, A
-				case 0xCD:
-					reg.ep = reg.a;
-					system_cycles = 8;
-					break;
-
-				//LD XP, A
-				case 0xCE:
-					reg.xp = reg.a;
-					system_cycles = 8;
-					break;
-
-				//LD YP, A
-				case 0xCF:
-					reg.yp = reg.a;
-					system_cycles = 8;
-					break;
-
-				//LD A, [#nnnn]
-				case 0xD0:
-					temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
-					reg.a = mem->read_u8(temp_val);
-					system_cycles = 20;
-
-					reg.pc += 2;
-					break;
-
-				//LD B, [#nnnn]
-				case 0xD1:
-					temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
-					reg.b = mem->read_u8(temp_val);
-					system_cycles = 20;
-
-					reg.pc += 2;
-					break;
-
-				//LD L, [#nnnn]
-				case 0xD2:
-					temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
-					reg.l = mem->read_u8(temp_val);
-					system_cycles = 20;
-
-					reg.pc += 2;
-					break;
-
-				//LD H, [#nnnn]
-				case 0xD3:
-					temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
-					reg.h = mem->read_u8(temp_val);
-					system_cycles = 20;
-
-					reg.pc += 2;
-					break;
-
-				//LD [#nnnn], A
-				case 0xD4:
-					temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
-					mem->write_u8(temp_val, reg.a);
-					system_cycles = 20;
-
-					reg.pc += 2;
-					break;
-
-				//LD [#nnnn], B
-				case 0xD5:
-					temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
-					mem->write_u8(temp_val, reg.b);
-					system_cycles = 20;
-
-					reg.pc += 2;
-					break;
-
-				//LD [#nnnn], L
-				case 0xD6:
-					temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
-					mem->write_u8(temp_val, reg.l);
-					system_cycles = 20;
-
-					reg.pc += 2;
-					break;
-
-				//LD [#nnnn], H
-				case 0xD7:
-					temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
-					mem->write_u8(temp_val, reg.h);
-					system_cycles = 20;
-
-					reg.pc += 2;
-					break;
-
-				//MLT L, A
-				case 0xD8:
-					reg.hl = mlt_u8(reg.l, reg.a);
-					system_cycles = 48;
-					break;
-
-				//DIV HL, A
-				case 0xD9:
-					reg.hl = div_u16(reg.hl, reg.a);
-					system_cycles = 52;
-					break;
-
-				//JRS LT #ss
-				case 0xE0:
-					{
-						s_temp = mem->read_s8(reg.pc_ex++);
-						reg.pc++;
-
-						u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
-						u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
-
-						if(flag_1 != flag_2)
-						{
-							reg.cb = reg.nb;
-							reg.pc = log_addr + s_temp + 2;
-						}
-
-						system_cycles = 12;
-					}
-
-					break;
-
-				//JRS LE #ss
-				case 0xE1:
-					{
-						s_temp = mem->read_s8(reg.pc_ex++);
-						reg.pc++;
-
-						u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
-						u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
-						u8 flag_3 = (reg.sc & ZERO_FLAG) ? 1 : 0;
-
-						if((flag_1 != flag_2) || (flag_3))
-						{
-							reg.cb = reg.nb;
-							reg.pc = log_addr + s_temp + 2;
-						}
-
-						system_cycles = 12;
-					}
-
-					break;
-
-				//JRS GT #ss
-				case 0xE2:
-					{
-						s_temp = mem->read_s8(reg.pc_ex++);
-						reg.pc++;
-
-						u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
-						u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
-						u8 flag_3 = (reg.sc & ZERO_FLAG) ? 1 : 0;
-
-						if((flag_1 == flag_2) && (flag_3 == 0))
-						{
-							reg.cb = reg.nb;
-							reg.pc = log_addr + s_temp + 2;
-						}
-
-						system_cycles = 12;
-					}
-
-					break;
-
-				//JRS GE #ss
-				case 0xE3:
-					{
-						s_temp = mem->read_s8(reg.pc_ex++);
-						reg.pc++;
-
-						u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
-						u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
-
-						if(flag_1 == flag_2)
-						{
-							reg.cb = reg.nb;
-							reg.pc = log_addr + s_temp + 2;
-						}
-
-						system_cycles = 12;
-					}
-
-					break;
-
-				//JRS V #ss
-				case 0xE4:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.pc++;
-
-					if(reg.sc & OVERFLOW_FLAG)
-					{
-						reg.cb = reg.nb;
-						reg.pc = log_addr + s_temp + 2;
-					}
-
-					system_cycles = 12;
-
-					break;
-
-				//JRS NV #ss
-				case 0xE5:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.pc++;
-
-					if((reg.sc & OVERFLOW_FLAG) == 0)
-					{
-						reg.cb = reg.nb;
-						reg.pc = log_addr + s_temp + 2;
-					}
-
-					system_cycles = 12;
-
-					break;
-
-				//JRS P #ss
-				case 0xE6:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.pc++;
-
-					if((reg.sc & NEGATIVE_FLAG) == 0)
-					{
-						reg.cb = reg.nb;
-						reg.pc = log_addr + s_temp + 2;
-					}
-
-					system_cycles = 12;
-
-					break;
-
-				//JRS M #ss
-				case 0xE7:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.pc++;
-
-					if(reg.sc & NEGATIVE_FLAG)
-					{
-						reg.cb = reg.nb;
-						reg.pc = log_addr + s_temp + 2;
-					}
-
-					system_cycles = 12;
-
-					break;
-
-				//CARS LT #ss
-				case 0xF0:
-					{
-						s_temp = mem->read_s8(reg.pc_ex++);
-						reg.pc++;
-
-						u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
-						u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
-
-						if(flag_1 != flag_2)
-						{
-							mem->write_u8(--reg.sp, (reg.cb));
-							mem->write_u8(--reg.sp, (reg.pc >> 8));
-							mem->write_u8(--reg.sp, (reg.pc & 0xFF));
-
-							reg.cb = reg.nb;
-							reg.pc = log_addr + s_temp + 2;
-
-							system_cycles = 24;
-						}
-
-						else { system_cycles = 12; }
-					}
-
-					break;
-
-				//CARS LE #ss
-				case 0xF1:
-					{
-						s_temp = mem->read_s8(reg.pc_ex++);
-						reg.pc++;
-
-						u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
-						u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
-						u8 flag_3 = (reg.sc & ZERO_FLAG) ? 1 : 0;
-
-						if((flag_1 != flag_2) || (flag_3))
-						{
-							mem->write_u8(--reg.sp, (reg.cb));
-							mem->write_u8(--reg.sp, (reg.pc >> 8));
-							mem->write_u8(--reg.sp, (reg.pc & 0xFF));
-
-							reg.cb = reg.nb;
-							reg.pc = log_addr + s_temp + 2;
-
-							system_cycles = 24;
-						}
-
-						else { system_cycles = 12; }
-					}
-
-					break;
-
-				//CARS GT #ss
-				case 0xF2:
-					{
-						s_temp = mem->read_s8(reg.pc_ex++);
-						reg.pc++;
-
-						u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
-						u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
-						u8 flag_3 = (reg.sc & ZERO_FLAG) ? 1 : 0;
-
-						if((flag_1 == flag_2) && (flag_3 == 0))
-						{
-							mem->write_u8(--reg.sp, (reg.cb));
-							mem->write_u8(--reg.sp, (reg.pc >> 8));
-							mem->write_u8(--reg.sp, (reg.pc & 0xFF));
-
-							reg.cb = reg.nb;
-							reg.pc = log_addr + s_temp + 2;
-
-							system_cycles = 24;
-						}
-
-						else { system_cycles = 12; }
-					}
-
-					break;
-
-				//CARS GE #ss
-				case 0xF3:
-					{
-						s_temp = mem->read_s8(reg.pc_ex++);
-						reg.pc++;
-
-						u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
-						u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
-
-						if(flag_1 == flag_2)
-						{
-							mem->write_u8(--reg.sp, (reg.cb));
-							mem->write_u8(--reg.sp, (reg.pc >> 8));
-							mem->write_u8(--reg.sp, (reg.pc & 0xFF));
-
-							reg.cb = reg.nb;
-							reg.pc = log_addr + s_temp + 2;
-
-							system_cycles = 24;
-						}
-
-						else { system_cycles = 12; }
-					}
-
-					break;
-
-				//CARS V #ss
-				case 0xF4:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.pc++;
-
-					if(reg.sc & OVERFLOW_FLAG)
-					{
-						mem->write_u8(--reg.sp, (reg.cb));
-						mem->write_u8(--reg.sp, (reg.pc >> 8));
-						mem->write_u8(--reg.sp, (reg.pc & 0xFF));
-
-						reg.cb = reg.nb;
-						reg.pc = log_addr + s_temp + 2;
-
-						system_cycles = 24;
-					}
-
-					else { system_cycles = 12; }
-
-					break;
-
-				//CARS NV #ss
-				case 0xF5:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.pc++;
-
-					if((reg.sc & OVERFLOW_FLAG) == 0)
-					{
-						mem->write_u8(--reg.sp, (reg.cb));
-						mem->write_u8(--reg.sp, (reg.pc >> 8));
-						mem->write_u8(--reg.sp, (reg.pc & 0xFF));
-
-						reg.cb = reg.nb;
-						reg.pc = log_addr + s_temp + 2;
-
-						system_cycles = 24;
-					}
-
-					else { system_cycles = 12; }
-
-					break;
-
-				//CARS P #ss
-				case 0xF6:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.pc++;
-
-					if((reg.sc & NEGATIVE_FLAG) == 0)
-					{
-						mem->write_u8(--reg.sp, (reg.cb));
-						mem->write_u8(--reg.sp, (reg.pc >> 8));
-						mem->write_u8(--reg.sp, (reg.pc & 0xFF));
-
-						reg.cb = reg.nb;
-						reg.pc = log_addr + s_temp + 2;
-
-						system_cycles = 24;
-					}
-
-					else { system_cycles = 12; }
-
-					break;
-
-				//CARS M #ss
-				case 0xF7:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					reg.pc++;
-
-					if(reg.sc & NEGATIVE_FLAG)
-					{
-						mem->write_u8(--reg.sp, (reg.cb));
-						mem->write_u8(--reg.sp, (reg.pc >> 8));
-						mem->write_u8(--reg.sp, (reg.pc & 0xFF));
-
-						reg.cb = reg.nb;
-						reg.pc = log_addr + s_temp + 2;
-
-						system_cycles = 24;
-					}
-
-					else { system_cycles = 12; }
-
-					break;
-
-				default:
-					std::cout<<"CPU::Error - Unknown 0xCE opcode -> 0x" << std::hex << opcode << " @ 0x" << reg.pc << "\n";
-					if(!config::ignore_illegal_opcodes) { running = false; }
-			}
-
+			execute_ce();
 			break;
 
 		//Extend 0xCF instructions
 		case 0xCF:
-			opcode = (opcode << 8) | mem->read_u8(reg.pc_ex++);
+			opcode = (opcode << 8) | fetch_u8();
 			reg.pc++;
-
-			switch(opcode & 0xFF)
-			{
-
-				//ADD BA, BA
-				case 0x00:
-					reg.ba = add_u16(reg.ba, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//ADD BA, HL
-				case 0x01:
-					reg.ba = add_u16(reg.ba, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//ADD BA, IX
-				case 0x02:
-					reg.ba = add_u16(reg.ba, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//ADD BA, IY
-				case 0x03:
-					reg.ba = add_u16(reg.ba, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//ADC BA, BA
-				case 0x04:
-					reg.ba = adc_u16(reg.ba, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//ADC BA, HL
-				case 0x05:
-					reg.ba = adc_u16(reg.ba, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//ADC BA, IX
-				case 0x06:
-					reg.ba = adc_u16(reg.ba, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//ADC BA, IY
-				case 0x07:
-					reg.ba = adc_u16(reg.ba, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//SUB BA, BA
-				case 0x08:
-					reg.ba = sub_u16(reg.ba, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//SUB BA, HL
-				case 0x09:
-					reg.ba = sub_u16(reg.ba, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//SUB BA, IX
-				case 0x0A:
-					reg.ba = sub_u16(reg.ba, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//SUB BA, IY
-				case 0x0B:
-					reg.ba = sub_u16(reg.ba, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//SBC BA, BA
-				case 0x0C:
-					reg.ba = sbc_u16(reg.ba, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//SBC BA, HL
-				case 0x0D:
-					reg.ba = sbc_u16(reg.ba, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//SBC BA, IX
-				case 0x0E:
-					reg.ba = sbc_u16(reg.ba, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//SBC BA, IY
-				case 0x0F:
-					reg.ba = sbc_u16(reg.ba, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//CP BA, BA
-				case 0x18:
-					cp_u16(reg.ba, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//CP BA, HL
-				case 0x19:
-					cp_u16(reg.ba, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//CP BA, IX
-				case 0x1A:
-					cp_u16(reg.ba, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//CP BA, IY
-				case 0x1B:
-					cp_u16(reg.ba, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//ADD HL, BA
-				case 0x20:
-					reg.hl = add_u16(reg.hl, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//ADD HL, HL
-				case 0x21:
-					reg.hl = add_u16(reg.hl, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//ADD HL, IX
-				case 0x22:
-					reg.hl = add_u16(reg.hl, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//ADD HL, IY
-				case 0x23:
-					reg.hl = add_u16(reg.hl, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//ADC HL, BA
-				case 0x24:
-					reg.hl = adc_u16(reg.hl, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//ADC HL, HL
-				case 0x25:
-					reg.hl = adc_u16(reg.hl, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//ADC HL, IX
-				case 0x26:
-					reg.hl = adc_u16(reg.hl, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//ADC HL, IY
-				case 0x27:
-					reg.hl = adc_u16(reg.hl, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//SUB HL, BA
-				case 0x28:
-					reg.hl = sub_u16(reg.hl, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//SUB HL, HL
-				case 0x29:
-					reg.hl = sub_u16(reg.hl, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//SUB HL, IX
-				case 0x2A:
-					reg.hl = sub_u16(reg.hl, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//SUB HL, IY
-				case 0x2B:
-					reg.hl = sub_u16(reg.hl, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//SBC HL, BA
-				case 0x2C:
-					reg.hl = sbc_u16(reg.hl, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//SBC HL, HL
-				case 0x2D:
-					reg.hl = sbc_u16(reg.hl, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//SBC HL, IX
-				case 0x2E:
-					reg.hl = sbc_u16(reg.hl, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//SBC HL, IY
-				case 0x2F:
-					reg.hl = sbc_u16(reg.hl, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//CP HL, BA
-				case 0x38:
-					cp_u16(reg.hl, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//CP HL, HL
-				case 0x39:
-					cp_u16(reg.hl, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//CP HL, IX
-				case 0x3A:
-					cp_u16(reg.hl, reg.ix);
-					system_cycles = 16;
-					break;
-
-				//CP HL, IY
-				case 0x3B:
-					cp_u16(reg.hl, reg.iy);
-					system_cycles = 16;
-					break;
-
-				//ADD IX, BA
-				case 0x40:
-					reg.ix = add_u16(reg.ix, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//ADD IX, HL
-				case 0x41:
-					reg.ix = add_u16(reg.ix, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//ADD IY, BA
-				case 0x42:
-					reg.iy = add_u16(reg.iy, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//ADD IY, HL
-				case 0x43:
-					reg.iy = add_u16(reg.iy, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//ADD SP, BA
-				case 0x44:
-					reg.sp = add_u16(reg.sp, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//ADD SP, HL
-				case 0x45:
-					reg.sp = add_u16(reg.sp, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//SUB IX, BA
-				case 0x48:
-					reg.ix = sub_u16(reg.ix, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//SUB IX, HL
-				case 0x49:
-					reg.ix = sub_u16(reg.ix, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//SUB IY, BA
-				case 0x4A:
-					reg.iy = sub_u16(reg.iy, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//SUB IY, HL
-				case 0x4B:
-					reg.iy = sub_u16(reg.iy, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//SUB SP, BA
-				case 0x4C:
-					reg.sp = sub_u16(reg.sp, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//SUB SP, HL
-				case 0x4D:
-					reg.sp = sub_u16(reg.sp, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//CP SP, BA
-				case 0x5C:
-					cp_u16(reg.sp, reg.ba);
-					system_cycles = 16;
-					break;
-
-				//CP SP, HL
-				case 0x5D:
-					cp_u16(reg.sp, reg.hl);
-					system_cycles = 16;
-					break;
-
-				//ADC BA, #nnnn
-				case 0x60:
-					temp_val = mem->read_u16(reg.pc_ex);
-					reg.ba = adc_u16(reg.ba, temp_val);
-					system_cycles = 12;
-
-					reg.pc += 2;
-					break;
-
-				//ADC HL, #nnnn
-				case 0x61:
-					temp_val = mem->read_u16(reg.pc_ex);
-					reg.hl = adc_u16(reg.hl, temp_val);
-					system_cycles = 12;
-
-					reg.pc += 2;
-					break;
-
-				//SBC BA, #nnnn
-				case 0x62:
-					temp_val = mem->read_u16(reg.pc_ex);
-					reg.ba = sbc_u16(reg.ba, temp_val);
-					system_cycles = 12;
-
-					reg.pc += 2;
-					break;
-
-				//SBC HL, #nnnn
-				case 0x63:
-					temp_val = mem->read_u16(reg.pc_ex);
-					reg.hl = sbc_u16(reg.hl, temp_val);
-					system_cycles = 12;
-
-					reg.pc += 2;
-					break;
-
-				//ADD SP, #nnnn
-				case 0x68:
-					temp_val = mem->read_u16(reg.pc_ex);
-					reg.sp = add_u16(reg.sp, temp_val);
-					system_cycles = 12;
-
-					reg.pc += 2;
-					break;
-
-				//SUB SP, #nnnn
-				case 0x6A:
-					temp_val = mem->read_u16(reg.pc_ex);
-					reg.sp = sub_u16(reg.sp, temp_val);
-					system_cycles = 12;
-
-					reg.pc += 2;
-					break;
-
-				//CP SP, #nnnn
-				case 0x6C:
-					temp_val = mem->read_u16(reg.pc_ex);
-					cp_u16(reg.sp, temp_val);
-					system_cycles = 12;
-
-					reg.pc += 2;
-					break;
-
-				//LD SP, #nnnn
-				case 0x6E:
-					reg.sp = mem->read_u16(reg.pc_ex);
-					system_cycles = 16;
-
-					reg.pc += 2;
-					break;
-
-				//LD BA, [SP + #ss]
-				case 0x70:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					temp_val = reg.sp + s_temp;
-					reg.ba = mem->read_u16(temp_val);
-					system_cycles = 24;
-
-					reg.pc++;
-					break;
-
-				//LD HL, [SP + #ss]
-				case 0x71:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					temp_val = reg.sp + s_temp;
-					reg.hl = mem->read_u16(temp_val);
-					system_cycles = 24;
-
-					reg.pc++;
-					break;
-
-				//LD IX, [SP + #ss]
-				case 0x72:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					temp_val = reg.sp + s_temp;
-					reg.ix = mem->read_u16(temp_val);
-					system_cycles = 24;
-
-					reg.pc++;
-					break;
-
-				//LD IY, [SP + #ss]
-				case 0x73:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					temp_val = reg.sp + s_temp;
-					reg.iy = mem->read_u16(temp_val);
-					system_cycles = 24;
-
-					reg.pc++;
-					break;
-
-				//LD [SP + #ss], BA
-				case 0x74:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					temp_val = reg.sp + s_temp;
-					mem->write_u16(temp_val, reg.ba);
-					system_cycles = 24;
-
-					reg.pc++;
-					break;
-
-				//LD [SP + #ss], HL
-				case 0x75:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					temp_val = reg.sp + s_temp;
-					mem->write_u16(temp_val, reg.hl);
-					system_cycles = 24;
-
-					reg.pc++;
-					break;
-
-				//LD [SP + #ss], IX
-				case 0x76:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					temp_val = reg.sp + s_temp;
-					mem->write_u16(temp_val, reg.ix);
-					system_cycles = 24;
-
-					reg.pc++;
-					break;
-
-				//LD [SP + #ss], IY
-				case 0x77:
-					s_temp = mem->read_s8(reg.pc_ex++);
-					temp_val = reg.sp + s_temp;
-					mem->write_u16(temp_val, reg.iy);
-					system_cycles = 24;
-
-					reg.pc++;
-					break;
-					
-				//LD SP, [#nnnn]
-				case 0x78:
-					temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
-					reg.sp = mem->read_u16(temp_val);
-					system_cycles = 24;
-
-					reg.pc += 2;
-					break;
-
-				//PUSH A
-				case 0xB0:
-					mem->write_u8(--reg.sp, reg.a);
-					system_cycles = 12;
-					break;
-
-				//PUSH B
-				case 0xB1:
-					mem->write_u8(--reg.sp, reg.b);
-					system_cycles = 12;
-					break;
-
-				//PUSH L
-				case 0xB2:
-					mem->write_u8(--reg.sp, reg.l);
-					system_cycles = 12;
-					break;
-
-				//PUSH H
-				case 0xB3:
-					mem->write_u8(--reg.sp, reg.h);
-					system_cycles = 12;
-					break;
-
-				//POP A
-				case 0xB4:
-					reg.a = mem->read_u8(reg.sp++);
-					system_cycles = 12;
-					break;
-
-				//POP B
-				case 0xB5:
-					reg.b = mem->read_u8(reg.sp++);
-					system_cycles = 12;
-					break;
-
-				//POP L
-				case 0xB6:
-					reg.l = mem->read_u8(reg.sp++);
-					system_cycles = 12;
-					break;
-
-				//POP H
-				case 0xB7:
-					reg.h = mem->read_u8(reg.sp++);
-					system_cycles = 12;
-					break;
-
-				//PUSH ALL
-				case 0xB8:
-					mem->write_u8(--reg.sp, reg.b);
-					mem->write_u8(--reg.sp, reg.a);
-					mem->write_u8(--reg.sp, reg.h);
-					mem->write_u8(--reg.sp, reg.l);
-					mem->write_u8(--reg.sp, (reg.ix >> 8));
-					mem->write_u8(--reg.sp, (reg.ix & 0xFF));
-					mem->write_u8(--reg.sp, (reg.iy >> 8));
-					mem->write_u8(--reg.sp, (reg.iy & 0xFF));
-					mem->write_u8(--reg.sp, reg.br);
-					system_cycles = 48;
-					break;
-
-				//PUSH ALE
-				case 0xB9:
-					mem->write_u8(--reg.sp, reg.b);
-					mem->write_u8(--reg.sp, reg.a);
-					mem->write_u8(--reg.sp, reg.h);
-					mem->write_u8(--reg.sp, reg.l);
-					mem->write_u8(--reg.sp, (reg.ix >> 8));
-					mem->write_u8(--reg.sp, (reg.ix & 0xFF));
-					mem->write_u8(--reg.sp, (reg.iy >> 8));
-					mem->write_u8(--reg.sp, (reg.iy & 0xFF));
-					mem->write_u8(--reg.sp, reg.br);
-					mem->write_u8(--reg.sp, reg.ep);
-					mem->write_u8(--reg.sp, reg.xp);
-					mem->write_u8(--reg.sp, reg.yp);
-					system_cycles = 60;
-					break;
-
-				//POP ALL
-				case 0xBC:
-					reg.br = mem->read_u8(reg.sp++);
-					reg.iy = mem->read_u8(reg.sp++);
-					reg.iy |= (mem->read_u8(reg.sp++) << 8);
-					reg.ix = mem->read_u8(reg.sp++);
-					reg.ix |= (mem->read_u8(reg.sp++) << 8);
-					reg.l = mem->read_u8(reg.sp++);
-					reg.h = mem->read_u8(reg.sp++);
-					reg.a = mem->read_u8(reg.sp++);
-					reg.b = mem->read_u8(reg.sp++);
-					system_cycles = 32;
-					break;
-
-				//POP ALE
-				case 0xBD:
-					reg.yp = mem->read_u8(reg.sp++);
-					reg.xp = mem->read_u8(reg.sp++);
-					reg.ep = mem->read_u8(reg.sp++);
-					reg.br = mem->read_u8(reg.sp++);
-					reg.iy = mem->read_u8(reg.sp++);
-					reg.iy |= (mem->read_u8(reg.sp++) << 8);
-					reg.ix = mem->read_u8(reg.sp++);
-					reg.ix |= (mem->read_u8(reg.sp++) << 8);
-					reg.l = mem->read_u8(reg.sp++);
-					reg.h = mem->read_u8(reg.sp++);
-					reg.a = mem->read_u8(reg.sp++);
-					reg.b = mem->read_u8(reg.sp++);
-					system_cycles = 40;
-					break;
-
-				//LD BA, [HL]
-				case 0xC0:
-					reg.ba = mem->read_u16(reg.hl_ex);
-					system_cycles = 20;
-					break;
-
-				//LD HL, [HL]
-				case 0xC1:
-					reg.hl = mem->read_u16(reg.hl_ex);
-					system_cycles = 20;
-					break;
-
-				//LD IX, [HL]
-				case 0xC2:
-					reg.ix = mem->read_u16(reg.hl_ex);
-					system_cycles = 20;
-					break;
-
-				//LD IY, [HL]
-				case 0xC3:
-					reg.iy = mem->read_u16(reg.hl_ex);
-					system_cycles = 20;
-					break;
-
-				//LD [HL], BA
-				case 0xC4:
-					mem->write_u16(reg.hl_ex, reg.ba);
-					system_cycles = 20;
-					break;
-
-				//LD [HL], HL
-				case 0xC5:
-					mem->write_u16(reg.hl_ex, reg.hl);
-					system_cycles = 20;
-					break;
-
-				//LD [HL], IX
-				case 0xC6:
-					mem->write_u16(reg.hl_ex, reg.ix);
-					system_cycles = 20;
-					break;
-
-				//LD [HL], IY
-				case 0xC7:
-					mem->write_u16(reg.hl_ex, reg.iy);
-					system_cycles = 20;
-					break;
-				
-				//LD BA, [IX]
-				case 0xD0:
-					reg.ba = mem->read_u16(reg.ix_ex);
-					system_cycles = 20;
-					break;
-
-				//LD HL, [IX]
-				case 0xD1:
-					reg.hl = mem->read_u16(reg.ix_ex);
-					system_cycles = 20;
-					break;
-
-				//LD IX, [IX]
-				case 0xD2:
-					reg.ix = mem->read_u16(reg.ix_ex);
-					system_cycles = 20;
-					break;
-
-				//LD IY, [IX]
-				case 0xD3:
-					reg.iy = mem->read_u16(reg.ix_ex);
-					system_cycles = 20;
-					break;
-
-				//LD IX, [BA]
-				case 0xD4:
-					mem->write_u16(reg.ix_ex, reg.ba);
-					system_cycles = 20;
-					break;
-
-				//LD [IX], HL
-				case 0xD5:
-					mem->write_u16(reg.ix_ex, reg.hl);
-					system_cycles = 20;
-					break;
-
-				//LD [IX], IX
-				case 0xD6:
-					mem->write_u16(reg.ix_ex, reg.ix);
-					system_cycles = 20;
-					break;
-
-				//LD [IX], IY
-				case 0xD7:
-					mem->write_u16(reg.ix_ex, reg.iy);
-					system_cycles = 20;
-					break;
-
-				//LD BA, [IY]
-				case 0xD8:
-					reg.ba = mem->read_u16(reg.iy_ex);
-					system_cycles = 20;
-					break;
-
-				//LD HL, [IY]
-				case 0xD9:
-					reg.hl = mem->read_u16(reg.iy_ex);
-					system_cycles = 20;
-					break;
-
-				//LD IX, [IY]
-				case 0xDA:
-					reg.ix = mem->read_u16(reg.iy_ex);
-					system_cycles = 20;
-					break;
-
-				//LD IY, [IY]
-				case 0xDB:
-					reg.iy = mem->read_u16(reg.iy_ex);
-					system_cycles = 20;
-					break;
-
-				//LD [IY], BA
-				case 0xDC:
-					mem->write_u16(reg.iy_ex, reg.ba);
-					system_cycles = 20;
-					break;
-
-				//LD [IY], HL
-				case 0xDD:
-					mem->write_u16(reg.iy_ex, reg.hl);
-					system_cycles = 20;
-					break;
-
-				//LD [IY], IX
-				case 0xDE:
-					mem->write_u16(reg.iy_ex, reg.ix);
-					system_cycles = 20;
-					break;
-
-				//LD [IY], IY
-				case 0xDF:
-					mem->write_u16(reg.iy_ex, reg.iy);
-					system_cycles = 20;
-					break;
-
-				//LD BA, BA
-				case 0xE0:
-					system_cycles = 8;
-					break;
-
-				//LD BA, HL
-				case 0xE1:
-					reg.ba = reg.hl;
-					system_cycles = 8;
-					break;
-
-				//LD BA, IX
-				case 0xE2:
-					reg.ba = reg.ix;
-					system_cycles = 8;
-					break;
-
-				//LD BA, IY
-				case 0xE3:
-					reg.ba = reg.iy;
-					system_cycles = 8;
-					break;
-
-				//LD HL, BA
-				case 0xE4:
-					reg.hl = reg.ba;
-					system_cycles = 8;
-					break;
-
-				//LD HL, HL
-				case 0xE5:
-					system_cycles = 8;
-					break;
-
-				//LD HL, IX
-				case 0xE6:
-					reg.hl = reg.ix;
-					system_cycles = 8;
-					break;
-
-				//LD HL, IY
-				case 0xE7:
-					reg.hl = reg.iy;
-					system_cycles = 8;
-					break;
-
-				//LD IX, BA
-				case 0xE8:
-					reg.ix = reg.ba;
-					system_cycles = 8;
-					break;
-
-				//LD IX, HL
-				case 0xE9:
-					reg.ix = reg.hl;
-					system_cycles = 8;
-					break;
-
-				//LD IX, IX
-				case 0xEA:
-					system_cycles = 8;
-					break;
-
-				//LD IX, IY
-				case 0xEB:
-					reg.ix = reg.iy;
-					system_cycles = 8;
-					break;
-
-				//LD IY, BA
-				case 0xEC:
-					reg.iy = reg.ba;
-					system_cycles = 8;
-					break;
-
-				//LD IY, HL
-				case 0xED:
-					reg.iy = reg.hl;
-					system_cycles = 8;
-					break;
-
-				//LD IY, IX
-				case 0xEE:
-					reg.iy = reg.ix;
-					system_cycles = 8;
-					break;
-
-				//LD IY, IY
-				case 0xEF:
-					system_cycles = 8;
-					break;
-
-				//LD SP, BA
-				case 0xF0:
-					reg.sp = reg.ba;
-					system_cycles = 8;
-					break;
-
-				//LD SP, HL
-				case 0xF1:
-					reg.sp = reg.hl;
-					system_cycles = 8;
-					break;
-
-				//LD SP, IX
-				case 0xF2:
-					reg.sp = reg.ix;
-					system_cycles = 8;
-					break;
-
-				//LD SP, IY
-				case 0xF3:
-					reg.sp = reg.iy;
-					system_cycles = 8;
-					break;
-
-				//LD HL, SP
-				case 0xF4:
-					reg.hl = reg.sp;
-					system_cycles = 8;
-					break;
-
-				//LD HL, PC
-				case 0xF5:
-					reg.hl = reg.pc;
-					system_cycles = 8;
-					break;
-
-				//LD BA, SP
-				case 0xF8:
-					reg.ba = reg.sp;
-					system_cycles = 8;
-					break;
-
-				//LD BA, PC
-				case 0xF9:
-					reg.ba = reg.pc;
-					system_cycles = 8;
-					break;
-
-				//LD IX, SP
-				case 0xFA:
-					reg.ix = reg.sp;
-					system_cycles = 8;
-					break;
-
-				//LD IY, SP
-				case 0xFE:
-					reg.iy = reg.sp;
-					system_cycles = 8;
-					break;
-
-				default:
-				std::cout<<"CPU::Error - Unknown 0xCF opcode -> 0x" << std::hex << opcode << "\n";
-				if(!config::ignore_illegal_opcodes) { running = false; }
-			}
-
+			execute_cf();
 			break;
 
 		//SUB BA, #nnnn
 		case 0xD0:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.ba = sub_u16(reg.ba, temp_val);
 			system_cycles = 12;
 
@@ -5336,7 +2727,7 @@ void S1C88::execute()
 
 		//SUB HL, #nnnn
 		case 0xD1:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.hl = sub_u16(reg.hl, temp_val);
 			system_cycles = 12;
 
@@ -5345,7 +2736,7 @@ void S1C88::execute()
 
 		//SUB IX, #nnnn
 		case 0xD2:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.ix = sub_u16(reg.ix, temp_val);
 			system_cycles = 12;
 
@@ -5354,7 +2745,7 @@ void S1C88::execute()
 
 		//SUB IY, #nnnn
 		case 0xD3:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.iy = sub_u16(reg.iy, temp_val);
 			system_cycles = 12;
 
@@ -5363,7 +2754,7 @@ void S1C88::execute()
 
 		//CP BA, #nnnn
 		case 0xD4:
-			temp_val = mem->read_u16(reg.pc_ex);
+			temp_val = fetch_u16();
 			cp_u16(reg.ba, temp_val);
 			system_cycles = 12;
 
@@ -5372,7 +2763,7 @@ void S1C88::execute()
 
 		//CP HL, #nnnn
 		case 0xD5:
-			temp_val = mem->read_u16(reg.pc_ex);
+			temp_val = fetch_u16();
 			cp_u16(reg.hl, temp_val);
 			system_cycles = 12;
 
@@ -5381,7 +2772,7 @@ void S1C88::execute()
 
 		//CP IX, #nnnn
 		case 0xD6:
-			temp_val = mem->read_u16(reg.pc_ex);
+			temp_val = fetch_u16();
 			cp_u16(reg.ix, temp_val);
 			system_cycles = 12;
 
@@ -5390,7 +2781,7 @@ void S1C88::execute()
 
 		//CP IY, #nnnn
 		case 0xD7:
-			temp_val = mem->read_u16(reg.pc_ex);
+			temp_val = fetch_u16();
 			cp_u16(reg.iy, temp_val);
 			system_cycles = 12;
 
@@ -5399,8 +2790,8 @@ void S1C88::execute()
 
 		//AND [BR + #nn], #nn
 		case 0xD8:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-			mem->write_u8(temp_val, and_u8(mem->read_u8(temp_val), mem->read_u8(reg.pc_ex++)));
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, and_u8(mem->read_u8(temp_val), fetch_u8()));
 			system_cycles = 20;
 
 			reg.pc += 2;
@@ -5408,8 +2799,8 @@ void S1C88::execute()
 
 		//OR [BR + #nn], #nn
 		case 0xD9:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-			mem->write_u8(temp_val, or_u8(mem->read_u8(temp_val), mem->read_u8(reg.pc_ex++)));
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, or_u8(mem->read_u8(temp_val), fetch_u8()));
 			system_cycles = 20;
 
 			reg.pc += 2;
@@ -5417,8 +2808,8 @@ void S1C88::execute()
 
 		//XOR [BR + #nn], #nn
 		case 0xDA:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-			mem->write_u8(temp_val, xor_u8(mem->read_u8(temp_val), mem->read_u8(reg.pc_ex++)));
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, xor_u8(mem->read_u8(temp_val), fetch_u8()));
 			system_cycles = 20;
 
 			reg.pc += 2;
@@ -5426,8 +2817,8 @@ void S1C88::execute()
 			
 		//CP [BR + #nn], #nn
 		case 0xDB:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
-			cp_u8(temp_val, mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
+			cp_u8(temp_val, fetch_u8());
 			system_cycles = 16;
 
 			reg.pc += 2;
@@ -5435,8 +2826,8 @@ void S1C88::execute()
 
 		//BIT [BR + #nn], #nn
 		case 0xDC:
-			temp_val = mem->read_u8((reg.br_ex << 8) | mem->read_u8(reg.pc_ex++));
-			bit_u8(temp_val, mem->read_u8(reg.pc_ex++));
+			temp_val = mem->read_u8((reg.br_ex << 8) | fetch_u8());
+			bit_u8(temp_val, fetch_u8());
 			system_cycles = 16;
 
 			reg.pc += 2;
@@ -5444,8 +2835,8 @@ void S1C88::execute()
 
 		//LD [BR + #nn], #nn
 		case 0xDD:
-			temp_val = (reg.br_ex << 8) | mem->read_u8(reg.pc_ex++);
-			mem->write_u8(temp_val, mem->read_u8(reg.pc_ex++));
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, fetch_u8());
 			system_cycles = 16;
 
 			reg.pc += 2;
@@ -5467,7 +2858,7 @@ void S1C88::execute()
 
 		//CARS C #ss
 		case 0xE0:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			if(reg.sc & CARRY_FLAG)
@@ -5488,7 +2879,7 @@ void S1C88::execute()
 
 		//CARS NC #ss
 		case 0xE1:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			if((reg.sc & CARRY_FLAG) == 0)
@@ -5509,7 +2900,7 @@ void S1C88::execute()
 
 		//CARS Z #ss
 		case 0xE2:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			if(reg.sc & ZERO_FLAG)
@@ -5530,7 +2921,7 @@ void S1C88::execute()
 
 		//CARS NZ #ss
 		case 0xE3:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			if((reg.sc & ZERO_FLAG) == 0)
@@ -5551,7 +2942,7 @@ void S1C88::execute()
 
 		//JRS C #ss
 		case 0xE4:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			if(reg.sc & CARRY_FLAG)
@@ -5566,7 +2957,7 @@ void S1C88::execute()
 
 		//JRS NC #ss
 		case 0xE5:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			if((reg.sc & CARRY_FLAG) == 0)
@@ -5581,7 +2972,7 @@ void S1C88::execute()
 
 		//JRS Z #ss
 		case 0xE6:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			if(reg.sc & ZERO_FLAG)
@@ -5596,7 +2987,7 @@ void S1C88::execute()
 
 		//JRS NZ #ss
 		case 0xE7:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			if((reg.sc & ZERO_FLAG) == 0)
@@ -5611,7 +3002,7 @@ void S1C88::execute()
 
 		//CARL C #ssss
 		case 0xE8:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			if(reg.sc & CARRY_FLAG)
@@ -5632,7 +3023,7 @@ void S1C88::execute()
 
 		//CARL NC #ssss
 		case 0xE9:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			if((reg.sc & CARRY_FLAG) == 0)
@@ -5653,7 +3044,7 @@ void S1C88::execute()
 
 		//CARL Z #ssss
 		case 0xEA:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			if(reg.sc & ZERO_FLAG)
@@ -5674,7 +3065,7 @@ void S1C88::execute()
 
 		//CARL NZ #ssss
 		case 0xEB:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			if((reg.sc & ZERO_FLAG) == 0)
@@ -5695,7 +3086,7 @@ void S1C88::execute()
 
 		//JRL C #ssss
 		case 0xEC:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			if(reg.sc & CARRY_FLAG)
@@ -5710,7 +3101,7 @@ void S1C88::execute()
 
 		//JRL NC #ssss
 		case 0xED:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			if((reg.sc & CARRY_FLAG) == 0)
@@ -5725,7 +3116,7 @@ void S1C88::execute()
 
 		//JRL Z #ssss
 		case 0xEE:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			if(reg.sc & ZERO_FLAG)
@@ -5740,7 +3131,7 @@ void S1C88::execute()
 
 		//JRL NZ #ssss
 		case 0xEF:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			if((reg.sc & ZERO_FLAG) == 0)
@@ -5755,7 +3146,7 @@ void S1C88::execute()
 
 		//CARS #ss
 		case 0xF0:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			mem->write_u8(--reg.sp, reg.cb);
@@ -5769,7 +3160,7 @@ void S1C88::execute()
 
 		//JRS #ss
 		case 0xF1:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 
 			reg.cb = reg.nb;
@@ -5779,7 +3170,7 @@ void S1C88::execute()
 
 		//CARL #ssss
 		case 0xF2:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			mem->write_u8(--reg.sp, reg.cb);
@@ -5791,7 +3182,7 @@ void S1C88::execute()
 
 		//JRL #ssss
 		case 0xF3:
-			s_temp = mem->read_s16(reg.pc_ex);
+			s_temp = fetch_s16();
 			reg.pc += 2;
 
 			reg.cb = reg.nb;
@@ -5808,7 +3199,7 @@ void S1C88::execute()
 
 		//DJR NZ #ss
 		case 0xF5:
-			s_temp = mem->read_s8(reg.pc_ex++);
+			s_temp = fetch_s8();
 			reg.pc++;
 			reg.b = dec_u8(reg.b);
 
@@ -5868,7 +3259,7 @@ void S1C88::execute()
 
 		//CALL [#nnnn]
 		case 0xFB:
-			temp_val = (reg.ep << 16) | mem->read_u16(reg.pc_ex);
+			temp_val = (reg.ep << 16) | fetch_u16();
 			reg.pc += 2;
 
 			mem->write_u8(--reg.sp, reg.cb);
@@ -5881,7 +3272,7 @@ void S1C88::execute()
 
 		//INT
 		case 0xFC:
-			temp_val = mem->read_u8(reg.pc_ex++);
+			temp_val = fetch_u8();
 			reg.pc++;
 
 			mem->write_u8(--reg.sp, reg.cb);
@@ -5895,7 +3286,7 @@ void S1C88::execute()
 
 		//JP INT
 		case 0xFD:
-			temp_val = mem->read_u8(reg.pc_ex++);
+			temp_val = fetch_u8();
 			reg.pc++;
 
 			reg.cb = reg.nb;
@@ -5917,96 +3308,2753 @@ void S1C88::execute()
 	log_addr = reg.pc;
 }
 
-/****** Process hardware interrupts ******/
-void S1C88::handle_interrupt()
+/****** Decode and execute extended 0xCE instructions ******/
+void S1C88::execute_ce()
 {
-	if(skip_irq) { return; }
-
-	u8 irq_mask = (reg.sc >> 6);
+	u32 temp_val = 0;
+	s16 s_temp = 0;
 
-	//Cycle through all 4 interrupt levels and jump to vector with highest priority
-	for(s32 x = 4; x > irq_mask; x--)
+	switch(opcode & 0xFF)
 	{
-		for(s32 y = 0; y < 32; y++)
-		{
-			if((mem->irq_enable[y]) && (mem->master_irq_flags & (1 << y)) && (mem->irq_priority[y] == x))
-			{
-				//Assume System Reset IRQ is not treated like a normal IRQ (i.e. just jump to IRQ vector)
-				if(y > 0)
-				{
-					halt = false;
+		//ADD A, [IX + #ss]
+		case 0x00:
+			s_temp = fetch_s8();
+			reg.a = add_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 16;
 
-					mem->write_u8(--reg.sp, reg.cb);
-					mem->write_u8(--reg.sp, (reg.pc >> 8));
-					mem->write_u8(--reg.sp, (reg.pc & 0xFF));
-					mem->write_u8(--reg.sp, reg.sc);
+			reg.pc++;
+			break;
 
-					reg.cb = 0;
-					reg.sc |= 0xC0;
-				}
+		//ADD A, [IY + #ss]
+		case 0x01:
+			s_temp = fetch_s8();
+			reg.a = add_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 16;
 
-				else { mem->master_irq_flags &= ~0x1; }
+			reg.pc++;
+			break;
 
-				reg.pc = mem->irq_vectors[y];
+		//ADD A, [IX + L]
+		case 0x02:
+			reg.a = add_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
 
-				x = 0;
-				y = 32;
-			}
-		}
-	}
-}
+		//ADD A, [IY + L]
+		case 0x03:
+			reg.a = add_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
 
-/****** Calculates most recent extended values for certain paged registers ******/
-void S1C88::update_regs()
-{
-	//Calculate extended PC
-	if((reg.pc & 0xFFFF) > 0x7FFF) { reg.pc_ex = (reg.pc & 0x7FFF) + (0x8000 * reg.cb); }
-	else { reg.pc_ex = reg.pc; }
+		//ADD [HL], A
+		case 0x04:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = add_u8(temp_val, reg.a);
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 16;
+			break;
 
-	//Calculate extended IX
-	if(reg.xp) { reg.ix_ex = reg.ix + (0x10000 * reg.xp); }
-	else { reg.ix_ex = reg.ix; }
+		//ADD [HL], #nn
+		case 0x05:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = add_u8(temp_val, fetch_u8());
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
 
-	//Calculate extended IY
-	if(reg.yp) { reg.iy_ex = reg.iy + (0x10000 * reg.yp); }
-	else { reg.iy_ex = reg.iy; }
+			reg.pc++;
+			break;
 
-	//Calculate extended BR and HL
-	if(reg.ep)
-	{
-		reg.hl_ex = reg.hl + (0x10000 * reg.ep);
-		reg.br_ex = reg.br + (0x10000 * reg.ep);
-	}
+		//ADD [HL], [IX]
+		case 0x06:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = add_u8(temp_val, mem->read_u8(reg.ix_ex));
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+			break;
 
-	else
-	{
-		reg.hl_ex = reg.hl;
-		reg.br_ex = reg.br;
-	}
-}
+		//ADD [HL], [IY]
+		case 0x07:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = add_u8(temp_val, mem->read_u8(reg.iy_ex));
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+			break;
 
-/****** Clocks CPU and Pokemon Mini subsystems ******/
-void S1C88::clock_system()
-{
-	//Clock CPU cycles for PRC
-	controllers.video.lcd_stat.prc_clock += system_cycles;
-	
-	//Increment PRC Count
-	if(controllers.video.lcd_stat.prc_clock >= (controllers.video.lcd_stat.prc_counter * PRC_COUNT_TIME))
-	{
-		controllers.video.lcd_stat.prc_counter++;
+		//ADC A, [IX + #ss]
+		case 0x08:
+			s_temp = fetch_s8();
+			reg.a = adc_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 16;
 
-		//Wait on PRC counts after rendering or copying frames to send PRC Copy Complete IRQ
-		if(controllers.video.lcd_stat.prc_copy_wait)
-		{
-			controllers.video.lcd_stat.prc_copy_wait--;
-			
-			//Trigger PRC Copy Complete IRQ
-			if(!controllers.video.lcd_stat.prc_copy_wait) { mem->update_irq_flags(PRC_COPY_IRQ); }
-		}
-			
-		//Reset PRC Count and increment frame counter
-		if(controllers.video.lcd_stat.prc_counter == 0x42)
+			reg.pc++;
+			break;
+
+		//ADC A, [IY + #ss]
+		case 0x09:
+			s_temp = fetch_s8();
+			reg.a = adc_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//ADC A, [IX + L]
+		case 0x0A:
+			reg.a = adc_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//ADC A, [IY + L]
+		case 0x0B:
+			reg.a = adc_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//ADC [HL], A
+		case 0x0C:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = adc_u8(temp_val, reg.a);
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 16;
+			break;
+
+		//ADC [HL], #nn
+		case 0x0D:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = adc_u8(temp_val, fetch_u8());
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//ADC [HL], [IX]
+		case 0x0E:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = adc_u8(temp_val, mem->read_u8(reg.ix_ex));
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+			break;
+
+		//ADC [HL], [IY]
+		case 0x0F:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = adc_u8(temp_val, mem->read_u8(reg.iy_ex));
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+			break;
+
+		//SUB A, [IX + #ss]
+		case 0x10:
+			s_temp = fetch_s8();
+			reg.a = sub_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//SUB A, [IY + #ss]
+		case 0x11:
+			s_temp = fetch_s8();
+			reg.a = sub_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//SUB A, [IX + L]
+		case 0x12:
+			reg.a = sub_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//SUB A, [IY + L]
+		case 0x13:
+			reg.a = sub_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//SUB [HL], A
+		case 0x14:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = sub_u8(temp_val, reg.a);
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 16;
+			break;
+
+		//SUB [HL], #nn
+		case 0x15:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = sub_u8(temp_val, fetch_u8());
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//SUB [HL], [IX]
+		case 0x16:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = sub_u8(temp_val, mem->read_u8(reg.ix_ex));
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+			break;
+
+		//SUB [HL], [IY]
+		case 0x17:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = sub_u8(temp_val, mem->read_u8(reg.iy_ex));
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+			break;
+
+		//SBC A, [IX + #ss]
+		case 0x18:
+			s_temp = fetch_s8();
+			reg.a = sbc_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//SBC A, [IY + #ss]
+		case 0x19:
+			s_temp = fetch_s8();
+			reg.a = sbc_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//SBC A, [IX + L]
+		case 0x1A:
+			reg.a = sbc_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//SBC A, [IY + L]
+		case 0x1B:
+			reg.a = sbc_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//SBC [HL], A
+		case 0x1C:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = sbc_u8(temp_val, reg.a);
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 16;
+			break;
+
+		//SBC [HL], #nn
+		case 0x1D:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = sbc_u8(temp_val, fetch_u8());
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//SBC [HL], [IX]
+		case 0x1E:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = sbc_u8(temp_val, mem->read_u8(reg.ix_ex));
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+			break;
+
+		//SBC [HL], [IY]
+		case 0x1F:
+			temp_val = mem->read_u8(reg.hl_ex);
+			temp_val = sbc_u8(temp_val, mem->read_u8(reg.iy_ex));
+			mem->write_u8(reg.hl_ex, temp_val);
+			system_cycles = 20;
+			break;
+
+		//AND A, [IX + #ss]
+		case 0x20:
+			s_temp = fetch_s8();
+			reg.a = and_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//AND A, [IY + #ss]
+		case 0x21:
+			s_temp = fetch_s8();
+			reg.a = and_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//AND A, [IX + L]
+		case 0x22:
+			reg.a = and_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//AND A, [IY + L]
+		case 0x23:
+			reg.a = and_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//AND [HL], A
+		case 0x24:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, and_u8(temp_val, reg.a));
+			system_cycles = 16;
+			break;
+
+		//AND [HL], #nn
+		case 0x25:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, and_u8(temp_val, fetch_u8()));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//AND [HL], [IX]
+		case 0x26:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, and_u8(temp_val, mem->read_u8(reg.ix_ex)));
+			system_cycles = 20;
+			break;
+
+		//AND [HL], [IY]
+		case 0x27:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, and_u8(temp_val, mem->read_u8(reg.iy_ex)));
+			system_cycles = 20;
+			break;
+
+		//OR A, [IX + #ss]
+		case 0x28:
+			s_temp = fetch_s8();
+			reg.a = or_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//OR A, [IY + #ss]
+		case 0x29:
+			s_temp = fetch_s8();
+			reg.a = or_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//OR A, [IX + L]
+		case 0x2A:
+			reg.a = or_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//OR A, [IY + L]
+		case 0x2B:
+			reg.a = or_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//OR [HL], A
+		case 0x2C:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, or_u8(temp_val, reg.a));
+			system_cycles = 16;
+			break;
+
+		//OR [HL], #nn
+		case 0x2D:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, or_u8(temp_val, fetch_u8()));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//OR [HL], [IX]
+		case 0x2E:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, or_u8(temp_val, mem->read_u8(reg.ix_ex)));
+			system_cycles = 20;
+			break;
+
+		//OR [HL], [IY]
+		case 0x2F:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, or_u8(temp_val, mem->read_u8(reg.iy_ex)));
+			system_cycles = 20;
+			break;
+
+		//CP A, [IX + #ss]
+		case 0x30:
+			s_temp = fetch_s8();
+			cp_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//CP A, [IY + #ss]
+		case 0x31:
+			s_temp = fetch_s8();
+			cp_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//CP A, [IX + L]
+		case 0x32:
+			cp_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//CP A, [IY + L]
+		case 0x33:
+			cp_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//CP [HL], A
+		case 0x34:
+			temp_val = mem->read_u8(reg.hl_ex);
+			cp_u8(temp_val, reg.a);
+			system_cycles = 16;
+			break;
+
+		//CP [HL], #nn
+		case 0x35:
+			temp_val = mem->read_u8(reg.hl_ex);
+			cp_u8(temp_val, fetch_u8());
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//CP [HL], [IX]
+		case 0x36:
+			temp_val = mem->read_u8(reg.hl_ex);
+			cp_u8(temp_val, mem->read_u8(reg.ix_ex));
+			system_cycles = 20;
+			break;
+
+		//CP [HL], [IY]
+		case 0x37:
+			temp_val = mem->read_u8(reg.hl_ex);
+			cp_u8(temp_val, mem->read_u8(reg.iy_ex));
+			system_cycles = 20;
+			break;
+
+		//XOR A, [IX + #ss]
+		case 0x38:
+			s_temp = fetch_s8();
+			reg.a = xor_u8(reg.a, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//XOR A, [IY + #ss]
+		case 0x39:
+			s_temp = fetch_s8();
+			reg.a = xor_u8(reg.a, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//XOR A, [IX + L]
+		case 0x3A:
+			reg.a = xor_u8(reg.a, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//XOR A, [IY + L]
+		case 0x3B:
+			reg.a = xor_u8(reg.a, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 16;
+			break;
+
+		//XOR [HL], A
+		case 0x3C:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, xor_u8(temp_val, reg.a));
+			system_cycles = 16;
+			break;
+
+		//XOR [HL], #nn
+		case 0x3D:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, xor_u8(temp_val, fetch_u8()));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//XOR [HL], [IX]
+		case 0x3E:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, xor_u8(temp_val, mem->read_u8(reg.ix_ex)));
+			system_cycles = 20;
+			break;
+
+		//XOR [HL], [IY]
+		case 0x3F:
+			temp_val = mem->read_u8(reg.hl_ex);
+			mem->write_u8(reg.hl_ex, xor_u8(temp_val, mem->read_u8(reg.iy_ex)));
+			system_cycles = 20;
+			break;
+
+		//LD A, [IX + #ss]
+		case 0x40:
+			s_temp = fetch_s8();
+			reg.a = mem->read_u8(reg.ix_ex + s_temp);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD A, [IY + #ss]
+		case 0x41:
+			s_temp = fetch_s8();
+			reg.a = mem->read_u8(reg.iy_ex + s_temp);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD A, [IX + L]
+		case 0x42:
+			reg.a = mem->read_u8(reg.ix_ex + comp8(reg.l));
+			system_cycles = 16;
+			break;
+
+		//LD A, [IY + L]
+		case 0x43:
+			reg.a = mem->read_u8(reg.iy_ex + comp8(reg.l));
+			system_cycles = 16;
+			break;
+
+		//LD [IX + #ss], A
+		case 0x44:
+			s_temp = fetch_s8();
+			mem->write_u8((reg.ix_ex + s_temp), reg.a);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD [IY + #ss], A
+		case 0x45:
+			s_temp = fetch_s8();
+			mem->write_u8((reg.iy_ex + s_temp), reg.a);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD [IX + L], A
+		case 0x46:
+			mem->write_u8((reg.ix_ex + comp8(reg.l)), reg.a);
+			system_cycles = 16;
+			break;
+
+		//LD [IY + L], A
+		case 0x47:
+			mem->write_u8((reg.iy_ex + comp8(reg.l)), reg.a);
+			system_cycles = 16;
+			break;
+
+		//LD B, [IX + #ss]
+		case 0x48:
+			s_temp = fetch_s8();
+			reg.b = mem->read_u8(reg.ix_ex + s_temp);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD B, [IY + #ss]
+		case 0x49:
+			s_temp = fetch_s8();
+			reg.b = mem->read_u8(reg.iy_ex + s_temp);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD B, [IX + L]
+		case 0x4A:
+			reg.b = mem->read_u8(reg.ix_ex + comp8(reg.l));
+			system_cycles = 16;
+			break;
+
+		//LD B, [IY + L]
+		case 0x4B:
+			reg.b = mem->read_u8(reg.iy_ex + comp8(reg.l));
+			system_cycles = 16;
+			break;
+
+		//LD [IX + #ss], B
+		case 0x4C:
+			s_temp = fetch_s8();
+			mem->write_u8((reg.ix_ex + s_temp), reg.b);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD [IY + #ss], B
+		case 0x4D:
+			s_temp = fetch_s8();
+			mem->write_u8((reg.iy_ex + s_temp), reg.b);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD [IX + L], B
+		case 0x4E:
+			mem->write_u8((reg.ix_ex + comp8(reg.l)), reg.b);
+			system_cycles = 16;
+			break;
+
+		//LD [IY + L], B
+		case 0x4F:
+			mem->write_u8((reg.iy_ex + comp8(reg.l)), reg.b);
+			system_cycles = 16;
+			break;
+
+		//LD L, [IX + #ss]
+		case 0x50:
+			s_temp = fetch_s8();
+			reg.l = mem->read_u8(reg.ix_ex + s_temp);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD L, [IY + #ss]
+		case 0x51:
+			s_temp = fetch_s8();
+			reg.l = mem->read_u8(reg.iy_ex + s_temp);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD L, [IX + L]
+		case 0x52:
+			reg.l = mem->read_u8(reg.ix_ex + comp8(reg.l));
+			system_cycles = 16;
+			break;
+
+		//LD L, [IY + L]
+		case 0x53:
+			reg.l = mem->read_u8(reg.iy_ex + comp8(reg.l));
+			system_cycles = 16;
+			break;
+
+		//LD [IX + #ss], L
+		case 0x54:
+			s_temp = fetch_s8();
+			mem->write_u8((reg.ix_ex + s_temp), reg.l);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD [IY + #ss], L
+		case 0x55:
+			s_temp = fetch_s8();
+			mem->write_u8((reg.iy_ex + s_temp), reg.l);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD [IX + L], L
+		case 0x56:
+			mem->write_u8((reg.ix_ex + comp8(reg.l)), reg.l);
+			system_cycles = 16;
+			break;
+
+		//LD [IY + L], L
+		case 0x57:
+			mem->write_u8((reg.iy_ex + comp8(reg.l)), reg.l);
+			system_cycles = 16;
+			break;
+
+		//LD H, [IX + #ss]
+		case 0x58:
+			s_temp = fetch_s8();
+			reg.h = mem->read_u8(reg.ix_ex + s_temp);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD H, [IY + #ss]
+		case 0x59:
+			s_temp = fetch_s8();
+			reg.h = mem->read_u8(reg.iy_ex + s_temp);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD H, [IX + L]
+		case 0x5A:
+			reg.h = mem->read_u8(reg.ix_ex + comp8(reg.l));
+			system_cycles = 16;
+			break;
+
+		//LD H, [IY + L]
+		case 0x5B:
+			reg.h = mem->read_u8(reg.iy_ex + comp8(reg.l));
+			system_cycles = 16;
+			break;
+
+		//LD [IX + #ss], H
+		case 0x5C:
+			s_temp = fetch_s8();
+			mem->write_u8((reg.ix_ex + s_temp), reg.h);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD [IY + #ss], H
+		case 0x5D:
+			s_temp = fetch_s8();
+			mem->write_u8((reg.iy_ex + s_temp), reg.h);
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD [IX + L], H
+		case 0x5E:
+			mem->write_u8((reg.ix_ex + comp8(reg.l)), reg.h);
+			system_cycles = 16;
+			break;
+
+		//LD [IY + L], H
+		case 0x5F:
+			mem->write_u8((reg.iy_ex + comp8(reg.l)), reg.h);
+			system_cycles = 16;
+			break;
+
+		//LD [HL], [IX + #ss]
+		case 0x60:
+			s_temp = fetch_s8();
+			mem->write_u8(reg.hl_ex, (reg.ix_ex + s_temp));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//LD [HL], [IY + #ss]
+		case 0x61:
+			s_temp = fetch_s8();
+			mem->write_u8(reg.hl_ex, (reg.iy_ex + s_temp));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//LD [HL], [IX + L]
+		case 0x62:
+			mem->write_u8(reg.hl_ex, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 20;
+			break;
+
+		//LD [HL], [IY + L]
+		case 0x63:
+			mem->write_u8(reg.hl_ex, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 20;
+			break;
+
+		//LD [IX], [IX + #ss]
+		case 0x68:
+			s_temp = fetch_s8();
+			mem->write_u8(reg.ix_ex, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//LD [IX], [IY + #ss]
+		case 0x69:
+			s_temp = fetch_s8();
+			mem->write_u8(reg.ix_ex, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//LD [IX], [IX + L]
+		case 0x6A:
+			mem->write_u8(reg.ix_ex, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 20;
+			break;
+
+		//LD [IX], [IY + L]
+		case 0x6B:
+			mem->write_u8(reg.ix_ex, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 20;
+			break;
+
+		//LD [IY], [IX + #ss]
+		case 0x78:
+			s_temp = fetch_s8();
+			mem->write_u8(reg.iy_ex, mem->read_u8(reg.ix_ex + s_temp));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//LD [IY], [IY + #ss]
+		case 0x79:
+			s_temp = fetch_s8();
+			mem->write_u8(reg.iy_ex, mem->read_u8(reg.iy_ex + s_temp));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//LD [IY], [IX + L]
+		case 0x7A:
+			mem->write_u8(reg.iy_ex, mem->read_u8(reg.ix_ex + comp8(reg.l)));
+			system_cycles = 20;
+			break;
+
+		//LD [IY], [IY + L]
+		case 0x7B:
+			mem->write_u8(reg.iy_ex, mem->read_u8(reg.iy_ex + comp8(reg.l)));
+			system_cycles = 20;
+			break;
+
+		//SLA A
+		case 0x80:
+			reg.a = sla_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//SLA B
+		case 0x81:
+			reg.b = sla_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//SLA [BR + #nn]
+		case 0x82:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, sla_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//SLA [HL]
+		case 0x83:
+			mem->write_u8(reg.hl_ex, sla_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//SLL A
+		case 0x84:
+			reg.a = sll_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//SLL B
+		case 0x85:
+			reg.b = sll_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//SLL [BR + #nn]
+		case 0x86:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, sll_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//SLL [HL]
+		case 0x87:
+			mem->write_u8(reg.hl_ex, sll_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//SRA A
+		case 0x88:
+			reg.a = sra_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//SRA B
+		case 0x89:
+			reg.b = sra_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//SRA [BR + #nn]
+		case 0x8A:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, sra_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//SRA [HL]
+		case 0x8B:
+			mem->write_u8(reg.hl_ex, sra_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//SRL A
+		case 0x8C:
+			reg.a = srl_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//SRL B
+		case 0x8D:
+			reg.b = srl_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//SRL [BR + #nn]
+		case 0x8E:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, srl_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//SRL [HL]
+		case 0x8F:
+			mem->write_u8(reg.hl_ex, srl_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//RL A
+		case 0x90:
+			reg.a = rl_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//RL B
+		case 0x91:
+			reg.b = rl_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//RL [BR + #nn]
+		case 0x92:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, rl_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//RL [HL]
+		case 0x93:
+			mem->write_u8(reg.hl_ex, rl_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//RLC A
+		case 0x94:
+			reg.a = rlc_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//RLC B
+		case 0x95:
+			reg.b = rlc_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//RLC [BR + #nn]
+		case 0x96:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, rlc_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//RLC [HL]
+		case 0x97:
+			mem->write_u8(reg.hl_ex, rlc_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//RR A
+		case 0x98:
+			reg.a = rr_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//RR B
+		case 0x99:
+			reg.b = rr_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//RR [BR + #nn]
+		case 0x9A:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, rr_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//RR [HL]
+		case 0x9B:
+			mem->write_u8(reg.hl_ex, rr_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//RRC A
+		case 0x9C:
+			reg.a = rrc_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//RRC B
+		case 0x9D:
+			reg.b = rrc_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//RRC [BR + #nn]
+		case 0x9E:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, rrc_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//RRC [HL]
+		case 0x9F:
+			mem->write_u8(reg.hl_ex, rrc_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//CPL A
+		case 0xA0:
+			reg.a = cpl_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//CPL B
+		case 0xA1:
+			reg.b = cpl_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//CPL [BR + #nn]
+		case 0xA2:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, cpl_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//CPL [HL]
+		case 0xA3:
+			mem->write_u8(reg.hl_ex, cpl_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//NEG A
+		case 0xA4:
+			reg.a = neg_u8(reg.a);
+			system_cycles = 12;
+			break;
+
+		//NEG B
+		case 0xA5:
+			reg.b = neg_u8(reg.b);
+			system_cycles = 12;
+			break;
+
+		//NEG [BR + #nn]
+		case 0xA6:
+			temp_val = (reg.br_ex << 8) | fetch_u8();
+			mem->write_u8(temp_val, neg_u8(mem->read_u8(temp_val)));
+			system_cycles = 20;
+
+			reg.pc++;
+			break;
+
+		//NEG [HL]
+		case 0xA7:
+			mem->write_u8(reg.hl_ex, neg_u8(mem->read_u8(reg.hl_ex)));
+			system_cycles = 16;
+			break;
+
+		//SEP
+		case 0xA8:
+			reg.b = (reg.a & 0x80) ? 0xFF : 0x00;
+			system_cycles = 12;
+			break;
+
+		//HALT
+		case 0xAE:
+			halt = true;
+			system_cycles = 12;
+			break;
+
+		//AND B, #nn
+		case 0xB0:
+			reg.b = and_u8(reg.b, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//AND L, #nn
+		case 0xB1:
+			reg.l = and_u8(reg.l, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//AND H, #nn
+		case 0xB2:
+			reg.h = and_u8(reg.h, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//OR B, #nn
+		case 0xB4:
+			reg.b = or_u8(reg.b, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//OR L, #nn
+		case 0xB5:
+			reg.l = or_u8(reg.l, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//OR H, #nn
+		case 0xB6:
+			reg.h = or_u8(reg.h, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//XOR B, #nn
+		case 0xB8:
+			reg.b = xor_u8(reg.b, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//XOR L, #nn
+		case 0xB9:
+			reg.l = xor_u8(reg.l, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//XOR H, #nn
+		case 0xBA:
+			reg.h = xor_u8(reg.h, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//CP B, #nn
+		case 0xBC:
+			cp_u8(reg.b, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//CP L, #nn
+		case 0xBD:
+			cp_u8(reg.l, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//CP H, #nn
+		case 0xBE:
+			cp_u8(reg.h, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//CP BR, #nn
+		case 0xBF:
+			cp_u8(reg.br, fetch_u8());
+			system_cycles = 12;
+
+			reg.pc++;
+			break;
+
+		//LD A, BR
+		case 0xC0:
+			reg.a = reg.br;
+			system_cycles = 8;
+			break;
+
+		//LD A, SC
+		case 0xC1:
+			reg.a = reg.sc;
+			system_cycles = 8;
+			break;
+
+		//LD BR, A
+		case 0xC2:
+			reg.br = reg.a;
+			system_cycles = 8;
+			break;
+
+		//LD SC, A
+		case 0xC3:
+			reg.sc = reg.a;
+			system_cycles = 12;
+			skip_irq = true;
+			break;
+
+		//LD NB, #nn
+		case 0xC4:
+			reg.nb = fetch_u8();
+			system_cycles = 16;
+			skip_irq = true;
+
+			reg.pc++;
+			break;
+
+		//LD EP, #nn
+		case 0xC5:
+			reg.ep = fetch_u8();
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD XP, #nn
+		case 0xC6:
+			reg.xp = fetch_u8();
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD YP, #nn
+		case 0xC7:
+			reg.yp = fetch_u8();
+			system_cycles = 16;
+
+			reg.pc++;
+			break;
+
+		//LD A, NB
+		case 0xC8:
+			reg.a = reg.nb;
+			system_cycles = 8;
+			break;
+
+		//LD A, EP
+		case 0xC9:
+			reg.a = reg.ep;
+			system_cycles = 8;
+			break;
+
+		//LD A, XP
+		case 0xCA:
+			reg.a = reg.xp;
+			system_cycles = 8;
+			break;
+
+		//LD A, YP
+		case 0xCB:
+			reg.a = reg.yp;
+			system_cycles = 8;
+			break;
+
+		//LD NB, A
+		case 0xCC:
+			reg.nb = reg.a;
+			system_cycles = 12;
+			skip_irq = true;
+			break;
+
+		//LD EP, A
+		case 0xCD:
+			reg.ep = reg.a;
+			system_cycles = 8;
+			break;
+
+		//LD XP, A
+		case 0xCE:
+			reg.xp = reg.a;
+			system_cycles = 8;
+			break;
+
+		//LD YP, A
+		case 0xCF:
+			reg.yp = reg.a;
+			system_cycles = 8;
+			break;
+
+		//LD A, [#nnnn]
+		case 0xD0:
+			temp_val = (reg.ep << 16) | fetch_u16();
+			reg.a = mem->read_u8(temp_val);
+			system_cycles = 20;
+
+			reg.pc += 2;
+			break;
+
+		//LD B, [#nnnn]
+		case 0xD1:
+			temp_val = (reg.ep << 16) | fetch_u16();
+			reg.b = mem->read_u8(temp_val);
+			system_cycles = 20;
+
+			reg.pc += 2;
+			break;
+
+		//LD L, [#nnnn]
+		case 0xD2:
+			temp_val = (reg.ep << 16) | fetch_u16();
+			reg.l = mem->read_u8(temp_val);
+			system_cycles = 20;
+
+			reg.pc += 2;
+			break;
+
+		//LD H, [#nnnn]
+		case 0xD3:
+			temp_val = (reg.ep << 16) | fetch_u16();
+			reg.h = mem->read_u8(temp_val);
+			system_cycles = 20;
+
+			reg.pc += 2;
+			break;
+
+		//LD [#nnnn], A
+		case 0xD4:
+			temp_val = (reg.ep << 16) | fetch_u16();
+			mem->write_u8(temp_val, reg.a);
+			system_cycles = 20;
+
+			reg.pc += 2;
+			break;
+
+		//LD [#nnnn], B
+		case 0xD5:
+			temp_val = (reg.ep << 16) | fetch_u16();
+			mem->write_u8(temp_val, reg.b);
+			system_cycles = 20;
+
+			reg.pc += 2;
+			break;
+
+		//LD [#nnnn], L
+		case 0xD6:
+			temp_val = (reg.ep << 16) | fetch_u16();
+			mem->write_u8(temp_val, reg.l);
+			system_cycles = 20;
+
+			reg.pc += 2;
+			break;
+
+		//LD [#nnnn], H
+		case 0xD7:
+			temp_val = (reg.ep << 16) | fetch_u16();
+			mem->write_u8(temp_val, reg.h);
+			system_cycles = 20;
+
+			reg.pc += 2;
+			break;
+
+		//MLT L, A
+		case 0xD8:
+			reg.hl = mlt_u8(reg.l, reg.a);
+			system_cycles = 48;
+			break;
+
+		//DIV HL, A
+		case 0xD9:
+			reg.hl = div_u16(reg.hl, reg.a);
+			system_cycles = 52;
+			break;
+
+		//JRS LT #ss
+		case 0xE0:
+			{
+				s_temp = fetch_s8();
+				reg.pc++;
+
+				u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
+				u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
+
+				if(flag_1 != flag_2)
+				{
+					reg.cb = reg.nb;
+					reg.pc = log_addr + s_temp + 2;
+				}
+
+				system_cycles = 12;
+			}
+
+			break;
+
+		//JRS LE #ss
+		case 0xE1:
+			{
+				s_temp = fetch_s8();
+				reg.pc++;
+
+				u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
+				u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
+				u8 flag_3 = (reg.sc & ZERO_FLAG) ? 1 : 0;
+
+				if((flag_1 != flag_2) || (flag_3))
+				{
+					reg.cb = reg.nb;
+					reg.pc = log_addr + s_temp + 2;
+				}
+
+				system_cycles = 12;
+			}
+
+			break;
+
+		//JRS GT #ss
+		case 0xE2:
+			{
+				s_temp = fetch_s8();
+				reg.pc++;
+
+				u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
+				u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
+				u8 flag_3 = (reg.sc & ZERO_FLAG) ? 1 : 0;
+
+				if((flag_1 == flag_2) && (flag_3 == 0))
+				{
+					reg.cb = reg.nb;
+					reg.pc = log_addr + s_temp + 2;
+				}
+
+				system_cycles = 12;
+			}
+
+			break;
+
+		//JRS GE #ss
+		case 0xE3:
+			{
+				s_temp = fetch_s8();
+				reg.pc++;
+
+				u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
+				u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
+
+				if(flag_1 == flag_2)
+				{
+					reg.cb = reg.nb;
+					reg.pc = log_addr + s_temp + 2;
+				}
+
+				system_cycles = 12;
+			}
+
+			break;
+
+		//JRS V #ss
+		case 0xE4:
+			s_temp = fetch_s8();
+			reg.pc++;
+
+			if(reg.sc & OVERFLOW_FLAG)
+			{
+				reg.cb = reg.nb;
+				reg.pc = log_addr + s_temp + 2;
+			}
+
+			system_cycles = 12;
+
+			break;
+
+		//JRS NV #ss
+		case 0xE5:
+			s_temp = fetch_s8();
+			reg.pc++;
+
+			if((reg.sc & OVERFLOW_FLAG) == 0)
+			{
+				reg.cb = reg.nb;
+				reg.pc = log_addr + s_temp + 2;
+			}
+
+			system_cycles = 12;
+
+			break;
+
+		//JRS P #ss
+		case 0xE6:
+			s_temp = fetch_s8();
+			reg.pc++;
+
+			if((reg.sc & NEGATIVE_FLAG) == 0)
+			{
+				reg.cb = reg.nb;
+				reg.pc = log_addr + s_temp + 2;
+			}
+
+			system_cycles = 12;
+
+			break;
+
+		//JRS M #ss
+		case 0xE7:
+			s_temp = fetch_s8();
+			reg.pc++;
+
+			if(reg.sc & NEGATIVE_FLAG)
+			{
+				reg.cb = reg.nb;
+				reg.pc = log_addr + s_temp + 2;
+			}
+
+			system_cycles = 12;
+
+			break;
+
+		//CARS LT #ss
+		case 0xF0:
+			{
+				s_temp = fetch_s8();
+				reg.pc++;
+
+				u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
+				u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
+
+				if(flag_1 != flag_2)
+				{
+					mem->write_u8(--reg.sp, (reg.cb));
+					mem->write_u8(--reg.sp, (reg.pc >> 8));
+					mem->write_u8(--reg.sp, (reg.pc & 0xFF));
+
+					reg.cb = reg.nb;
+					reg.pc = log_addr + s_temp + 2;
+
+					system_cycles = 24;
+				}
+
+				else { system_cycles = 12; }
+			}
+
+			break;
+
+		//CARS LE #ss
+		case 0xF1:
+			{
+				s_temp = fetch_s8();
+				reg.pc++;
+
+				u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
+				u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
+				u8 flag_3 = (reg.sc & ZERO_FLAG) ? 1 : 0;
+
+				if((flag_1 != flag_2) || (flag_3))
+				{
+					mem->write_u8(--reg.sp, (reg.cb));
+					mem->write_u8(--reg.sp, (reg.pc >> 8));
+					mem->write_u8(--reg.sp, (reg.pc & 0xFF));
+
+					reg.cb = reg.nb;
+					reg.pc = log_addr + s_temp + 2;
+
+					system_cycles = 24;
+				}
+
+				else { system_cycles = 12; }
+			}
+
+			break;
+
+		//CARS GT #ss
+		case 0xF2:
+			{
+				s_temp = fetch_s8();
+				reg.pc++;
+
+				u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
+				u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
+				u8 flag_3 = (reg.sc & ZERO_FLAG) ? 1 : 0;
+
+				if((flag_1 == flag_2) && (flag_3 == 0))
+				{
+					mem->write_u8(--reg.sp, (reg.cb));
+					mem->write_u8(--reg.sp, (reg.pc >> 8));
+					mem->write_u8(--reg.sp, (reg.pc & 0xFF));
+
+					reg.cb = reg.nb;
+					reg.pc = log_addr + s_temp + 2;
+
+					system_cycles = 24;
+				}
+
+				else { system_cycles = 12; }
+			}
+
+			break;
+
+		//CARS GE #ss
+		case 0xF3:
+			{
+				s_temp = fetch_s8();
+				reg.pc++;
+
+				u8 flag_1 = (reg.sc & OVERFLOW_FLAG) ? 1 : 0;
+				u8 flag_2 = (reg.sc & NEGATIVE_FLAG) ? 1 : 0;
+
+				if(flag_1 == flag_2)
+				{
+					mem->write_u8(--reg.sp, (reg.cb));
+					mem->write_u8(--reg.sp, (reg.pc >> 8));
+					mem->write_u8(--reg.sp, (reg.pc & 0xFF));
+
+					reg.cb = reg.nb;
+					reg.pc = log_addr + s_temp + 2;
+
+					system_cycles = 24;
+				}
+
+				else { system_cycles = 12; }
+			}
+
+			break;
+
+		//CARS V #ss
+		case 0xF4:
+			s_temp = fetch_s8();
+			reg.pc++;
+
+			if(reg.sc & OVERFLOW_FLAG)
+			{
+				mem->write_u8(--reg.sp, (reg.cb));
+				mem->write_u8(--reg.sp, (reg.pc >> 8));
+				mem->write_u8(--reg.sp, (reg.pc & 0xFF));
+
+				reg.cb = reg.nb;
+				reg.pc = log_addr + s_temp + 2;
+
+				system_cycles = 24;
+			}
+
+			else { system_cycles = 12; }
+
+			break;
+
+		//CARS NV #ss
+		case 0xF5:
+			s_temp = fetch_s8();
+			reg.pc++;
+
+			if((reg.sc & OVERFLOW_FLAG) == 0)
+			{
+				mem->write_u8(--reg.sp, (reg.cb));
+				mem->write_u8(--reg.sp, (reg.pc >> 8));
+				mem->write_u8(--reg.sp, (reg.pc & 0xFF));
+
+				reg.cb = reg.nb;
+				reg.pc = log_addr + s_temp + 2;
+
+				system_cycles = 24;
+			}
+
+			else { system_cycles = 12; }
+
+			break;
+
+		//CARS P #ss
+		case 0xF6:
+			s_temp = fetch_s8();
+			reg.pc++;
+
+			if((reg.sc & NEGATIVE_FLAG) == 0)
+			{
+				mem->write_u8(--reg.sp, (reg.cb));
+				mem->write_u8(--reg.sp, (reg.pc >> 8));
+				mem->write_u8(--reg.sp, (reg.pc & 0xFF));
+
+				reg.cb = reg.nb;
+				reg.pc = log_addr + s_temp + 2;
+
+				system_cycles = 24;
+			}
+
+			else { system_cycles = 12; }
+
+			break;
+
+		//CARS M #ss
+		case 0xF7:
+			s_temp = fetch_s8();
+			reg.pc++;
+
+			if(reg.sc & NEGATIVE_FLAG)
+			{
+				mem->write_u8(--reg.sp, (reg.cb));
+				mem->write_u8(--reg.sp, (reg.pc >> 8));
+				mem->write_u8(--reg.sp, (reg.pc & 0xFF));
+
+				reg.cb = reg.nb;
+				reg.pc = log_addr + s_temp + 2;
+
+				system_cycles = 24;
+			}
+
+			else { system_cycles = 12; }
+
+			break;
+
+		default:
+			std::cout<<"CPU::Error - Unknown 0xCE opcode -> 0x" << std::hex << opcode << " @ 0x" << reg.pc << "\n";
+			if(!config::ignore_illegal_opcodes) { running = false; }
+	}
+}
+
+/****** Decode and execute extended 0xCF instructions ******/
+void S1C88::execute_cf()
+{
+	u32 temp_val = 0;
+	s16 s_temp = 0;
+
+	switch(opcode & 0xFF)
+	{
+
+		//ADD BA, BA
+		case 0x00:
+			reg.ba = add_u16(reg.ba, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//ADD BA, HL
+		case 0x01:
+			reg.ba = add_u16(reg.ba, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//ADD BA, IX
+		case 0x02:
+			reg.ba = add_u16(reg.ba, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//ADD BA, IY
+		case 0x03:
+			reg.ba = add_u16(reg.ba, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//ADC BA, BA
+		case 0x04:
+			reg.ba = adc_u16(reg.ba, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//ADC BA, HL
+		case 0x05:
+			reg.ba = adc_u16(reg.ba, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//ADC BA, IX
+		case 0x06:
+			reg.ba = adc_u16(reg.ba, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//ADC BA, IY
+		case 0x07:
+			reg.ba = adc_u16(reg.ba, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//SUB BA, BA
+		case 0x08:
+			reg.ba = sub_u16(reg.ba, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//SUB BA, HL
+		case 0x09:
+			reg.ba = sub_u16(reg.ba, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//SUB BA, IX
+		case 0x0A:
+			reg.ba = sub_u16(reg.ba, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//SUB BA, IY
+		case 0x0B:
+			reg.ba = sub_u16(reg.ba, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//SBC BA, BA
+		case 0x0C:
+			reg.ba = sbc_u16(reg.ba, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//SBC BA, HL
+		case 0x0D:
+			reg.ba = sbc_u16(reg.ba, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//SBC BA, IX
+		case 0x0E:
+			reg.ba = sbc_u16(reg.ba, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//SBC BA, IY
+		case 0x0F:
+			reg.ba = sbc_u16(reg.ba, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//CP BA, BA
+		case 0x18:
+			cp_u16(reg.ba, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//CP BA, HL
+		case 0x19:
+			cp_u16(reg.ba, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//CP BA, IX
+		case 0x1A:
+			cp_u16(reg.ba, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//CP BA, IY
+		case 0x1B:
+			cp_u16(reg.ba, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//ADD HL, BA
+		case 0x20:
+			reg.hl = add_u16(reg.hl, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//ADD HL, HL
+		case 0x21:
+			reg.hl = add_u16(reg.hl, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//ADD HL, IX
+		case 0x22:
+			reg.hl = add_u16(reg.hl, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//ADD HL, IY
+		case 0x23:
+			reg.hl = add_u16(reg.hl, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//ADC HL, BA
+		case 0x24:
+			reg.hl = adc_u16(reg.hl, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//ADC HL, HL
+		case 0x25:
+			reg.hl = adc_u16(reg.hl, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//ADC HL, IX
+		case 0x26:
+			reg.hl = adc_u16(reg.hl, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//ADC HL, IY
+		case 0x27:
+			reg.hl = adc_u16(reg.hl, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//SUB HL, BA
+		case 0x28:
+			reg.hl = sub_u16(reg.hl, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//SUB HL, HL
+		case 0x29:
+			reg.hl = sub_u16(reg.hl, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//SUB HL, IX
+		case 0x2A:
+			reg.hl = sub_u16(reg.hl, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//SUB HL, IY
+		case 0x2B:
+			reg.hl = sub_u16(reg.hl, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//SBC HL, BA
+		case 0x2C:
+			reg.hl = sbc_u16(reg.hl, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//SBC HL, HL
+		case 0x2D:
+			reg.hl = sbc_u16(reg.hl, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//SBC HL, IX
+		case 0x2E:
+			reg.hl = sbc_u16(reg.hl, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//SBC HL, IY
+		case 0x2F:
+			reg.hl = sbc_u16(reg.hl, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//CP HL, BA
+		case 0x38:
+			cp_u16(reg.hl, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//CP HL, HL
+		case 0x39:
+			cp_u16(reg.hl, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//CP HL, IX
+		case 0x3A:
+			cp_u16(reg.hl, reg.ix);
+			system_cycles = 16;
+			break;
+
+		//CP HL, IY
+		case 0x3B:
+			cp_u16(reg.hl, reg.iy);
+			system_cycles = 16;
+			break;
+
+		//ADD IX, BA
+		case 0x40:
+			reg.ix = add_u16(reg.ix, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//ADD IX, HL
+		case 0x41:
+			reg.ix = add_u16(reg.ix, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//ADD IY, BA
+		case 0x42:
+			reg.iy = add_u16(reg.iy, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//ADD IY, HL
+		case 0x43:
+			reg.iy = add_u16(reg.iy, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//ADD SP, BA
+		case 0x44:
+			reg.sp = add_u16(reg.sp, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//ADD SP, HL
+		case 0x45:
+			reg.sp = add_u16(reg.sp, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//SUB IX, BA
+		case 0x48:
+			reg.ix = sub_u16(reg.ix, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//SUB IX, HL
+		case 0x49:
+			reg.ix = sub_u16(reg.ix, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//SUB IY, BA
+		case 0x4A:
+			reg.iy = sub_u16(reg.iy, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//SUB IY, HL
+		case 0x4B:
+			reg.iy = sub_u16(reg.iy, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//SUB SP, BA
+		case 0x4C:
+			reg.sp = sub_u16(reg.sp, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//SUB SP, HL
+		case 0x4D:
+			reg.sp = sub_u16(reg.sp, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//CP SP, BA
+		case 0x5C:
+			cp_u16(reg.sp, reg.ba);
+			system_cycles = 16;
+			break;
+
+		//CP SP, HL
+		case 0x5D:
+			cp_u16(reg.sp, reg.hl);
+			system_cycles = 16;
+			break;
+
+		//ADC BA, #nnnn
+		case 0x60:
+			temp_val = fetch_u16();
+			reg.ba = adc_u16(reg.ba, temp_val);
+			system_cycles = 12;
+
+			reg.pc += 2;
+			break;
+
+		//ADC HL, #nnnn
+		case 0x61:
+			temp_val = fetch_u16();
+			reg.hl = adc_u16(reg.hl, temp_val);
+			system_cycles = 12;
+
+			reg.pc += 2;
+			break;
+
+		//SBC BA, #nnnn
+		case 0x62:
+			temp_val = fetch_u16();
+			reg.ba = sbc_u16(reg.ba, temp_val);
+			system_cycles = 12;
+
+			reg.pc += 2;
+			break;
+
+		//SBC HL, #nnnn
+		case 0x63:
+			temp_val = fetch_u16();
+			reg.hl = sbc_u16(reg.hl, temp_val);
+			system_cycles = 12;
+
+			reg.pc += 2;
+			break;
+
+		//ADD SP, #nnnn
+		case 0x68:
+			temp_val = fetch_u16();
+			reg.sp = add_u16(reg.sp, temp_val);
+			system_cycles = 12;
+
+			reg.pc += 2;
+			break;
+
+		//SUB SP, #nnnn
+		case 0x6A:
+			temp_val = fetch_u16();
+			reg.sp = sub_u16(reg.sp, temp_val);
+			system_cycles = 12;
+
+			reg.pc += 2;
+			break;
+
+		//CP SP, #nnnn
+		case 0x6C:
+			temp_val = fetch_u16();
+			cp_u16(reg.sp, temp_val);
+			system_cycles = 12;
+
+			reg.pc += 2;
+			break;
+
+		//LD SP, #nnnn
+		case 0x6E:
+			reg.sp = fetch_u16();
+			system_cycles = 16;
+
+			reg.pc += 2;
+			break;
+
+		//LD BA, [SP + #ss]
+		case 0x70:
+			s_temp = fetch_s8();
+			temp_val = reg.sp + s_temp;
+			reg.ba = mem->read_u16(temp_val);
+			system_cycles = 24;
+
+			reg.pc++;
+			break;
+
+		//LD HL, [SP + #ss]
+		case 0x71:
+			s_temp = fetch_s8();
+			temp_val = reg.sp + s_temp;
+			reg.hl = mem->read_u16(temp_val);
+			system_cycles = 24;
+
+			reg.pc++;
+			break;
+
+		//LD IX, [SP + #ss]
+		case 0x72:
+			s_temp = fetch_s8();
+			temp_val = reg.sp + s_temp;
+			reg.ix = mem->read_u16(temp_val);
+			system_cycles = 24;
+
+			reg.pc++;
+			break;
+
+		//LD IY, [SP + #ss]
+		case 0x73:
+			s_temp = fetch_s8();
+			temp_val = reg.sp + s_temp;
+			reg.iy = mem->read_u16(temp_val);
+			system_cycles = 24;
+
+			reg.pc++;
+			break;
+
+		//LD [SP + #ss], BA
+		case 0x74:
+			s_temp = fetch_s8();
+			temp_val = reg.sp + s_temp;
+			mem->write_u16(temp_val, reg.ba);
+			system_cycles = 24;
+
+			reg.pc++;
+			break;
+
+		//LD [SP + #ss], HL
+		case 0x75:
+			s_temp = fetch_s8();
+			temp_val = reg.sp + s_temp;
+			mem->write_u16(temp_val, reg.hl);
+			system_cycles = 24;
+
+			reg.pc++;
+			break;
+
+		//LD [SP + #ss], IX
+		case 0x76:
+			s_temp = fetch_s8();
+			temp_val = reg.sp + s_temp;
+			mem->write_u16(temp_val, reg.ix);
+			system_cycles = 24;
+
+			reg.pc++;
+			break;
+
+		//LD [SP + #ss], IY
+		case 0x77:
+			s_temp = fetch_s8();
+			temp_val = reg.sp + s_temp;
+			mem->write_u16(temp_val, reg.iy);
+			system_cycles = 24;
+
+			reg.pc++;
+			break;
+			
+		//LD SP, [#nnnn]
+		case 0x78:
+			temp_val = (reg.ep << 16) | fetch_u16();
+			reg.sp = mem->read_u16(temp_val);
+			system_cycles = 24;
+
+			reg.pc += 2;
+			break;
+
+		//PUSH A
+		case 0xB0:
+			mem->write_u8(--reg.sp, reg.a);
+			system_cycles = 12;
+			break;
+
+		//PUSH B
+		case 0xB1:
+			mem->write_u8(--reg.sp, reg.b);
+			system_cycles = 12;
+			break;
+
+		//PUSH L
+		case 0xB2:
+			mem->write_u8(--reg.sp, reg.l);
+			system_cycles = 12;
+			break;
+
+		//PUSH H
+		case 0xB3:
+			mem->write_u8(--reg.sp, reg.h);
+			system_cycles = 12;
+			break;
+
+		//POP A
+		case 0xB4:
+			reg.a = mem->read_u8(reg.sp++);
+			system_cycles = 12;
+			break;
+
+		//POP B
+		case 0xB5:
+			reg.b = mem->read_u8(reg.sp++);
+			system_cycles = 12;
+			break;
+
+		//POP L
+		case 0xB6:
+			reg.l = mem->read_u8(reg.sp++);
+			system_cycles = 12;
+			break;
+
+		//POP H
+		case 0xB7:
+			reg.h = mem->read_u8(reg.sp++);
+			system_cycles = 12;
+			break;
+
+		//PUSH ALL
+		case 0xB8:
+			mem->write_u8(--reg.sp, reg.b);
+			mem->write_u8(--reg.sp, reg.a);
+			mem->write_u8(--reg.sp, reg.h);
+			mem->write_u8(--reg.sp, reg.l);
+			mem->write_u8(--reg.sp, (reg.ix >> 8));
+			mem->write_u8(--reg.sp, (reg.ix & 0xFF));
+			mem->write_u8(--reg.sp, (reg.iy >> 8));
+			mem->write_u8(--reg.sp, (reg.iy & 0xFF));
+			mem->write_u8(--reg.sp, reg.br);
+			system_cycles = 48;
+			break;
+
+		//PUSH ALE
+		case 0xB9:
+			mem->write_u8(--reg.sp, reg.b);
+			mem->write_u8(--reg.sp, reg.a);
+			mem->write_u8(--reg.sp, reg.h);
+			mem->write_u8(--reg.sp, reg.l);
+			mem->write_u8(--reg.sp, (reg.ix >> 8));
+			mem->write_u8(--reg.sp, (reg.ix & 0xFF));
+			mem->write_u8(--reg.sp, (reg.iy >> 8));
+			mem->write_u8(--reg.sp, (reg.iy & 0xFF));
+			mem->write_u8(--reg.sp, reg.br);
+			mem->write_u8(--reg.sp, reg.ep);
+			mem->write_u8(--reg.sp, reg.xp);
+			mem->write_u8(--reg.sp, reg.yp);
+			system_cycles = 60;
+			break;
+
+		//POP ALL
+		case 0xBC:
+			reg.br = mem->read_u8(reg.sp++);
+			reg.iy = mem->read_u8(reg.sp++);
+			reg.iy |= (mem->read_u8(reg.sp++) << 8);
+			reg.ix = mem->read_u8(reg.sp++);
+			reg.ix |= (mem->read_u8(reg.sp++) << 8);
+			reg.l = mem->read_u8(reg.sp++);
+			reg.h = mem->read_u8(reg.sp++);
+			reg.a = mem->read_u8(reg.sp++);
+			reg.b = mem->read_u8(reg.sp++);
+			system_cycles = 32;
+			break;
+
+		//POP ALE
+		case 0xBD:
+			reg.yp = mem->read_u8(reg.sp++);
+			reg.xp = mem->read_u8(reg.sp++);
+			reg.ep = mem->read_u8(reg.sp++);
+			reg.br = mem->read_u8(reg.sp++);
+			reg.iy = mem->read_u8(reg.sp++);
+			reg.iy |= (mem->read_u8(reg.sp++) << 8);
+			reg.ix = mem->read_u8(reg.sp++);
+			reg.ix |= (mem->read_u8(reg.sp++) << 8);
+			reg.l = mem->read_u8(reg.sp++);
+			reg.h = mem->read_u8(reg.sp++);
+			reg.a = mem->read_u8(reg.sp++);
+			reg.b = mem->read_u8(reg.sp++);
+			system_cycles = 40;
+			break;
+
+		//LD BA, [HL]
+		case 0xC0:
+			reg.ba = mem->read_u16(reg.hl_ex);
+			system_cycles = 20;
+			break;
+
+		//LD HL, [HL]
+		case 0xC1:
+			reg.hl = mem->read_u16(reg.hl_ex);
+			system_cycles = 20;
+			break;
+
+		//LD IX, [HL]
+		case 0xC2:
+			reg.ix = mem->read_u16(reg.hl_ex);
+			system_cycles = 20;
+			break;
+
+		//LD IY, [HL]
+		case 0xC3:
+			reg.iy = mem->read_u16(reg.hl_ex);
+			system_cycles = 20;
+			break;
+
+		//LD [HL], BA
+		case 0xC4:
+			mem->write_u16(reg.hl_ex, reg.ba);
+			system_cycles = 20;
+			break;
+
+		//LD [HL], HL
+		case 0xC5:
+			mem->write_u16(reg.hl_ex, reg.hl);
+			system_cycles = 20;
+			break;
+
+		//LD [HL], IX
+		case 0xC6:
+			mem->write_u16(reg.hl_ex, reg.ix);
+			system_cycles = 20;
+			break;
+
+		//LD [HL], IY
+		case 0xC7:
+			mem->write_u16(reg.hl_ex, reg.iy);
+			system_cycles = 20;
+			break;
+		
+		//LD BA, [IX]
+		case 0xD0:
+			reg.ba = mem->read_u16(reg.ix_ex);
+			system_cycles = 20;
+			break;
+
+		//LD HL, [IX]
+		case 0xD1:
+			reg.hl = mem->read_u16(reg.ix_ex);
+			system_cycles = 20;
+			break;
+
+		//LD IX, [IX]
+		case 0xD2:
+			reg.ix = mem->read_u16(reg.ix_ex);
+			system_cycles = 20;
+			break;
+
+		//LD IY, [IX]
+		case 0xD3:
+			reg.iy = mem->read_u16(reg.ix_ex);
+			system_cycles = 20;
+			break;
+
+		//LD IX, [BA]
+		case 0xD4:
+			mem->write_u16(reg.ix_ex, reg.ba);
+			system_cycles = 20;
+			break;
+
+		//LD [IX], HL
+		case 0xD5:
+			mem->write_u16(reg.ix_ex, reg.hl);
+			system_cycles = 20;
+			break;
+
+		//LD [IX], IX
+		case 0xD6:
+			mem->write_u16(reg.ix_ex, reg.ix);
+			system_cycles = 20;
+			break;
+
+		//LD [IX], IY
+		case 0xD7:
+			mem->write_u16(reg.ix_ex, reg.iy);
+			system_cycles = 20;
+			break;
+
+		//LD BA, [IY]
+		case 0xD8:
+			reg.ba = mem->read_u16(reg.iy_ex);
+			system_cycles = 20;
+			break;
+
+		//LD HL, [IY]
+		case 0xD9:
+			reg.hl = mem->read_u16(reg.iy_ex);
+			system_cycles = 20;
+			break;
+
+		//LD IX, [IY]
+		case 0xDA:
+			reg.ix = mem->read_u16(reg.iy_ex);
+			system_cycles = 20;
+			break;
+
+		//LD IY, [IY]
+		case 0xDB:
+			reg.iy = mem->read_u16(reg.iy_ex);
+			system_cycles = 20;
+			break;
+
+		//LD [IY], BA
+		case 0xDC:
+			mem->write_u16(reg.iy_ex, reg.ba);
+			system_cycles = 20;
+			break;
+
+		//LD [IY], HL
+		case 0xDD:
+			mem->write_u16(reg.iy_ex, reg.hl);
+			system_cycles = 20;
+			break;
+
+		//LD [IY], IX
+		case 0xDE:
+			mem->write_u16(reg.iy_ex, reg.ix);
+			system_cycles = 20;
+			break;
+
+		//LD [IY], IY
+		case 0xDF:
+			mem->write_u16(reg.iy_ex, reg.iy);
+			system_cycles = 20;
+			break;
+
+		//LD BA, BA
+		case 0xE0:
+			system_cycles = 8;
+			break;
+
+		//LD BA, HL
+		case 0xE1:
+			reg.ba = reg.hl;
+			system_cycles = 8;
+			break;
+
+		//LD BA, IX
+		case 0xE2:
+			reg.ba = reg.ix;
+			system_cycles = 8;
+			break;
+
+		//LD BA, IY
+		case 0xE3:
+			reg.ba = reg.iy;
+			system_cycles = 8;
+			break;
+
+		//LD HL, BA
+		case 0xE4:
+			reg.hl = reg.ba;
+			system_cycles = 8;
+			break;
+
+		//LD HL, HL
+		case 0xE5:
+			system_cycles = 8;
+			break;
+
+		//LD HL, IX
+		case 0xE6:
+			reg.hl = reg.ix;
+			system_cycles = 8;
+			break;
+
+		//LD HL, IY
+		case 0xE7:
+			reg.hl = reg.iy;
+			system_cycles = 8;
+			break;
+
+		//LD IX, BA
+		case 0xE8:
+			reg.ix = reg.ba;
+			system_cycles = 8;
+			break;
+
+		//LD IX, HL
+		case 0xE9:
+			reg.ix = reg.hl;
+			system_cycles = 8;
+			break;
+
+		//LD IX, IX
+		case 0xEA:
+			system_cycles = 8;
+			break;
+
+		//LD IX, IY
+		case 0xEB:
+			reg.ix = reg.iy;
+			system_cycles = 8;
+			break;
+
+		//LD IY, BA
+		case 0xEC:
+			reg.iy = reg.ba;
+			system_cycles = 8;
+			break;
+
+		//LD IY, HL
+		case 0xED:
+			reg.iy = reg.hl;
+			system_cycles = 8;
+			break;
+
+		//LD IY, IX
+		case 0xEE:
+			reg.iy = reg.ix;
+			system_cycles = 8;
+			break;
+
+		//LD IY, IY
+		case 0xEF:
+			system_cycles = 8;
+			break;
+
+		//LD SP, BA
+		case 0xF0:
+			reg.sp = reg.ba;
+			system_cycles = 8;
+			break;
+
+		//LD SP, HL
+		case 0xF1:
+			reg.sp = reg.hl;
+			system_cycles = 8;
+			break;
+
+		//LD SP, IX
+		case 0xF2:
+			reg.sp = reg.ix;
+			system_cycles = 8;
+			break;
+
+		//LD SP, IY
+		case 0xF3:
+			reg.sp = reg.iy;
+			system_cycles = 8;
+			break;
+
+		//LD HL, SP
+		case 0xF4:
+			reg.hl = reg.sp;
+			system_cycles = 8;
+			break;
+
+		//LD HL, PC
+		case 0xF5:
+			reg.hl = reg.pc;
+			system_cycles = 8;
+			break;
+
+		//LD BA, SP
+		case 0xF8:
+			reg.ba = reg.sp;
+			system_cycles = 8;
+			break;
+
+		//LD BA, PC
+		case 0xF9:
+			reg.ba = reg.pc;
+			system_cycles = 8;
+			break;
+
+		//LD IX, SP
+		case 0xFA:
+			reg.ix = reg.sp;
+			system_cycles = 8;
+			break;
+
+		//LD IY, SP
+		case 0xFE:
+			reg.iy = reg.sp;
+			system_cycles = 8;
+			break;
+
+		default:
+		std::cout<<"CPU::Error - Unknown 0xCF opcode -> 0x" << std::hex << opcode << "\n";
+		if(!config::ignore_illegal_opcodes) { running = false; }
+	}
+}
+
+/****** Process hardware interrupts ******/
+void S1C88::handle_interrupt()
+{
+	if(skip_irq) { return; }
+
+	//Nothing to do unless at least one IRQ has been flagged
+	if(!mem->master_irq_flags) { return; }
+
+	u8 irq_mask = (reg.sc >> 6);
+
+	//Cycle through all 4 interrupt levels and jump to vector with highest priority
+	for(s32 x = 4; x > irq_mask; x--)
+	{
+		for(s32 y = 0; y < 32; y++)
+		{
+			if((mem->irq_enable[y]) && (mem->master_irq_flags & (1 << y)) && (mem->irq_priority[y] == x))
+			{
+				//Assume System Reset IRQ is not treated like a normal IRQ (i.e. just jump to IRQ vector)
+				if(y > 0)
+				{
+					halt = false;
+
+					mem->write_u8(--reg.sp, reg.cb);
+					mem->write_u8(--reg.sp, (reg.pc >> 8));
+					mem->write_u8(--reg.sp, (reg.pc & 0xFF));
+					mem->write_u8(--reg.sp, reg.sc);
+
+					reg.cb = 0;
+					reg.sc |= 0xC0;
+				}
+
+				else { mem->master_irq_flags &= ~0x1; }
+
+				reg.pc = mem->irq_vectors[y];
+
+				x = 0;
+				y = 32;
+			}
+		}
+	}
+}
+
+/****** Calculates most recent extended values for certain paged registers ******/
+void S1C88::update_regs()
+{
+	//Calculate extended PC
+	if((reg.pc & 0xFFFF) > 0x7FFF) { reg.pc_ex = (reg.pc & 0x7FFF) + (0x8000 * reg.cb); }
+	else { reg.pc_ex = reg.pc; }
+
+	//Calculate extended IX
+	if(reg.xp) { reg.ix_ex = reg.ix + (0x10000 * reg.xp); }
+	else { reg.ix_ex = reg.ix; }
+
+	//Calculate extended IY
+	if(reg.yp) { reg.iy_ex = reg.iy + (0x10000 * reg.yp); }
+	else { reg.iy_ex = reg.iy; }
+
+	//Calculate extended BR and HL
+	if(reg.ep)
+	{
+		reg.hl_ex = reg.hl + (0x10000 * reg.ep);
+		reg.br_ex = reg.br + (0x10000 * reg.ep);
+	}
+
+	else
+	{
+		reg.hl_ex = reg.hl;
+		reg.br_ex = reg.br;
+	}
+}
+
+/****** Clocks CPU and Pokemon Mini subsystems ******/
+void S1C88::clock_system()
+{
+	//Clock CPU cycles for PRC
+	controllers.video.lcd_stat.prc_clock += system_cycles;
+	
+	//Increment PRC Count
+	if(controllers.video.lcd_stat.prc_clock >= (controllers.video.lcd_stat.prc_counter * PRC_COUNT_TIME))
+	{
+		controllers.video.lcd_stat.prc_counter++;
+
+		//Wait on PRC counts after rendering or copying frames to send PRC Copy Complete IRQ
+		if(controllers.video.lcd_stat.prc_copy_wait)
+		{
+			controllers.video.lcd_stat.prc_copy_wait--;
+			
+			//Trigger PRC Copy Complete IRQ
+			if(!controllers.video.lcd_stat.prc_copy_wait) { mem->update_irq_flags(PRC_COPY_IRQ); }
+		}
+			
+		//Reset PRC Count and increment frame counter
+		if(controllers.video.lcd_stat.prc_counter == 0x42)
 		{
 			u8 frame_counter = (controllers.video.lcd_stat.prc_rate & 0xF0) >> 4;
 			frame_counter++;
@@ -6046,7 +6094,13 @@ void S1C88::clock_system()
 		if((controllers.video.lcd_stat.prc_counter == 0x1) || (controllers.video.lcd_stat.prc_counter == 0x21))
 		{
 			//Generate audio buffer for sound channels on VBlank
-			if(controllers.audio.apu_stat.pwm_needs_fill) { controllers.audio.buffer_channel(); }
+			//The audio callback buffers on its own thread when it runs dry, so only this call counts as APU time
+			if(controllers.audio.apu_stat.pwm_needs_fill)
+			{
+				profiler::scope timer(profiler::PROF_APU);
+				controllers.audio.buffer_channel();
+			}
+
 			controllers.audio.apu_stat.pwm_needs_fill = true;
 		}
 
@@ -107,6 +107,8 @@ class S1C88
 	void reset();
 
 	void execute();
+	void execute_ce();
+	void execute_cf();
 	void handle_interrupt();
 	void clock_system();
 
@@ -157,6 +159,13 @@ class S1C88
 
 	void update_regs();
 
+	//Instruction stream fetches, bypass the MMU for ROM and RAM
+	u8 read_code_u8(u32 address);
+	u8 fetch_u8();
+	s8 fetch_s8();
+	u16 fetch_u16();
+	s16 fetch_s16();
+
 	//Serialize data for save state loading/saving
 	bool cpu_read(u32 offset, std::string filename);
 	bool cpu_write(std::string filename);
@@ -12,6 +12,7 @@
 #include <cmath>
 
 #include "apu.h"
+#include "common/profiler.h"
 
 /****** APU Constructor ******/
 NTR_APU::NTR_APU()
@@ -45,6 +46,7 @@ void NTR_APU::reset()
 		apu_stat.channel[x].output_frequency = 0.0;
 		apu_stat.channel[x].data_src = 0;
 		apu_stat.channel[x].data_pos = 0;
+		apu_stat.channel[x].sample_frac = 0.0;
 		apu_stat.channel[x].loop_start = 0;
 		apu_stat.channel[x].length = 0;
 		apu_stat.channel[x].samples = 0;
@@ -83,6 +85,13 @@ void NTR_APU::reset()
 	apu_stat.index_table[7] = 8;
 
 	apu_stat.mic_out = 0;
+
+	//Reset output ring buffer
+	output_read = 0;
+	output_write = 0;
+	last_sample = -32768;
+	sample_clock = 0;
+	pending_samples = 0;
 }
 
 /****** Initialize APU with SDL ******/
@@ -110,6 +119,18 @@ bool NTR_APU::init()
     	desired_spec.callback = ntr_audio_callback;
     	desired_spec.userdata = this;
 
+	//Allocate mixing buffers up front
+	audio_mix::reserve(mix, 16, NDS_SAMPLE_BATCH_SIZE);
+
+	//Ring buffer holds several callbacks' worth of samples, must be a power of 2
+	u32 ring_size = 1;
+	while(ring_size < (desired_spec.samples * 4)) { ring_size <<= 1; }
+
+	output_buffer.clear();
+	output_buffer.resize(ring_size, -32768);
+	output_read = 0;
+	output_write = 0;
+
     	//Open SDL audio for desired specifications
 	if(SDL_OpenAudio(&desired_spec, nullptr) < 0) 
 	{ 
@@ -128,18 +149,13 @@ bool NTR_APU::init()
 }
 
 /****** Generates samples for NDS sound channels ******/
-void NTR_APU::generate_channel_samples(s32* stream, int length, u8 id)
+void NTR_APU::generate_channel_samples(s16* stream, int length, u8 id)
 {
 	double sample_ratio = (apu_stat.channel[id].output_frequency / apu_stat.sample_rate);
 	u32 sample_pos = apu_stat.channel[id].data_pos;
 	u8 format = ((apu_stat.channel[id].cnt >> 29) & 0x3);
 	u8 loop_mode = ((apu_stat.channel[id].cnt >> 27) & 0x3);
 
-	//Calculate volume
-	float vol = (apu_stat.channel[id].volume != 0) ? (apu_stat.channel[id].volume / 127.0) : 0;
-	vol *= (apu_stat.main_volume / 127.0);
-	vol *= (config::volume / 128.0);
-
 	s8 nds_sample_8 = 0;
 	s16 nds_sample_16 = 0;
 	u32 samples_played = 0;
@@ -147,9 +163,6 @@ void NTR_APU::generate_channel_samples(s32* stream, int length, u8 id)
 
 	for(u32 x = 0; x < length; x++)
 	{
-		//Channel 0 should set default data
-		if(id == 0) { stream[x] = 0; }
-
 		//Pull data from NDS memory
 		if((apu_stat.channel[id].samples) && (apu_stat.channel[id].playing))
 		{
@@ -160,10 +173,7 @@ void NTR_APU::generate_channel_samples(s32* stream, int length, u8 id)
 				nds_sample_8 = mem->memory_map[sample_pos + (sample_ratio * x)];
 
 				//Scale S8 audio to S16
-				stream[x] += (nds_sample_8 * 256);
-
-				//Adjust volume level
-				stream[x] *= vol;
+				stream[x] = (nds_sample_8 * 256);
 
 				if(data_addr >= (apu_stat.channel[id].data_src + apu_stat.channel[id].samples))
 				{
@@ -192,10 +202,7 @@ void NTR_APU::generate_channel_samples(s32* stream, int length, u8 id)
 				data_addr &= ~0x1;
 				nds_sample_16 = mem->read_u16_fast(data_addr);
 
-				stream[x] += nds_sample_16;
-
-				//Adjust volume level
-				stream[x] *= vol;
+				stream[x] = nds_sample_16;
 
 				if(data_addr >= (apu_stat.channel[id].data_src + apu_stat.channel[id].samples))
 				{
@@ -224,10 +231,7 @@ void NTR_APU::generate_channel_samples(s32* stream, int length, u8 id)
 				if(data_pos > apu_stat.channel[id].adpcm_buffer.size()) { data_pos = (apu_stat.channel[id].adpcm_buffer.size() - 1); }
 				nds_sample_16 = apu_stat.channel[id].adpcm_buffer[data_pos];
 
-				stream[x] += nds_sample_16;
-
-				//Adjust volume level
-				stream[x] *= vol;
+				stream[x] = nds_sample_16;
 
 				if(data_pos >= apu_stat.channel[id].samples)
 				{
@@ -248,29 +252,34 @@ void NTR_APU::generate_channel_samples(s32* stream, int length, u8 id)
 
 			}
 
-			else { stream[x] += (-32768 * vol); }
+			else { stream[x] = -32768; }
 
 			samples_played++;
 		}
 
 		//Generate silence if sound has run out of samples or is not playing
-		else { stream[x] += (-32768 * vol); }
+		else { stream[x] = -32768; }
 	}
 
 	//Advance data pointer to sound samples
+	//Keep the fractional part so short batches do not drift out of tune
+	double advance = apu_stat.channel[id].sample_frac + (sample_ratio * samples_played);
+	u32 whole_advance = advance;
+	apu_stat.channel[id].sample_frac = advance - whole_advance;
+
 	switch(format)
 	{
 		case 0x0:
-			apu_stat.channel[id].data_pos += (sample_ratio * samples_played);
+			apu_stat.channel[id].data_pos += whole_advance;
 			break;
 
 		case 0x1:
-			apu_stat.channel[id].data_pos += (sample_ratio * samples_played);
+			apu_stat.channel[id].data_pos += whole_advance;
 			apu_stat.channel[id].data_pos &= ~0x1;
 			break;
 
 		case 0x2:
-			apu_stat.channel[id].adpcm_pos += (sample_ratio * samples_played);
+			apu_stat.channel[id].adpcm_pos += whole_advance;
 			break;
 	} 
 }
@@ -334,29 +343,97 @@ void NTR_APU::decode_adpcm_samples(u8 id)
 	}
 }	
 
-/****** SDL Audio Callback ******/ 
-void ntr_audio_callback(void* _apu, u8 *_stream, int _length)
+/****** Advances audio by a number of ARM7 cycles, generating samples as emulated time passes ******/
+void NTR_APU::clock(u32 cycles)
 {
-	s16* stream = (s16*) _stream;
-	int length = _length/2;
-	std::vector<s32> channel_stream(length);
+	//One output sample every (ARM7 clock / sample rate) cycles
+	sample_clock += (u64(cycles) * u32(apu_stat.sample_rate));
 
-	NTR_APU* apu_link = (NTR_APU*) _apu;
+	while(sample_clock >= NDS_ARM7_CLOCK)
+	{
+		sample_clock -= NDS_ARM7_CLOCK;
+		pending_samples++;
+	}
+
+	if(pending_samples >= NDS_SAMPLE_BATCH_SIZE)
+	{
+		generate_samples(pending_samples);
+		pending_samples = 0;
+	}
+}
+
+/****** Generates and mixes samples for all 16 channels, then queues them for playback ******/
+void NTR_APU::generate_samples(u32 length)
+{
+	profiler::scope timer(profiler::PROF_APU);
+
+	audio_mix::reserve(mix, 16, length);
+
+	double master_ratio = (apu_stat.main_volume / 127.0) * (config::volume / 128.0);
+
+	audio_mix::clear(&mix.left[0], length);
 
 	//Generate samples
 	for(u32 x = 0; x < 16; x++)
 	{
 		//Decode IMA-ADPCM samples first
-		if(apu_link->apu_stat.channel[x].decode_adpcm) { apu_link->decode_adpcm_samples(x); }
+		if(apu_stat.channel[x].decode_adpcm) { decode_adpcm_samples(x); }
 
 		//Grab samples
-		apu_link->generate_channel_samples(&channel_stream[0], length, x);
-	}
+		generate_channel_samples(&mix.channel[x][0], length, x);
 
-	//Custom software mixing
-	for(u32 x = 0; x < length; x++)
-	{
-		channel_stream[x] /= 16;
-		stream[x] = channel_stream[x];
+		//Custom software mixing - Adjust volume level
+		//Dividing by the total amount of channels happens on output so quiet channels keep their full gain precision
+		s32 gain = audio_mix::to_gain((apu_stat.channel[x].volume / 127.0) * master_ratio);
+		audio_mix::add(&mix.left[0], &mix.channel[x][0], gain, length);
 	}
+
+	//Reuse the first channel buffer for final output, dividing by 16 channels
+	s16* out = &mix.channel[0][0];
+	audio_mix::store_mono(out, &mix.left[0], length, 1, audio_mix::GAIN_SHIFT + 4);
+
+	//Queue samples for the audio callback, drop them if the buffer is full (e.g. turbo mode)
+	if(output_buffer.empty()) { return; }
+
+	u32 mask = output_buffer.size() - 1;
+	u32 write_pos = output_write.load(std::memory_order_relaxed);
+	u32 read_pos = output_read.load(std::memory_order_acquire);
+	u32 free_space = output_buffer.size() - (write_pos - read_pos);
+
+	if(length > free_space) { length = free_space; }
+
+	for(u32 x = 0; x < length; x++) { output_buffer[(write_pos + x) & mask] = out[x]; }
+
+	output_write.store(write_pos + length, std::memory_order_release);
+}
+
+/****** SDL Audio Callback ******/ 
+void ntr_audio_callback(void* _apu, u8 *_stream, int _length)
+{
+	profiler::scope timer(profiler::PROF_AUDIO_OUT);
+
+	s16* stream = (s16*) _stream;
+	u32 length = _length/2;
+
+	NTR_APU* apu_link = (NTR_APU*) _apu;
+
+	//Only copy out samples already generated by the emulation thread
+	u32 mask = apu_link->output_buffer.size() - 1;
+	u32 read_pos = apu_link->output_read.load(std::memory_order_relaxed);
+	u32 write_pos = apu_link->output_write.load(std::memory_order_acquire);
+	u32 available = write_pos - read_pos;
+	u32 copy_length = (available < length) ? available : length;
+
+	for(u32 x = 0; x < copy_length; x++) { stream[x] = apu_link->output_buffer[(read_pos + x) & mask]; }
+	read_pos += copy_length;
+
+	//Hold the last sample on underruns to avoid pops
+	if(copy_length) { apu_link->last_sample = stream[copy_length - 1]; }
+	for(u32 x = copy_length; x < length; x++) { stream[x] = apu_link->last_sample; }
+
+	//Keep latency bounded if the emulation thread is running ahead
+	available -= copy_length;
+	if(available > (length * 2)) { read_pos += (available - length); }
+
+	apu_link->output_read.store(read_pos, std::memory_order_release);
 }
@@ -12,9 +12,18 @@
 #ifndef NDS_APU
 #define NDS_APU
 
+#include <atomic>
+
 #include <SDL.h>
 #include <SDL_audio.h>
 #include "mmu.h"
+#include "common/audio_mix.h"
+
+//ARM7 clock rate in Hz, used to time sample generation
+const u32 NDS_ARM7_CLOCK = 33513982;
+
+//Number of samples generated together on the emulation thread
+const u32 NDS_SAMPLE_BATCH_SIZE = 32;
 
 class NTR_APU
 {
@@ -27,10 +36,25 @@ class NTR_APU
 
 	SDL_AudioSpec desired_spec;
 
+	//Mixing buffers, used on the emulation thread
+	audio_mix::mix_buffers mix;
+
+	//Final samples, written by the emulation thread and read by the SDL audio callback
+	std::vector<s16> output_buffer;
+	std::atomic<u32> output_read;
+	std::atomic<u32> output_write;
+	s16 last_sample;
+
+	//Emulated time since the last generated sample
+	u64 sample_clock;
+	u32 pending_samples;
+
 	NTR_APU();
 	~NTR_APU();
 
-	void generate_channel_samples(s32* stream, int length, u8 id);
+	void clock(u32 cycles);
+	void generate_samples(u32 length);
+	void generate_channel_samples(s16* stream, int length, u8 id);
 	void decode_adpcm_samples(u8 id);
 
 	bool init();
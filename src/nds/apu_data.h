@@ -22,6 +22,7 @@ struct ntr_apu_data
 		double output_frequency;
 		u32 data_src;
 		u32 data_pos;
+		double sample_frac;
 		u32 loop_start;
 		u32 length;
 		u32 samples;
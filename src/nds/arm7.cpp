@@ -1405,6 +1405,9 @@ void NTR_ARM7::clock_system()
 	//Run timers
 	clock_timers(system_cycles);
 
+	//Generate audio samples as emulated time passes
+	controllers.audio.clock(system_cycles);
+
 	//Run RTC
 	if((mem->nds7_ie & 0x80) && (mem->nds7_rtc.int1_enable) && (mem->memory_map[NDS_RCNT+1] & 0x1))
 	{
@@ -15,6 +15,10 @@
 #include <sstream>
 
 #include "common/util.h"
+#include "common/sw_filter.h"
+#include "common/mem_trace.h"
+#include "common/profiler.h"
+#include "common/save_flush.h"
 
 #include "core.h"
 
@@ -347,6 +351,9 @@ void NTR_core::run_core()
 	//Begin running the core
 	while(running)
 	{
+		//Write battery saves in the background once games stop writing to them
+		if((save_flush::pending) && (core_cpu_nds9.controllers.video.lcd_stat.current_scanline == 192)) { save_flush::update(); }
+
 		//Handle SDL Events
 		if((core_cpu_nds9.controllers.video.lcd_stat.current_scanline == 192) && SDL_PollEvent(&event))
 		{
@@ -374,6 +381,9 @@ void NTR_core::run_core()
 			//Hotplug joypad
 			else if((event.type == SDL_JOYDEVICEADDED) && (!core_pad.joy_init)) { core_pad.init(); }
 			else if((event.type == SDL_JOYDEVICEREMOVED) && (core_pad.joy_init)) { core_pad.close_joystick(); }
+
+			//Window resized, exposed, or restored - Its contents must be presented again
+			else if(event.type == SDL_WINDOWEVENT) { frame_diff::invalidate(); }
 		}
 
 		//Run the CPU
@@ -381,6 +391,9 @@ void NTR_core::run_core()
 		{	
 			if(db_unit.debug_mode) { debug_step(); }
 
+			//Single-stepping keeps both CPUs in lockstep
+			double sync_quantum = (db_unit.debug_mode) ? 0.0 : config::nds_sync_quantum;
+
 			//Run NDS9
 			if(core_cpu_nds9.re_sync)
 			{
@@ -503,14 +516,16 @@ void NTR_core::run_core()
 				core_cpu_nds9.clock_system();
 
 				//Determine if NDS7 needs to run in order to sync
+				//NDS9 runs ahead by up to the sync quantum, unless it touched registers shared with NDS7
 				cpu_sync_cycles -= core_cpu_nds9.sync_cycles;	
 
-				if(cpu_sync_cycles <= 0)
+				if((cpu_sync_cycles <= -sync_quantum) || ((core_mmu.sync_request) && (cpu_sync_cycles <= 0)))
 				{
 					core_cpu_nds9.re_sync = false;
 					core_cpu_nds7.re_sync = true;
 					cpu_sync_cycles *= -1.0;
 					core_mmu.access_mode = 0;
+					core_mmu.sync_request = false;
 				}
 
 				core_cpu_nds9.thumb_long_branch = false;
@@ -635,14 +650,16 @@ void NTR_core::run_core()
 				core_cpu_nds7.clock_system();
 
 				//Determine if NDS9 needs to run in order to sync
+				//NDS7 runs ahead by up to the sync quantum, unless it touched registers shared with NDS9
 				cpu_sync_cycles -= core_cpu_nds7.sync_cycles;
 
-				if(cpu_sync_cycles <= 0)
+				if((cpu_sync_cycles <= -sync_quantum) || ((core_mmu.sync_request) && (cpu_sync_cycles <= 0)))
 				{
 					core_cpu_nds7.re_sync = false;
 					core_cpu_nds9.re_sync = true;
 					cpu_sync_cycles *= -1.0;
 					core_mmu.access_mode = 1;
+					core_mmu.sync_request = false;
 				}
 
 				core_cpu_nds7.thumb_long_branch = false;
@@ -665,6 +682,9 @@ void NTR_core::step()
 	{	
 		if(db_unit.debug_mode) { debug_step(); }
 
+		//Single-stepping keeps both CPUs in lockstep
+		double sync_quantum = (db_unit.debug_mode) ? 0.0 : config::nds_sync_quantum;
+
 		//Run NDS9
 		if(core_cpu_nds9.re_sync)
 		{
@@ -754,14 +774,16 @@ void NTR_core::step()
 			core_cpu_nds9.clock_system();
 
 			//Determine if NDS7 needs to run in order to sync
+			//NDS9 runs ahead by up to the sync quantum, unless it touched registers shared with NDS7
 			cpu_sync_cycles -= core_cpu_nds9.sync_cycles;	
 
-			if(cpu_sync_cycles <= 0)
+			if((cpu_sync_cycles <= -sync_quantum) || ((core_mmu.sync_request) && (cpu_sync_cycles <= 0)))
 			{
 				core_cpu_nds9.re_sync = false;
 				core_cpu_nds7.re_sync = true;
 				cpu_sync_cycles *= -1.0;
 				core_mmu.access_mode = 0;
+				core_mmu.sync_request = false;
 			}
 		}
 
@@ -851,14 +873,16 @@ void NTR_core::step()
 			core_cpu_nds7.clock_system();
 
 			//Determine if NDS9 needs to run in order to sync
+			//NDS7 runs ahead by up to the sync quantum, unless it touched registers shared with NDS9
 			cpu_sync_cycles -= core_cpu_nds7.sync_cycles;
 
-			if(cpu_sync_cycles <= 0)
+			if((cpu_sync_cycles <= -sync_quantum) || ((core_mmu.sync_request) && (cpu_sync_cycles <= 0)))
 			{
 				core_cpu_nds7.re_sync = false;
 				core_cpu_nds9.re_sync = true;
 				cpu_sync_cycles *= -1.0;
 				core_mmu.access_mode = 1;
+				core_mmu.sync_request = false;
 			}
 		}
 	}
@@ -933,8 +957,10 @@ void NTR_core::handle_hotkey(SDL_Event& event)
 	//Toggle Fullscreen on F12
 	else if((event.type == SDL_KEYUP) && (event.key.keysym.sym == SDLK_F12))
 	{
-		u32 next_w = config::sys_width;
-		u32 next_h = config::sys_height;
+		//Windowed mode must match the software filter's output size
+		u32 filter_scale = (config::use_opengl) ? 1 : sw_filter::get_scale();
+		u32 next_w = config::sys_width * filter_scale;
+		u32 next_h = config::sys_height * filter_scale;
 
 		//Unset fullscreen
 		if(config::flags & SDL_WINDOW_FULLSCREEN)
@@ -1035,6 +1061,12 @@ void NTR_core::handle_hotkey(SDL_Event& event)
 		core_mmu.ntr_027.start_comms = true;
 	}
 
+	//Start or stop memory access tracing on F10
+	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F10)) { mem_trace::toggle(); }
+
+	//Start or stop frame profiling on F6 - F11 is used by Slot-2 and microphone devices
+	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F6)) { profiler::toggle(); }
+
 	//Reset emulation on F8
 	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F8)) { reset(); }
 
@@ -1089,6 +1121,12 @@ void NTR_core::handle_hotkey(int input, bool pressed)
 	//Toggle turbo off
 	else if((input == config::hotkey_turbo) && (!pressed)) { config::turbo = false; }
 
+	//Start or stop memory access tracing on F10
+	else if((input == SDLK_F10) && (pressed)) { mem_trace::toggle(); }
+
+	//Start or stop frame profiling on F6 - F11 is used by Slot-2 and microphone devices
+	else if((input == SDLK_F6) && (pressed)) { profiler::toggle(); }
+
 	//Toggle swap NDS screens on F4
 	else if((input == config::hotkey_swap_screen) && (pressed))
 	{
@@ -11,6 +11,7 @@
 
 #include "arm9.h"
 #include "arm7.h" 
+#include "common/profiler.h"
 
 /****** Performs DMA0 through DMA3 transfers - NDS9 ******/
 void NTR_ARM9::nds9_dma(u8 index)
@@ -43,6 +44,9 @@ void NTR_ARM9::nds9_dma(u8 index)
 			if(!mem->dma[index].started) { return; }
 	}
 
+	//Only time DMAs that actually transfer, pending ones are checked every cycle
+	profiler::scope timer(profiler::PROF_DMA);
+
 	//std::cout<<"NDS9 DMA" << std::dec << (u16)index << "\n";
 	//std::cout<<"START ADDR -> 0x" << std::hex << mem->dma[index].start_address << "\n";
 	//std::cout<<"DEST  ADDR -> 0x" << std::hex << mem->dma[index].destination_address << "\n";
@@ -60,6 +64,9 @@ void NTR_ARM9::nds9_dma(u8 index)
 			mem->dma[index].start_address &= ~0x1;
 			mem->dma[index].destination_address &= ~0x1;
 
+			//Whole block copy or fill for Main RAM
+			mem->dma_block_transfer(index, 2);
+
 			while(mem->dma[index].word_count != 0)
 			{
 				temp_value = mem->read_u16(mem->dma[index].start_address);
@@ -86,6 +93,9 @@ void NTR_ARM9::nds9_dma(u8 index)
 			mem->dma[index].start_address &= ~0x3;
 			mem->dma[index].destination_address &= ~0x3;
 
+			//Whole block copy or fill for Main RAM
+			mem->dma_block_transfer(index, 4);
+
 			while(mem->dma[index].word_count != 0)
 			{
 				temp_value = mem->read_u32(mem->dma[index].start_address);
@@ -123,11 +133,11 @@ void NTR_ARM9::nds9_dma(u8 index)
 
 		mem->nds_card.transfer_src = (mem->nds_card.cmd_lo << 8);
 		mem->nds_card.transfer_src |= (mem->nds_card.cmd_hi >> 24);
-		mem->nds_card.transfer_src &= (mem->cart_data.size() - 1);
+		mem->nds_card.transfer_src &= (mem->cart_size - 1);
 
 		while(mem->dma[index].word_count != 0)
 		{
-			mem->memory_map[mem->dma[index].destination_address++] = mem->cart_data[mem->nds_card.transfer_src++];
+			mem->memory_map[mem->dma[index].destination_address++] = mem->read_cart_u8(mem->nds_card.transfer_src++);
 			mem->dma[index].word_count--;
 		}
 
@@ -220,6 +230,9 @@ void NTR_ARM7::nds7_dma(u8 index)
 			if(!mem->dma[index].started) { return; }
 	}
 
+	//Only time DMAs that actually transfer, pending ones are checked every cycle
+	profiler::scope timer(profiler::PROF_DMA);
+
 	//std::cout<<"NDS7 DMA" << std::dec << (u16)index << "\n";
 	//std::cout<<"START ADDR -> 0x" << std::hex << mem->dma[index].start_address << "\n";
 	//std::cout<<"DEST  ADDR -> 0x" << std::hex << mem->dma[index].destination_address << "\n";
@@ -232,6 +245,9 @@ void NTR_ARM7::nds7_dma(u8 index)
 		mem->dma[index].start_address &= ~0x1;
 		mem->dma[index].destination_address &= ~0x1;
 
+		//Whole block copy or fill for Main RAM
+		mem->dma_block_transfer(index, 2);
+
 		while(mem->dma[index].word_count != 0)
 		{
 			temp_value = mem->read_u16(mem->dma[index].start_address);
@@ -258,6 +274,9 @@ void NTR_ARM7::nds7_dma(u8 index)
 		mem->dma[index].start_address &= ~0x3;
 		mem->dma[index].destination_address &= ~0x3;
 
+		//Whole block copy or fill for Main RAM
+		mem->dma_block_transfer(index, 4);
+
 		while(mem->dma[index].word_count != 0)
 		{
 			temp_value = mem->read_u32(mem->dma[index].start_address);
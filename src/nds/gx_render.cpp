@@ -22,10 +22,13 @@ void NTR_LCD::render_bg_3D()
 	if(!lcd_stat.bg_enable_a[0]) { return; }
 
 	//Abort rendering if BGs with high priority have already completely rendered a scanline
-	if(full_scanline_render_a) { return; }
+	if(full_scanline_render[0]) { return; }
 
 	bool full_render = true;
 
+	//3D is always BG0 of Engine A
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[0];
+
 	u8 bg_priority = lcd_stat.bg_priority_a[0] + 1;
 	u16 x_offset = lcd_stat.bg_offset_x_a[0];
 
@@ -39,17 +42,17 @@ void NTR_LCD::render_bg_3D()
 	{
 		i &= 0x1FF;
 
-		if((!render_buffer_a[x] || (bg_priority < render_buffer_a[x])) && (i < 0x100))
+		if((!render_buffer[0][x] || (bg_priority < render_buffer[0][x])) && (i < 0x100))
 		{
 			if(gx_render_buffer[current_buffer][gx_index + i])
 			{
-				render_buffer_a[x] = bg_priority;
-				scanline_buffer_a[x] = gx_screen_buffer[current_buffer][gx_index + i];
+				render_buffer[0][x] = bg_priority;
+				scanline_buffer[0][x] = gx_screen_buffer[current_buffer][gx_index + i];
 				line_buffer[4][x] |= 1;
 			}
 		}
 
-		line_buffer[0][x] = scanline_buffer_a[x];
+		line_buffer[0][x] = scanline_buffer[0][x];
 	} 
 }
 
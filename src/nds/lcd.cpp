@@ -13,6 +13,8 @@
 
 #include "lcd.h"
 #include "common/util.h"
+#include "common/sw_filter.h"
+#include "common/profiler.h"
 
 /****** LCD Constructor ******/
 NTR_LCD::NTR_LCD()
@@ -24,13 +26,15 @@ NTR_LCD::NTR_LCD()
 /****** LCD Destructor ******/
 NTR_LCD::~NTR_LCD()
 {
+	engine_b_worker.stop();
+
 	screen_buffer.clear();
 
-	scanline_buffer_a.clear();
-	scanline_buffer_b.clear();
+	scanline_buffer[0].clear();
+	scanline_buffer[1].clear();
 
-	render_buffer_a.clear();
-	render_buffer_b.clear();
+	render_buffer[0].clear();
+	render_buffer[1].clear();
 
 	SDL_DestroyWindow(window);
 
@@ -54,11 +58,11 @@ void NTR_LCD::reset()
 	screen_buffer.clear();
 	gx_screen_buffer.clear();
 
-	scanline_buffer_a.clear();
-	scanline_buffer_b.clear();
+	scanline_buffer[0].clear();
+	scanline_buffer[1].clear();
 
-	render_buffer_a.clear();
-	render_buffer_b.clear();
+	render_buffer[0].clear();
+	render_buffer[1].clear();
 	gx_render_buffer.clear();
 	gx_z_buffer.clear();
 
@@ -90,24 +94,27 @@ void NTR_LCD::reset()
 	gx_screen_buffer[0].resize(0xC000, 0);
 	gx_screen_buffer[1].resize(0xC000, 0);
 
-	scanline_buffer_a.resize(0x100, 0);
-	scanline_buffer_b.resize(0x100, 0);
+	scanline_buffer[0].resize(0x100, 0);
+	scanline_buffer[1].resize(0x100, 0);
 
-	render_buffer_a.resize(0x100, 0);
-	render_buffer_b.resize(0x100, 0);
+	render_buffer[0].resize(0x100, 0);
+	render_buffer[1].resize(0x100, 0);
 	gx_render_buffer.resize(2);
 	gx_render_buffer[0].resize(0xC000, 0);
 	gx_render_buffer[1].resize(0xC000, 0);
 	gx_z_buffer.resize(0xC000, 4096);
 
-	line_buffer.resize(8);
-	for(u32 x = 0; x < 8; x++) { line_buffer[x].resize(0x100); }
+	for(u32 engine_id = 0; engine_id < 2; engine_id++)
+	{
+		line_buffers[engine_id].resize(8);
+		for(u32 x = 0; x < 8; x++) { line_buffers[engine_id][x].resize(0x100); }
 
-	obj_line_buffer.resize(8);
-	for(u32 x = 0; x < 8; x++) { obj_line_buffer[x].resize(0x100); }
+		obj_line_buffers[engine_id].resize(8);
+		for(u32 x = 0; x < 8; x++) { obj_line_buffers[engine_id][x].resize(0x100); }
+	}
 
-	full_scanline_render_a = false;
-	full_scanline_render_b = false;
+	full_scanline_render[0] = false;
+	full_scanline_render[1] = false;
 
 	//BG palette initialization
 	lcd_stat.bg_pal_update_a = true;
@@ -153,8 +160,8 @@ void NTR_LCD::reset()
 
 	//OAM and OBJ initialization
 	lcd_stat.oam_update = true;
-	obj_render_length_a = 0;
-	obj_render_length_b = 0;
+	obj_render_length[0] = 0;
+	obj_render_length[1] = 0;
 
 	for(u32 x = 0; x < 0x100; x++)
 	{
@@ -200,8 +207,8 @@ void NTR_LCD::reset()
 
 	for(int x = 0; x < 0x80; x++)
 	{
-		obj_render_list_a[x] = 0;
-		obj_render_list_b[x] = 0;
+		obj_render_list[0][x] = 0;
+		obj_render_list[1][x] = 0;
 	}
 
 	lcd_stat.update_bg_control_a = false;
@@ -475,6 +482,105 @@ void NTR_LCD::reset()
 	max_fullscreen_ratio = 2;
 
 	try_window_rebuild = false;
+
+	screen_diff.hashes.clear();
+	screen_diff.generation = 0;
+
+	init_engine_views();
+}
+
+/****** Points each engine's register view at its Engine A or Engine B data ******/
+void NTR_LCD::init_engine_views()
+{
+	engine_2d &a = engine[0];
+	engine_2d &b = engine[1];
+
+	a.display_control = &lcd_stat.display_control_a;
+	b.display_control = &lcd_stat.display_control_b;
+	a.bg_mode = &lcd_stat.bg_mode_a;
+	b.bg_mode = &lcd_stat.bg_mode_b;
+	a.display_mode = &lcd_stat.display_mode_a;
+	b.display_mode = &lcd_stat.display_mode_b;
+	a.ext_pal = &lcd_stat.ext_pal_a;
+	b.ext_pal = &lcd_stat.ext_pal_b;
+	a.master_bright = &lcd_stat.master_bright_a;
+	b.master_bright = &lcd_stat.master_bright_b;
+
+	a.bg_control = lcd_stat.bg_control_a;
+	b.bg_control = lcd_stat.bg_control_b;
+	a.bg_offset_x = lcd_stat.bg_offset_x_a;
+	b.bg_offset_x = lcd_stat.bg_offset_x_b;
+	a.bg_offset_y = lcd_stat.bg_offset_y_a;
+	b.bg_offset_y = lcd_stat.bg_offset_y_b;
+	a.bg_depth = lcd_stat.bg_depth_a;
+	b.bg_depth = lcd_stat.bg_depth_b;
+	a.bg_size = lcd_stat.bg_size_a;
+	b.bg_size = lcd_stat.bg_size_b;
+	a.text_width = lcd_stat.text_width_a;
+	b.text_width = lcd_stat.text_width_b;
+	a.text_height = lcd_stat.text_height_a;
+	b.text_height = lcd_stat.text_height_b;
+	a.bg_base_map_addr = lcd_stat.bg_base_map_addr_a;
+	b.bg_base_map_addr = lcd_stat.bg_base_map_addr_b;
+	a.bg_base_tile_addr = lcd_stat.bg_base_tile_addr_a;
+	b.bg_base_tile_addr = lcd_stat.bg_base_tile_addr_b;
+	a.bg_bitmap_base_addr = lcd_stat.bg_bitmap_base_addr_a;
+	b.bg_bitmap_base_addr = lcd_stat.bg_bitmap_base_addr_b;
+	a.bg_priority = lcd_stat.bg_priority_a;
+	b.bg_priority = lcd_stat.bg_priority_b;
+	a.bg_enable = lcd_stat.bg_enable_a;
+	b.bg_enable = lcd_stat.bg_enable_b;
+	a.bg_affine = lcd_stat.bg_affine_a;
+	b.bg_affine = lcd_stat.bg_affine_b;
+
+	a.bg_pal = lcd_stat.bg_pal_a;
+	b.bg_pal = lcd_stat.bg_pal_b;
+	a.bg_ext_pal = lcd_stat.bg_ext_pal_a;
+	b.bg_ext_pal = lcd_stat.bg_ext_pal_b;
+	a.obj_pal = lcd_stat.obj_pal_a;
+	b.obj_pal = lcd_stat.obj_pal_b;
+	a.obj_ext_pal = lcd_stat.obj_ext_pal_a;
+	b.obj_ext_pal = lcd_stat.obj_ext_pal_b;
+
+	a.sfx_target = lcd_stat.sfx_target_a;
+	b.sfx_target = lcd_stat.sfx_target_b;
+	a.current_sfx_type = &lcd_stat.current_sfx_type_a;
+	b.current_sfx_type = &lcd_stat.current_sfx_type_b;
+	a.brightness_coef = &lcd_stat.brightness_coef_a;
+	b.brightness_coef = &lcd_stat.brightness_coef_b;
+	a.alpha_coef = lcd_stat.alpha_coef_a;
+	b.alpha_coef = lcd_stat.alpha_coef_b;
+
+	a.window_x = lcd_stat.window_x_a;
+	b.window_x = lcd_stat.window_x_b;
+	a.window_y = lcd_stat.window_y_a;
+	b.window_y = lcd_stat.window_y_b;
+	a.window_enable = lcd_stat.window_enable_a;
+	b.window_enable = lcd_stat.window_enable_b;
+	a.window_in_enable = lcd_stat.window_in_enable_a;
+	b.window_in_enable = lcd_stat.window_in_enable_b;
+	a.window_out_enable = lcd_stat.window_out_enable_a;
+	b.window_out_enable = lcd_stat.window_out_enable_b;
+	a.window_status = lcd_stat.window_status_a;
+	b.window_status = lcd_stat.window_status_b;
+	a.window_id = lcd_stat.window_id_a;
+	b.window_id = lcd_stat.window_id_b;
+
+	//BG control registers and BG VRAM locations
+	a.bg_cnt_base = NDS_BG0CNT_A;
+	b.bg_cnt_base = NDS_BG0CNT_B;
+	a.bg_vram_addr = 0x6000000;
+	b.bg_vram_addr = 0x6200000;
+	a.bg_vram = nullptr;
+	b.bg_vram = nullptr;
+
+	for(u32 engine_id = 0; engine_id < 2; engine_id++)
+	{
+		for(u32 bg_id = 0; bg_id < 4; bg_id++)
+		{
+			for(u32 x = 0; x < 256; x++) { window_mask[engine_id][bg_id][x] = true; }
+		}
+	}
 }
 
 /****** Initialize LCD with SDL ******/
@@ -500,11 +606,12 @@ bool NTR_LCD::init()
 			}
 		}
 
-		//Set up software rendering
+		//Set up software rendering - Software filters may enlarge the output
 		else
 		{
-			u32 next_w = config::sys_width;
-			u32 next_h = config::sys_height;
+			u32 filter_scale = sw_filter::get_scale();
+			u32 next_w = config::sys_width * filter_scale;
+			u32 next_h = config::sys_height * filter_scale;
 
 			if(config::flags & SDL_WINDOW_FULLSCREEN)
 			{
@@ -529,8 +636,8 @@ bool NTR_LCD::init()
 			window = SDL_CreateWindow("GBE+", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, next_w, next_h, config::flags);
 			SDL_GetWindowSize(window, &config::win_width, &config::win_height);
 			final_screen = SDL_GetWindowSurface(window);
-			original_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, config::sys_width, config::sys_height, 32, 0, 0, 0, 0);
-			config::scaling_factor = 1;
+			original_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, (config::sys_width * filter_scale), (config::sys_height * filter_scale), 32, 0, 0, 0, 0);
+			config::scaling_factor = filter_scale;
 		}
 
 		if(final_screen == nullptr) { return false; }
@@ -544,6 +651,9 @@ bool NTR_LCD::init()
 		final_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, config::sys_width, config::sys_height, 32, 0, 0, 0, 0);
 	}
 
+	//Any new window or surface starts empty, so present the next frame in full
+	frame_diff::invalidate();
+
 	std::cout<<"LCD::Initialized\n";
 
 	return true;
@@ -784,8 +894,8 @@ void NTR_LCD::update_obj_affine_transformation()
 /****** Updates a list of OBJs to render on the current scanline ******/
 void NTR_LCD::update_obj_render_list()
 {
-	obj_render_length_a = 0;
-	obj_render_length_b = 0;
+	obj_render_length[0] = 0;
+	obj_render_length[1] = 0;
 
 	//Sort them based on BG priorities
 	for(int bg = 0; bg < 4; bg++)
@@ -800,8 +910,8 @@ void NTR_LCD::update_obj_render_list()
 
 			else if(obj[x].bg_priority == bg)
 			{
-				if(x < 128) { obj_render_list_a[obj_render_length_a++] = x; }
-				else { obj_render_list_b[obj_render_length_b++] = x; } 
+				if(x < 128) { obj_render_list[0][obj_render_length[0]++] = x; }
+				else { obj_render_list[1][obj_render_length[1]++] = x; } 
 			}
 		}
 	}
@@ -1050,391 +1160,191 @@ void NTR_LCD::update_palettes()
 /****** Render the line for a BG ******/
 void NTR_LCD::render_bg_scanline(u32 bg_control)
 {
-	u8 bg_mode = (bg_control & 0x1000) ? lcd_stat.bg_mode_b : lcd_stat.bg_mode_a;
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[engine_id];
+	std::vector< std::vector<u32> > &obj_line_buffer = obj_line_buffers[engine_id];
+
 	u8 bg_render_list[4];
 	u8 bg_id = 0;
 
-	//Calculate window status for Engine A and Engine B for current scanline
-	calculate_window_on_scanline();
+	//Reset render buffer
+	full_scanline_render[engine_id] = false;
+	render_buffer[engine_id].assign(0x100, 0);
 
-	//Render Engine A
-	if((bg_control & 0x1000) == 0)
+	//Reset line buffers
+	for(u32 x = 0; x < 8; x++)
 	{
-		//Reset render buffer
-		full_scanline_render_a = false;
-		render_buffer_a.assign(0x100, 0);
-
-		//Reset line buffers
-		for(u32 x = 0; x < 8; x++)
-		{
-			line_buffer[x].assign(0x100, 0x00);
-			obj_line_buffer[x].assign(0x100, 0x00);
-		}
-
-		//Clear scanline with backdrop
-		for(u16 x = 0; x < 256; x++) { scanline_buffer_a[x] = lcd_stat.bg_pal_a[0]; }
-
-		//Determine BG priority
-		for(int x = 0, list_length = 0; x < 4; x++)
-		{
-			if(lcd_stat.bg_priority_a[0] == x) { bg_render_list[list_length++] = 0; }
-			if(lcd_stat.bg_priority_a[1] == x) { bg_render_list[list_length++] = 1; }
-			if(lcd_stat.bg_priority_a[2] == x) { bg_render_list[list_length++] = 2; }
-			if(lcd_stat.bg_priority_a[3] == x) { bg_render_list[list_length++] = 3; }
-		}
-
-		//Render OBJs if possible
-		if(lcd_stat.display_control_a & 0x1000) { render_obj_scanline(bg_control); }
-
-		//Render BGs based on priority (3 is the 'lowest', 0 is the 'highest')
-		for(int x = 0; x < 4; x++)
-		{
-			bg_id = bg_render_list[x];
-			bg_control = NDS_BG0CNT_A + (bg_id << 1);
-
-			//Render 3D first
-			if((bg_id == 0) && (lcd_stat.display_control_a & 0x8))
-			{
-				render_bg_3D();
-				x++;
-
-				if(x == 4) { break; }
-
-				bg_id = bg_render_list[x];
-				bg_control = NDS_BG0CNT_A + (bg_id << 1);
-			}
-
-			//Verify VRAM Bank availibility 
-			if(!mem->bg_vram_bank_enable_a)  { break; }
-
-			switch(lcd_stat.bg_mode_a)
-			{
-				//BG Mode 0
-				case 0x0:
-					render_bg_mode_text(bg_control);
-					break;
-
-				//BG Mode 1
-				case 0x1:
-					
-					//BG0-2 Text
-					if(bg_id != 3) { render_bg_mode_text(bg_control); }
-					
-					//BG3 Affine
-					else { render_bg_mode_affine(bg_control); }
-
-					break;
-
-				//BG Mode 2
-				case 0x2:
-					//BG0-1 Text
-					if(bg_id < 2) { render_bg_mode_text(bg_control); }
-
-					//BG2-3 Affine
-					else { render_bg_mode_affine(bg_control); }
-
-					break;
-
-				//BG Mode 3
-				case 0x3:
-					//BG0-2 Text
-					if(bg_id != 3) { render_bg_mode_text(bg_control); }
-
-					//BG3 Extended
-					else
-					{
-						u8 ext_mode = (lcd_stat.bg_control_a[bg_id] & 0x80) | (lcd_stat.bg_control_a[bg_id] & 0x4);
-						switch(ext_mode)
-						{
-							//16-bit Affine
-							case 0x0:
-							case 0x4:
-								render_bg_mode_affine_ext(bg_control);
-								break;
-
-							//256 color Affine
-							case 0x80:
-								render_bg_mode_bitmap(bg_control);
-								break;
-
-							//Direct color Affine
-							case 0x84:
-								render_bg_mode_direct(bg_control);
-								break;
-						}
-					}
-
-					break;
-
-				//BG Mode 4
-				case 0x4:
-					//BG0-1 Text
-					if(bg_id < 2) { render_bg_mode_text(bg_control); }
-
-					//BG2 Affine
-					else if(bg_id == 2) { render_bg_mode_affine(bg_control); }
-
-					//BG3 Extended
-					else
-					{
-						u8 ext_mode = (lcd_stat.bg_control_a[bg_id] & 0x80) | (lcd_stat.bg_control_a[bg_id] & 0x4);
-						switch(ext_mode)
-						{
-							//16-bit Affine
-							case 0x0:
-							case 0x4:
-								render_bg_mode_affine_ext(bg_control);
-								break;
-
-							//256 color Affine
-							case 0x80:
-								render_bg_mode_bitmap(bg_control);
-								break;
-
-							//Direct color Affine
-							case 0x84:
-								render_bg_mode_direct(bg_control);
-								break;
-						}
-					}
-
-					break;
+		line_buffer[x].assign(0x100, 0x00);
+		obj_line_buffer[x].assign(0x100, 0x00);
+	}
 
-				//BG Mode 5
-				case 0x5:
-					//BG0-1 Text
-					if(bg_id < 2) { render_bg_mode_text(bg_control); }
+	//Clear scanline with backdrop
+	for(u16 x = 0; x < 256; x++) { scanline_buffer[engine_id][x] = eng.bg_pal[0]; }
 
-					//BG2-3 Extended
-					else
-					{
-						u16 ext_mode = (lcd_stat.bg_control_a[bg_id] & 0x80) | (lcd_stat.bg_control_a[bg_id] & 0x4);
-						switch(ext_mode)
-						{
-							//16-bit Affine
-							case 0x0:
-							case 0x4:
-								render_bg_mode_affine_ext(bg_control);
-								break;
-
-							//256 color Affine
-							case 0x80:
-								render_bg_mode_bitmap(bg_control);
-								break;
-
-							//Direct color Affine
-							case 0x84:
-								render_bg_mode_direct(bg_control);
-								break;
-						}
-					}
+	//Determine BG priority
+	for(int x = 0, list_length = 0; x < 4; x++)
+	{
+		if(eng.bg_priority[0] == x) { bg_render_list[list_length++] = 0; }
+		if(eng.bg_priority[1] == x) { bg_render_list[list_length++] = 1; }
+		if(eng.bg_priority[2] == x) { bg_render_list[list_length++] = 2; }
+		if(eng.bg_priority[3] == x) { bg_render_list[list_length++] = 3; }
+	}
 
-					break;
+	//Render OBJs if possible
+	if((*eng.display_control) & 0x1000) { render_obj_scanline(bg_control); }
 
-				default:
-					std::cout<<"LCD::Engine A - invalid or unsupported BG Mode : " << std::dec << (u16)lcd_stat.bg_mode_a << "\n";
-			}
-		}
+	//Verify VRAM Bank availibility
+	bool vram_bank_enabled = (engine_id) ? mem->bg_vram_bank_enable_b : mem->bg_vram_bank_enable_a;
 
-		//Apply SFX
-		apply_sfx(NDS_DISPCNT_A);
-	}
+	//BG VRAM is read directly, grab its location for this line
+	eng.bg_vram = &mem->memory_map[eng.bg_vram_addr];
 
-	//Render Engine B
-	else
+	//Render BGs based on priority (3 is the 'lowest', 0 is the 'highest')
+	for(int x = 0; x < 4; x++)
 	{
-		//Reset render buffer
-		full_scanline_render_b = false;
-		render_buffer_b.assign(0x100, 0);
+		bg_id = bg_render_list[x];
+		bg_control = eng.bg_cnt_base + (bg_id << 1);
 
-		//Reset line buffers
-		for(u32 x = 0; x < 8; x++)
+		//Render 3D first - Engine A only
+		if((!engine_id) && (bg_id == 0) && ((*eng.display_control) & 0x8))
 		{
-			line_buffer[x].assign(0x100, 0x00);
-			obj_line_buffer[x].assign(0x100, 0x00);
-		}
+			render_bg_3D();
+			x++;
 
-		//Clear scanline with backdrop
-		for(u16 x = 0; x < 256; x++) { scanline_buffer_b[x] = lcd_stat.bg_pal_b[0]; }
+			if(x == 4) { break; }
 
-		//Determine BG priority
-		for(int x = 0, list_length = 0; x < 4; x++)
-		{
-			if(lcd_stat.bg_priority_b[0] == x) { bg_render_list[list_length++] = 0; }
-			if(lcd_stat.bg_priority_b[1] == x) { bg_render_list[list_length++] = 1; }
-			if(lcd_stat.bg_priority_b[2] == x) { bg_render_list[list_length++] = 2; }
-			if(lcd_stat.bg_priority_b[3] == x) { bg_render_list[list_length++] = 3; }
+			bg_id = bg_render_list[x];
+			bg_control = eng.bg_cnt_base + (bg_id << 1);
 		}
 
-		//Render OBJs if possible
-		if(lcd_stat.display_control_b & 0x1000) { render_obj_scanline(bg_control); }
+		if(!vram_bank_enabled) { break; }
 
-		//Render BGs based on priority (3 is the 'lowest', 0 is the 'highest')
-		for(int x = 0; x < 4; x++)
+		switch(*eng.bg_mode)
 		{
-			bg_id = bg_render_list[x];
-			bg_control = NDS_BG0CNT_B + (bg_id << 1);
+			//BG Mode 0
+			case 0x0:
+				render_bg_mode_text(bg_control);
+				break;
 
-			//Verify VRAM Bank availibility 
-			if(!mem->bg_vram_bank_enable_b)  { break; }
+			//BG Mode 1
+			case 0x1:
+				//BG0-2 Text
+				if(bg_id != 3) { render_bg_mode_text(bg_control); }
+				
+				//BG3 Affine
+				else { render_bg_mode_affine(bg_control); }
 
-			switch(lcd_stat.bg_mode_b)
-			{
-				//BG Mode 0
-				case 0x0:
-					render_bg_mode_text(bg_control);
-					break;
+				break;
 
-				//BG Mode 1
-				case 0x1:
-					//BG0-2 Text
-					if(bg_id != 3) { render_bg_mode_text(bg_control); }
-					
-					//BG3 Affine
-					else { render_bg_mode_affine(bg_control); }
+			//BG Mode 2
+			case 0x2:
+				//BG0-1 Text
+				if(bg_id < 2) { render_bg_mode_text(bg_control); }
 
-					break;
+				//BG2-3 Affine
+				else { render_bg_mode_affine(bg_control); }
 
-				//BG Mode 2
-				case 0x2:
-					//BG0-1 Text
-					if(bg_id < 2) { render_bg_mode_text(bg_control); }
+				break;
 
-					//BG2-3 Affine
-					else { render_bg_mode_affine(bg_control); }
+			//BG Mode 3
+			case 0x3:
+				//BG0-2 Text
+				if(bg_id != 3) { render_bg_mode_text(bg_control); }
 
-					break;
+				//BG3 Extended
+				else { render_bg_mode_extended(bg_control); }
 
-				//BG Mode 3
-				case 0x3:
-					//BG0-2 Text
-					if(bg_id != 3) { render_bg_mode_text(bg_control); }
+				break;
 
-					//BG3 Extended
-					else
-					{
-						u8 ext_mode = (lcd_stat.bg_control_b[bg_id] & 0x80) | (lcd_stat.bg_control_b[bg_id] & 0x4);
-						switch(ext_mode)
-						{
-							//16-bit Affine
-							case 0x0:
-							case 0x4:
-								render_bg_mode_affine_ext(bg_control);
-								break;
-
-							//256 color Affine
-							case 0x80:
-								render_bg_mode_bitmap(bg_control);
-								break;
-
-							//Direct color Affine
-							case 0x84:
-								render_bg_mode_direct(bg_control);
-								break;
-						}
-					}
+			//BG Mode 4
+			case 0x4:
+				//BG0-1 Text
+				if(bg_id < 2) { render_bg_mode_text(bg_control); }
 
-					break;
+				//BG2 Affine
+				else if(bg_id == 2) { render_bg_mode_affine(bg_control); }
 
-				//BG Mode 4
-				case 0x4:
-					//BG0-1 Text
-					if(bg_id < 2) { render_bg_mode_text(bg_control); }
+				//BG3 Extended
+				else { render_bg_mode_extended(bg_control); }
 
-					//BG2 Affine
-					else if(bg_id == 2) { render_bg_mode_affine(bg_control); }
+				break;
 
-					//BG3 Extended
-					else
-					{
-						u8 ext_mode = (lcd_stat.bg_control_b[bg_id] & 0x80) | (lcd_stat.bg_control_b[bg_id] & 0x4);
-						switch(ext_mode)
-						{
-							//16-bit Affine
-							case 0x0:
-							case 0x4:
-								render_bg_mode_affine_ext(bg_control);
-								break;
-
-							//256 color Affine
-							case 0x80:
-								render_bg_mode_bitmap(bg_control);
-								break;
-
-							//Direct color Affine
-							case 0x84:
-								render_bg_mode_direct(bg_control);
-								break;
-						}
-					}
+			//BG Mode 5
+			case 0x5:
+				//BG0-1 Text
+				if(bg_id < 2) { render_bg_mode_text(bg_control); }
 
-					break;
+				//BG2-3 Extended
+				else { render_bg_mode_extended(bg_control); }
 
-				//BG Mode 5
-				case 0x5:
-					//BG0-1 Text
-					if(bg_id < 2) { render_bg_mode_text(bg_control); }
+				break;
 
-					//BG2-3 Extended
-					else
-					{
-						u8 ext_mode = (lcd_stat.bg_control_b[bg_id] & 0x80) | (lcd_stat.bg_control_b[bg_id] & 0x4);
-						switch(ext_mode)
-						{
-							//16-bit Affine
-							case 0x0:
-							case 0x4:
-								render_bg_mode_affine_ext(bg_control);
-								break;
-
-							//256 color Affine
-							case 0x80:
-								render_bg_mode_bitmap(bg_control);
-								break;
-
-							//Direct color Affine
-							case 0x84:
-								render_bg_mode_direct(bg_control);
-								break;
-						}
-					}
+			default:
+				std::cout<<"LCD::Engine " << ((engine_id) ? "B" : "A") << " - invalid or unsupported BG Mode : " << std::dec << (u16)(*eng.bg_mode) << "\n";
+		}
+	}
 
-					break;
+	//Apply SFX
+	apply_sfx((engine_id) ? NDS_DISPCNT_B : NDS_DISPCNT_A);
+}
 
-				default:
-					std::cout<<"LCD::Engine B - invalid or unsupported BG Mode : " << std::dec << (u16)lcd_stat.bg_mode_b << "\n";
-			}
-		}
+/****** Renders an extended BG scanline based on its BG control ******/
+void NTR_LCD::render_bg_mode_extended(u32 bg_control)
+{
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	u8 bg_id = (bg_control - engine[engine_id].bg_cnt_base) >> 1;
+	u16 ext_mode = (engine[engine_id].bg_control[bg_id] & 0x80) | (engine[engine_id].bg_control[bg_id] & 0x4);
+
+	switch(ext_mode)
+	{
+		//16-bit Affine
+		case 0x0:
+		case 0x4:
+			render_bg_mode_affine_ext(bg_control);
+			break;
 
-		//Apply SFX
-		apply_sfx(NDS_DISPCNT_B);
+		//256 color Affine
+		case 0x80:
+			render_bg_mode_bitmap(bg_control);
+			break;
+
+		//Direct color Affine
+		case 0x84:
+			render_bg_mode_direct(bg_control);
+			break;
 	}
 }
 
 /****** Renders a scanline for OBJs ******/
 void NTR_LCD::render_obj_scanline(u32 bg_control)
 {
-	//Detemine if Engine A or B
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
 	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &obj_line_buffer = obj_line_buffers[engine_id];
 
 	//Abort if no OBJs are rendered on this line
-	if(!engine_id && !obj_render_length_a) { return; }
-	else if(engine_id && !obj_render_length_b) { return; }
+	if(!obj_render_length[engine_id]) { return; }
 
 	u8 obj_id = 0;
 	u16 pal_id = 0;
-	u8 obj_render_length = engine_id ? obj_render_length_b : obj_render_length_a;
 	u16 scanline_pixel_counter = 0;
 	u16 render_width = 0;
 	u8 raw_color = 0;
 	u16 raw_pixel = 0;
-	bool ext_pal = false;
 	bool render_obj;
 	bool direct_bitmap = false;
 	bool vram_bank_enabled = false;
 	s16 h_flip, v_flip = 0;
 	u16 obj_x, obj_y = 0;
-	u32 disp_cnt = engine_id ? lcd_stat.display_control_b : lcd_stat.display_control_a;
+	u32 disp_cnt = *eng.display_control;
+	u8 bitmap_mask = (disp_cnt & 0x20) ? 0x1F : 0xF;
+
+	//Extended palettes apply to every OBJ on this line
+	bool ext_pal = ((*eng.ext_pal) & 0x2) ? true : false;
+	u32* obj_pal = (ext_pal) ? eng.obj_ext_pal : eng.obj_pal;
 
 	//Check OBJ VRAM bank status
 	if((!engine_id) &&
@@ -1458,15 +1368,9 @@ void NTR_LCD::render_obj_scanline(u32 bg_control)
 	if(!vram_bank_enabled) { return; }
 
 	//Cycle through all current OBJ and render them based on their priority
-	for(int x = 0; x < obj_render_length; x++)
+	for(int x = 0; x < obj_render_length[engine_id]; x++)
 	{
-		obj_id = engine_id ? obj_render_list_b[x] : obj_render_list_a[x];
-
-		//Determine whether or not extended palettes are necessary
-		ext_pal = false;
-
-		if((!engine_id) && (lcd_stat.ext_pal_a & 0x2)) { ext_pal = true; }
-		else if((engine_id) && (lcd_stat.ext_pal_b & 0x2)) { ext_pal = true; }
+		obj_id = obj_render_list[engine_id][x];
 
 		if(obj[obj_id].bit_depth == 8)
 		{
@@ -1490,9 +1394,6 @@ void NTR_LCD::render_obj_scanline(u32 bg_control)
 			u8 pixel_shift = (bit_depth == 32) ? 1 : 0;
 			u16 draw_width = (obj[obj_id].affine_enable && obj[obj_id].type) ? (obj[obj_id].width * 2) : obj[obj_id].width;
 
-			u8 bitmap_mask_a = (lcd_stat.display_control_a & 0x20) ? 0x1F : 0xF;
-			u8 bitmap_mask_b = (lcd_stat.display_control_b & 0x20) ? 0x1F : 0xF; 
-			
 			direct_bitmap = (obj[obj_id].mode == 3) ? true : false;
 
 			while(render_width < draw_width)
@@ -1591,20 +1492,12 @@ void NTR_LCD::render_obj_scanline(u32 bg_control)
 						//Process 4-bit depth if necessary
 						if((bit_depth == 32) && (!ext_pal)) { raw_color = (obj_x & 0x1) ? (raw_color >> 4) : (raw_color & 0xF); }
 
-						//Draw for Engine A
-						if(!engine_id && raw_color && !render_buffer_a[scanline_pixel_counter] && render_obj)
+						//Only draw if no previous pixel was rendered
+						if(raw_color && !render_buffer[engine_id][scanline_pixel_counter] && render_obj)
 						{
-							scanline_buffer_a[scanline_pixel_counter] = (ext_pal) ? lcd_stat.obj_ext_pal_a[pal_id + raw_color] : lcd_stat.obj_pal_a[pal_id + raw_color];
-							render_buffer_a[scanline_pixel_counter] = (obj[obj_id].bg_priority + 1);
-							obj_line_buffer[obj[obj_id].bg_priority][scanline_pixel_counter] = scanline_buffer_a[scanline_pixel_counter];
-						}
-
-						//Draw for Engine B
-						else if(engine_id && raw_color && !render_buffer_b[scanline_pixel_counter] && render_obj)
-						{
-							scanline_buffer_b[scanline_pixel_counter] = (ext_pal) ? lcd_stat.obj_ext_pal_b[pal_id + raw_color] : lcd_stat.obj_pal_b[pal_id + raw_color];
-							render_buffer_b[scanline_pixel_counter] = (obj[obj_id].bg_priority + 1);
-							obj_line_buffer[obj[obj_id].bg_priority][scanline_pixel_counter] = scanline_buffer_b[scanline_pixel_counter];
+							scanline_buffer[engine_id][scanline_pixel_counter] = obj_pal[pal_id + raw_color];
+							render_buffer[engine_id][scanline_pixel_counter] = (obj[obj_id].bg_priority + 1);
+							obj_line_buffer[obj[obj_id].bg_priority][scanline_pixel_counter] = scanline_buffer[engine_id][scanline_pixel_counter];
 						}
 
 						//Line buffer
@@ -1634,28 +1527,18 @@ void NTR_LCD::render_obj_scanline(u32 bg_control)
 							u8 obj_shift = (disp_cnt & 0x20) ? 9 : 8;
 
 							u16 target_tile = obj[obj_id].tile_number + meta_x + (meta_y << meta_shift);
-							u8 mask = (engine_id) ? bitmap_mask_b : bitmap_mask_a;
-							
-							obj_addr = base + ((target_tile & mask) * 0x10) + ((target_tile & ~mask) * 0x80);
+							obj_addr = base + ((target_tile & bitmap_mask) * 0x10) + ((target_tile & ~bitmap_mask) * 0x80);
 							obj_addr += ((obj_x % 8) << 1) + ((obj_y % 8) << obj_shift);
 						}
 
 						raw_pixel = mem->read_u16_fast(obj_addr);
 
-						//Draw for Engine A
-						if(!engine_id && (raw_pixel & 0x8000) && !render_buffer_a[scanline_pixel_counter] && render_obj)
-						{
-							scanline_buffer_a[scanline_pixel_counter] = get_rgb15(raw_pixel);
-							render_buffer_a[scanline_pixel_counter] = (obj[obj_id].bg_priority + 1);
-							obj_line_buffer[obj[obj_id].bg_priority][scanline_pixel_counter] = scanline_buffer_a[scanline_pixel_counter];
-						}
-
-						//Draw for Engine B
-						else if(engine_id && (raw_pixel & 0x8000) && !render_buffer_b[scanline_pixel_counter] && render_obj)
+						//Only draw if no previous pixel was rendered
+						if((raw_pixel & 0x8000) && !render_buffer[engine_id][scanline_pixel_counter] && render_obj)
 						{
-							scanline_buffer_b[scanline_pixel_counter] = get_rgb15(raw_pixel);
-							render_buffer_b[scanline_pixel_counter] = (obj[obj_id].bg_priority + 1);
-							obj_line_buffer[obj[obj_id].bg_priority][scanline_pixel_counter] = scanline_buffer_b[scanline_pixel_counter];
+							scanline_buffer[engine_id][scanline_pixel_counter] = get_rgb15(raw_pixel);
+							render_buffer[engine_id][scanline_pixel_counter] = (obj[obj_id].bg_priority + 1);
+							obj_line_buffer[obj[obj_id].bg_priority][scanline_pixel_counter] = scanline_buffer[engine_id][scanline_pixel_counter];
 						}
 
 						//Line buffer
@@ -1681,1565 +1564,737 @@ void NTR_LCD::render_obj_scanline(u32 bg_control)
 /****** Render BG Mode Text scanline ******/
 void NTR_LCD::render_bg_mode_text(u32 bg_control)
 {
-	//Render Engine A
-	if((bg_control & 0x1000) == 0)
-	{
-		//Grab BG ID
-		u8 bg_id = (bg_control - 0x4000008) >> 1;
-		u8 bg_priority = lcd_stat.bg_priority_a[bg_id] + 1;
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[engine_id];
 
-		//If this BG is used for SFX, make sure to render line buffer
-		bool force_render = ((lcd_stat.sfx_target_a[bg_id][0] || lcd_stat.sfx_target_a[bg_id][1]) && (lcd_stat.bg_enable_a[bg_id]));
+	//Grab BG ID
+	u8 bg_id = (bg_control - eng.bg_cnt_base) >> 1;
+	u8 bg_priority = eng.bg_priority[bg_id] + 1;
 
-		//Abort rendering if this BG is disabled
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if((!force_render) && (!lcd_stat.bg_enable_a[bg_id] || full_scanline_render_a)) { return; }
+	//If this BG is used for SFX, make sure to render line buffer
+	bool force_render = ((eng.sfx_target[bg_id][0] || eng.sfx_target[bg_id][1]) && (eng.bg_enable[bg_id]));
 
-		bool full_render = true;
+	//Abort rendering if this BG is disabled
+	//Abort rendering if BGs with high priority have already completely rendered a scanline
+	if((!force_render) && (!eng.bg_enable[bg_id] || full_scanline_render[engine_id])) { return; }
 
-		//Grab tile offsets
-		u8 tile_offset_x = lcd_stat.bg_offset_x_a[bg_id] & 0x7;
+	bool full_render = true;
 
-		u16 tile_id;
-		u16 ext_pal_id;
-		u8 pal_id;
-		u8 flip;
-		u8 slot;
+	//Grab tile offsets
+	u8 tile_offset_x = eng.bg_offset_x[bg_id] & 0x7;
 
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool window_draw[256];
-		bool can_winout = lcd_stat.display_control_a & 0x6000;
-		bool enable = lcd_stat.bg_enable_a[bg_id];
+	u16 tile_id;
+	u8 pal_id;
+	u8 flip;
+	u8 slot;
 
-		for(u32 x = 0; x < 256; x++)
-		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_a[x];
+	bool* window_draw = window_mask[engine_id][bg_id];
+	bool enable = eng.bg_enable[bg_id];
+	bool use_ext_pal = ((*eng.ext_pal) & 0x1);
 
-			if(lcd_stat.window_status_a[x][win_id] && !lcd_stat.window_in_enable_a[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
+	u16 scanline_pixel_counter = 0;
+	u8 current_screen_line = (lcd_stat.current_scanline + eng.bg_offset_y[bg_id]);
 
-			if(can_winout && !lcd_stat.window_status_a[x][0] && !lcd_stat.window_status_a[x][1] && !lcd_stat.window_out_enable_a[bg_id][0]) { out_window = false; }
-			else { out_window = true; }
+	u8 current_screen_pixel = eng.bg_offset_x[bg_id];
+	u16 current_tile_line = (lcd_stat.current_scanline + eng.bg_offset_y[bg_id]) % 8;
 
-			window_draw[x] = (in_window & out_window); 
-		}
+	//Grab BG bit-depth and bytes per tile line
+	u8 bit_depth = eng.bg_depth[bg_id] ? 64 : 32;
+	u8 line_size = bit_depth >> 3;
 
-		u16 scanline_pixel_counter = 0;
-		u8 current_screen_line = (lcd_stat.current_scanline + lcd_stat.bg_offset_y_a[bg_id]);
+	//Get tile and map addresses
+	u8* vram = eng.bg_vram;
+	u32 tile_addr = eng.bg_base_tile_addr[bg_id];
+	u32 map_addr_base = eng.bg_base_map_addr[bg_id];
+	u32 map_addr = 0;
 
-		u8 current_screen_pixel = lcd_stat.bg_offset_x_a[bg_id];
-		u16 current_tile_line = (lcd_stat.current_scanline + lcd_stat.bg_offset_y_a[bg_id]) % 8;
+	//Determine meta Y-coordinate of rendered BG pixel
+	u16 meta_y = ((lcd_stat.current_scanline + eng.bg_offset_y[bg_id]) & eng.text_height[bg_id]);
 
-		//Grab BG bit-depth and offset for the current tile line
-		u8 bit_depth = lcd_stat.bg_depth_a[bg_id] ? 64 : 32;
-		u8 line_offset;
+	//Grab slot for extended palettes
+	if((eng.bg_control[bg_id] & 0x2000) && (bg_id < 2)) { slot = bg_id + 2; }
+	else { slot = bg_id; }
 
-		//Get tile and map addresses
-		u32 tile_addr = 0x6000000 + lcd_stat.bg_base_tile_addr_a[bg_id];
-		u32 map_addr_base = 0x6000000 + lcd_stat.bg_base_map_addr_a[bg_id];
-		u32 map_addr = 0;
+	//Decoded palette indices and colors for one tile line
+	u8 tile_pixels[8];
+	u32 tile_colors[8];
 
-		//Grab slot for extended palettes
-		if((lcd_stat.bg_control_a[bg_id] & 0x2000) && (bg_id < 2)) { slot = bg_id + 2; }
-		else { slot = bg_id; }
- 
-		//Cycle through all tiles on this scanline
-		for(u32 x = 0; x < 256;)
+	//Cycle through all tiles on this scanline
+	while(scanline_pixel_counter < 256)
+	{
+		//Determine meta x-coordinate of rendered BG pixel
+		u16 meta_x = ((scanline_pixel_counter + eng.bg_offset_x[bg_id]) & eng.text_width[bg_id]);
+
+		//Determine the address offset for the screen
+		switch(eng.bg_size[bg_id])
 		{
-			//Determine meta x-coordinate of rendered BG pixel
-			u16 meta_x = ((scanline_pixel_counter + lcd_stat.bg_offset_x_a[bg_id]) & lcd_stat.text_width_a[bg_id]);
+			//Size 0 - 256x256
+			case 0x0:
+				map_addr = map_addr_base;
+				break;
+
+			//Size 1 - 512x256
+			case 0x1: 
+				map_addr = map_addr_base + screen_offset_lut[meta_x];
+				break;
+
+			//Size 2 - 256x512
+			case 0x2:
+				map_addr = map_addr_base + screen_offset_lut[meta_y];
+				break;
+
+			//Size 3 - 512x512
+			case 0x3:
+				map_addr = screen_offset_lut[meta_x];
+				if(meta_y > 255) { map_addr |= 0x1000; }
+				map_addr += map_addr_base;
+				break;
+		}
+			
+		//Determine which map entry to start looking up tiles
+		u16 map_entry = ((current_screen_line >> 3) << 5);
+		map_entry += (current_screen_pixel >> 3);
+		map_addr += (map_entry << 1);
+
+		//Pull map data from current map entry
+		u16 map_data = (vram[map_addr + 1] << 8) | vram[map_addr];
 
-			//Determine meta Y-coordinate of rendered BG pixel
-			u16 meta_y = ((lcd_stat.current_scanline + lcd_stat.bg_offset_y_a[bg_id]) & lcd_stat.text_height_a[bg_id]);
+		//Get tile, palette number, and flipping parameters
+		tile_id = (map_data & 0x3FF);
+		pal_id = (map_data >> 12) & 0xF;
+		flip = (map_data >> 10) & 0x3;
 
-			//Determine the address offset for the screen
-			switch(lcd_stat.bg_size_a[bg_id])
+		//Calculate VRAM address of the current tile line
+		u8 tile_line = (flip & 0x2) ? inv_lut[current_tile_line] : current_tile_line;
+		u8* tile_data = vram + tile_addr + (tile_id * bit_depth) + (tile_line * line_size);
+
+		//Decode all 8 pixels of the tile line at once, accounting for horizontal flipping
+		//Process 8-bit depth
+		if(bit_depth == 64)
+		{
+			u32* pal = (use_ext_pal) ? &eng.bg_ext_pal[(slot << 12) + (pal_id << 8)] : eng.bg_pal;
+
+			for(u32 y = 0; y < 8; y++)
 			{
-				//Size 0 - 256x256
-				case 0x0:
-					map_addr = map_addr_base;
-					break;
+				tile_pixels[y] = (flip & 0x1) ? tile_data[7 - y] : tile_data[y];
+				tile_colors[y] = pal[tile_pixels[y]];
+			}
+		}
 
-				//Size 1 - 512x256
-				case 0x1: 
-					map_addr = map_addr_base + screen_offset_lut[meta_x];
-					break;
+		//Process 4-bit depth
+		else
+		{
+			u32* pal = &eng.bg_pal[pal_id << 4];
 
-				//Size 2 - 256x512
-				case 0x2:
-					map_addr = map_addr_base + screen_offset_lut[meta_y];
-					break;
+			for(u32 y = 0; y < 8; y++)
+			{
+				u8 src_x = (flip & 0x1) ? (7 - y) : y;
+				u8 raw_color = tile_data[src_x >> 1];
 
-				//Size 3 - 512x512
-				case 0x3:
-					map_addr = screen_offset_lut[meta_x];
-					if(meta_y > 255) { map_addr |= 0x1000; }
-					map_addr += map_addr_base;
-					break;
+				tile_pixels[y] = (src_x & 0x1) ? (raw_color >> 4) : (raw_color & 0xF);
+				tile_colors[y] = pal[tile_pixels[y]];
 			}
-				
-			//Determine which map entry to start looking up tiles
-			u16 map_entry = ((current_screen_line >> 3) << 5);
-			map_entry += (current_screen_pixel >> 3);
-
-			//Pull map data from current map entry
-			u16 map_data = mem->read_u16_fast(map_addr + (map_entry << 1));
-
-			//Get tile, palette number, and flipping parameters
-			tile_id = (map_data & 0x3FF);
-			pal_id = (map_data >> 12) & 0xF;
-			ext_pal_id = (slot << 12) + (pal_id << 8);
-			flip = (map_data >> 10) & 0x3;
-			pal_id <<= 4;
-
-			//Calculate VRAM address to start pulling up tile data
-			line_offset = (flip & 0x2) ? ((bit_depth >> 3) * inv_lut[current_tile_line]) : ((bit_depth >> 3) * current_tile_line);
-			u32 tile_data_addr = tile_addr + (tile_id * bit_depth) + line_offset;
-			if(flip & 0x1) { tile_data_addr += ((bit_depth >> 3) - 1); }
-
-			//Read 8 pixels from VRAM and put them in the scanline buffer
-			for(u32 y = tile_offset_x; y < 8; y++, x++)
+		}
+
+		//Put decoded pixels in the scanline buffer, a partially scrolled tile starts at its visible pixel
+		for(u32 y = tile_offset_x; y < 8; y++)
+		{
+			u8 raw_color = tile_pixels[y];
+
+			//Only draw if no previous pixel was rendered
+			if(!render_buffer[engine_id][scanline_pixel_counter] || (bg_priority < render_buffer[engine_id][scanline_pixel_counter]))
 			{
-				//Process 8-bit depth
-				if(bit_depth == 64)
+				//Only draw colors if not transparent
+				if(raw_color && window_draw[scanline_pixel_counter])
 				{
-					//Grab dot-data, account for horizontal flipping 
-					u8 raw_color = (flip & 0x1) ? mem->memory_map[tile_data_addr--] : mem->memory_map[tile_data_addr++];
+					scanline_buffer[engine_id][scanline_pixel_counter] = tile_colors[y];
+					render_buffer[engine_id][scanline_pixel_counter] = bg_priority;
+				}
 
-					//Only draw if no previous pixel was rendered
-					if(!render_buffer_a[scanline_pixel_counter] || (bg_priority < render_buffer_a[scanline_pixel_counter]))
-					{
-						//Only draw colors if not transparent
-						if(raw_color && window_draw[scanline_pixel_counter])
-						{
-							scanline_buffer_a[scanline_pixel_counter] = (lcd_stat.ext_pal_a & 0x1) ? lcd_stat.bg_ext_pal_a[ext_pal_id + raw_color]  : lcd_stat.bg_pal_a[raw_color];
-							render_buffer_a[scanline_pixel_counter] = bg_priority;
-						}
+				else { full_render = false; }
+			}
 
-						else { full_render = false; }
-					}
+			//Line buffer
+			line_buffer[bg_id][scanline_pixel_counter] = tile_colors[y];
+			if(raw_color && window_draw[scanline_pixel_counter] && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
 
-					//Line buffer
-					line_buffer[bg_id][scanline_pixel_counter] = (lcd_stat.ext_pal_a & 0x1) ? lcd_stat.bg_ext_pal_a[ext_pal_id + raw_color]  : lcd_stat.bg_pal_a[raw_color];
-					if(raw_color && window_draw[scanline_pixel_counter] && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
+			//Draw 256 pixels max
+			current_screen_pixel++;
+			if(++scanline_pixel_counter & 0x100) { break; }
+		}
 
-					//Draw 256 pixels max
-					scanline_pixel_counter++;
-					current_screen_pixel++;
-					if(scanline_pixel_counter & 0x100) { return; }
-				}
+		tile_offset_x = 0;
+	}
 
-				//Process 4-bit depth
-				else
-				{
-					//Grab dot-data, account for horizontal flipping 
-					u8 raw_color = (flip & 0x1) ? mem->memory_map[tile_data_addr--] : mem->memory_map[tile_data_addr++];
+	full_scanline_render[engine_id] = full_render;
+}
 
-					u8 pal_1 = (flip & 0x1) ? (pal_id + (raw_color >> 4)) : (pal_id + (raw_color & 0xF));
-					u8 pal_2 = (flip & 0x1) ? (pal_id + (raw_color & 0xF)) : (pal_id + (raw_color >> 4));
+/****** Render BG Mode Affine scanline ******/
+void NTR_LCD::render_bg_mode_affine(u32 bg_control)
+{
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[engine_id];
 
-					//Only draw if no previous pixel was rendered
-					if(!render_buffer_a[scanline_pixel_counter] || (bg_priority < render_buffer_a[scanline_pixel_counter]))
-					{
-						//Only draw colors if not transparent
-						if((raw_color & 0xF) && (window_draw[scanline_pixel_counter]))
-						{
-							scanline_buffer_a[scanline_pixel_counter] = lcd_stat.bg_pal_a[pal_1];
-							render_buffer_a[scanline_pixel_counter] = bg_priority;
-						}
+	//Grab BG ID and affine ID
+	u8 bg_id = (bg_control - eng.bg_cnt_base) >> 1;
+	u8 affine_id = (bg_id & 0x1);
+	u8 bg_priority = eng.bg_priority[bg_id] + 1;
 
-						else { full_render = false; }
-					}
+	//If this BG is used for SFX, make sure to render line buffer
+	bool force_render = ((eng.sfx_target[bg_id][0] || eng.sfx_target[bg_id][1]) && (eng.bg_enable[bg_id]));
 
-					//Line buffer
-					line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_a[pal_1];
-					if((raw_color & 0xF) && (window_draw[scanline_pixel_counter]) && (enable)) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
+	//Abort rendering if this BG is disabled
+	//Abort rendering if BGs with high priority have already completely rendered a scanline
+	if((!force_render) && (!eng.bg_enable[bg_id] || full_scanline_render[engine_id])) { return; }
 
-					//Draw 256 pixels max
-					if(++scanline_pixel_counter & 0x100) { return; }
+	bool full_render = true;
 
-					//Only draw if no previous pixel was rendered
-					if(!render_buffer_a[scanline_pixel_counter] || (bg_priority < render_buffer_a[scanline_pixel_counter]))
-					{
-						//Only draw colors if not transparent
-						if((raw_color >> 4) && (window_draw[scanline_pixel_counter]))
-						{
-							scanline_buffer_a[scanline_pixel_counter] = lcd_stat.bg_pal_a[pal_2];
-							render_buffer_a[scanline_pixel_counter] = bg_priority;
+	bool* window_draw = window_mask[engine_id][bg_id];
+	bool enable = eng.bg_enable[bg_id];
 
-						}
+	//Reload X-Y references at start of frame
+	if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
 
-						else { full_render = false; }
-					}
+	//Get BG size in tiles, pixels
+	//0 - 128x128, 1 - 256x256, 2 - 512x512, 3 - 1024x1024
+	u16 bg_tile_size = (16 << (eng.bg_control[bg_id] >> 14));
+	u16 bg_pixel_size = bg_tile_size << 3;
 
-					//Line buffer
-					line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_a[pal_2];
-					if((raw_color >> 4) && (window_draw[scanline_pixel_counter]) && (enable)) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
+	u16 scanline_pixel_counter = 0;
+	u16 src_x, src_y = 0;
+	double new_x, new_y = 0.0;
 
-					//Draw 256 pixels max
-					if(++scanline_pixel_counter & 0x100) { return; }
+	//Set current texture position at X and Y references
+	eng.bg_affine[affine_id].x_pos = eng.bg_affine[affine_id].x_ref - eng.bg_affine[affine_id].dx;
+	eng.bg_affine[affine_id].y_pos = eng.bg_affine[affine_id].y_ref - eng.bg_affine[affine_id].dy;
 
-					current_screen_pixel += 2;
-					y++;
-				}
-			}
+	//Get tile and map addresses
+	u32 tile_base = eng.bg_base_tile_addr[bg_id];
+	u32 map_base = eng.bg_base_map_addr[bg_id];
+	u8* vram = eng.bg_vram;
+ 
+	//Cycle through all tiles on this scanline
+	for(u32 x = 0; x < 256; x++, scanline_pixel_counter++)
+	{
+		bool render_pixel = true;
+		u8 raw_color = 0;
 
-			tile_offset_x = 0;
-		}
+		//Update texture position with DX and DY
+		eng.bg_affine[affine_id].x_pos += eng.bg_affine[affine_id].dx;
+		eng.bg_affine[affine_id].y_pos += eng.bg_affine[affine_id].dy;
 
-		full_scanline_render_a = full_render;
-	}
+		new_x = eng.bg_affine[affine_id].x_pos;
+		new_y = eng.bg_affine[affine_id].y_pos;
 
-	//Render Engine B
-	else
-	{
-		//Grab BG ID
-		u8 bg_id = (bg_control - 0x4001008) >> 1;
-		u8 bg_priority = lcd_stat.bg_priority_b[bg_id] + 1;
+		//Clip BG if coordinates overflow and overflow flag is not set
+		if(!eng.bg_affine[affine_id].overflow)
+		{
+			if((new_x >= bg_pixel_size) || (new_x < 0)) { render_pixel = false; }
+			if((new_y >= bg_pixel_size) || (new_y < 0)) { render_pixel = false; }
+		}
 
-		//If this BG is used for SFX, make sure to render line buffer
-		bool force_render = ((lcd_stat.sfx_target_b[bg_id][0] || lcd_stat.sfx_target_b[bg_id][1]) && (lcd_stat.bg_enable_b[bg_id]));
+		//Wrap BG if coordinates overflow and overflow flag is set
+		else 
+		{
+			while(new_x >= bg_pixel_size) { new_x -= bg_pixel_size; }
+			while(new_y >= bg_pixel_size) { new_y -= bg_pixel_size; }
+			while(new_x < 0) { new_x += bg_pixel_size; }
+			while(new_y < 0) { new_y += bg_pixel_size; } 
+		}
 
-		//Abort rendering if this BG is disabled
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if((!force_render) && (!lcd_stat.bg_enable_b[bg_id] || full_scanline_render_b)) { return; }
+		//Only draw if no previous pixel was rendered
+		if(!render_buffer[engine_id][scanline_pixel_counter] || (bg_priority < render_buffer[engine_id][scanline_pixel_counter]))
+		{
+			if(render_pixel)
+			{
+				//Determine source pixel X-Y coordinates
+				src_x = new_x; 
+				src_y = new_y;
 
-		bool full_render = true;
+				//Get current map entry for rendered pixel
+				u16 tile_number = ((src_y / 8) * bg_tile_size) + (src_x / 8);
 
-		//Grab tile offsets
-		u8 tile_offset_x = lcd_stat.bg_offset_x_b[bg_id] & 0x7;
+				//Look at the Tile Map #(tile_number), see what Tile # it points to
+				u8 map_entry = vram[map_base + tile_number];
 
-		u16 tile_id;
-		u16 ext_pal_id;
-		u8 pal_id;
-		u8 flip;
-		u8 slot;
+				//Get address of Tile #(map_entry)
+				u32 tile_addr = tile_base + (map_entry * 64);
 
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool window_draw[256];
-		bool can_winout = lcd_stat.display_control_b & 0x6000;
-		bool enable = lcd_stat.bg_enable_b[bg_id];
+				u8 current_tile_pixel = ((src_y % 8) * 8) + (src_x % 8);
 
-		for(u32 x = 0; x < 256; x++)
-		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_b[x];
+				//Grab the byte corresponding to (current_tile_pixel), render it as ARGB - 8-bit version
+				tile_addr += current_tile_pixel;
+				raw_color = vram[tile_addr];
 
-			if(lcd_stat.window_status_b[x][win_id] && !lcd_stat.window_in_enable_b[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
+				//Only draw BG color if not transparent
+				if(raw_color && window_draw[scanline_pixel_counter])
+				{
+					scanline_buffer[engine_id][scanline_pixel_counter] = eng.bg_pal[raw_color];
+					render_buffer[engine_id][scanline_pixel_counter] = bg_priority;
+				}
 
-			if(can_winout && !lcd_stat.window_status_b[x][0] && !lcd_stat.window_status_b[x][1] && !lcd_stat.window_out_enable_b[bg_id][0]) { out_window = false; }
-			else { out_window = true; }
+				else { full_render = false; }
+			}
 
-			window_draw[x] = (in_window & out_window); 
+			else { full_render = false; }
 		}
 
-		u16 scanline_pixel_counter = 0;
-		u8 current_screen_line = (lcd_stat.current_scanline + lcd_stat.bg_offset_y_b[bg_id]);
+		//Line buffer
+		line_buffer[bg_id][scanline_pixel_counter] = eng.bg_pal[raw_color];
+		if(raw_color && window_draw[scanline_pixel_counter] && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
+	}
 
-		u8 current_screen_pixel = lcd_stat.bg_offset_x_b[bg_id];
-		u16 current_tile_line = (lcd_stat.current_scanline + lcd_stat.bg_offset_y_b[bg_id]) % 8;
+	//Update XREF and YREF for next line
+	eng.bg_affine[affine_id].x_ref += eng.bg_affine[affine_id].dmx;
+	eng.bg_affine[affine_id].y_ref += eng.bg_affine[affine_id].dmy;
 
-		//Grab BG bit-depth and offset for the current tile line
-		u8 bit_depth = lcd_stat.bg_depth_b[bg_id] ? 64 : 32;
-		u8 line_offset;
+	full_scanline_render[engine_id] = full_render;
+}
 
-		//Get tile and map addresses
-		u32 tile_addr = 0x6200000 + lcd_stat.bg_base_tile_addr_b[bg_id];
-		u32 map_addr_base = 0x6200000 + lcd_stat.bg_base_map_addr_b[bg_id];
-		u32 map_addr = 0;
+/****** Render BG Mode Affine-Extended scanline ******/
+void NTR_LCD::render_bg_mode_affine_ext(u32 bg_control)
+{
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[engine_id];
 
-		//Grab slot for extended palettes
-		if((lcd_stat.bg_control_b[bg_id] & 0x2000) && (bg_id < 2)) { slot = bg_id + 2; }
-		else { slot = bg_id; }
+	//Grab BG ID and affine ID
+	u8 bg_id = (bg_control - eng.bg_cnt_base) >> 1;
+	u8 affine_id = (bg_id & 0x1);
+	u8 bg_priority = eng.bg_priority[bg_id] + 1;
 
-		//Cycle through all tiles on this scanline
-		for(u32 x = 0; x < 256;)
-		{
-			//Determine meta x-coordinate of rendered BG pixel
-			u16 meta_x = ((scanline_pixel_counter + lcd_stat.bg_offset_x_b[bg_id]) & lcd_stat.text_width_b[bg_id]);
+	//If this BG is used for SFX, make sure to render line buffer
+	bool force_render = ((eng.sfx_target[bg_id][0] || eng.sfx_target[bg_id][1]) && (eng.bg_enable[bg_id]));
 
-			//Determine meta Y-coordinate of rendered BG pixel
-			u16 meta_y = ((lcd_stat.current_scanline + lcd_stat.bg_offset_y_b[bg_id]) & lcd_stat.text_height_b[bg_id]);
+	//Abort rendering if this BG is disabled
+	//Abort rendering if BGs with high priority have already completely rendered a scanline
+	if((!force_render) && (!eng.bg_enable[bg_id] || full_scanline_render[engine_id])) { return; }
 
-			//Determine the address offset for the screen
-			switch(lcd_stat.bg_size_b[bg_id])
-			{
-				//Size 0 - 256x256
-				case 0x0:
-					map_addr = map_addr_base;
-					break;
+	bool full_render = true;
 
-				//Size 1 - 512x256
-				case 0x1: 
-					map_addr = map_addr_base + screen_offset_lut[meta_x];
-					break;
+	u8 pal_id;
+	u16 ext_pal_id;
+	bool* window_draw = window_mask[engine_id][bg_id];
+	bool enable = eng.bg_enable[bg_id];
+	u8 slot;
 
-				//Size 2 - 256x512
-				case 0x2:
-					map_addr = map_addr_base + screen_offset_lut[meta_y];
-					break;
-
-				//Size 3 - 512x512
-				case 0x3:
-					map_addr = screen_offset_lut[meta_x];
-					if(meta_y > 255) { map_addr |= 0x1000; }
-					map_addr += map_addr_base;
-					break;
-			}
-
-			//Determine which map entry to start looking up tiles
-			u16 map_entry = ((current_screen_line >> 3) << 5);
-			map_entry += (current_screen_pixel >> 3);
-
-			//Pull map data from current map entry
-			u16 map_data = mem->read_u16_fast(map_addr + (map_entry << 1));
-
-			//Get tile, palette number, and flipping parameters
-			tile_id = (map_data & 0x3FF);
-			pal_id = (map_data >> 12) & 0xF;
-			ext_pal_id = (slot << 12) + (pal_id << 8);
-			flip = (map_data >> 10) & 0x3;
-			pal_id <<= 4;
-
-			//Calculate VRAM address to start pulling up tile data
-			line_offset = (flip & 0x2) ? ((bit_depth >> 3) * inv_lut[current_tile_line]) : ((bit_depth >> 3) * current_tile_line);
-			u32 tile_data_addr = tile_addr + (tile_id * bit_depth) + line_offset;
-			if(flip & 0x1) { tile_data_addr += ((bit_depth >> 3) - 1); }
-
-			//Read 8 pixels from VRAM and put them in the scanline buffer
-			for(u32 y = tile_offset_x; y < 8; y++, x++)
-			{
-				//Process 8-bit depth
-				if(bit_depth == 64)
-				{
-					//Grab dot-data, account for horizontal flipping 
-					u8 raw_color = (flip & 0x1) ? mem->memory_map[tile_data_addr--] : mem->memory_map[tile_data_addr++];
-
-					//Only draw if no previous pixel was rendered
-					if(!render_buffer_b[scanline_pixel_counter] || (bg_priority < render_buffer_b[scanline_pixel_counter]))
-					{
-						//Only draw colors if not transparent
-						if(raw_color && window_draw[scanline_pixel_counter])
-						{
-							scanline_buffer_b[scanline_pixel_counter] = (lcd_stat.ext_pal_b & 0x1) ? lcd_stat.bg_ext_pal_b[ext_pal_id + raw_color]  : lcd_stat.bg_pal_b[raw_color];
-							render_buffer_b[scanline_pixel_counter] = bg_priority;
-						}
-
-						else { full_render = false; }
-					}
-
-					//Line buffer
-					line_buffer[bg_id][scanline_pixel_counter] = (lcd_stat.ext_pal_b & 0x1) ? lcd_stat.bg_ext_pal_b[ext_pal_id + raw_color]  : lcd_stat.bg_pal_b[raw_color];
-					if(raw_color && window_draw[scanline_pixel_counter] && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
-
-					//Draw 256 pixels max
-					scanline_pixel_counter++;
-					current_screen_pixel++;
-					if(scanline_pixel_counter & 0x100) { return; }
-				}
+	//Reload X-Y references at start of frame
+	if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
 
-				//Process 4-bit depth
-				else
-				{
-					//Grab dot-data, account for horizontal flipping 
-					u8 raw_color = (flip & 0x1) ? mem->memory_map[tile_data_addr--] : mem->memory_map[tile_data_addr++];
-
-					u8 pal_1 = (flip & 0x1) ? (pal_id + (raw_color >> 4)) : (pal_id + (raw_color & 0xF));
-					u8 pal_2 = (flip & 0x1) ? (pal_id + (raw_color & 0xF)) : (pal_id + (raw_color >> 4));
-
-					//Only draw if no previous pixel was rendered
-					if(!render_buffer_b[scanline_pixel_counter] || (bg_priority < render_buffer_b[scanline_pixel_counter]))
-					{
-						//Only draw colors if not transparent
-						if((raw_color & 0xF) && (window_draw[scanline_pixel_counter]))
-						{
-							scanline_buffer_b[scanline_pixel_counter] = lcd_stat.bg_pal_b[pal_1];
-							render_buffer_b[scanline_pixel_counter] = bg_priority;
-						}
-
-						else { full_render = false; }
-					}
-
-					//Line buffer
-					line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_b[pal_1];
-					if((raw_color & 0xF) && (window_draw[scanline_pixel_counter]) && (enable)) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
+	//Get BG size in tiles, pixels
+	//0 - 128x128, 1 - 256x256, 2 - 512x512, 3 - 1024x1024
+	u16 bg_tile_size = (16 << (eng.bg_control[bg_id] >> 14));
+	u16 bg_pixel_size = bg_tile_size << 3;
 
-					//Draw 256 pixels max
-					if(++scanline_pixel_counter & 0x100) { return; }
+	u8 scanline_pixel_counter = 0;
+	u16 src_x, src_y = 0;
+	double new_x, new_y = 0.0;
+	u8 flip = 0;
 
-					//Only draw if no previous pixel was rendered
-					if(!render_buffer_b[scanline_pixel_counter] || (bg_priority < render_buffer_b[scanline_pixel_counter]))
-					{
-						//Only draw colors if not transparent
-						if((raw_color >> 4) && (window_draw[scanline_pixel_counter]))
-						{
-							scanline_buffer_b[scanline_pixel_counter] = lcd_stat.bg_pal_b[pal_2];
-							render_buffer_b[scanline_pixel_counter] = bg_priority;
-						}
+	//Set current texture position at X and Y references
+	eng.bg_affine[affine_id].x_pos = eng.bg_affine[affine_id].x_ref - eng.bg_affine[affine_id].dx;
+	eng.bg_affine[affine_id].y_pos = eng.bg_affine[affine_id].y_ref - eng.bg_affine[affine_id].dy;
 
-						else { full_render = false; }
-					}
-
-					//Line buffer
-					line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_b[pal_2]; 
-					if((raw_color >> 4) && (window_draw[scanline_pixel_counter]) && (enable)) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
+	//Get tile and map addresses
+	u32 tile_base = eng.bg_base_tile_addr[bg_id];
+	u32 map_base = eng.bg_base_map_addr[bg_id];
+	u8* vram = eng.bg_vram;
 
-					//Draw 256 pixels max
-					if(++scanline_pixel_counter & 0x100) { return; }
-
-					current_screen_pixel += 2;
-					y++;
-				}
-			}
-
-			tile_offset_x = 0;
-		}
+	//Grab slot for extended palettes
+	if((eng.bg_control[bg_id] & 0x2000) && (bg_id < 2)) { slot = bg_id + 2; }
+	else { slot = bg_id; }
 
-		full_scanline_render_b = full_render;	
-	}
-}
-
-/****** Render BG Mode Affine scanline ******/
-void NTR_LCD::render_bg_mode_affine(u32 bg_control)
-{
-	//Render Engine A
-	if((bg_control & 0x1000) == 0)
+	//Cycle through all tiles on this scanline
+	for(u32 x = 0; x < 256; x++, scanline_pixel_counter++)
 	{
-		//Grab BG ID and affine ID
-		u8 bg_id = (bg_control - 0x4000008) >> 1;
-		u8 affine_id = (bg_id & 0x1);
-		u8 bg_priority = lcd_stat.bg_priority_a[bg_id] + 1;
-
-		//If this BG is used for SFX, make sure to render line buffer
-		bool force_render = ((lcd_stat.sfx_target_a[bg_id][0] || lcd_stat.sfx_target_a[bg_id][1]) && (lcd_stat.bg_enable_a[bg_id]));
-
-		//Abort rendering if this BG is disabled
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if((!force_render) && (!lcd_stat.bg_enable_a[bg_id] || full_scanline_render_a)) { return; }
-
-		bool full_render = true;
-
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool can_winout = lcd_stat.display_control_a & 0x6000;
-		bool enable = lcd_stat.bg_enable_a[bg_id];
-
-		//Reload X-Y references at start of frame
-		if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
-
-		//Get BG size in tiles, pixels
-		//0 - 128x128, 1 - 256x256, 2 - 512x512, 3 - 1024x1024
-		u16 bg_tile_size = (16 << (lcd_stat.bg_control_a[bg_id] >> 14));
-		u16 bg_pixel_size = bg_tile_size << 3;
-
-		u16 scanline_pixel_counter = 0;
-		u16 src_x, src_y = 0;
-		double new_x, new_y = 0.0;
-
-		//Set current texture position at X and Y references
-		lcd_stat.bg_affine_a[affine_id].x_pos = lcd_stat.bg_affine_a[affine_id].x_ref - lcd_stat.bg_affine_a[affine_id].dx;
-		lcd_stat.bg_affine_a[affine_id].y_pos = lcd_stat.bg_affine_a[affine_id].y_ref - lcd_stat.bg_affine_a[affine_id].dy;
-
-		//Get tile and map addresses
-		u32 tile_base = 0x6000000 + lcd_stat.bg_base_tile_addr_a[bg_id];
-		u32 map_base = 0x6000000 + lcd_stat.bg_base_map_addr_a[bg_id];
- 
-		//Cycle through all tiles on this scanline
-		for(u32 x = 0; x < 256; x++, scanline_pixel_counter++)
-		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_a[x];
-
-			if(lcd_stat.window_status_a[x][win_id] && !lcd_stat.window_in_enable_a[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
-
-			if(can_winout && !lcd_stat.window_status_a[x][0] && !lcd_stat.window_status_a[x][1] && !lcd_stat.window_out_enable_a[bg_id][0]) { out_window = false; }
-			else { out_window = true; } 
-
-			bool render_pixel = true;
-			u8 raw_color = 0;
-
-			//Update texture position with DX and DY
-			lcd_stat.bg_affine_a[affine_id].x_pos += lcd_stat.bg_affine_a[affine_id].dx;
-			lcd_stat.bg_affine_a[affine_id].y_pos += lcd_stat.bg_affine_a[affine_id].dy;
-
-			new_x = lcd_stat.bg_affine_a[affine_id].x_pos;
-			new_y = lcd_stat.bg_affine_a[affine_id].y_pos;
-
-			//Clip BG if coordinates overflow and overflow flag is not set
-			if(!lcd_stat.bg_affine_a[affine_id].overflow)
-			{
-				if((new_x >= bg_pixel_size) || (new_x < 0)) { render_pixel = false; }
-				if((new_y >= bg_pixel_size) || (new_y < 0)) { render_pixel = false; }
-			}
-
-			//Wrap BG if coordinates overflow and overflow flag is set
-			else 
-			{
-				while(new_x >= bg_pixel_size) { new_x -= bg_pixel_size; }
-				while(new_y >= bg_pixel_size) { new_y -= bg_pixel_size; }
-				while(new_x < 0) { new_x += bg_pixel_size; }
-				while(new_y < 0) { new_y += bg_pixel_size; } 
-			}
-
-			//Only draw if no previous pixel was rendered
-			if(!render_buffer_a[scanline_pixel_counter] || (bg_priority < render_buffer_a[scanline_pixel_counter]))
-			{
-				if(render_pixel)
-				{
-					//Determine source pixel X-Y coordinates
-					src_x = new_x; 
-					src_y = new_y;
-
-					//Get current map entry for rendered pixel
-					u16 tile_number = ((src_y / 8) * bg_tile_size) + (src_x / 8);
-
-					//Look at the Tile Map #(tile_number), see what Tile # it points to
-					u8 map_entry = mem->memory_map[map_base + tile_number];
-
-					//Get address of Tile #(map_entry)
-					u32 tile_addr = tile_base + (map_entry * 64);
-
-					u8 current_tile_pixel = ((src_y % 8) * 8) + (src_x % 8);
-
-					//Grab the byte corresponding to (current_tile_pixel), render it as ARGB - 8-bit version
-					tile_addr += current_tile_pixel;
-					raw_color = mem->memory_map[tile_addr];
-
-					//Only draw BG color if not transparent
-					if(raw_color && in_window && out_window)
-					{
-						scanline_buffer_a[scanline_pixel_counter] = lcd_stat.bg_pal_a[raw_color];
-						render_buffer_a[scanline_pixel_counter] = bg_priority;
-					}
-
-					else { full_render = false; }
-				}
-
-				else { full_render = false; }
-			}
-
-			//Line buffer
-			line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_a[raw_color];
-			if(raw_color && in_window && out_window && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
-		}
-
-		//Update XREF and YREF for next line
-		lcd_stat.bg_affine_a[affine_id].x_ref += lcd_stat.bg_affine_a[affine_id].dmx;
-		lcd_stat.bg_affine_a[affine_id].y_ref += lcd_stat.bg_affine_a[affine_id].dmy;
-
-		full_scanline_render_a = full_render;
-	}
-
-	//Render Engine B
-	else
-	{
-		//Grab BG ID and affine ID
-		u8 bg_id = (bg_control - 0x4001008) >> 1;
-		u8 affine_id = (bg_id & 0x1);
-		u8 bg_priority = lcd_stat.bg_priority_b[bg_id] + 1;
-
-		//If this BG is used for SFX, make sure to render line buffer
-		bool force_render = ((lcd_stat.sfx_target_b[bg_id][0] || lcd_stat.sfx_target_b[bg_id][1]) && (lcd_stat.bg_enable_b[bg_id]));
-
-		//Abort rendering if this BG is disabled
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if((!force_render) && (!lcd_stat.bg_enable_b[bg_id] || full_scanline_render_b)) { return; }
-
-		bool full_render = true;
-
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool can_winout = lcd_stat.display_control_b & 0x6000;
-		bool enable = lcd_stat.bg_enable_b[bg_id];
-
-		//Reload X-Y references at start of frame
-		if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
-
-		//Get BG size in tiles, pixels
-		//0 - 128x128, 1 - 256x256, 2 - 512x512, 3 - 1024x1024
-		u16 bg_tile_size = (16 << (lcd_stat.bg_control_b[bg_id] >> 14));
-		u16 bg_pixel_size = bg_tile_size << 3;
+		bool render_pixel = true;
+		u8 raw_color = 0;
 
-		u16 scanline_pixel_counter = 0;
-		u16 src_x, src_y = 0;
-		double new_x, new_y = 0.0;
+		//Update texture position with DX and DY
+		eng.bg_affine[affine_id].x_pos += eng.bg_affine[affine_id].dx;
+		eng.bg_affine[affine_id].y_pos += eng.bg_affine[affine_id].dy;
 
-		//Set current texture position at X and Y references
-		lcd_stat.bg_affine_b[affine_id].x_pos = lcd_stat.bg_affine_b[affine_id].x_ref - lcd_stat.bg_affine_b[affine_id].dx;
-		lcd_stat.bg_affine_b[affine_id].y_pos = lcd_stat.bg_affine_b[affine_id].y_ref - lcd_stat.bg_affine_b[affine_id].dy;
+		new_x = eng.bg_affine[affine_id].x_pos;
+		new_y = eng.bg_affine[affine_id].y_pos;
 
-		//Get tile and map addresses
-		u32 tile_base = 0x6200000 + lcd_stat.bg_base_tile_addr_b[bg_id];
-		u32 map_base = 0x6200000 + lcd_stat.bg_base_map_addr_b[bg_id];
- 
-		//Cycle through all tiles on this scanline
-		for(u32 x = 0; x < 256; x++, scanline_pixel_counter++)
+		//Clip BG if coordinates overflow and overflow flag is not set
+		if(!eng.bg_affine[affine_id].overflow)
 		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_b[x];
-
-			if(lcd_stat.window_status_b[x][win_id] && !lcd_stat.window_in_enable_b[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
-
-			if(can_winout && !lcd_stat.window_status_b[x][0] && !lcd_stat.window_status_b[x][1] && !lcd_stat.window_out_enable_b[bg_id][0]) { out_window = false; }
-			else { out_window = true; } 
-
-			bool render_pixel = true;
-			u8 raw_color = 0;
-
-			//Update texture position with DX and DY
-			lcd_stat.bg_affine_b[affine_id].x_pos += lcd_stat.bg_affine_b[affine_id].dx;
-			lcd_stat.bg_affine_b[affine_id].y_pos += lcd_stat.bg_affine_b[affine_id].dy;
-
-			new_x = lcd_stat.bg_affine_b[affine_id].x_pos;
-			new_y = lcd_stat.bg_affine_b[affine_id].y_pos;
-
-			//Clip BG if coordinates overflow and overflow flag is not set
-			if(!lcd_stat.bg_affine_b[affine_id].overflow)
-			{
-				if((new_x >= bg_pixel_size) || (new_x < 0)) { render_pixel = false; }
-				if((new_y >= bg_pixel_size) || (new_y < 0)) { render_pixel = false; }
-			}
-
-			//Wrap BG if coordinates overflow and overflow flag is set
-			else 
-			{
-				while(new_x >= bg_pixel_size) { new_x -= bg_pixel_size; }
-				while(new_y >= bg_pixel_size) { new_y -= bg_pixel_size; }
-				while(new_x < 0) { new_x += bg_pixel_size; }
-				while(new_y < 0) { new_y += bg_pixel_size; } 
-			}
-
-			//Only draw if no previous pixel was rendered
-			if(!render_buffer_b[scanline_pixel_counter] || (bg_priority < render_buffer_b[scanline_pixel_counter]))
-			{
-				if(render_pixel)
-				{
-					//Determine source pixel X-Y coordinates
-					src_x = new_x; 
-					src_y = new_y;
-
-					//Get current map entry for rendered pixel
-					u16 tile_number = ((src_y / 8) * bg_tile_size) + (src_x / 8);
-
-					//Look at the Tile Map #(tile_number), see what Tile # it points to
-					u8 map_entry = mem->memory_map[map_base + tile_number];
-
-					//Get address of Tile #(map_entry)
-					u32 tile_addr = tile_base + (map_entry * 64);
-
-					u8 current_tile_pixel = ((src_y % 8) * 8) + (src_x % 8);
-
-					//Grab the byte corresponding to (current_tile_pixel), render it as ARGB - 8-bit version
-					tile_addr += current_tile_pixel;
-					raw_color = mem->memory_map[tile_addr];
-
-					//Only draw BG color if not transparent
-					if(raw_color && in_window && out_window)
-					{
-						scanline_buffer_b[scanline_pixel_counter] = lcd_stat.bg_pal_b[raw_color];
-						render_buffer_b[scanline_pixel_counter] = bg_priority;
-					}
-
-					else { full_render = false; }
-				}
-
-				else { full_render = false; }
-			}
-
-			//Line buffer
-			line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_b[raw_color];
-			if(raw_color && in_window && out_window && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
+			if((new_x >= bg_pixel_size) || (new_x < 0)) { render_pixel = false; }
+			if((new_y >= bg_pixel_size) || (new_y < 0)) { render_pixel = false; }
 		}
 
-		//Update XREF and YREF for next line
-		lcd_stat.bg_affine_b[affine_id].x_ref += lcd_stat.bg_affine_b[affine_id].dmx;
-		lcd_stat.bg_affine_b[affine_id].y_ref += lcd_stat.bg_affine_b[affine_id].dmy;
-
-		full_scanline_render_b = full_render;
-	}
-}
-
-/****** Render BG Mode Affine-Extended scanline ******/
-void NTR_LCD::render_bg_mode_affine_ext(u32 bg_control)
-{
-	//Render Engine A
-	if((bg_control & 0x1000) == 0)
-	{
-		//Grab BG ID and affine ID
-		u8 bg_id = (bg_control - 0x4000008) >> 1;
-		u8 affine_id = (bg_id & 0x1);
-		u8 bg_priority = lcd_stat.bg_priority_a[bg_id] + 1;
-
-		//If this BG is used for SFX, make sure to render line buffer
-		bool force_render = ((lcd_stat.sfx_target_a[bg_id][0] || lcd_stat.sfx_target_a[bg_id][1]) && (lcd_stat.bg_enable_a[bg_id]));
-
-		//Abort rendering if this BG is disabled
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if((!force_render) && (!lcd_stat.bg_enable_a[bg_id] || full_scanline_render_a)) { return; }
-
-		bool full_render = true;
-
-		u8 pal_id;
-		u16 ext_pal_id;
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool can_winout = lcd_stat.display_control_a & 0x6000;
-		bool enable = lcd_stat.bg_enable_a[bg_id];
-		u8 slot;
-
-		//Reload X-Y references at start of frame
-		if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
-
-		//Get BG size in tiles, pixels
-		//0 - 128x128, 1 - 256x256, 2 - 512x512, 3 - 1024x1024
-		u16 bg_tile_size = (16 << (lcd_stat.bg_control_a[bg_id] >> 14));
-		u16 bg_pixel_size = bg_tile_size << 3;
-
-		u8 scanline_pixel_counter = 0;
-		u16 src_x, src_y = 0;
-		double new_x, new_y = 0.0;
-		u8 flip = 0;
-
-		//Set current texture position at X and Y references
-		lcd_stat.bg_affine_a[affine_id].x_pos = lcd_stat.bg_affine_a[affine_id].x_ref - lcd_stat.bg_affine_a[affine_id].dx;
-		lcd_stat.bg_affine_a[affine_id].y_pos = lcd_stat.bg_affine_a[affine_id].y_ref - lcd_stat.bg_affine_a[affine_id].dy;
-
-		//Get tile and map addresses
-		u32 tile_base = 0x6000000 + lcd_stat.bg_base_tile_addr_a[bg_id];
-		u32 map_base = 0x6000000 + lcd_stat.bg_base_map_addr_a[bg_id];
-
-		//Grab slot for extended palettes
-		if((lcd_stat.bg_control_a[bg_id] & 0x2000) && (bg_id < 2)) { slot = bg_id + 2; }
-		else { slot = bg_id; }
-
-		//Cycle through all tiles on this scanline
-		for(u32 x = 0; x < 256; x++, scanline_pixel_counter++)
+		//Wrap BG if coordinates overflow and overflow flag is set
+		else 
 		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_a[x];
-
-			if(lcd_stat.window_status_a[x][win_id] && !lcd_stat.window_in_enable_a[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
-
-			if(can_winout && !lcd_stat.window_status_a[x][0] && !lcd_stat.window_status_a[x][1] && !lcd_stat.window_out_enable_a[bg_id][0]) { out_window = false; }
-			else { out_window = true; } 
-
-			bool render_pixel = true;
-			u8 raw_color = 0;
-
-			//Update texture position with DX and DY
-			lcd_stat.bg_affine_a[affine_id].x_pos += lcd_stat.bg_affine_a[affine_id].dx;
-			lcd_stat.bg_affine_a[affine_id].y_pos += lcd_stat.bg_affine_a[affine_id].dy;
-
-			new_x = lcd_stat.bg_affine_a[affine_id].x_pos;
-			new_y = lcd_stat.bg_affine_a[affine_id].y_pos;
-
-			//Clip BG if coordinates overflow and overflow flag is not set
-			if(!lcd_stat.bg_affine_a[affine_id].overflow)
-			{
-				if((new_x >= bg_pixel_size) || (new_x < 0)) { render_pixel = false; }
-				if((new_y >= bg_pixel_size) || (new_y < 0)) { render_pixel = false; }
-			}
-
-			//Wrap BG if coordinates overflow and overflow flag is set
-			else 
-			{
-				while(new_x >= bg_pixel_size) { new_x -= bg_pixel_size; }
-				while(new_y >= bg_pixel_size) { new_y -= bg_pixel_size; }
-				while(new_x < 0) { new_x += bg_pixel_size; }
-				while(new_y < 0) { new_y += bg_pixel_size; } 
-			}
-
-			//Only draw if no previous pixel was rendered
-			if(!render_buffer_a[scanline_pixel_counter] || (bg_priority < render_buffer_a[scanline_pixel_counter]))
-			{
-				if(render_pixel)
-				{
-					//Determine source pixel X-Y coordinates
-					src_x = new_x; 
-					src_y = new_y;
-
-					//Get current map entry for rendered pixel
-					u16 tile_number = ((src_y / 8) * bg_tile_size) + (src_x / 8);
-
-					//Look at the Tile Map #(tile_number), see what Tile # it points to
-					u16 map_entry = mem->read_u16_fast(map_base + (tile_number << 1));
-
-					//Grab flipping attributes
-					flip = (map_entry >> 10) & 0x3;
-					src_x = (flip & 0x1) ? inv_lut[src_x % 8] : (src_x % 8);
-					src_y = (flip & 0x2) ? inv_lut[src_y % 8] : (src_y % 8);
-
-					//Grab palettes
-					pal_id = (map_entry >> 12) & 0xF;
-					ext_pal_id = (slot << 12) + (pal_id << 8);
-
-					//Get address of Tile #(map_entry)
-					u32 tile_addr = tile_base + ((map_entry & 0x3FF) * 64);
-
-					u8 current_tile_pixel = (src_y * 8) + src_x;
-
-					//Grab the byte corresponding to (current_tile_pixel), render it as ARGB - 8-bit version
-					tile_addr += current_tile_pixel;
-					raw_color = mem->memory_map[tile_addr];
-
-					//Only draw BG color if not transparent
-					if(raw_color && in_window && out_window)
-					{
-						scanline_buffer_a[scanline_pixel_counter] = (lcd_stat.ext_pal_a & 0x1) ? lcd_stat.bg_ext_pal_a[ext_pal_id + raw_color] : lcd_stat.bg_pal_a[raw_color];
-						render_buffer_a[scanline_pixel_counter] = bg_priority;
-					}
-
-					else { full_render = false; }
-				}
-
-				else { full_render = false; }	
-			}
-
-			//Line buffer
-			line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_a[raw_color];
-			if(raw_color && in_window && out_window && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
+			while(new_x >= bg_pixel_size) { new_x -= bg_pixel_size; }
+			while(new_y >= bg_pixel_size) { new_y -= bg_pixel_size; }
+			while(new_x < 0) { new_x += bg_pixel_size; }
+			while(new_y < 0) { new_y += bg_pixel_size; } 
 		}
 
-		//Update XREF and YREF for next line
-		lcd_stat.bg_affine_a[affine_id].x_ref += lcd_stat.bg_affine_a[affine_id].dmx;
-		lcd_stat.bg_affine_a[affine_id].y_ref += lcd_stat.bg_affine_a[affine_id].dmy;
-
-		full_scanline_render_a = full_render;
-	}
-
-	//Render Engine B
-	else
-	{
-		//Grab BG ID and affine ID
-		u8 bg_id = (bg_control - 0x4001008) >> 1;
-		u8 affine_id = (bg_id & 0x1);
-		u8 bg_priority = lcd_stat.bg_priority_b[bg_id] + 1;
-
-		//If this BG is used for SFX, make sure to render line buffer
-		bool force_render = ((lcd_stat.sfx_target_b[bg_id][0] || lcd_stat.sfx_target_b[bg_id][1]) && (lcd_stat.bg_enable_b[bg_id]));
-
-		//Abort rendering if this BG is disabled
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if((!force_render) && (!lcd_stat.bg_enable_b[bg_id] || full_scanline_render_b)) { return; }
-
-		bool full_render = true;
-
-		u8 pal_id;
-		u16 ext_pal_id;
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool can_winout = lcd_stat.display_control_b & 0x6000;
-		bool enable = lcd_stat.bg_enable_b[bg_id];
-		u8 slot;
-
-		//Reload X-Y references at start of frame
-		if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
-
-		//Get BG size in tiles, pixels
-		//0 - 128x128, 1 - 256x256, 2 - 512x512, 3 - 1024x1024
-		u16 bg_tile_size = (16 << (lcd_stat.bg_control_b[bg_id] >> 14));
-		u16 bg_pixel_size = bg_tile_size << 3;
-
-		u8 scanline_pixel_counter = 0;
-		u16 src_x, src_y = 0;
-		double new_x, new_y = 0.0;
-		u8 flip = 0;
-
-		//Set current texture position at X and Y references
-		lcd_stat.bg_affine_b[affine_id].x_pos = lcd_stat.bg_affine_b[affine_id].x_ref - lcd_stat.bg_affine_b[affine_id].dx;
-		lcd_stat.bg_affine_b[affine_id].y_pos = lcd_stat.bg_affine_b[affine_id].y_ref - lcd_stat.bg_affine_b[affine_id].dy;
-
-		//Get tile and map addresses
-		u32 tile_base = 0x6200000 + lcd_stat.bg_base_tile_addr_b[bg_id];
-		u32 map_base = 0x6200000 + lcd_stat.bg_base_map_addr_b[bg_id];
-
-		//Grab slot for extended palettes
-		if((lcd_stat.bg_control_a[bg_id] & 0x2000) && (bg_id < 2)) { slot = bg_id + 2; }
-		else { slot = bg_id; }
-
-		//Cycle through all tiles on this scanline
-		for(u32 x = 0; x < 256; x++, scanline_pixel_counter++)
+		//Only draw if no previous pixel was rendered
+		if(!render_buffer[engine_id][scanline_pixel_counter] || (bg_priority < render_buffer[engine_id][scanline_pixel_counter]))
 		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_b[x];
-
-			if(lcd_stat.window_status_b[x][win_id] && !lcd_stat.window_in_enable_b[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
-
-			if(can_winout && !lcd_stat.window_status_b[x][0] && !lcd_stat.window_status_b[x][1] && !lcd_stat.window_out_enable_b[bg_id][0]) { out_window = false; }
-			else { out_window = true; } 
-
-			bool render_pixel = true;
-			u8 raw_color = 0;
-
-			//Update texture position with DX and DY
-			lcd_stat.bg_affine_b[affine_id].x_pos += lcd_stat.bg_affine_b[affine_id].dx;
-			lcd_stat.bg_affine_b[affine_id].y_pos += lcd_stat.bg_affine_b[affine_id].dy;
-
-			new_x = lcd_stat.bg_affine_b[affine_id].x_pos;
-			new_y = lcd_stat.bg_affine_b[affine_id].y_pos;
-
-			//Clip BG if coordinates overflow and overflow flag is not set
-			if(!lcd_stat.bg_affine_b[affine_id].overflow)
-			{
-				if((new_x >= bg_pixel_size) || (new_x < 0)) { render_pixel = false; }
-				if((new_y >= bg_pixel_size) || (new_y < 0)) { render_pixel = false; }
-			}
-
-			//Wrap BG if coordinates overflow and overflow flag is set
-			else 
+			if(render_pixel)
 			{
-				while(new_x >= bg_pixel_size) { new_x -= bg_pixel_size; }
-				while(new_y >= bg_pixel_size) { new_y -= bg_pixel_size; }
-				while(new_x < 0) { new_x += bg_pixel_size; }
-				while(new_y < 0) { new_y += bg_pixel_size; } 
-			}
-
-			//Only draw if no previous pixel was rendered
-			if(!render_buffer_b[scanline_pixel_counter] || (bg_priority < render_buffer_b[scanline_pixel_counter]))
-			{
-				if(render_pixel)
-				{
-					//Determine source pixel X-Y coordinates
-					src_x = new_x; 
-					src_y = new_y;
-
-					//Get current map entry for rendered pixel
-					u16 tile_number = ((src_y / 8) * bg_tile_size) + (src_x / 8);
+				//Determine source pixel X-Y coordinates
+				src_x = new_x; 
+				src_y = new_y;
 
-					//Look at the Tile Map #(tile_number), see what Tile # it points to
-					u16 map_entry = mem->read_u16_fast(map_base + (tile_number << 1));
+				//Get current map entry for rendered pixel
+				u16 tile_number = ((src_y / 8) * bg_tile_size) + (src_x / 8);
 
-					//Grab flipping attributes
-					flip = (map_entry >> 10) & 0x3;
-					src_x = (flip & 0x1) ? inv_lut[src_x % 8] : (src_x % 8);
-					src_y = (flip & 0x2) ? inv_lut[src_y % 8] : (src_y % 8);
+				//Look at the Tile Map #(tile_number), see what Tile # it points to
+				u32 map_addr = map_base + (tile_number << 1);
+				u16 map_entry = (vram[map_addr + 1] << 8) | vram[map_addr];
 
-					//Grab palettes
-					pal_id = (map_entry >> 12) & 0xF;
-					ext_pal_id = (slot << 12) + (pal_id << 8);
-
-					//Get address of Tile #(map_entry)
-					u32 tile_addr = tile_base + ((map_entry & 0x3FF) * 64);
-
-					u8 current_tile_pixel = (src_y * 8) + src_x;
-
-					//Grab the byte corresponding to (current_tile_pixel), render it as ARGB - 8-bit version
-					tile_addr += current_tile_pixel;
-					raw_color = mem->memory_map[tile_addr];
-
-					//Only draw BG color if not transparent
-					if(raw_color && in_window && out_window)
-					{
-						scanline_buffer_b[scanline_pixel_counter] = (lcd_stat.ext_pal_b & 0x1) ? lcd_stat.bg_ext_pal_b[ext_pal_id + raw_color] : lcd_stat.bg_pal_b[raw_color];
-						render_buffer_b[scanline_pixel_counter] = bg_priority;
-					}
-
-					else { full_render = false; }
-				}
-
-				else { full_render = false; }	
-			}
-
-			//Line buffer
-			line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_b[raw_color];
-			if(raw_color && in_window && out_window && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
-		}
-
-		//Update XREF and YREF for next line
-		lcd_stat.bg_affine_b[affine_id].x_ref += lcd_stat.bg_affine_b[affine_id].dmx;
-		lcd_stat.bg_affine_b[affine_id].y_ref += lcd_stat.bg_affine_b[affine_id].dmy;
-
-		full_scanline_render_b = full_render;
-	}
-}
-
-/****** Render BG Mode 256-color scanline ******/
-void NTR_LCD::render_bg_mode_bitmap(u32 bg_control)
-{
-	//Render Engine A
-	if((bg_control & 0x1000) == 0)
-	{
-		//Grab BG ID
-		u8 bg_id = (bg_control - 0x4000008) >> 1;
-		u8 affine_id = (bg_id & 0x1);
-		u8 bg_priority = lcd_stat.bg_priority_a[bg_id] + 1;
+				//Grab flipping attributes
+				flip = (map_entry >> 10) & 0x3;
+				src_x = (flip & 0x1) ? inv_lut[src_x % 8] : (src_x % 8);
+				src_y = (flip & 0x2) ? inv_lut[src_y % 8] : (src_y % 8);
 
-		//If this BG is used for SFX, make sure to render line buffer
-		bool force_render = ((lcd_stat.sfx_target_a[bg_id][0] || lcd_stat.sfx_target_a[bg_id][1]) && (lcd_stat.bg_enable_a[bg_id]));
+				//Grab palettes
+				pal_id = (map_entry >> 12) & 0xF;
+				ext_pal_id = (slot << 12) + (pal_id << 8);
 
-		//Abort rendering if this BG is disabled
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if((!force_render) && (!lcd_stat.bg_enable_a[bg_id] || full_scanline_render_a)) { return; }
+				//Get address of Tile #(map_entry)
+				u32 tile_addr = tile_base + ((map_entry & 0x3FF) * 64);
 
-		bool full_render = true;
+				u8 current_tile_pixel = (src_y * 8) + src_x;
 
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool can_winout = lcd_stat.display_control_a & 0x6000;
-		bool enable = lcd_stat.bg_enable_a[bg_id];
+				//Grab the byte corresponding to (current_tile_pixel), render it as ARGB - 8-bit version
+				tile_addr += current_tile_pixel;
+				raw_color = vram[tile_addr];
 
-		//Reload X-Y references at start of frame
-		if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
-
-		u8 raw_color = 0;
-		u8 scanline_pixel_counter = 0;
-
-		u16 src_x, src_y = 0;
-		double new_x, new_y = 0.0;
-		u16 bg_pixel_width, bg_pixel_height = 0;
-
-		u32 bitmap_addr = lcd_stat.bg_bitmap_base_addr_a[bg_id & 0x1];
-
-		//Determine bitmap dimensions
-		switch(lcd_stat.bg_size_a[bg_id])
-		{
-			case 0x0:
-				bg_pixel_width = 128;
-				bg_pixel_height = 128;
-				break;
-
-			case 0x1:
-				bg_pixel_width = 256;
-				bg_pixel_height = 256;
-				break;
-
-			case 0x2:
-				bg_pixel_width = 512;
-				bg_pixel_height = 256;
-				break;
-
-			case 0x3:
-				bg_pixel_width = 512;
-				bg_pixel_height = 512;
-				break;
-		}
-
-		//Set current texture position at X and Y references
-		lcd_stat.bg_affine_a[affine_id].x_pos = lcd_stat.bg_affine_a[affine_id].x_ref;
-		lcd_stat.bg_affine_a[affine_id].y_pos = lcd_stat.bg_affine_a[affine_id].y_ref;
-		
-		for(int x = 0; x < 256; x++)
-		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_a[x];
-
-			if(lcd_stat.window_status_a[x][win_id] && !lcd_stat.window_in_enable_a[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
-
-			if(can_winout && !lcd_stat.window_status_a[x][0] && !lcd_stat.window_status_a[x][1] && !lcd_stat.window_out_enable_a[bg_id][0]) { out_window = false; }
-			else { out_window = true; } 
-
-			bool render_pixel = true;
-
-			new_x = lcd_stat.bg_affine_a[affine_id].x_pos;
-			new_y = lcd_stat.bg_affine_a[affine_id].y_pos;
-
-			//Clip BG if coordinates overflow and overflow flag is not set
-			if(!lcd_stat.bg_affine_a[affine_id].overflow)
-			{
-				if((new_x >= bg_pixel_width) || (new_x < 0)) { render_pixel = false; }
-				if((new_y >= bg_pixel_height) || (new_y < 0)) { render_pixel = false; }
-			}
-
-			//Wrap BG if coordinates overflow and overflow flag is set
-			else 
-			{
-				while(new_x >= bg_pixel_width) { new_x -= bg_pixel_width; }
-				while(new_y >= bg_pixel_height) { new_y -= bg_pixel_height; }
-				while(new_x < 0) { new_x += bg_pixel_width; }
-				while(new_y < 0) { new_y += bg_pixel_height; } 
-			}
-
-			//Only draw if no previous pixel was rendered
-			if(!render_buffer_a[scanline_pixel_counter] || (bg_priority < render_buffer_a[scanline_pixel_counter]))
-			{
-				if(render_pixel)
+				//Only draw BG color if not transparent
+				if(raw_color && window_draw[scanline_pixel_counter])
 				{
-					//Determine source pixel X-Y coordinates
-					src_x = new_x;
-					src_y = new_y;
-
-					raw_color = mem->memory_map[bitmap_addr + (src_y * bg_pixel_width) + src_x];
-			
-					if(raw_color && in_window && out_window)
-					{
-						scanline_buffer_a[scanline_pixel_counter] = lcd_stat.bg_pal_a[raw_color];
-						render_buffer_a[scanline_pixel_counter] = bg_priority;
-					}
-
-					else { full_render = false; }
+					scanline_buffer[engine_id][scanline_pixel_counter] = ((*eng.ext_pal) & 0x1) ? eng.bg_ext_pal[ext_pal_id + raw_color] : eng.bg_pal[raw_color];
+					render_buffer[engine_id][scanline_pixel_counter] = bg_priority;
 				}
 
 				else { full_render = false; }
 			}
 
-			//Line buffer
-			line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_a[raw_color];
-			if(raw_color && in_window && out_window && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
-
-			scanline_pixel_counter++;
-
-			//Update texture position with DX and DY
-			lcd_stat.bg_affine_a[affine_id].x_pos += lcd_stat.bg_affine_a[affine_id].dx;
-			lcd_stat.bg_affine_a[affine_id].y_pos += lcd_stat.bg_affine_a[affine_id].dy;
+			else { full_render = false; }	
 		}
 
-		//Update XREF and YREF for next line
-		lcd_stat.bg_affine_a[affine_id].x_ref += lcd_stat.bg_affine_a[affine_id].dmx;
-		lcd_stat.bg_affine_a[affine_id].y_ref += lcd_stat.bg_affine_a[affine_id].dmy;
-
-		full_scanline_render_a = full_render;
+		//Line buffer
+		line_buffer[bg_id][scanline_pixel_counter] = eng.bg_pal[raw_color];
+		if(raw_color && window_draw[scanline_pixel_counter] && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
 	}
 
-	//Render Engine B
-	else
-	{
-		//Grab BG ID
-		u8 bg_id = (bg_control - 0x4001008) >> 1;
-		u8 affine_id = (bg_id & 0x1);
-		u8 bg_priority = lcd_stat.bg_priority_b[bg_id] + 1;
-
-		//If this BG is used for SFX, make sure to render line buffer
-		bool force_render = ((lcd_stat.sfx_target_b[bg_id][0] || lcd_stat.sfx_target_b[bg_id][1]) && (lcd_stat.bg_enable_b[bg_id]));
-
-		//Abort rendering if this BG is disabled
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if((!force_render) && (!lcd_stat.bg_enable_b[bg_id] || full_scanline_render_b)) { return; }
-
-		bool full_render = true;
-
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool can_winout = lcd_stat.display_control_b & 0x6000;
-		bool enable = lcd_stat.bg_enable_b[bg_id];
-
-		//Reload X-Y references at start of frame
-		if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
-
-		u8 raw_color = 0;
-		u8 scanline_pixel_counter = 0;
-
-		u16 src_x, src_y = 0;
-		double new_x, new_y = 0.0;
-		u16 bg_pixel_width, bg_pixel_height = 0;
-
-		u32 bitmap_addr = lcd_stat.bg_bitmap_base_addr_b[bg_id & 0x1];
-
-		//Determine bitmap dimensions
-		switch(lcd_stat.bg_size_b[bg_id])
-		{
-			case 0x0:
-				bg_pixel_width = 128;
-				bg_pixel_height = 128;
-				break;
-
-			case 0x1:
-				bg_pixel_width = 256;
-				bg_pixel_height = 256;
-				break;
-
-			case 0x2:
-				bg_pixel_width = 512;
-				bg_pixel_height = 256;
-				break;
-
-			case 0x3:
-				bg_pixel_width = 512;
-				bg_pixel_height = 512;
-				break;
-		}
-
-		//Set current texture position at X and Y references
-		lcd_stat.bg_affine_b[affine_id].x_pos = lcd_stat.bg_affine_b[affine_id].x_ref;
-		lcd_stat.bg_affine_b[affine_id].y_pos = lcd_stat.bg_affine_b[affine_id].y_ref;
-		
-		for(int x = 0; x < 256; x++)
-		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_b[x];
-
-			if(lcd_stat.window_status_b[x][win_id] && !lcd_stat.window_in_enable_b[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
-
-			if(can_winout && !lcd_stat.window_status_b[x][0] && !lcd_stat.window_status_b[x][1] && !lcd_stat.window_out_enable_b[bg_id][0]) { out_window = false; }
-			else { out_window = true; } 
-
-			bool render_pixel = true;
-
-			new_x = lcd_stat.bg_affine_b[affine_id].x_pos;
-			new_y = lcd_stat.bg_affine_b[affine_id].y_pos;
-
-			//Clip BG if coordinates overflow and overflow flag is not set
-			if(!lcd_stat.bg_affine_b[affine_id].overflow)
-			{
-				if((new_x >= bg_pixel_width) || (new_x < 0)) { render_pixel = false; }
-				if((new_y >= bg_pixel_height) || (new_y < 0)) { render_pixel = false; }
-			}
-
-			//Wrap BG if coordinates overflow and overflow flag is set
-			else 
-			{
-				while(new_x >= bg_pixel_width) { new_x -= bg_pixel_width; }
-				while(new_y >= bg_pixel_height) { new_y -= bg_pixel_height; }
-				while(new_x < 0) { new_x += bg_pixel_width; }
-				while(new_y < 0) { new_y += bg_pixel_height; } 
-			}
-
-			//Only draw if no previous pixel was rendered
-			if(!render_buffer_b[scanline_pixel_counter] || (bg_priority < render_buffer_b[scanline_pixel_counter]))
-			{
-				if(render_pixel)
-				{
-					//Determine source pixel X-Y coordinates
-					src_x = new_x;
-					src_y = new_y;
-
-					raw_color = mem->memory_map[bitmap_addr + (src_y * bg_pixel_width) + src_x];
-			
-					if(raw_color && in_window && out_window)
-					{
-						scanline_buffer_b[scanline_pixel_counter] = lcd_stat.bg_pal_b[raw_color];
-						render_buffer_b[scanline_pixel_counter] = bg_priority;
-					}
-
-					else { full_render = false; }
-				}
-
-				else { full_render = false; }
-			}
-
-			//Line buffer
-			line_buffer[bg_id][scanline_pixel_counter] = lcd_stat.bg_pal_b[raw_color];
-			if(raw_color && in_window && out_window && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
-
-			scanline_pixel_counter++;
-
-			//Update texture position with DX and DY
-			lcd_stat.bg_affine_b[affine_id].x_pos += lcd_stat.bg_affine_b[affine_id].dx;
-			lcd_stat.bg_affine_b[affine_id].y_pos += lcd_stat.bg_affine_b[affine_id].dy;
-		}
-
-		//Update XREF and YREF for next line
-		lcd_stat.bg_affine_b[affine_id].x_ref += lcd_stat.bg_affine_b[affine_id].dmx;
-		lcd_stat.bg_affine_b[affine_id].y_ref += lcd_stat.bg_affine_b[affine_id].dmy;
+	//Update XREF and YREF for next line
+	eng.bg_affine[affine_id].x_ref += eng.bg_affine[affine_id].dmx;
+	eng.bg_affine[affine_id].y_ref += eng.bg_affine[affine_id].dmy;
 
-		full_scanline_render_b = full_render;
-	}
+	full_scanline_render[engine_id] = full_render;
 }
 
-/****** Render BG Mode direct color scanline ******/
-void NTR_LCD::render_bg_mode_direct(u32 bg_control)
+/****** Render BG Mode 256-color scanline ******/
+void NTR_LCD::render_bg_mode_bitmap(u32 bg_control)
 {
-	//Render Engine A
-	if((bg_control & 0x1000) == 0)
-	{
-		//Grab BG ID
-		u8 bg_id = (bg_control - 0x4000008) >> 1;
-		u8 affine_id = (bg_id & 0x1);
-		u8 bg_priority = lcd_stat.bg_priority_a[bg_id] + 1;
-
-		//Reload X-Y references at start of frame
-		if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
-
-		//Abort rendering if this bg is disabled
-		if(!lcd_stat.bg_enable_a[bg_id]) { return; }
-
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if(full_scanline_render_a) { return; }
-
-		bool full_render = true;
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[engine_id];
 
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool can_winout = lcd_stat.display_control_a & 0x6000;
-		bool enable = lcd_stat.bg_enable_a[bg_id];
+	//Grab BG ID
+	u8 bg_id = (bg_control - eng.bg_cnt_base) >> 1;
+	u8 affine_id = (bg_id & 0x1);
+	u8 bg_priority = eng.bg_priority[bg_id] + 1;
 
-		u16 raw_color = 0;
-		u8 scanline_pixel_counter = 0;
+	//If this BG is used for SFX, make sure to render line buffer
+	bool force_render = ((eng.sfx_target[bg_id][0] || eng.sfx_target[bg_id][1]) && (eng.bg_enable[bg_id]));
 
-		u16 src_x, src_y = 0;
-		double new_x, new_y = 0.0;
-		u16 bg_pixel_width, bg_pixel_height = 0;
+	//Abort rendering if this BG is disabled
+	//Abort rendering if BGs with high priority have already completely rendered a scanline
+	if((!force_render) && (!eng.bg_enable[bg_id] || full_scanline_render[engine_id])) { return; }
 
-		u32 bitmap_addr = lcd_stat.bg_bitmap_base_addr_a[bg_id & 0x1];
+	bool full_render = true;
 
-		//Determine bitmap dimensions
-		switch(lcd_stat.bg_size_a[bg_id])
-		{
-			case 0x0:
-				bg_pixel_width = 128;
-				bg_pixel_height = 128;
-				break;
-
-			case 0x1:
-				bg_pixel_width = 256;
-				bg_pixel_height = 256;
-				break;
+	bool* window_draw = window_mask[engine_id][bg_id];
+	bool enable = eng.bg_enable[bg_id];
 
-			case 0x2:
-				bg_pixel_width = 512;
-				bg_pixel_height = 256;
-				break;
-
-			case 0x3:
-				bg_pixel_width = 512;
-				bg_pixel_height = 512;
-				break;
-		}
-
-		//Set current texture position at X and Y references
-		lcd_stat.bg_affine_a[affine_id].x_pos = lcd_stat.bg_affine_a[affine_id].x_ref;
-		lcd_stat.bg_affine_a[affine_id].y_pos = lcd_stat.bg_affine_a[affine_id].y_ref;
-		
-		for(int x = 0; x < 256; x++)
-		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_a[x];
+	//Reload X-Y references at start of frame
+	if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
 
-			if(lcd_stat.window_status_a[x][win_id] && !lcd_stat.window_in_enable_a[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
+	u8 raw_color = 0;
+	u8 scanline_pixel_counter = 0;
 
-			if(can_winout && !lcd_stat.window_status_a[x][0] && !lcd_stat.window_status_a[x][1] && !lcd_stat.window_out_enable_a[bg_id][0]) { out_window = false; }
-			else { out_window = true; }
+	u16 src_x, src_y = 0;
+	double new_x, new_y = 0.0;
+	u16 bg_pixel_width, bg_pixel_height = 0;
 
-			bool render_pixel = true;
+	u32 bitmap_addr = eng.bg_bitmap_base_addr[bg_id & 0x1];
 
-			new_x = lcd_stat.bg_affine_a[affine_id].x_pos;
-			new_y = lcd_stat.bg_affine_a[affine_id].y_pos;
+	//Determine bitmap dimensions
+	switch(eng.bg_size[bg_id])
+	{
+		case 0x0:
+			bg_pixel_width = 128;
+			bg_pixel_height = 128;
+			break;
 
-			//Clip BG if coordinates overflow and overflow flag is not set
-			if(!lcd_stat.bg_affine_a[affine_id].overflow)
-			{
-				if((new_x >= bg_pixel_width) || (new_x < 0)) { render_pixel = false; }
-				if((new_y >= bg_pixel_height) || (new_y < 0)) { render_pixel = false; }
-			}
+		case 0x1:
+			bg_pixel_width = 256;
+			bg_pixel_height = 256;
+			break;
 
-			//Wrap BG if coordinates overflow and overflow flag is set
-			else 
-			{
-				while(new_x >= bg_pixel_width) { new_x -= bg_pixel_width; }
-				while(new_y >= bg_pixel_height) { new_y -= bg_pixel_height; }
-				while(new_x < 0) { new_x += bg_pixel_width; }
-				while(new_y < 0) { new_y += bg_pixel_height; } 
-			}
+		case 0x2:
+			bg_pixel_width = 512;
+			bg_pixel_height = 256;
+			break;
 
-			//Only draw if no previous pixel was rendered
-			if(!render_buffer_a[scanline_pixel_counter] || (bg_priority < render_buffer_a[scanline_pixel_counter]))
-			{
-				if(render_pixel)
-				{
-					//Determine source pixel X-Y coordinates
-					src_x = new_x;
-					src_y = new_y;
+		case 0x3:
+			bg_pixel_width = 512;
+			bg_pixel_height = 512;
+			break;
+	}
 
-					raw_color = mem->read_u16_fast(bitmap_addr + (((src_y * bg_pixel_width) + src_x) * 2));
-			
-					//Convert 16-bit ARGB to 32-bit ARGB - Bit 15 is alpha transparency
-					if(raw_color & 0x8000)
-					{
-						u8 red = ((raw_color & 0x1F) << 3);
-						raw_color >>= 5;
+	//Set current texture position at X and Y references
+	eng.bg_affine[affine_id].x_pos = eng.bg_affine[affine_id].x_ref;
+	eng.bg_affine[affine_id].y_pos = eng.bg_affine[affine_id].y_ref;
+	
+	for(int x = 0; x < 256; x++)
+	{
+		bool render_pixel = true;
 
-						u8 green = ((raw_color & 0x1F) << 3);
-						raw_color >>= 5;
+		new_x = eng.bg_affine[affine_id].x_pos;
+		new_y = eng.bg_affine[affine_id].y_pos;
 
-						u8 blue = ((raw_color & 0x1F) << 3);
+		//Clip BG if coordinates overflow and overflow flag is not set
+		if(!eng.bg_affine[affine_id].overflow)
+		{
+			if((new_x >= bg_pixel_width) || (new_x < 0)) { render_pixel = false; }
+			if((new_y >= bg_pixel_height) || (new_y < 0)) { render_pixel = false; }
+		}
 
-						scanline_buffer_a[scanline_pixel_counter] = 0xFF000000 | (red << 16) | (green << 8) | (blue);
-						render_buffer_a[scanline_pixel_counter] = bg_priority;
+		//Wrap BG if coordinates overflow and overflow flag is set
+		else 
+		{
+			while(new_x >= bg_pixel_width) { new_x -= bg_pixel_width; }
+			while(new_y >= bg_pixel_height) { new_y -= bg_pixel_height; }
+			while(new_x < 0) { new_x += bg_pixel_width; }
+			while(new_y < 0) { new_y += bg_pixel_height; } 
+		}
 
-						//Line buffer
-						line_buffer[bg_id][scanline_pixel_counter] = scanline_buffer_a[scanline_pixel_counter];
-						if(in_window && out_window && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
-					}
+		//Only draw if no previous pixel was rendered
+		if(!render_buffer[engine_id][scanline_pixel_counter] || (bg_priority < render_buffer[engine_id][scanline_pixel_counter]))
+		{
+			if(render_pixel)
+			{
+				//Determine source pixel X-Y coordinates
+				src_x = new_x;
+				src_y = new_y;
 
-					else { full_render = false; }
+				raw_color = mem->memory_map[bitmap_addr + (src_y * bg_pixel_width) + src_x];
+		
+				if(raw_color && window_draw[scanline_pixel_counter])
+				{
+					scanline_buffer[engine_id][scanline_pixel_counter] = eng.bg_pal[raw_color];
+					render_buffer[engine_id][scanline_pixel_counter] = bg_priority;
 				}
 
 				else { full_render = false; }
 			}
 
-			scanline_pixel_counter++;
-
-			//Update texture position with DX and DY
-			lcd_stat.bg_affine_a[affine_id].x_pos += lcd_stat.bg_affine_a[affine_id].dx;
-			lcd_stat.bg_affine_a[affine_id].y_pos += lcd_stat.bg_affine_a[affine_id].dy;
+			else { full_render = false; }
 		}
 
-		//Update XREF and YREF for next line
-		lcd_stat.bg_affine_a[affine_id].x_ref += lcd_stat.bg_affine_a[affine_id].dmx;
-		lcd_stat.bg_affine_a[affine_id].y_ref += lcd_stat.bg_affine_a[affine_id].dmy;
+		//Line buffer
+		line_buffer[bg_id][scanline_pixel_counter] = eng.bg_pal[raw_color];
+		if(raw_color && window_draw[scanline_pixel_counter] && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
+
+		scanline_pixel_counter++;
 
-		full_scanline_render_a = full_render;
+		//Update texture position with DX and DY
+		eng.bg_affine[affine_id].x_pos += eng.bg_affine[affine_id].dx;
+		eng.bg_affine[affine_id].y_pos += eng.bg_affine[affine_id].dy;
 	}
 
-	//Render Engine B
-	else
-	{
-		//Grab BG ID
-		u8 bg_id = (bg_control - 0x4001008) >> 1;
-		u8 affine_id = (bg_id & 0x1);
-		u8 bg_priority = lcd_stat.bg_priority_b[bg_id] + 1;
+	//Update XREF and YREF for next line
+	eng.bg_affine[affine_id].x_ref += eng.bg_affine[affine_id].dmx;
+	eng.bg_affine[affine_id].y_ref += eng.bg_affine[affine_id].dmy;
 
-		//Reload X-Y references at start of frame
-		if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
+	full_scanline_render[engine_id] = full_render;
+}
 
-		//Abort rendering if this bg is disabled
-		if(!lcd_stat.bg_enable_b[bg_id]) { return; }
+/****** Render BG Mode direct color scanline ******/
+void NTR_LCD::render_bg_mode_direct(u32 bg_control)
+{
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[engine_id];
 
-		//Abort rendering if BGs with high priority have already completely rendered a scanline
-		if(full_scanline_render_b) { return; }
+	//Grab BG ID
+	u8 bg_id = (bg_control - eng.bg_cnt_base) >> 1;
+	u8 affine_id = (bg_id & 0x1);
+	u8 bg_priority = eng.bg_priority[bg_id] + 1;
 
-		bool full_render = true;
+	//Reload X-Y references at start of frame
+	if(lcd_stat.current_scanline == 0) { reload_affine_references(bg_control); }
 
-		u8 win_id = 0;
-		bool in_window;
-		bool out_window;
-		bool can_winout = lcd_stat.display_control_b & 0x6000;
-		bool enable = lcd_stat.bg_enable_b[bg_id];
+	//Abort rendering if this bg is disabled
+	if(!eng.bg_enable[bg_id]) { return; }
 
-		u16 raw_color = 0;
-		u8 scanline_pixel_counter = 0;
+	//Abort rendering if BGs with high priority have already completely rendered a scanline
+	if(full_scanline_render[engine_id]) { return; }
 
-		u16 src_x, src_y = 0;
-		double new_x, new_y = 0.0;
-		u16 bg_pixel_width, bg_pixel_height = 0;
+	bool full_render = true;
 
-		u32 bitmap_addr = lcd_stat.bg_bitmap_base_addr_b[bg_id & 0x1];
+	bool* window_draw = window_mask[engine_id][bg_id];
+	bool enable = eng.bg_enable[bg_id];
 
-		//Determine bitmap dimensions
-		switch(lcd_stat.bg_size_b[bg_id])
-		{
-			case 0x0:
-				bg_pixel_width = 128;
-				bg_pixel_height = 128;
-				break;
+	u16 raw_color = 0;
+	u8 scanline_pixel_counter = 0;
 
-			case 0x1:
-				bg_pixel_width = 256;
-				bg_pixel_height = 256;
-				break;
+	u16 src_x, src_y = 0;
+	double new_x, new_y = 0.0;
+	u16 bg_pixel_width, bg_pixel_height = 0;
 
-			case 0x2:
-				bg_pixel_width = 512;
-				bg_pixel_height = 256;
-				break;
+	u32 bitmap_addr = eng.bg_bitmap_base_addr[bg_id & 0x1];
 
-			case 0x3:
-				bg_pixel_width = 512;
-				bg_pixel_height = 512;
-				break;
-		}
+	//Determine bitmap dimensions
+	switch(eng.bg_size[bg_id])
+	{
+		case 0x0:
+			bg_pixel_width = 128;
+			bg_pixel_height = 128;
+			break;
 
-		//Set current texture position at X and Y references
-		lcd_stat.bg_affine_b[affine_id].x_pos = lcd_stat.bg_affine_b[affine_id].x_ref;
-		lcd_stat.bg_affine_b[affine_id].y_pos = lcd_stat.bg_affine_b[affine_id].y_ref;
-		
-		for(int x = 0; x < 256; x++)
-		{
-			//Determine if pixel can be drawn inside or outside an active window
-			win_id = lcd_stat.window_id_b[x];
+		case 0x1:
+			bg_pixel_width = 256;
+			bg_pixel_height = 256;
+			break;
+
+		case 0x2:
+			bg_pixel_width = 512;
+			bg_pixel_height = 256;
+			break;
 
-			if(lcd_stat.window_status_b[x][win_id] && !lcd_stat.window_in_enable_b[bg_id][win_id]) { in_window = false; }
-			else { in_window = true; }
+		case 0x3:
+			bg_pixel_width = 512;
+			bg_pixel_height = 512;
+			break;
+	}
 
-			if(can_winout && !lcd_stat.window_status_b[x][0] && !lcd_stat.window_status_b[x][1] && !lcd_stat.window_out_enable_b[bg_id][0]) { out_window = false; }
-			else { out_window = true; } 
+	//Set current texture position at X and Y references
+	eng.bg_affine[affine_id].x_pos = eng.bg_affine[affine_id].x_ref;
+	eng.bg_affine[affine_id].y_pos = eng.bg_affine[affine_id].y_ref;
+	
+	for(int x = 0; x < 256; x++)
+	{
+		bool render_pixel = true;
 
-			bool render_pixel = true;
+		new_x = eng.bg_affine[affine_id].x_pos;
+		new_y = eng.bg_affine[affine_id].y_pos;
 
-			new_x = lcd_stat.bg_affine_b[affine_id].x_pos;
-			new_y = lcd_stat.bg_affine_b[affine_id].y_pos;
+		//Clip BG if coordinates overflow and overflow flag is not set
+		if(!eng.bg_affine[affine_id].overflow)
+		{
+			if((new_x >= bg_pixel_width) || (new_x < 0)) { render_pixel = false; }
+			if((new_y >= bg_pixel_height) || (new_y < 0)) { render_pixel = false; }
+		}
 
-			//Clip BG if coordinates overflow and overflow flag is not set
-			if(!lcd_stat.bg_affine_b[affine_id].overflow)
-			{
-				if((new_x >= bg_pixel_width) || (new_x < 0)) { render_pixel = false; }
-				if((new_y >= bg_pixel_height) || (new_y < 0)) { render_pixel = false; }
-			}
+		//Wrap BG if coordinates overflow and overflow flag is set
+		else 
+		{
+			while(new_x >= bg_pixel_width) { new_x -= bg_pixel_width; }
+			while(new_y >= bg_pixel_height) { new_y -= bg_pixel_height; }
+			while(new_x < 0) { new_x += bg_pixel_width; }
+			while(new_y < 0) { new_y += bg_pixel_height; } 
+		}
 
-			//Wrap BG if coordinates overflow and overflow flag is set
-			else 
+		//Only draw if no previous pixel was rendered
+		if(!render_buffer[engine_id][scanline_pixel_counter] || (bg_priority < render_buffer[engine_id][scanline_pixel_counter]))
+		{
+			if(render_pixel)
 			{
-				while(new_x >= bg_pixel_width) { new_x -= bg_pixel_width; }
-				while(new_y >= bg_pixel_height) { new_y -= bg_pixel_height; }
-				while(new_x < 0) { new_x += bg_pixel_width; }
-				while(new_y < 0) { new_y += bg_pixel_height; } 
-			}
+				//Determine source pixel X-Y coordinates
+				src_x = new_x;
+				src_y = new_y;
 
-			//Only draw if no previous pixel was rendered
-			if(!render_buffer_b[scanline_pixel_counter] || (bg_priority < render_buffer_b[scanline_pixel_counter]))
-			{
-				if(render_pixel)
+				raw_color = mem->read_u16_fast(bitmap_addr + (((src_y * bg_pixel_width) + src_x) * 2));
+		
+				//Convert 16-bit ARGB to 32-bit ARGB - Bit 15 is alpha transparency
+				if(raw_color & 0x8000)
 				{
-					//Determine source pixel X-Y coordinates
-					src_x = new_x;
-					src_y = new_y;
-
-					raw_color = mem->read_u16_fast(bitmap_addr + (((src_y * bg_pixel_width) + src_x) * 2));
-			
-					//Convert 16-bit ARGB to 32-bit ARGB - Bit 15 is alpha transparency
-					if(raw_color & 0x8000)
-					{
-						u8 red = ((raw_color & 0x1F) << 3);
-						raw_color >>= 5;
-
-						u8 green = ((raw_color & 0x1F) << 3);
-						raw_color >>= 5;
+					u8 red = ((raw_color & 0x1F) << 3);
+					raw_color >>= 5;
 
-						u8 blue = ((raw_color & 0x1F) << 3);
+					u8 green = ((raw_color & 0x1F) << 3);
+					raw_color >>= 5;
 
-						scanline_buffer_b[scanline_pixel_counter] = 0xFF000000 | (red << 16) | (green << 8) | (blue);
-						render_buffer_b[scanline_pixel_counter] = bg_priority;
+					u8 blue = ((raw_color & 0x1F) << 3);
 
-						//Line buffer
-						line_buffer[bg_id][scanline_pixel_counter] = scanline_buffer_b[scanline_pixel_counter];
-						if(in_window && out_window && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
-					}
+					scanline_buffer[engine_id][scanline_pixel_counter] = 0xFF000000 | (red << 16) | (green << 8) | (blue);
+					render_buffer[engine_id][scanline_pixel_counter] = bg_priority;
 
-					else { full_render = false; }
+					//Line buffer
+					line_buffer[bg_id][scanline_pixel_counter] = scanline_buffer[engine_id][scanline_pixel_counter];
+					if(window_draw[scanline_pixel_counter] && enable) { line_buffer[bg_id + 4][scanline_pixel_counter] |= 1; }
 				}
 
 				else { full_render = false; }
 			}
 
-			scanline_pixel_counter++;
-
-			//Update texture position with DX and DY
-			lcd_stat.bg_affine_b[affine_id].x_pos += lcd_stat.bg_affine_b[affine_id].dx;
-			lcd_stat.bg_affine_b[affine_id].y_pos += lcd_stat.bg_affine_b[affine_id].dy;
+			else { full_render = false; }
 		}
 
-		//Update XREF and YREF for next line
-		lcd_stat.bg_affine_b[affine_id].x_ref += lcd_stat.bg_affine_b[affine_id].dmx;
-		lcd_stat.bg_affine_b[affine_id].y_ref += lcd_stat.bg_affine_b[affine_id].dmy;
+		scanline_pixel_counter++;
 
-		full_scanline_render_b = full_render;
+		//Update texture position with DX and DY
+		eng.bg_affine[affine_id].x_pos += eng.bg_affine[affine_id].dx;
+		eng.bg_affine[affine_id].y_pos += eng.bg_affine[affine_id].dy;
 	}
+
+	//Update XREF and YREF for next line
+	eng.bg_affine[affine_id].x_ref += eng.bg_affine[affine_id].dmx;
+	eng.bg_affine[affine_id].y_ref += eng.bg_affine[affine_id].dmy;
+
+	full_scanline_render[engine_id] = full_render;
 }
 
 /****** Render pixels for a given scanline (per-pixel) ******/
 void NTR_LCD::render_scanline()
 {
-	//Engine A - Render based on display modes
-	switch(lcd_stat.display_mode_a)
+	//Window status is shared by both engines, so calculate it before either engine starts
+	if((lcd_stat.display_mode_a == 0x1) || (lcd_stat.display_mode_b == 0x1)) { calculate_window_on_scanline(); }
+
+	//Render Engine B on the worker thread while Engine A renders here
+	//Emulation waits for both engines, so neither sees registers or VRAM change mid-line
+	//Spin-waiting only pays off when the worker has a CPU of its own
+	if((config::nds_threaded_2d) && (line_worker::has_spare_core()))
+	{
+		if(!engine_b_worker.is_running()) { engine_b_worker.start([this]{ render_engine(1); }); }
+
+		engine_b_worker.post();
+		render_engine(0);
+		engine_b_worker.wait();
+	}
+
+	else
+	{
+		render_engine(0);
+		render_engine(1);
+	}
+}
+
+/****** Render pixels for Engine A (0) or Engine B (1) on a given scanline ******/
+void NTR_LCD::render_engine(u8 engine_id)
+{
+	engine_2d &eng = engine[engine_id];
+
+	//Render based on display modes
+	switch(*eng.display_mode)
 	{
 		//Display Mode 0 - Blank screen
 		case 0x0:
@@ -3247,19 +2302,25 @@ void NTR_LCD::render_scanline()
 		//Forced Blank
 		case 0x80:
 		case 0x81:
+			for(u16 x = 0; x < 256; x++) { scanline_buffer[engine_id][x] = 0xFFFFFFFF; }
+			break;
+
+		//Forced Blank - Engine A only
 		case 0x82:
-			for(u16 x = 0; x < 256; x++) { scanline_buffer_a[x] = 0xFFFFFFFF; }
+			if(engine_id) { std::cout<<"LCD::Warning - Engine B - Unsupported Display Mode " << std::dec << (int)(*eng.display_mode) << "\n"; }
+			else { for(u16 x = 0; x < 256; x++) { scanline_buffer[engine_id][x] = 0xFFFFFFFF; } }
 			break;
 
 		//Display Mode 1 - Tiled BG and OBJ
 		case 0x1:
-			render_bg_scanline(NDS_DISPCNT_A);
+			render_bg_scanline((engine_id) ? NDS_DISPCNT_B : NDS_DISPCNT_A);
 			break;
 
-		//Display Mode 2 - VRAM
+		//Display Mode 2 - VRAM - Engine A only
 		case 0x2:
+			if(!engine_id)
 			{
-				u8 vram_block = ((lcd_stat.display_control_a >> 18) & 0x3);
+				u8 vram_block = (((*eng.display_control) >> 18) & 0x3);
 				u32 vram_addr = lcd_stat.vram_bank_addr[vram_block] + (lcd_stat.current_scanline * 256 * 2);
 
 				for(u16 x = 0; x < 256; x++)
@@ -3274,40 +2335,22 @@ void NTR_LCD::render_scanline()
 
 					u8 blue = ((color_bytes & 0x1F) << 3);
 
-					scanline_buffer_a[x] = 0xFF000000 | (red << 16) | (green << 8) | (blue);
+					scanline_buffer[engine_id][x] = 0xFF000000 | (red << 16) | (green << 8) | (blue);
 				}
-			}
 
-			break;
+				break;
+			}
 
 		//Display Mode 3 - Main Memory
+		//Modes 2 and 3 unsupported by Engine B
 		default:
-			std::cout<<"LCD::Warning - Engine A - Unsupported Display Mode 3 \n";
+			if(engine_id) { std::cout<<"LCD::Warning - Engine B - Unsupported Display Mode " << std::dec << (int)(*eng.display_mode) << "\n"; }
+			else { std::cout<<"LCD::Warning - Engine A - Unsupported Display Mode 3 \n"; }
 			break;
 	}
 
-	//Engine B - Render based on display modes
-	switch(lcd_stat.display_mode_b)
-	{
-		//Display Mode 0 - Blank screen
-		case 0x0:
-
-		//Forced Blank
-		case 0x80:
-		case 0x81:
-			for(u16 x = 0; x < 256; x++) { scanline_buffer_b[x] = 0xFFFFFFFF; }
-			break;
-
-		//Display Mode 1 - Tiled BG and OBJ
-		case 0x1:
-			render_bg_scanline(NDS_DISPCNT_B);
-			break;
-
-		//Modes 2 and 3 unsupported by Engine B
-		default:
-			std::cout<<"LCD::Warning - Engine B - Unsupported Display Mode " << std::dec << (int)lcd_stat.display_mode_b << "\n";
-			break;
-	}		
+	//Apply Master Brightness if necessary
+	if((*eng.master_bright) & 0xC000) { adjust_master_brightness(engine_id); }
 }
 
 /****** Apply SFX to scanline pixels ******/
@@ -3315,7 +2358,7 @@ void NTR_LCD::apply_sfx(u32 bg_control)
 {
 	//TODO - Determine is SFX can be applied here based on various other conditions
 
-	nds_sfx_types temp_type = (bg_control == NDS_DISPCNT_A) ? lcd_stat.current_sfx_type_a : lcd_stat.current_sfx_type_b;
+	nds_sfx_types temp_type = *engine[(bg_control & 0x1000) ? 1 : 0].current_sfx_type;
 
 	//Apply the specified SFX
 	switch(temp_type)
@@ -3337,15 +2380,21 @@ void NTR_LCD::apply_sfx(u32 bg_control)
 /****** SFX - Adjust scanline brightness up ******/
 void NTR_LCD::brightness_up(u32 bg_control)
 {
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[engine_id];
+	std::vector< std::vector<u32> > &obj_line_buffer = obj_line_buffers[engine_id];
+
 	u8 bg_render_list[4];
 	u8 bg_layer[4];
 
-	u8 bg_priority_0 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[0] : lcd_stat.bg_priority_b[0];
-	u8 bg_priority_1 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[1] : lcd_stat.bg_priority_b[1];
-	u8 bg_priority_2 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[2] : lcd_stat.bg_priority_b[2];
-	u8 bg_priority_3 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[3] : lcd_stat.bg_priority_b[3];
+	u8 bg_priority_0 = eng.bg_priority[0];
+	u8 bg_priority_1 = eng.bg_priority[1];
+	u8 bg_priority_2 = eng.bg_priority[2];
+	u8 bg_priority_3 = eng.bg_priority[3];
 
-	double coef = (bg_control == NDS_DISPCNT_A) ? lcd_stat.brightness_coef_a : lcd_stat.brightness_coef_b;
+	double coef = (*eng.brightness_coef);
 
 	//Determine BG priority
 	for(int x = 0, list_length = 0; x < 4; x++)
@@ -3423,7 +2472,7 @@ void NTR_LCD::brightness_up(u32 bg_control)
 		if(!found_target) { target = 5; }
 
 		//Check to see if target is enabled
-		target_enable = (bg_control == NDS_DISPCNT_A) ? lcd_stat.sfx_target_a[target][0] : lcd_stat.sfx_target_b[target][0];
+		target_enable = eng.sfx_target[target][0];
 
 		//Proceed with SFX
 		if(target_enable)
@@ -3432,7 +2481,7 @@ void NTR_LCD::brightness_up(u32 bg_control)
 			s16 result = 0;
 
 			//Pull color from backdrop
-			if(target == 5) { color = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_pal_a[0] : lcd_stat.bg_pal_b[0]; }
+			if(target == 5) { color = eng.bg_pal[0]; }
 
 			//Pull color from layers
 			else { color = (is_obj) ? obj_line_buffer[layer][x] : line_buffer[layer][x]; }
@@ -3451,8 +2500,7 @@ void NTR_LCD::brightness_up(u32 bg_control)
 			blue = (result > 0x1F) ? 0x1F : result;
 
 			//Copy 32-bit color to scanline buffer
-			if(bg_control == NDS_DISPCNT_A) { scanline_buffer_a[x] = 0xFF000000 | (red << 19) | (green << 11) | (blue << 3); }
-			else { scanline_buffer_b[x] = 0xFF000000 | (red << 19) | (green << 11) | (blue << 3); }
+			scanline_buffer[engine_id][x] = 0xFF000000 | (red << 19) | (green << 11) | (blue << 3);
 		}
 	}
 }
@@ -3460,15 +2508,21 @@ void NTR_LCD::brightness_up(u32 bg_control)
 /****** SFX - Adjust scanline brightness down ******/
 void NTR_LCD::brightness_down(u32 bg_control)
 {
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[engine_id];
+	std::vector< std::vector<u32> > &obj_line_buffer = obj_line_buffers[engine_id];
+
 	u8 bg_render_list[4];
 	u8 bg_layer[4];
 
-	u8 bg_priority_0 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[0] : lcd_stat.bg_priority_b[0];
-	u8 bg_priority_1 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[1] : lcd_stat.bg_priority_b[1];
-	u8 bg_priority_2 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[2] : lcd_stat.bg_priority_b[2];
-	u8 bg_priority_3 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[3] : lcd_stat.bg_priority_b[3];
+	u8 bg_priority_0 = eng.bg_priority[0];
+	u8 bg_priority_1 = eng.bg_priority[1];
+	u8 bg_priority_2 = eng.bg_priority[2];
+	u8 bg_priority_3 = eng.bg_priority[3];
 
-	double coef = (bg_control == NDS_DISPCNT_A) ? lcd_stat.brightness_coef_a : lcd_stat.brightness_coef_b;
+	double coef = (*eng.brightness_coef);
 
 	//Determine BG priority
 	for(int x = 0, list_length = 0; x < 4; x++)
@@ -3546,7 +2600,7 @@ void NTR_LCD::brightness_down(u32 bg_control)
 		if(!found_target) { target = 5; }
 
 		//Check to see if target is enabled
-		target_enable = (bg_control == NDS_DISPCNT_A) ? lcd_stat.sfx_target_a[target][0] : lcd_stat.sfx_target_b[target][0];
+		target_enable = eng.sfx_target[target][0];
 
 		//Proceed with SFX
 		if(target_enable)
@@ -3555,7 +2609,7 @@ void NTR_LCD::brightness_down(u32 bg_control)
 			s16 result = 0;
 
 			//Pull color from backdrop
-			if(target == 5) { color = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_pal_a[0] : lcd_stat.bg_pal_b[0]; }
+			if(target == 5) { color = eng.bg_pal[0]; }
 
 			//Pull color from layers
 			else { color = (is_obj) ? obj_line_buffer[layer][x] : line_buffer[layer][x]; }
@@ -3574,8 +2628,7 @@ void NTR_LCD::brightness_down(u32 bg_control)
 			blue = (result < 0) ? 0 : result;
 
 			//Copy 32-bit color to scanline buffer
-			if(bg_control == NDS_DISPCNT_A) { scanline_buffer_a[x] = 0xFF000000 | (red << 19) | (green << 11) | (blue << 3); }
-			else { scanline_buffer_b[x] = 0xFF000000 | (red << 19) | (green << 11) | (blue << 3); }
+			scanline_buffer[engine_id][x] = 0xFF000000 | (red << 19) | (green << 11) | (blue << 3);
 		}
 	}
 }
@@ -3583,6 +2636,12 @@ void NTR_LCD::brightness_down(u32 bg_control)
 /****** SFX - Alpha blending *****/
 void NTR_LCD::alpha_blend(u32 bg_control)
 {
+	//Engine A and Engine B share this renderer, registers and scratch buffers are selected per engine
+	u8 engine_id = (bg_control & 0x1000) ? 1 : 0;
+	engine_2d &eng = engine[engine_id];
+	std::vector< std::vector<u32> > &line_buffer = line_buffers[engine_id];
+	std::vector< std::vector<u32> > &obj_line_buffer = obj_line_buffers[engine_id];
+
 	u8 bg_render_list[4];
 	u8 bg_layer[4];
 
@@ -3590,18 +2649,18 @@ void NTR_LCD::alpha_blend(u32 bg_control)
 	u8 g1, g2;
 	u8 b1, b2;
 
-	double coef_1 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.alpha_coef_a[0] : lcd_stat.alpha_coef_b[0];
-	double coef_2 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.alpha_coef_a[1] : lcd_stat.alpha_coef_b[1];
+	double coef_1 = eng.alpha_coef[0];
+	double coef_2 = eng.alpha_coef[1];
 
-	u8 bg_priority_0 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[0] : lcd_stat.bg_priority_b[0];
-	u8 bg_priority_1 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[1] : lcd_stat.bg_priority_b[1];
-	u8 bg_priority_2 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[2] : lcd_stat.bg_priority_b[2];
-	u8 bg_priority_3 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_priority_a[3] : lcd_stat.bg_priority_b[3];
+	u8 bg_priority_0 = eng.bg_priority[0];
+	u8 bg_priority_1 = eng.bg_priority[1];
+	u8 bg_priority_2 = eng.bg_priority[2];
+	u8 bg_priority_3 = eng.bg_priority[3];
 
 	bool bg0_is_3D = false;
 	bool target_3D = false;
 
-	if((bg_control == NDS_DISPCNT_A) && (lcd_stat.display_control_a & 0x8)) { bg0_is_3D = true; }
+	if((!engine_id) && ((*eng.display_control) & 0x8)) { bg0_is_3D = true; }
 
 	//Determine BG priority
 	for(int x = 0, list_length = 0; x < 4; x++)
@@ -3748,8 +2807,8 @@ void NTR_LCD::alpha_blend(u32 bg_control)
 		//If no target is found, use backdrop as layer
 		if(!found_target_2) { target_2 = 5; }
 
-		bool target_1_enable = (bg_control == NDS_DISPCNT_A) ? lcd_stat.sfx_target_a[target_1][0] : lcd_stat.sfx_target_b[target_1][0];
-		bool target_2_enable = (bg_control == NDS_DISPCNT_A) ? lcd_stat.sfx_target_a[target_2][1] : lcd_stat.sfx_target_b[target_2][1];
+		bool target_1_enable = eng.sfx_target[target_1][0];
+		bool target_2_enable = eng.sfx_target[target_2][1];
 
 		//Force SFX for semi-transparent objects
 		if(obj_semi_1) { target_1_enable = true; }
@@ -3766,7 +2825,7 @@ void NTR_LCD::alpha_blend(u32 bg_control)
 			u32 color_2 = 0;
 
 			//Pull color from backdrop
-			if(target_2 == 5) { color_2 = (bg_control == NDS_DISPCNT_A) ? lcd_stat.bg_pal_a[0] : lcd_stat.bg_pal_b[0]; }
+			if(target_2 == 5) { color_2 = eng.bg_pal[0]; }
 
 			//Pull color from layers
 			else { color_2 = (is_obj_2) ? obj_line_buffer[layer_2][x] : line_buffer[layer_2][x]; }
@@ -3790,8 +2849,7 @@ void NTR_LCD::alpha_blend(u32 bg_control)
 			u8 blue = (result > 0x1F) ? 0x1F : result;
 
 			//Copy 32-bit color to scanline buffer
-			if(bg_control == NDS_DISPCNT_A) { scanline_buffer_a[x] = 0xFF000000 | (red << 19) | (green << 11) | (blue << 3); }
-			else { scanline_buffer_b[x] = 0xFF000000 | (red << 19) | (green << 11) | (blue << 3); }
+			scanline_buffer[engine_id][x] = 0xFF000000 | (red << 19) | (green << 11) | (blue << 3);
 		}
 	}
 }
@@ -3799,7 +2857,8 @@ void NTR_LCD::alpha_blend(u32 bg_control)
 /****** Adjusts master brightness before final scanline output ******/
 void NTR_LCD::adjust_master_brightness(u8 engine_id)
 {
-	u16 master_bright = (engine_id) ? lcd_stat.master_bright_a : lcd_stat.master_bright_b;
+	u16 master_bright = *engine[engine_id].master_bright;
+	std::vector<u32> &line = scanline_buffer[engine_id];
 
 	double factor = (master_bright & 0x1F) / 16.0;
 	u32 color = 0;
@@ -3812,100 +2871,46 @@ void NTR_LCD::adjust_master_brightness(u8 engine_id)
 	//Master Brightness Up
 	if((master_bright >> 14) == 0x1)
 	{
-		//Engine A pixels
-		if(engine_id)
-		{
-			for(u32 x = 0; x < 256; x++)
-			{
-				color = scanline_buffer_a[x];
-
-				r = (color >> 18) & 0x3F;
-				result = r + ((63 - r) * factor);
-				r = (result > 63) ? 63 : result;
-
-				g = (color >> 10) & 0x3F;
-				result = g + ((63 - g) * factor);
-				g = (result > 63) ? 63 : result;
-
-				b = (color >> 2) & 0x3F;
-				result = b + ((63 - b) * factor);
-				b = (result > 63) ? 63 : result;
-
-				scanline_buffer_a[x] = 0xFF000000 | (r << 18) | (g << 10) | (b << 2);
-			}
-		}
-
-		//Engine B pixels
-		else
+		for(u32 x = 0; x < 256; x++)
 		{
-			for(u32 x = 0; x < 256; x++)
-			{
-				color = scanline_buffer_b[x];
+			color = line[x];
 
-				r = (color >> 18) & 0x3F;
-				result = r + ((63 - r) * factor);
-				r = (result > 63) ? 63 : result;
+			r = (color >> 18) & 0x3F;
+			result = r + ((63 - r) * factor);
+			r = (result > 63) ? 63 : result;
 
-				g = (color >> 10) & 0x3F;
-				result = g + ((63 - g) * factor);
-				g = (result > 63) ? 63 : result;
+			g = (color >> 10) & 0x3F;
+			result = g + ((63 - g) * factor);
+			g = (result > 63) ? 63 : result;
 
-				b = (color >> 2) & 0x3F;
-				result = b + ((63 - b) * factor);
-				b = (result > 63) ? 63 : result;
+			b = (color >> 2) & 0x3F;
+			result = b + ((63 - b) * factor);
+			b = (result > 63) ? 63 : result;
 
-				scanline_buffer_b[x] = 0xFF000000 | (r << 18) | (g << 10) | (b << 2);
-			}
+			line[x] = 0xFF000000 | (r << 18) | (g << 10) | (b << 2);
 		}
 	}
 
 	//Master Bright Down
 	if((master_bright >> 14) == 0x2)
 	{
-		//Engine A pixels
-		if(engine_id)
-		{
-			for(u32 x = 0; x < 256; x++)
-			{
-				color = scanline_buffer_a[x];
-
-				r = ((color >> 18) & 0x3F);
-				result = r - (r * factor);
-				r = (result < 0) ? 0 : result;
-
-				g = ((color >> 10) & 0x3F);
-				result = g - (g * factor);
-				g = (result < 0) ? 0 : result;
-
-				b = ((color >> 2) & 0x3F);
-				result = b - (b * factor);
-				b = (result < 0) ? 0 : result;
-
-				scanline_buffer_a[x] = 0xFF000000 | (r << 18) | (g << 10) | (b << 2);
-			}
-		}
-
-		//Engine B pixels
-		else
+		for(u32 x = 0; x < 256; x++)
 		{
-			for(u32 x = 0; x < 256; x++)
-			{
-				color = scanline_buffer_b[x];
+			color = line[x];
 
-				r = ((color >> 18) & 0x3F);
-				result = r - (r * factor);
-				r = (result < 0) ? 0 : result;
+			r = ((color >> 18) & 0x3F);
+			result = r - (r * factor);
+			r = (result < 0) ? 0 : result;
 
-				g = ((color >> 10) & 0x3F);
-				result = g - (g * factor);
-				g = (result < 0) ? 0 : result;
+			g = ((color >> 10) & 0x3F);
+			result = g - (g * factor);
+			g = (result < 0) ? 0 : result;
 
-				b = ((color >> 2) & 0x3F);
-				result = b - (b * factor);
-				b = (result < 0) ? 0 : result;
+			b = ((color >> 2) & 0x3F);
+			result = b - (b * factor);
+			b = (result < 0) ? 0 : result;
 
-				scanline_buffer_b[x] = 0xFF000000 | (r << 18) | (g << 10) | (b << 2);
-			}
+			line[x] = 0xFF000000 | (r << 18) | (g << 10) | (b << 2);
 		}
 	}
 }
@@ -3913,151 +2918,90 @@ void NTR_LCD::adjust_master_brightness(u8 engine_id)
 /****** Calculates what coordinates of a scanline are within a Window ******/
 void NTR_LCD::calculate_window_on_scanline()
 {
-	//Clear previous calculations
-	for(u32 y = 0; y < 2; y++)
+	u32 line = lcd_stat.current_scanline;
+
+	for(u32 engine_id = 0; engine_id < 2; engine_id++)
 	{
+		engine_2d &eng = engine[engine_id];
+
+		bool win_stat[2];
+		u16 win_y[2][2];
+
+		//Clear previous calculations
 		for(u32 x = 0; x < 256; x++)
 		{
-			lcd_stat.window_status_a[x][y] = false;
-			lcd_stat.window_status_b[x][y] = false;
+			eng.window_status[x][0] = false;
+			eng.window_status[x][1] = false;
 		}
-	}
 
-	u32 line = lcd_stat.current_scanline;
-
-	bool win_stat[2];
-	u16 temp_y_a[2][2];
-	u16 temp_y_b[2][2];
-
-	//Store temporary Y values for windows
-	for(u32 y = 0; y < 2; y++)
-	{
-		for(u32 x = 0; x < 2; x++)
+		//Use temporary Y values for windows
+		for(u32 y = 0; y < 2; y++)
 		{
-			temp_y_a[x][y] = lcd_stat.window_y_a[x][y];
-			temp_y_b[x][y] = lcd_stat.window_y_b[x][y];
+			for(u32 x = 0; x < 2; x++) { win_y[x][y] = eng.window_y[x][y]; }
 		}
-	}
-
-	//Check if windows are enabled and if they are usable
-	win_stat[0] = ((lcd_stat.window_enable_a[0]) && (lcd_stat.window_x_a[0][0] != lcd_stat.window_x_a[0][1]));
-	win_stat[1] = ((lcd_stat.window_enable_a[1]) && (lcd_stat.window_x_a[1][0] != lcd_stat.window_x_a[1][1]));
 
-	if((win_stat[0]) && (lcd_stat.window_y_a[0][0] == lcd_stat.window_y_a[0][1]) && (!lcd_stat.window_y_a[0][0]))
-	{
-		lcd_stat.window_y_a[0][1] = 256;
-	}
+		//Check if windows are enabled and if they are usable
+		win_stat[0] = ((eng.window_enable[0]) && (eng.window_x[0][0] != eng.window_x[0][1]));
+		win_stat[1] = ((eng.window_enable[1]) && (eng.window_x[1][0] != eng.window_x[1][1]));
 
-	if((win_stat[1]) && (lcd_stat.window_y_a[1][0] == lcd_stat.window_y_a[1][1]) && (!lcd_stat.window_y_a[1][0]))
-	{
-		lcd_stat.window_y_a[1][1] = 256;
-	}
+		if((win_stat[0]) && (win_y[0][0] == win_y[0][1]) && (!win_y[0][0])) { win_y[0][1] = 256; }
+		if((win_stat[1]) && (win_y[1][0] == win_y[1][1]) && (!win_y[1][0])) { win_y[1][1] = 256; }
 
-	//Calculate Engine A
-	for(u32 win_id = 0; win_id < 2; win_id++)
-	{
-		for(u32 pixel = 0; pixel < 256; pixel++)
+		for(u32 win_id = 0; win_id < 2; win_id++)
 		{
-			bool check_x = false;
+			//Skip unusable windows and windows that do not cover this line
+			if(!win_stat[win_id]) { continue; }
+
 			bool check_y = false;
 
-			//Determine window status of this pixel
-			if(win_stat[win_id])
+			if((win_y[win_id][0] <= win_y[win_id][1]) && (line >= win_y[win_id][0]) && (line < win_y[win_id][1])) { check_y = true; }
+			else if((win_y[win_id][0] > win_y[win_id][1]) && ((line >= win_y[win_id][0]) || (line < win_y[win_id][1]))) { check_y = true; }
+
+			if(!check_y) { continue; }
+
+			for(u32 pixel = 0; pixel < 256; pixel++)
 			{
-				if((lcd_stat.window_x_a[win_id][0] <= lcd_stat.window_x_a[win_id][1]) && (pixel >= lcd_stat.window_x_a[win_id][0]) && (pixel <= lcd_stat.window_x_a[win_id][1]))
-				{
-					check_x = true;
-				}
+				bool check_x = false;
 
-				else if((lcd_stat.window_x_a[win_id][0] > lcd_stat.window_x_a[win_id][1]) && ((pixel >= lcd_stat.window_x_a[win_id][0]) || (pixel <= lcd_stat.window_x_a[win_id][1])))
+				//Determine window status of this pixel
+				if((eng.window_x[win_id][0] <= eng.window_x[win_id][1]) && (pixel >= eng.window_x[win_id][0]) && (pixel <= eng.window_x[win_id][1]))
 				{
 					check_x = true;
 				}
 
-				if((lcd_stat.window_y_a[win_id][0] <= lcd_stat.window_y_a[win_id][1]) && (line >= lcd_stat.window_y_a[win_id][0]) && (line < lcd_stat.window_y_a[win_id][1]))
-				{
-					check_y = true;
-				}
-
-				else if((lcd_stat.window_y_a[win_id][0] > lcd_stat.window_y_a[win_id][1]) && ((line >= lcd_stat.window_y_a[win_id][0]) || (line < lcd_stat.window_y_a[win_id][1])))
+				else if((eng.window_x[win_id][0] > eng.window_x[win_id][1]) && ((pixel >= eng.window_x[win_id][0]) || (pixel <= eng.window_x[win_id][1])))
 				{
-					check_y = true;
+					check_x = true;
 				}
 
 				//Set window status and ID
-				if(check_x && check_y && !lcd_stat.window_status_a[pixel][win_id])
+				if(check_x && !eng.window_status[pixel][win_id])
 				{
-					lcd_stat.window_status_a[pixel][win_id] = true;
-					lcd_stat.window_id_a[pixel] = win_id;
+					eng.window_status[pixel][win_id] = true;
+					eng.window_id[pixel] = win_id;
 				}
 			}
 		}
-	}
-
-	//Check if windows are enabled and if they are usable
-	win_stat[0] = ((lcd_stat.window_enable_b[0]) && (lcd_stat.window_x_b[0][0] != lcd_stat.window_x_b[0][1]));
-	win_stat[1] = ((lcd_stat.window_enable_b[1]) && (lcd_stat.window_x_b[1][0] != lcd_stat.window_x_b[1][1]));
-
-	if((win_stat[0]) && (lcd_stat.window_y_b[0][0] == lcd_stat.window_y_b[0][1]) && (!lcd_stat.window_y_b[0][0]))
-	{
-		lcd_stat.window_y_b[0][1] = 256;
-	}
 
-	if((win_stat[1]) && (lcd_stat.window_y_b[1][0] == lcd_stat.window_y_b[1][1]) && (!lcd_stat.window_y_b[1][0]))
-	{
-		lcd_stat.window_y_b[1][1] = 256;
-	}
+		//Build per-BG masks so renderers only do a lookup per pixel
+		bool can_winout = (*eng.display_control) & 0x6000;
 
-	//Calculate Engine B
-	for(u32 win_id = 0; win_id < 2; win_id++)
-	{	
-		for(u32 pixel = 0; pixel < 256; pixel++)
+		for(u32 bg_id = 0; bg_id < 4; bg_id++)
 		{
-			bool check_x = false;
-			bool check_y = false;
-
-			//Determine window status of this pixel
-			if(win_stat[win_id])
+			for(u32 x = 0; x < 256; x++)
 			{
-				if((lcd_stat.window_x_b[win_id][0] <= lcd_stat.window_x_b[win_id][1]) && (pixel >= lcd_stat.window_x_b[win_id][0]) && (pixel <= lcd_stat.window_x_b[win_id][1]))
-				{
-					check_x = true;
-				}
-
-				else if((lcd_stat.window_x_b[win_id][0] > lcd_stat.window_x_b[win_id][1]) && ((pixel >= lcd_stat.window_x_b[win_id][0]) || (pixel <= lcd_stat.window_x_b[win_id][1])))
-				{
-					check_x = true;
-				}
+				//Determine if pixel can be drawn inside or outside an active window
+				u8 win_id = eng.window_id[x];
+				bool in_window = true;
+				bool out_window = true;
 
-				if((lcd_stat.window_y_b[win_id][0] <= lcd_stat.window_y_b[win_id][1]) && (line >= lcd_stat.window_y_b[win_id][0]) && (line < lcd_stat.window_y_b[win_id][1]))
-				{
-					check_y = true;
-				}
+				if(eng.window_status[x][win_id] && !eng.window_in_enable[bg_id][win_id]) { in_window = false; }
+				if(can_winout && !eng.window_status[x][0] && !eng.window_status[x][1] && !eng.window_out_enable[bg_id][0]) { out_window = false; }
 
-				else if((lcd_stat.window_y_b[win_id][0] > lcd_stat.window_y_b[win_id][1]) && ((line >= lcd_stat.window_y_b[win_id][0]) || (line < lcd_stat.window_y_b[win_id][1])))
-				{
-					check_y = true;
-				}
-		
-				//Set window status and ID
-				if(check_x && check_y && !lcd_stat.window_status_b[pixel][win_id])
-				{
-					lcd_stat.window_status_b[pixel][win_id] = true;
-					lcd_stat.window_id_b[pixel] = win_id;
-				}
+				window_mask[engine_id][bg_id][x] = (in_window && out_window);
 			}
 		}
 	}
-
-	//Restore original Y values for windows
-	for(u32 y = 0; y < 2; y++)
-	{
-		for(u32 x = 0; x < 2; x++)
-		{
-			lcd_stat.window_y_a[x][y] = temp_y_a[x][y];
-			lcd_stat.window_y_b[x][y] = temp_y_b[x][y];
-		}
-	}
 }
 		
 /****** Immediately draw current buffer to the screen ******/
@@ -4070,7 +3014,13 @@ void NTR_LCD::update()
 		if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
 		u32* out_pixel_data = (u32*)final_screen->pixels;
 
-		for(int a = 0; a < 0x18000; a++) { out_pixel_data[a] = screen_buffer[a]; }
+		//Apply software filters
+		if(sw_filter::is_enabled()) { sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, final_screen->pitch >> 2); }
+
+		else
+		{
+			for(int a = 0; a < 0x18000; a++) { out_pixel_data[a] = screen_buffer[a]; }
+		}
 
 		//Unlock source surface
 		if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
@@ -4128,7 +3078,11 @@ void NTR_LCD::step()
 	//Process GX commands and states
 	if(lcd_3D_stat.process_command) { process_gx_command(); }
 	
-	if(lcd_3D_stat.render_polygon) { render_geometry(); }
+	if(lcd_3D_stat.render_polygon)
+	{
+		profiler::scope timer(profiler::PROF_PPU);
+		render_geometry();
+	}
 
 	//Mode 0 - Scanline rendering
 	if(((lcd_stat.lcd_clock % 2130) <= 1536) && (lcd_stat.lcd_clock < 408960)) 
@@ -4197,12 +3151,11 @@ void NTR_LCD::step()
 				lcd_stat.update_bg_control_b = false;
 			}
 
-			//Render scanline data
-			render_scanline();
-
-			//Apply Master Brightness on Engine A and/or Engine B if necessary
-			if(lcd_stat.master_bright_a & 0xC000) { adjust_master_brightness(1); }
-			if(lcd_stat.master_bright_b & 0xC000) { adjust_master_brightness(0); }
+			//Render scanline data - Engine B's worker is waited on here, so its time counts as well
+			{
+				profiler::scope timer(profiler::PROF_PPU);
+				render_scanline();
+			}
 
 			u32 render_position = (lcd_stat.current_scanline * config::sys_width);
 
@@ -4227,8 +3180,8 @@ void NTR_LCD::step()
 			//Push scanline pixel data to screen buffer
 			for(u16 x = 0; x < 256; x++)
 			{
-				screen_buffer[render_position + x + disp_a_offset] = scanline_buffer_a[x];
-				screen_buffer[render_position + x + disp_b_offset] = scanline_buffer_b[x];
+				screen_buffer[render_position + x + disp_a_offset] = scanline_buffer[0][x];
+				screen_buffer[render_position + x + disp_b_offset] = scanline_buffer[1][x];
 			}
 
 			//Start HBlank DMA
@@ -4277,17 +3230,35 @@ void NTR_LCD::step()
 				if(mem->g_pad->vc_pause < config::vc_timeout) { render_virtual_cursor(); }
 			}
 
+			//Display profiler overlay
+			if(profiler::enabled) { profiler::draw_overlay(screen_buffer); }
+
+			//Presentation covers both SDL and external rendering
+			u64 present_ticks = (profiler::enabled) ? profiler::get_ticks() : 0;
+
 			//Use SDL
 			if(config::sdl_render)
 			{
+				//Only present lines that changed since the last frame, or nothing at all if the frame is identical
+				//When only one screen changes, the other screen is never copied or presented
+				u32 dirty_lines = frame_diff::update(screen_diff, screen_buffer.data(), config::sys_width, config::sys_height);
+
 				//If using SDL and no OpenGL, manually stretch for fullscreen via SDL
-				if((config::flags & SDL_WINDOW_FULLSCREEN) && (!config::use_opengl))
+				if((config::flags & SDL_WINDOW_FULLSCREEN) && (!config::use_opengl) && (dirty_lines))
 				{
 					//Lock source surface
 					if(SDL_MUSTLOCK(original_screen)){ SDL_LockSurface(original_screen); }
 					u32* out_pixel_data = (u32*)original_screen->pixels;
 
-					for(int a = 0; a < 0x18000; a++) { out_pixel_data[a] = screen_buffer[a]; }
+					//Apply software filters
+					if(sw_filter::is_enabled()) { sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, original_screen->pitch >> 2); }
+
+					else
+					{
+						u32 start = screen_diff.first_dirty * config::sys_width;
+						u32 end = (screen_diff.last_dirty + 1) * config::sys_width;
+						for(u32 a = start; a < end; a++) { out_pixel_data[a] = screen_buffer[a]; }
+					}
 
 					//Unlock source surface
 					if(SDL_MUSTLOCK(original_screen)){ SDL_UnlockSurface(original_screen); }
@@ -4317,24 +3288,41 @@ void NTR_LCD::step()
 				}
 					
 				//Otherwise, render normally (SDL 1:1, OpenGL handles its own stretching)
-				else
+				else if(dirty_lines)
 				{
-					//Lock source surface
-					if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
-					u32* out_pixel_data = (u32*)final_screen->pixels;
-
-					for(int a = 0; a < 0x18000; a++) { out_pixel_data[a] = screen_buffer[a]; }
+					//Display final screen buffer - OpenGL, uploaded straight from the screen buffer
+					if(config::use_opengl) { gx_blit_opengl(window, screen_buffer.data()); }
 
-					//Unlock source surface
-					if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
-		
-					//Display final screen buffer - OpenGL
-					if(config::use_opengl) { gx_blit_opengl(window, final_screen); }
-				
 					//Display final screen buffer - SDL
-					else 
+					else
 					{
-						if(SDL_UpdateWindowSurface(window) != 0)
+						//Lock source surface
+						if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
+						u32* out_pixel_data = (u32*)final_screen->pixels;
+
+						//Apply software filters - Filters sample neighboring lines, so the whole frame is presented
+						SDL_Rect dirty_rect;
+						dirty_rect.x = 0;
+						dirty_rect.w = final_screen->w;
+						dirty_rect.y = 0;
+						dirty_rect.h = final_screen->h;
+
+						if(sw_filter::is_enabled()) { sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, final_screen->pitch >> 2); }
+
+						else
+						{
+							u32 start = screen_diff.first_dirty * config::sys_width;
+							u32 end = (screen_diff.last_dirty + 1) * config::sys_width;
+							for(u32 a = start; a < end; a++) { out_pixel_data[a] = screen_buffer[a]; }
+
+							dirty_rect.y = screen_diff.first_dirty;
+							dirty_rect.h = (screen_diff.last_dirty - screen_diff.first_dirty) + 1;
+						}
+
+						//Unlock source surface
+						if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
+
+						if(SDL_UpdateWindowSurfaceRects(window, &dirty_rect, 1) != 0)
 						{
 							std::cout<<"LCD::Error - Could not blit\n";
 
@@ -4372,15 +3360,22 @@ void NTR_LCD::step()
 				}
 			}
 
+			if(present_ticks) { profiler::add_time(profiler::PROF_PRESENT, profiler::get_ticks() - present_ticks); }
+
 			//Limit framerate
 			if(!config::turbo)
 			{
+				profiler::scope timer(profiler::PROF_IDLE);
+
 				frame_current_time = SDL_GetTicks();
 				int delay = frame_delay[fps_count % 60];
 				if((frame_current_time - frame_start_time) < delay) { SDL_Delay(delay - (frame_current_time - frame_start_time));}
 				frame_start_time = SDL_GetTicks();
 			}
 
+			//Total profiler timers for this frame
+			profiler::end_frame();
+
 			//Update FPS counter + title
 			fps_count++;
 			if(((SDL_GetTicks() - fps_time) >= 1000) && (config::sdl_render))
@@ -4667,7 +3662,7 @@ bool NTR_LCD::get_cart_icon(SDL_Surface* nds_icon)
 
 		for(u32 y = 0; y < 32; y++)
 		{
-			u8 icon_char = mem->cart_data[icon_base + 0x20 + data_pos];
+			u8 icon_char = mem->read_cart_u8(icon_base + 0x20 + data_pos);
 			u8 char_r = (icon_char >> 4);
 			u8 char_l = (icon_char & 0xF);
 			data_pos++;
@@ -4726,7 +3721,7 @@ bool NTR_LCD::save_cart_icon(std::string nds_icon_file)
 
 		for(u32 y = 0; y < 32; y++)
 		{
-			u8 icon_char = mem->cart_data[icon_base + 0x20 + data_pos];
+			u8 icon_char = mem->read_cart_u8(icon_base + 0x20 + data_pos);
 			u8 char_r = (icon_char >> 4);
 			u8 char_l = (icon_char & 0xF);
 			data_pos++;
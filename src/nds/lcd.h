@@ -16,6 +16,8 @@
 #include "mmu.h"
 
 #include "common/gx_util.h"
+#include "common/frame_diff.h"
+#include "common/line_worker.h"
 
 class NTR_LCD
 {
@@ -54,6 +56,9 @@ class NTR_LCD
 	bool lcd_read(u32 offset, std::string filename);
 	bool lcd_write(std::string filename);
 
+	//Micro-benchmarks drive the renderers directly
+	friend class gbe_bench;
+
 	private:
 
 	struct oam_entries
@@ -110,45 +115,97 @@ class NTR_LCD
 	void update_obj_affine_transformation();
 	void update_obj_render_list();
 
-	//OBJ rendering
-	u8 obj_render_list_a[128];
-	u8 obj_render_length_a;
-
-	u8 obj_render_list_b[128];
-	u8 obj_render_length_b;
+	//Per-engine view of 2D registers - Lets Engine A and Engine B share the same renderers
+	//Index 0 is Engine A, index 1 is Engine B
+	struct engine_2d
+	{
+		u32* display_control;
+		u8* bg_mode;
+		u8* display_mode;
+		u8* ext_pal;
+		u16* master_bright;
+
+		u16* bg_control;
+		u16* bg_offset_x;
+		u16* bg_offset_y;
+		u8* bg_depth;
+		u8* bg_size;
+		u16* text_width;
+		u16* text_height;
+		u32* bg_base_map_addr;
+		u32* bg_base_tile_addr;
+		u32* bg_bitmap_base_addr;
+		u8* bg_priority;
+		bool* bg_enable;
+		ntr_lcd_data::bg_affine_parameters* bg_affine;
+
+		u32* bg_pal;
+		u32* bg_ext_pal;
+		u32* obj_pal;
+		u32* obj_ext_pal;
+
+		bool (*sfx_target)[2];
+		nds_sfx_types* current_sfx_type;
+		double* brightness_coef;
+		double* alpha_coef;
+
+		u16 (*window_x)[2];
+		u16 (*window_y)[2];
+		bool* window_enable;
+		bool (*window_in_enable)[2];
+		bool (*window_out_enable)[2];
+		bool (*window_status)[2];
+		bool* window_id;
+
+		u32 bg_cnt_base;
+		u32 bg_vram_addr;
+		u8* bg_vram;
+	} engine[2];
+
+	void init_engine_views();
+
+	//Per-BG window masks for the current scanline, calculated once before either engine renders
+	bool window_mask[2][4][256];
+
+	//OBJ rendering - Index 0 is Engine A, index 1 is Engine B
+	u8 obj_render_list[2][128];
+	u8 obj_render_length[2];
 
 	//Screen pixel buffer
-	std::vector<u32> scanline_buffer_a;
-	std::vector<u32> scanline_buffer_b;
+	std::vector<u32> scanline_buffer[2];
 	std::vector<u32> screen_buffer;
 	std::vector< std::vector<u32> > gx_screen_buffer;
 
 	//Render buffer
-	std::vector<u8> render_buffer_a;
-	std::vector<u8> render_buffer_b;
+	std::vector<u8> render_buffer[2];
 	std::vector< std::vector<u8> > gx_render_buffer;
 	std::vector<float> gx_z_buffer;
 
-	//Other buffers
-	std::vector< std::vector<u32> > line_buffer;
-	std::vector< std::vector<u32> > obj_line_buffer;
+	//Other buffers - Engine A and Engine B each have their own line buffers so both can render at once
+	std::vector< std::vector<u32> > line_buffers[2];
+	std::vector< std::vector<u32> > obj_line_buffers[2];
 	std::vector <u32> tex_data;
 
 	//Display Capture
 	bool capture_on;
 	std::vector<u16> capture_buffer;
 
-	bool full_scanline_render_a;
-	bool full_scanline_render_b;
+	bool full_scanline_render[2];
 
 	u32 scanline_pixel_counter;
 
+	//Engine B worker - Renders Engine B while the emulation thread renders Engine A
+	line_worker engine_b_worker;
+
 	int frame_start_time;
 	int frame_current_time;
 	int fps_count;
 	int fps_time;
 	int frame_delay[60];
 
+	//Line hashes of the last presented frame
+	frame_diff::line_state screen_diff;
+
 	bool try_window_rebuild;
 
 	u8 inv_lut[8];
@@ -188,12 +245,14 @@ class NTR_LCD
 	float shine_table[4];
 
 	void render_scanline();
+	void render_engine(u8 engine_id);
 	void render_bg_scanline(u32 bg_control);
 	void render_bg_mode_text(u32 bg_control);
 	void render_bg_mode_affine(u32 bg_control);
 	void render_bg_mode_affine_ext(u32 bg_control);
 	void render_bg_mode_bitmap(u32 bg_control);
 	void render_bg_mode_direct(u32 bg_control);
+	void render_bg_mode_extended(u32 bg_control);
 	void render_obj_scanline(u32 bg_control);
 	void scanline_compare();
 	void reload_affine_references(u32 bg_control);
@@ -122,7 +122,7 @@ struct ntr_lcd_data
 	u32 obj_ext_pal_b[4096];
 	u16 raw_obj_ext_pal_b[4096];
 
-	struct bg_affine_parameters_a
+	struct bg_affine_parameters
 	{
 		//Parameters, X-Y reference
 		float dx, dmx, dy, dmy;
@@ -130,17 +130,10 @@ struct ntr_lcd_data
 		float x_pos, y_pos;
 
 		bool overflow;
-	} bg_affine_a[2];
+	};
 
-	struct bg_affine_parameters_b
-	{
-		//Parameters, X-Y reference
-		float dx, dmx, dy, dmy;
-		float x_ref, y_ref;
-		float x_pos, y_pos;
-
-		bool overflow;
-	} bg_affine_b[2];
+	bg_affine_parameters bg_affine_a[2];
+	bg_affine_parameters bg_affine_b[2];
 
 	float obj_affine[256];
 
@@ -10,10 +10,14 @@
 
 #include "mmu.h"
 #include "common/util.h"
+#include "common/mem_trace.h"
+#include "common/rom_cache.h"
+#include "common/save_flush.h"
 
 #include <filesystem>
 #include <cmath>
 #include <algorithm>
+#include <cstring>
 
 /****** MMU Constructor ******/
 NTR_MMU::NTR_MMU() 
@@ -24,9 +28,13 @@ NTR_MMU::NTR_MMU()
 /****** MMU Deconstructor ******/
 NTR_MMU::~NTR_MMU() 
 {
-	save_backup(config::save_file);
+	//Background saving only has to write what changed since its last flush
+	if(save_flush::is_active()) { save_flush::stop(); }
+	else { save_backup(config::save_file); }
+
 	memory_map.clear();
 	cart_data.clear();
+	cart_stream.close();
 	nds7_bios.clear();
 	nds9_bios.clear();
 	std::cout<<"MMU::Shutdown\n"; 
@@ -147,6 +155,9 @@ void NTR_MMU::reset()
 	memory_map.resize(0x10000000, 0);
 
 	cart_data.clear();
+	cart_stream.close();
+	cart_streamed = false;
+	cart_size = 0;
 
 	firmware.clear();
 	firmware.resize(0x40000, 0);
@@ -387,6 +398,7 @@ void NTR_MMU::reset()
 	bg_vram_bank_enable_b = false;
 
 	access_mode = 1;
+	sync_request = false;
 	wram_mode = 3;
 	rumble_state = 0;
 	do_save = false;
@@ -413,6 +425,21 @@ void NTR_MMU::reset()
 	std::cout<<"MMU::Initialized\n";
 }
 
+/****** Returns true for I/O registers the NDS9 and NDS7 use to communicate with each other ******/
+static inline bool is_sync_register(u32 address)
+{
+	//IPCSYNC, IPCFIFOCNT, IPCFIFOSEND
+	if((address >= NDS_IPCSYNC) && (address < (NDS_IPCFIFOSND + 4))) { return true; }
+
+	//IME, IE, IF
+	if((address >= NDS_IME) && (address < (NDS_IF + 4))) { return true; }
+
+	//IPCFIFORECV
+	if((address >= NDS_IPCFIFORECV) && (address < (NDS_IPCFIFORECV + 4))) { return true; }
+
+	return (address == NDS_WRAMCNT);
+}
+
 /****** Read byte from memory ******/
 u8 NTR_MMU::read_u8(u32 address)
 {
@@ -423,6 +450,21 @@ u8 NTR_MMU::read_u8(u32 address)
 	debug_addr[(address & 0x3) + (access_mode << 2)] = address;
 	#endif
 
+	//Memory access tracing, ARM7 accesses are flagged as coming from the sub CPU
+	//Perform the read first so the returned value is recorded
+	if((mem_trace::enabled) && (!mem_trace::in_read))
+	{
+		mem_trace::in_read = true;
+		u8 value = read_u8(address);
+		mem_trace::in_read = false;
+
+		mem_trace::record_access(address, value, (access_mode) ? mem_trace::TRACE_READ : (mem_trace::TRACE_READ | mem_trace::TRACE_SUB_CPU));
+		return value;
+	}
+
+	//IPC, IRQ, and WRAMCNT accesses let the other CPU catch up right away
+	if(((address >> 24) == 0x4) && (is_sync_register(address))) { sync_request = true; }
+
 	//Check DTCM first
 	if((access_mode) && (!fetch_request) && (address >= dtcm_addr) && (address <= dtcm_end) && (!dtcm_load_mode))
 	{
@@ -1160,16 +1202,22 @@ u32 NTR_MMU::read_u32_fast(u32 address) const
 	return ((memory_map[address+3] << 24) | (memory_map[address+2] << 16) | (memory_map[address+1] << 8) | memory_map[address]);
 }
 
+/****** Reads 1 byte from cartridge memory - No checks done on the read ******/
+u8 NTR_MMU::read_cart_u8(u32 address)
+{
+	return (cart_streamed) ? cart_stream.read_u8(address) : cart_data[address];
+}
+
 /****** Reads 2 bytes from cartridge memory - No checks done on the read ******/
-u16 NTR_MMU::read_cart_u16(u32 address) const
+u16 NTR_MMU::read_cart_u16(u32 address)
 {
-	return ((cart_data[address+1] << 8) | cart_data[address]);
+	return ((read_cart_u8(address+1) << 8) | read_cart_u8(address));
 }
 
 /****** Reads 4 bytes from cartridge memory - No checks done on the read ******/
-u32 NTR_MMU::read_cart_u32(u32 address) const
+u32 NTR_MMU::read_cart_u32(u32 address)
 {
-	return ((cart_data[address+3] << 24) | (cart_data[address+2] << 16) | (cart_data[address+1] << 8) | cart_data[address]);
+	return ((read_cart_u8(address+3) << 24) | (read_cart_u8(address+2) << 16) | (read_cart_u8(address+1) << 8) | read_cart_u8(address));
 }
 
 /****** Write byte into memory ******/
@@ -1182,6 +1230,12 @@ void NTR_MMU::write_u8(u32 address, u8 value)
 	debug_addr[(address & 0x3) + (access_mode << 2)] = address;
 	#endif
 
+	//Memory access tracing, ARM7 accesses are flagged as coming from the sub CPU
+	if(mem_trace::enabled) { mem_trace::record_access(address, value, (access_mode) ? mem_trace::TRACE_WRITE : (mem_trace::TRACE_WRITE | mem_trace::TRACE_SUB_CPU)); }
+
+	//IPC, IRQ, and WRAMCNT accesses let the other CPU catch up right away
+	if(((address >> 24) == 0x4) && (is_sync_register(address))) { sync_request = true; }
+
 	//Check DTCM first
 	if((access_mode) && (address >= dtcm_addr) && (address <= dtcm_end))
 	{
@@ -4008,6 +4062,7 @@ void NTR_MMU::write_u8(u32 address, u8 value)
 				if(next_start_flag && !last_start_flag)
 				{
 					apu_stat->channel[apu_io_id].playing = true;
+					apu_stat->channel[apu_io_id].sample_frac = 0.0;
 					u8 format = ((apu_stat->channel[apu_io_id].cnt >> 29) & 0x3);
 
 					//Determine loop start offset and sample length
@@ -4388,6 +4443,92 @@ void NTR_MMU::write_u32(u32 address, u32 value)
 	write_u8(address, (value & 0xFF));
 }
 
+/****** Returns direct access to a block of memory for DMA if it lies entirely within Main RAM ******/
+u8* NTR_MMU::get_dma_block(u32 address, u32 length)
+{
+	if(!length) { return nullptr; }
+
+	u32 end_address = address + length - 1;
+
+	//Only Main RAM, without crossing into any mirrors
+	if((address < 0x2000000) || (end_address > 0x23FFFFF) || (end_address < address)) { return nullptr; }
+
+	//DTCM overrides Main RAM for the NDS9
+	if((access_mode) && (address <= dtcm_end) && (end_address >= dtcm_addr)) { return nullptr; }
+
+	return &memory_map[address];
+}
+
+/****** Copies or fills a whole DMA block at once when both ends are Main RAM - Returns false if not possible ******/
+bool NTR_MMU::dma_block_transfer(u8 index, u8 unit_size)
+{
+	//Debugging and tracing need to see every access
+	#ifdef GBE_DEBUG
+	return false;
+	#endif
+
+	if(mem_trace::enabled) { return false; }
+
+	//Decrementing addresses are rare, leave them to the per-unit path
+	u8 src_ctrl = dma[index].src_addr_ctrl;
+	u8 dst_ctrl = dma[index].dest_addr_ctrl;
+
+	if((src_ctrl == 1) || (dst_ctrl == 1)) { return false; }
+
+	bool is_fill = (src_ctrl == 4);
+	bool src_fixed = ((src_ctrl == 2) || is_fill);
+	bool dst_fixed = (dst_ctrl == 2);
+
+	u32 src_addr = dma[index].start_address;
+	u32 dst_addr = dma[index].destination_address;
+	u32 length = dma[index].word_count * unit_size;
+	u32 src_length = (src_fixed) ? unit_size : length;
+	u32 dst_length = (dst_fixed) ? unit_size : length;
+
+	u8* dst = get_dma_block(dst_addr, dst_length);
+	if(dst == nullptr) { return false; }
+
+	u8 fill_value[4];
+	u8* src = nullptr;
+
+	//DMA fill reads its value from the DMAxFILL register once
+	if(is_fill)
+	{
+		u32 value = (unit_size == 4) ? read_u32(src_addr) : read_u16(src_addr);
+		for(u32 x = 0; x < 4; x++) { fill_value[x] = (value >> (x * 8)); }
+		src = fill_value;
+	}
+
+	else
+	{
+		//Overlapping ranges depend on transfer order, use the per-unit path
+		if((src_addr < (dst_addr + dst_length)) && (dst_addr < (src_addr + src_length))) { return false; }
+
+		src = get_dma_block(src_addr, src_length);
+		if(src == nullptr) { return false; }
+	}
+
+	//Block copy
+	if(!src_fixed && !dst_fixed) { memcpy(dst, src, length); }
+
+	//Fill
+	else if(src_fixed && !dst_fixed)
+	{
+		for(u32 x = 0; x < length; x += unit_size) { memcpy(dst + x, src, unit_size); }
+	}
+
+	//Fixed destination only keeps the last unit
+	else if(dst_fixed && !src_fixed) { memcpy(dst, src + length - unit_size, unit_size); }
+	else { memcpy(dst, src, unit_size); }
+
+	if(!src_fixed) { dma[index].start_address += length; }
+	if(!dst_fixed) { dma[index].destination_address += length; }
+
+	dma[index].word_count = 0;
+
+	return true;
+}
+
 /****** Writes 2 bytes into memory - No checks done on the read, used for known memory locations such as registers ******/
 void NTR_MMU::write_u16_fast(u32 address, u16 value)
 {
@@ -4442,15 +4583,41 @@ bool NTR_MMU::read_file(std::string filename)
 	u32 file_size = util::get_file_size(filename);
 	if(!file_size) { return util::report_error(filename, util::FILE_SIZE_ZERO); }
 
-	cart_data.resize(file_size);
+	u8 archive_type = rom_archive::get_archive_type(filename);
+
+	//Block-compressed ROMs are decompressed on demand as the cart is read
+	if(archive_type == rom_archive::ARCHIVE_BGZF)
+	{
+		if(!cart_stream.open(filename, (config::rom_cache_size * 1024))) { return false; }
+
+		cart_streamed = true;
+		file_size = cart_stream.size();
+
+		if(config::use_patches) { std::cout<<"MMU::Warning - Patches cannot be applied to block-compressed ROMs\n"; }
+	}
+
+	//Other compressed ROMs are decompressed entirely
+	else if(archive_type != rom_archive::ARCHIVE_NONE)
+	{
+		if(!rom_archive::extract(filename, cart_data, 0x20000000)) { return false; }
+
+		file_size = cart_data.size();
+		if(!file_size) { return util::report_error(filename, util::FILE_SIZE_ZERO); }
+	}
 
 	//Read data from the ROM file
-	file.read(reinterpret_cast<char*> (&cart_data[0]), file_size);
+	else
+	{
+		cart_data.resize(file_size);
+		file.read(reinterpret_cast<char*> (&cart_data[0]), file_size);
+	}
+
+	cart_size = file_size;
 
 	//Apply patches to the ROM data
-	if(config::use_patches)
+	if((config::use_patches) && (!cart_streamed))
 	{
-		std::string patch_file = util::get_filename_no_ext(filename);
+		std::string patch_file = rom_archive::get_patch_filename(filename);
 
 		//Attempt a IPS patch
 		bool patch_pass = util::patch_ips((patch_file + ".ips"), cart_data, 0x00, file_size);
@@ -4469,7 +4636,7 @@ bool NTR_MMU::read_file(std::string filename)
 	}
 
 	//Copy 368 bytes from header to Main RAM on boot
-	for(u32 x = 0; x < 0x170; x++) { write_u8((0x27FFE00 + x), cart_data[x]); }
+	for(u32 x = 0; x < 0x170; x++) { write_u8((0x27FFE00 + x), read_cart_u8(x)); }
 
 	file.close();
 	std::cout<<"MMU::" << filename << " loaded successfully. \n";
@@ -4482,7 +4649,7 @@ bool NTR_MMU::read_file(std::string filename)
 	for(u32 x = 0; x < header.arm9_size; x++)
 	{
 		if((header.arm9_rom_offset + x) >= file_size) { break; }
-		write_u8((header.arm9_ram_addr + x), cart_data[header.arm9_rom_offset + x]);
+		write_u8((header.arm9_ram_addr + x), read_cart_u8(header.arm9_rom_offset + x));
 	}
 
 	access_mode = 0;
@@ -4491,7 +4658,7 @@ bool NTR_MMU::read_file(std::string filename)
 	for(u32 x = 0; x < header.arm7_size; x++)
 	{
 		if((header.arm7_rom_offset + x) >= file_size) { break; }
-		write_u8((header.arm7_ram_addr + x), cart_data[header.arm7_rom_offset + x]);
+		write_u8((header.arm7_ram_addr + x), read_cart_u8(header.arm7_rom_offset + x));
 	}
 
 	access_mode = 1;
@@ -4869,6 +5036,26 @@ bool NTR_MMU::save_backup(std::string filename)
 	return true;
 }
 
+/****** Marks part of the battery save as changed so it can be written in the background ******/
+void NTR_MMU::mark_save_dirty(u32 offset, u32 length)
+{
+	if(!config::use_save_flush) { return; }
+
+	//Start background saving on the first write, or restart it if FRAM was expanded
+	if(save_flush::get_size() != save_data.size())
+	{
+		save_flush::start(config::save_file, save_data.size(), [this](u32 offset, u8* dst, u32 length) { read_save_data(offset, dst, length); });
+	}
+
+	save_flush::mark_dirty(offset, length);
+}
+
+/****** Copies part of the battery save into a buffer ******/
+void NTR_MMU::read_save_data(u32 offset, u8* dst, u32 length)
+{
+	for(u32 x = 0; x < length; x++) { dst[x] = save_data[offset + x]; }
+}
+
 /****** Start the DMA channels during HBlanking periods ******/
 void NTR_MMU::start_hblank_dma()
 {
@@ -4923,31 +5110,33 @@ void NTR_MMU::parse_header()
 {
 	//Game title
 	header.title = "";
-	for(int x = 0; x < 12; x++) { header.title += cart_data[x]; }
+	for(int x = 0; x < 12; x++) { header.title += read_cart_u8(x); }
 
 	//Game code
 	header.game_code = "";
-	for(int x = 0; x < 4; x++) { header.game_code += cart_data[0xC + x]; }
+	for(int x = 0; x < 4; x++) { header.game_code += read_cart_u8(0xC + x); }
 
 	//Maker code
 	header.maker_code = "";
-	for(int x = 0; x < 2; x++) { header.maker_code += cart_data[0x10 + x]; }
+	for(int x = 0; x < 2; x++) { header.maker_code += read_cart_u8(0x10 + x); }
 
 	std::cout<<"MMU::Game Title - " << util::make_ascii_printable(header.title) << "\n";
 	std::cout<<"MMU::Game Code - " << util::make_ascii_printable(header.game_code) << "\n";
 	std::cout<<"MMU::Maker Code - " << util::make_ascii_printable(header.maker_code) << "\n";
 
-	if(cart_data.size() < 0x100000) { std::cout<<"MMU::ROM Size: " << std::dec << (cart_data.size() / 1024) << "KB\n"; }
-	else { std::cout<<"MMU::ROM Size: " << std::dec << (cart_data.size() / 0x100000) << "MB\n"; }
+	if(cart_size < 0x100000) { std::cout<<"MMU::ROM Size: " << std::dec << (cart_size / 1024) << "KB\n"; }
+	else { std::cout<<"MMU::ROM Size: " << std::dec << (cart_size / 0x100000) << "MB\n"; }
 
-	std::cout<<"MMU::ROM CRC32: " << std::hex << util::get_crc32(&cart_data[0], cart_data.size()) << "\n";
+	//Block-compressed ROMs already know their CRC32 without decompressing everything
+	u32 crc32 = (cart_streamed) ? cart_stream.get_crc32() : rom_cache::get_crc32(config::rom_file, &cart_data[0], cart_size);
+	std::cout<<"MMU::ROM CRC32: " << std::hex << crc32 << "\n";
 
 	//ARM9 ROM Offset
 	header.arm9_rom_offset = 0;
 	for(int x = 0; x < 4; x++) 
 	{
 		header.arm9_rom_offset <<= 8;
-		header.arm9_rom_offset |= cart_data[0x23 - x];
+		header.arm9_rom_offset |= read_cart_u8(0x23 - x);
 	}
 
 	//ARM9 Entry Address
@@ -4955,7 +5144,7 @@ void NTR_MMU::parse_header()
 	for(int x = 0; x < 4; x++) 
 	{
 		header.arm9_entry_addr <<= 8;
-		header.arm9_entry_addr |= cart_data[0x27 - x];
+		header.arm9_entry_addr |= read_cart_u8(0x27 - x);
 	}
 
 	//ARM9 RAM Address
@@ -4963,7 +5152,7 @@ void NTR_MMU::parse_header()
 	for(int x = 0; x < 4; x++) 
 	{
 		header.arm9_ram_addr <<= 8;
-		header.arm9_ram_addr |= cart_data[0x2B - x];
+		header.arm9_ram_addr |= read_cart_u8(0x2B - x);
 	}
 
 	//ARM9 Size
@@ -4971,7 +5160,7 @@ void NTR_MMU::parse_header()
 	for(int x = 0; x < 4; x++) 
 	{
 		header.arm9_size <<= 8;
-		header.arm9_size |= cart_data[0x2F - x];
+		header.arm9_size |= read_cart_u8(0x2F - x);
 		if(header.arm9_size > 0x3BFE00) { header.arm9_size = 0x3BFE00; }
 	}
 
@@ -4980,7 +5169,7 @@ void NTR_MMU::parse_header()
 	for(int x = 0; x < 4; x++)
 	{
 		header.arm7_rom_offset <<= 8;
-		header.arm7_rom_offset |= cart_data[0x33 - x];
+		header.arm7_rom_offset |= read_cart_u8(0x33 - x);
 	}
 
 	//ARM7 Entry Address
@@ -4988,7 +5177,7 @@ void NTR_MMU::parse_header()
 	for(int x = 0; x < 4; x++) 
 	{
 		header.arm7_entry_addr <<= 8;
-		header.arm7_entry_addr |= cart_data[0x37 - x];
+		header.arm7_entry_addr |= read_cart_u8(0x37 - x);
 		if(header.arm7_size > 0x3BFE00) { header.arm7_size = 0x3BFE00; }
 	}
 
@@ -4997,7 +5186,7 @@ void NTR_MMU::parse_header()
 	for(int x = 0; x < 4; x++) 
 	{
 		header.arm7_ram_addr <<= 8;
-		header.arm7_ram_addr |= cart_data[0x3B - x];
+		header.arm7_ram_addr |= read_cart_u8(0x3B - x);
 	}
 
 	//ARM7 Size
@@ -5005,15 +5194,15 @@ void NTR_MMU::parse_header()
 	for(int x = 0; x < 4; x++) 
 	{
 		header.arm7_size <<= 8;
-		header.arm7_size |= cart_data[0x3F - x];
+		header.arm7_size |= read_cart_u8(0x3F - x);
 	}
 
 	//Set default ID code to Game ID
-	key_id = (cart_data[0xC] | (cart_data[0xD] << 8) | (cart_data[0xE] << 16) | (cart_data[0xF] << 24));
+	key_id = (read_cart_u8(0xC) | (read_cart_u8(0xD) << 8) | (read_cart_u8(0xE) << 16) | (read_cart_u8(0xF) << 24));
 
 	//Calculate Chip ID 1
 	u32 chip_id = 0xC2;
-	chip_id |= ((((128 << cart_data[0x14]) / 1024) - 1) << 8);
+	chip_id |= ((((128 << read_cart_u8(0x14)) / 1024) - 1) << 8);
 
 	write_u32(0x27FFC00, chip_id);
 	write_u32(0x27FF800, chip_id);
@@ -5323,7 +5512,8 @@ void NTR_MMU::process_aux_spi_bus()
 					while(save_data.size() < nds_aux_spi.access_addr) { save_data.resize(save_data.size() << 1); }
 				}
 
-				save_data[nds_aux_spi.access_addr++] = nds_aux_spi.data;
+				save_data[nds_aux_spi.access_addr] = nds_aux_spi.data;
+				mark_save_dirty(nds_aux_spi.access_addr++, 1);
 				nds_aux_spi.access_index++;
 				break;
 
@@ -21,6 +21,7 @@
 #include "gamepad.h"
 #include "timer.h"
 #include "common/config.h"
+#include "common/rom_archive.h"
 #include "lcd_data.h"
 #include "apu_data.h"
 
@@ -81,6 +82,11 @@ class NTR_MMU
 
 	std::vector <u8> memory_map;
 	std::vector <u8> cart_data;
+	u32 cart_size;
+
+	//Block-compressed ROMs are read through a cache instead of cart_data
+	rom_archive::block_stream cart_stream;
+	bool cart_streamed;
 	std::vector <u8> nds7_bios;
 	std::vector <u8> nds9_bios;
 	std::vector <u8> firmware;
@@ -332,6 +338,9 @@ class NTR_MMU
 
 	//Determines whether memory access comes from NDS9/NDS7
 	u8 access_mode;
+
+	//Set when a CPU touches registers shared with the other CPU, ends its time slice early
+	bool sync_request;
 	u8 wram_mode;
 	u8 rumble_state;
 
@@ -480,10 +489,14 @@ class NTR_MMU
 
 	void write_u16_fast(u32 address, u16 value);
 	void write_u32_fast(u32 address, u32 value);
+
+	u8* get_dma_block(u32 address, u32 length);
+	bool dma_block_transfer(u8 index, u8 unit_size);
 	void write_u64_fast(u32 address, u64 value);
 
-	u16 read_cart_u16(u32 address) const;
-	u32 read_cart_u32(u32 address) const;
+	u8 read_cart_u8(u32 address);
+	u16 read_cart_u16(u32 address);
+	u32 read_cart_u32(u32 address);
 
 	bool read_file(std::string filename);
 	bool read_slot2_file(std::string filename);
@@ -492,6 +505,8 @@ class NTR_MMU
 	bool read_firmware(std::string filename);
 	bool save_backup(std::string filename);
 	bool load_backup(std::string filename);
+	void mark_save_dirty(u32 offset, u32 length);
+	void read_save_data(u32 offset, u8* dst, u32 length);
 
 	void process_spi_bus();
 	void process_aux_spi_bus();
@@ -20,7 +20,7 @@ u8 NTR_MMU::read_slot2_device(u32 address)
 	switch(current_slot2_device)
 	{
 		case SLOT2_PASSME:
-			if((address & 0x7FFFFFF) < cart_data.size()) { slot_byte = cart_data[address & 0x7FFFFFF]; }
+			if((address & 0x7FFFFFF) < cart_size) { slot_byte = read_cart_u8(address & 0x7FFFFFF); }
 			break;
 
 		case SLOT2_RUMBLE_PAK:
@@ -17,7 +17,9 @@
 
 #include "common/config.h"
 #include "common/util.h"
+#include "common/mem_trace.h"
 #include "common/info.h"
+#include "common/rom_archive.h"
 
 /****** Main menu constructor ******/
 main_menu::main_menu(QWidget *parent) : QWidget(parent)
@@ -340,7 +342,7 @@ void main_menu::open_file()
 
 	if(config::cli_args.empty())
 	{
-		QString filename = QFileDialog::getOpenFileName(this, tr("Open"), "", tr("GBx/NDS/MIN/AM3 files (*.gb *.gbc *.gba *.nds *.min *.am3)"));
+		QString filename = QFileDialog::getOpenFileName(this, tr("Open"), "", tr("GBx/NDS/MIN/AM3 files (*.gb *.gbc *.gba *.nds *.min *.am3 *.zip *.gz)"));
 		if(filename.isNull()) { SDL_PauseAudio(0); return; }
 
 		next_rom_file = filename.toStdString();
@@ -976,10 +978,11 @@ void main_menu::boot_game()
 	//Note, DMG and GBC games are automatically detected in the Gameboy MMU, so only check for GBA and NDS types here
 	if(config::rom_file != "NOCART")
 	{
-		std::size_t dot = config::rom_file.find_last_of(".");
+		std::string rom_name = rom_archive::get_rom_filename(config::rom_file);
+		std::size_t dot = rom_name.find_last_of(".");
 		std::string ext = "";
 
-		if(dot != std::string::npos) { ext = config::rom_file.substr(dot); }
+		if(dot != std::string::npos) { ext = rom_name.substr(dot); }
 
 		config::gb_type = settings->sys_type->currentIndex();
 	
@@ -1148,8 +1151,18 @@ void main_menu::boot_game()
 	save_ini_file();
 	save_cheats_file();
 
+	//Start memory access tracing from boot if requested
+	if(config::use_mem_trace) { mem_trace::start(); }
+
 	//Actually run the core
 	main_menu::gbe_plus->run_core();
+
+	//Save any memory trace still in progress
+	if(mem_trace::enabled)
+	{
+		mem_trace::stop();
+		mem_trace::dump(mem_trace::get_dump_filename());
+	}
 }
 
 /****** Updates the main window ******/
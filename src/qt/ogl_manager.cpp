@@ -32,6 +32,9 @@
 ogl_manager::ogl_manager()
 {
 	lcd_texture = 0;
+	pixel_buffers[0] = pixel_buffers[1] = pixel_buffers[2] = 0;
+	pixel_buffer_index = 0;
+	texture_width = texture_height = 0;
 	program_id = 0;
 	vertex_buffer_object = 0;
 	vertex_array_object = 0;
@@ -61,6 +64,8 @@ void ogl_manager::init()
 	glDeleteVertexArrays(1, &vertex_array_object);
 	glDeleteBuffers(1, &vertex_buffer_object);
 	glDeleteBuffers(1, &element_buffer_object);
+	glDeleteBuffers(3, pixel_buffers);
+	glDeleteTextures(1, &lcd_texture);
 
 	//Define vertices and texture coordinates for the screen texture
     	GLfloat vertices[] =
@@ -104,9 +109,13 @@ void ogl_manager::init()
 	//Unbind vertex array object
 	glBindVertexArray(0);
 
-	//Generate the screen texture
+	//Generate the screen texture - Storage and pixel buffers are created on the first upload
 	glGenTextures(1, &lcd_texture);
 
+	pixel_buffers[0] = pixel_buffers[1] = pixel_buffers[2] = 0;
+	pixel_buffer_index = 0;
+	texture_width = texture_height = 0;
+
 	external_data_usage = 0;
 
 	//Load the shader
@@ -118,14 +127,8 @@ void ogl_manager::init()
 /****** OpenGL Manager - Paint ******/
 void ogl_manager::paint()
 {
-	//Bind screen texture, then generate texture from lcd pixels
-	glBindTexture(GL_TEXTURE_2D, lcd_texture);
-
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, config::sys_width, config::sys_height, 0, GL_BGRA, GL_UNSIGNED_BYTE, pixel_data);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-	glBindTexture(GL_TEXTURE_2D, 0);
+	//Stream lcd pixels into the screen texture
+	gx_upload_texture(lcd_texture, pixel_buffers, pixel_buffer_index, texture_width, texture_height, pixel_data, config::sys_width, config::sys_height);
 
     	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
     	glClear(GL_COLOR_BUFFER_BIT);
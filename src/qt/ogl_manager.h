@@ -26,6 +26,9 @@ class ogl_manager
 	void resize(u32 w, u32 h);
 
 	u32 lcd_texture;
+	u32 pixel_buffers[3];
+	u32 pixel_buffer_index;
+	u32 texture_width, texture_height;
 	u32 program_id;
 	u32 external_data_usage;
 	u32 vertex_buffer_object, vertex_array_object, element_buffer_object;
@@ -8,6 +8,8 @@
 //
 // Renders the screen for an emulated system using Qt
 
+#include <cstring>
+
 #include "render.h"
 
 #include "common/config.h"
@@ -30,19 +32,18 @@ void render_screen_sw(std::vector<u32>& image)
 		qt_gui::screen = new QImage(config::sys_width, config::sys_height, QImage::Format_ARGB32);
 	}
 
-	int width, height = 0;
-
 	//Determine the dimensions of the source image
 	//GBA = 240x160, GB-GBC = 160x144, NDS = 256x384, SGB = 256x224, MIN = 96x64
-	width = config::sys_width;
-	height = config::sys_height;
+	u32 width = config::sys_width;
+	u32 height = config::sys_height;
 
-	//Fill in image with pixels from the emulated LCD
-	for(int y = 0; y < height; y++)
-	{
-		u32* pixel_data = (u32*)qt_gui::screen->scanLine(y);
+	if((width * height) > image.size()) { height = image.size() / width; }
 
-		for(int x = 0; x < width; x++) { pixel_data[x] = image[x + (y*width)]; }
+	//Fill in image with pixels from the emulated LCD, one whole line at a time
+	if((qt_gui::screen != nullptr) && (width <= (u32)qt_gui::screen->width()))
+	{
+		if(height > (u32)qt_gui::screen->height()) { height = qt_gui::screen->height(); }
+		for(u32 y = 0; y < height; y++) { memcpy(qt_gui::screen->scanLine(y), &image[y * width], width * 4); }
 	}
 
 	if(qt_gui::draw_surface != nullptr) { qt_gui::draw_surface->update(); }
@@ -31,23 +31,21 @@ void soft_screen::paintEvent(QPaintEvent* event)
 	if(qt_gui::screen != nullptr)
 	{
 		//Maintain aspect ratio
+		//Scale while drawing rather than building an intermediate scaled QImage every frame
 		if(config::maintain_aspect_ratio)
 		{
-			QImage final_screen = qt_gui::screen->scaled(width(), height(), Qt::KeepAspectRatio);
-			QPainter painter(this);
+			QSize final_size = qt_gui::screen->size().scaled(width(), height(), Qt::KeepAspectRatio);
 
-			int x_offset = (width() - final_screen.width()) / 2;
-			int y_offset = (height() - final_screen.height()) / 2;
+			int x_offset = (width() - final_size.width()) / 2;
+			int y_offset = (height() - final_size.height()) / 2;
 
-			painter.drawImage(x_offset, y_offset, final_screen);	
+			painter.drawImage(QRect(x_offset, y_offset, final_size.width(), final_size.height()), *qt_gui::screen);
 		}
 
 		//Ignore aspect ratio
 		else
 		{
-			QImage final_screen = qt_gui::screen->scaled(width(), height());
-			QPainter painter(this);
-			painter.drawImage(0, 0, final_screen);
+			painter.drawImage(QRect(0, 0, width(), height()), *qt_gui::screen);
 		}
 
 		//Update FPS counter + title
@@ -0,0 +1,553 @@
+// GB Enhanced Copyright Daniel Baxter 2026
+// Licensed under the GPLv2
+// See LICENSE.txt for full license text
+
+// File : regress.cpp
+// Date : October 19, 2026
+// Description : Headless frame-hash regression runner
+//
+// Boots a ROM without any windows, plays back a scripted input log, and runs for a fixed number of frames
+// Every frame's screen buffer and the audio mixed during that frame are hashed, and emulated FPS is measured
+// Results can be recorded as a golden file, or compared against one to catch changes in output or speed
+// A watchdog fails the run if no frame arrives for too long, e.g. when a game leaves the LCD off
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+#include "gba/core.h"
+#include "dmg/core.h"
+#include "sgb/core.h"
+#include "nds/core.h"
+#include "min/core.h"
+#include "common/config.h"
+#include "common/util.h"
+
+#include <SDL_main.h>
+
+namespace regress
+{
+	//Hashes for one emulated frame
+	struct frame_hash
+	{
+		u32 video;
+		u32 audio;
+	};
+
+	//One scripted button press or release
+	struct input_event
+	{
+		u32 frame;
+		u32 key;
+		bool pressed;
+	};
+
+	//Results of a run, or the contents of a golden file
+	struct run_data
+	{
+		std::string rom;
+		u32 frames;
+		double fps;
+		std::vector<frame_hash> hashes;
+	};
+
+	core_emu* core = nullptr;
+	SDL_AudioSpec* audio_spec = nullptr;
+	std::vector<u8> audio_buffer;
+
+	std::vector<input_event> inputs;
+	u32 next_input = 0;
+
+	u32 target_frames = 0;
+	run_data current;
+
+	//Watchdog state - Frames are only counted when the core presents them, so a blank LCD would otherwise run forever
+	std::atomic<u32> frame_count(0);
+	std::thread watchdog;
+	std::mutex watchdog_lock;
+	std::condition_variable watchdog_wake;
+	bool watchdog_quit = false;
+	std::string save_file = "";
+
+/****** Finds the audio specification of the core's APU - Used to pull audio manually, one frame at a time ******/
+SDL_AudioSpec* get_audio_spec(core_emu* emu)
+{
+	if(AGB_core* agb = dynamic_cast<AGB_core*>(emu)) { return &agb->core_cpu.controllers.audio.desired_spec; }
+	else if(DMG_core* dmg = dynamic_cast<DMG_core*>(emu)) { return &dmg->core_cpu.controllers.audio.desired_spec; }
+	else if(SGB_core* sgb = dynamic_cast<SGB_core*>(emu)) { return &sgb->core_cpu.controllers.audio.desired_spec; }
+	else if(NTR_core* ntr = dynamic_cast<NTR_core*>(emu)) { return &ntr->core_cpu_nds7.controllers.audio.desired_spec; }
+	else if(MIN_core* min = dynamic_cast<MIN_core*>(emu)) { return &min->core_cpu.controllers.audio.desired_spec; }
+
+	return nullptr;
+}
+
+/****** Converts a button name from an input log into the key bound to it ******/
+bool get_key(std::string name, u32 &key)
+{
+	std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+	if(name == "a") { key = config::gbe_key_a; }
+	else if(name == "b") { key = config::gbe_key_b; }
+	else if(name == "x") { key = config::gbe_key_x; }
+	else if(name == "y") { key = config::gbe_key_y; }
+	else if(name == "l") { key = config::gbe_key_l_trigger; }
+	else if(name == "r") { key = config::gbe_key_r_trigger; }
+	else if(name == "start") { key = config::gbe_key_start; }
+	else if(name == "select") { key = config::gbe_key_select; }
+	else if(name == "up") { key = config::gbe_key_up; }
+	else if(name == "down") { key = config::gbe_key_down; }
+	else if(name == "left") { key = config::gbe_key_left; }
+	else if(name == "right") { key = config::gbe_key_right; }
+	else { return false; }
+
+	return true;
+}
+
+/****** Loads a scripted input log - Each line is "<frame> <button> <down|up>" ******/
+bool load_inputs(std::string filename)
+{
+	std::ifstream file(filename.c_str(), std::ios::in);
+
+	if(!file.is_open())
+	{
+		std::cout<<"GBE::Error - Could not open input log " << filename << "\n";
+		return false;
+	}
+
+	std::string line;
+	u32 line_number = 0;
+
+	while(std::getline(file, line))
+	{
+		line_number++;
+
+		//Skip blank lines and comments
+		if(line.empty() || (line[0] == '#')) { continue; }
+
+		std::istringstream stream(line);
+		std::string frame_str, button, state;
+		stream >> frame_str >> button >> state;
+
+		input_event event;
+
+		if(!util::from_str(frame_str, event.frame) || !get_key(button, event.key) || ((state != "down") && (state != "up")))
+		{
+			std::cout<<"GBE::Error - Invalid input log entry on line " << line_number << " : " << line << "\n";
+			return false;
+		}
+
+		event.pressed = (state == "down");
+		inputs.push_back(event);
+	}
+
+	//Events for the same frame keep their original order
+	std::stable_sort(inputs.begin(), inputs.end(), [](const input_event &a, const input_event &b) { return a.frame < b.frame; });
+
+	std::cout<<"GBE::Loaded " << inputs.size() << " input events from " << filename << "\n";
+	return true;
+}
+
+/****** Feeds every scripted input due before the given frame ******/
+void apply_inputs(u32 frame)
+{
+	while((next_input < inputs.size()) && (inputs[next_input].frame <= frame))
+	{
+		core->feed_key_input(inputs[next_input].key, inputs[next_input].pressed);
+		next_input++;
+	}
+}
+
+/****** Receives each finished frame from the core - Hashes video and audio, then feeds input for the next frame ******/
+void capture_frame(std::vector<u32> &buffer)
+{
+	frame_hash hash;
+	hash.video = util::get_crc32((u8*)buffer.data(), buffer.size() * 4);
+	hash.audio = 0;
+
+	//Mix exactly one frame's worth of audio
+	if((audio_spec != nullptr) && (audio_spec->callback != nullptr))
+	{
+		u32 length = (audio_spec->freq / 60) * audio_spec->channels * 2;
+		audio_buffer.assign(length, 0);
+
+		audio_spec->callback(audio_spec->userdata, audio_buffer.data(), length);
+		hash.audio = util::get_crc32(audio_buffer.data(), length);
+	}
+
+	current.hashes.push_back(hash);
+	frame_count = current.hashes.size();
+	config::osd_count = 0;
+
+	if(current.hashes.size() >= target_frames) { core->running = false; }
+	else { apply_inputs(current.hashes.size()); }
+}
+
+/****** Watchdog thread - Fails the run when no frame has been produced within the timeout ******/
+void watchdog_main(u32 timeout)
+{
+	typedef std::chrono::steady_clock watchdog_clock;
+
+	u32 last_count = 0;
+	auto last_progress = watchdog_clock::now();
+
+	std::unique_lock<std::mutex> lock(watchdog_lock);
+
+	while(!watchdog_quit)
+	{
+		watchdog_wake.wait_for(lock, std::chrono::milliseconds(100));
+
+		u32 count = frame_count;
+		auto now = watchdog_clock::now();
+
+		if(count != last_count)
+		{
+			last_count = count;
+			last_progress = now;
+		}
+
+		//The emulation thread cannot be interrupted safely, so end the whole process with a failure
+		else if(std::chrono::duration_cast<std::chrono::seconds>(now - last_progress).count() >= (s64)timeout)
+		{
+			std::cout<<"GBE::Error - No frame produced for " << timeout << " seconds after frame " << count << " of " << target_frames << ", the LCD may be off\n" << std::flush;
+			std::filesystem::remove(save_file);
+			std::_Exit(1);
+		}
+	}
+}
+
+/****** Starts the watchdog - A timeout of 0 disables it ******/
+void start_watchdog(u32 timeout)
+{
+	if(!timeout) { return; }
+	watchdog = std::thread(watchdog_main, timeout);
+}
+
+/****** Stops the watchdog once the core returns ******/
+void stop_watchdog()
+{
+	if(!watchdog.joinable()) { return; }
+
+	{
+		std::lock_guard<std::mutex> lock(watchdog_lock);
+		watchdog_quit = true;
+	}
+
+	watchdog_wake.notify_one();
+	watchdog.join();
+}
+
+/****** Writes results as a golden file ******/
+bool save_golden(std::string filename, const run_data &data)
+{
+	std::ofstream file(filename.c_str(), std::ios::out | std::ios::trunc);
+
+	if(!file.is_open())
+	{
+		std::cout<<"GBE::Error - Could not write golden file " << filename << "\n";
+		return false;
+	}
+
+	file << "# GBE+ frame hash golden file\n";
+	file << "# Each frame is listed as <frame> <video CRC32> <audio CRC32>\n";
+	file << "rom " << data.rom << "\n";
+	file << "frames " << data.frames << "\n";
+	file << "fps " << std::fixed << std::setprecision(2) << data.fps << "\n";
+
+	for(u32 x = 0; x < data.hashes.size(); x++)
+	{
+		file << std::dec << x << std::hex << std::uppercase << std::setfill('0');
+		file << " " << std::setw(8) << data.hashes[x].video << " " << std::setw(8) << data.hashes[x].audio << "\n";
+	}
+
+	file.close();
+
+	std::cout<<"GBE::Wrote golden file " << filename << "\n";
+	return true;
+}
+
+/****** Reads a golden file ******/
+bool load_golden(std::string filename, run_data &data)
+{
+	std::ifstream file(filename.c_str(), std::ios::in);
+
+	if(!file.is_open())
+	{
+		std::cout<<"GBE::Error - Could not open golden file " << filename << "\n";
+		return false;
+	}
+
+	data.rom = "";
+	data.frames = 0;
+	data.fps = 0.0;
+	data.hashes.clear();
+
+	std::string line;
+
+	while(std::getline(file, line))
+	{
+		if(line.empty() || (line[0] == '#')) { continue; }
+
+		std::istringstream stream(line);
+		std::string field;
+		stream >> field;
+
+		if(field == "rom") { std::getline(stream >> std::ws, data.rom); }
+		else if(field == "frames") { stream >> data.frames; }
+		else if(field == "fps") { stream >> data.fps; }
+
+		else
+		{
+			std::string video, audio;
+			stream >> video >> audio;
+
+			frame_hash hash;
+
+			if(!util::from_hex_str(video, hash.video) || !util::from_hex_str(audio, hash.audio))
+			{
+				std::cout<<"GBE::Error - Invalid golden file entry : " << line << "\n";
+				return false;
+			}
+
+			data.hashes.push_back(hash);
+		}
+	}
+
+	if(data.hashes.size() != data.frames)
+	{
+		std::cout<<"GBE::Error - Golden file " << filename << " lists " << data.hashes.size() << " of " << data.frames << " frames\n";
+		return false;
+	}
+
+	return true;
+}
+
+/****** Compares a run against a golden file - Returns true if output matches and speed is within tolerance ******/
+bool compare(const run_data &golden, const run_data &data, double fps_tolerance)
+{
+	bool result = true;
+
+	if(golden.rom != data.rom) { std::cout<<"GBE::Warning - Golden file was recorded with " << golden.rom << "\n"; }
+
+	if(golden.frames != data.frames)
+	{
+		std::cout<<"GBE::Frame count differs - Expected " << golden.frames << ", ran " << data.frames << "\n";
+		result = false;
+	}
+
+	u32 video_mismatches = 0;
+	u32 audio_mismatches = 0;
+	u32 count = std::min(golden.hashes.size(), data.hashes.size());
+
+	for(u32 x = 0; x < count; x++)
+	{
+		bool video_match = (golden.hashes[x].video == data.hashes[x].video);
+		bool audio_match = (golden.hashes[x].audio == data.hashes[x].audio);
+
+		if(!video_match) { video_mismatches++; }
+		if(!audio_match) { audio_mismatches++; }
+
+		//Only the first few differences are useful, later frames usually differ as a result
+		if((!video_match || !audio_match) && ((video_mismatches + audio_mismatches) <= 10))
+		{
+			std::cout<<"GBE::Frame " << x << " differs -" << (video_match ? "" : " video") << (audio_match ? "" : " audio") << "\n";
+		}
+	}
+
+	if(video_mismatches || audio_mismatches)
+	{
+		std::cout<<"GBE::Output differs - " << video_mismatches << " video frames, " << audio_mismatches << " audio frames\n";
+		result = false;
+	}
+
+	else { std::cout<<"GBE::Output matches golden file\n"; }
+
+	//Speed is reported, and only fails the run when a tolerance is given
+	if(golden.fps > 0.0)
+	{
+		double change = ((data.fps - golden.fps) / golden.fps) * 100.0;
+		std::cout<<"GBE::Speed " << std::fixed << std::setprecision(2) << data.fps << " FPS vs " << golden.fps << " FPS (" << std::showpos << change << std::noshowpos << "%)\n";
+
+		if((fps_tolerance >= 0.0) && (change < -fps_tolerance))
+		{
+			std::cout<<"GBE::Speed is more than " << fps_tolerance << "% below golden file\n";
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+/****** Creates the core for the current system type ******/
+core_emu* create_core()
+{
+	if(config::gb_type == SYS_GBA) { return new AGB_core(); }
+	else if((config::gb_type >= SYS_AUTO) && (config::gb_type <= SYS_GBC)) { return new DMG_core(); }
+	else if((config::gb_type == SYS_SGB) || (config::gb_type == SYS_SGB2)) { return new SGB_core(); }
+	else if(config::gb_type == SYS_MIN) { return new MIN_core(); }
+	else { return new NTR_core(); }
+}
+
+}
+
+int main(int argc, char* args[])
+{
+	std::string input_file = "";
+	std::string golden_file = "";
+	std::string record_file = "";
+	double fps_tolerance = -1.0;
+	u32 frames = 0;
+	u32 timeout = 10;
+	bool valid_args = true;
+
+	//Runner options are handled here, everything else goes to the normal command-line parser
+	for(int x = 1; x < argc; x++)
+	{
+		std::string arg = args[x];
+
+		if((arg == "--frames") && ((x + 1) < argc)) { valid_args &= util::from_str(args[++x], frames); }
+		else if((arg == "--timeout") && ((x + 1) < argc)) { valid_args &= util::from_str(args[++x], timeout); }
+		else if((arg == "--input") && ((x + 1) < argc)) { input_file = args[++x]; }
+		else if((arg == "--golden") && ((x + 1) < argc)) { golden_file = args[++x]; }
+		else if((arg == "--record") && ((x + 1) < argc)) { record_file = args[++x]; }
+		else if((arg == "--fps-tolerance") && ((x + 1) < argc))
+		{
+			u32 percent = 0;
+			valid_args &= util::from_str(args[++x], percent);
+			fps_tolerance = percent;
+		}
+
+		else { config::cli_args.push_back(arg); }
+	}
+
+	if(!valid_args)
+	{
+		std::cout<<"GBE::Error - --frames, --timeout, and --fps-tolerance need a whole number\n";
+		return 1;
+	}
+
+	if(config::cli_args.empty() || ((config::cli_args[0] == "-h") || (config::cli_args[0] == "--help")))
+	{
+		std::cout<<"Usage: gbe_regress rom_file [--frames n] [--input input_log] [--golden file | --record file] [--fps-tolerance percent] [--timeout seconds] [GBE+ options]\n";
+		return config::cli_args.empty() ? 1 : 0;
+	}
+
+	regress::run_data golden;
+	bool use_golden = !golden_file.empty();
+
+	if(use_golden)
+	{
+		if(!regress::load_golden(golden_file, golden)) { return 1; }
+		if(!frames) { frames = golden.frames; }
+	}
+
+	if(!frames)
+	{
+		std::cout<<"GBE::Error - No frame count given\n";
+		return 1;
+	}
+
+	parse_filenames();
+	load_ini_file("gbe.ini");
+
+	if(!parse_cli_args()) { return 1; }
+
+	config::gb_type = get_system_type_from_file(config::rom_file);
+
+	//Never open windows, never wait for real time, and render every single frame
+	config::sdl_render = false;
+	config::use_opengl = false;
+	config::render_external_sw = regress::capture_frame;
+	config::turbo = true;
+	config::turbo_frame_skip = 0;
+	config::frame_skip = 0;
+	config::auto_frame_skip = false;
+	config::override_audio_driver = "dummy";
+	config::use_debugger = false;
+
+	//Keep battery saves out of the results - Every run starts from a blank save
+	std::string save_file = (std::filesystem::temp_directory_path() / "gbe_regress.sav").string();
+	std::filesystem::remove(save_file);
+	regress::save_file = save_file;
+
+	config::save_file = save_file;
+	config::save_path = "";
+	config::save_export_path = "";
+	config::use_save_flush = false;
+
+	if(!input_file.empty() && !regress::load_inputs(input_file)) { return 1; }
+
+	SDL_Init(SDL_INIT_EVENTS);
+
+	regress::core = regress::create_core();
+
+	if(config::use_bios)
+	{
+		if(config::bios_file == "")
+		{
+			switch(config::gb_type)
+			{
+				case SYS_DMG: config::bios_file = config::dmg_bios_path; break;
+				case SYS_GBC: config::bios_file = config::gbc_bios_path; break;
+				case SYS_GBA: config::bios_file = config::agb_bios_path; break;
+				case SYS_MIN: config::bios_file = config::min_bios_path; break;
+			}
+		}
+
+		if(!regress::core->read_bios(config::bios_file)) { return 1; }
+	}
+
+	if(!regress::core->read_file(config::rom_file)) { return 1; }
+
+	if((config::use_firmware) && (config::gb_type == SYS_NDS))
+	{
+		if(!regress::core->read_firmware(config::nds_firmware_path)) { return 1; }
+	}
+
+	//Boot messages would otherwise be drawn into the first frames
+	config::osd_count = 0;
+
+	regress::core->start();
+
+	if(!regress::core->running)
+	{
+		std::cout<<"GBE::Error - Core could not be started\n";
+		return 1;
+	}
+
+	//Audio is pulled once per frame by the runner instead of by the audio device
+	SDL_CloseAudio();
+	regress::audio_spec = regress::get_audio_spec(regress::core);
+
+	regress::target_frames = frames;
+	regress::current.rom = util::get_filename_from_path(config::rom_file);
+	regress::apply_inputs(0);
+
+	auto start = std::chrono::steady_clock::now();
+	regress::start_watchdog(timeout);
+	regress::core->run_core();
+	regress::stop_watchdog();
+
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::filesystem::remove(save_file);
+
+	regress::current.frames = regress::current.hashes.size();
+	regress::current.fps = (elapsed > 0.0) ? (regress::current.frames / elapsed) : 0.0;
+
+	std::cout<<"GBE::Ran " << regress::current.frames << " frames in " << std::fixed << std::setprecision(3) << elapsed << " seconds (" << std::setprecision(2) << regress::current.fps << " FPS)\n";
+
+	bool result = true;
+
+	if(!record_file.empty()) { result = regress::save_golden(record_file, regress::current); }
+	if(use_golden) { result = regress::compare(golden, regress::current, fps_tolerance) && result; }
+
+	return (result) ? 0 : 1;
+}
@@ -15,6 +15,10 @@
 #include <sstream>
 
 #include "common/util.h"
+#include "common/sw_filter.h"
+#include "common/mem_trace.h"
+#include "common/profiler.h"
+#include "common/save_flush.h"
 
 #include "core.h"
 
@@ -284,6 +288,9 @@ void SGB_core::run_core()
 	//Begin running the core
 	while(running)
 	{
+		//Write battery saves in the background once games stop writing to them
+		if((save_flush::pending) && (core_cpu.controllers.video.lcd_stat.current_scanline == 144)) { save_flush::update(); }
+
 		//Handle SDL Events
 		if(core_cpu.controllers.video.lcd_stat.current_scanline == 144)
 		{
@@ -320,6 +327,8 @@ void SGB_core::run_core()
 			//Receive byte from another instance of GBE+ via netplay
 			if(core_cpu.controllers.serial_io.sio_stat.connected)
 			{
+				profiler::scope timer(profiler::PROF_SIO);
+
 				//Perform syncing operations when hard sync is enabled
 				if(config::netplay_hard_sync)
 				{
@@ -764,8 +773,10 @@ void SGB_core::handle_hotkey(SDL_Event& event)
 	//Toggle Fullscreen on F12
 	else if((event.type == SDL_KEYUP) && (event.key.keysym.sym == SDLK_F12))
 	{
-		u32 next_w = config::sys_width;
-		u32 next_h = config::sys_height;
+		//Windowed mode must match the software filter's output size
+		u32 filter_scale = (config::use_opengl) ? 1 : sw_filter::get_scale();
+		u32 next_w = config::sys_width * filter_scale;
+		u32 next_h = config::sys_height * filter_scale;
 
 		//Unset fullscreen
 		if(config::flags & SDL_WINDOW_FULLSCREEN)
@@ -859,6 +870,12 @@ void SGB_core::handle_hotkey(SDL_Event& event)
 		if((config::sdl_render) && (config::use_opengl)) { SDL_GL_SetSwapInterval(1); }
 	}
 		
+	//Start or stop memory access tracing on F10
+	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F10)) { mem_trace::toggle(); }
+
+	//Start or stop frame profiling on F11
+	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F11)) { profiler::toggle(); }
+
 	//Reset emulation on F8
 	else if((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_F8))
 	{
@@ -941,6 +958,12 @@ void SGB_core::handle_hotkey(int input, bool pressed)
 	//Toggle turbo off
 	else if((input == config::hotkey_turbo) && (!pressed)) { config::turbo = false; }
 
+	//Start or stop memory access tracing on F10
+	else if((input == SDLK_F10) && (pressed)) { mem_trace::toggle(); }
+
+	//Start or stop frame profiling on F11
+	else if((input == SDLK_F11) && (pressed)) { profiler::toggle(); }
+
 	//GB Camera load/unload external picture into VRAM
 	else if((input == config::hotkey_camera) && (pressed))
 	{
@@ -13,6 +13,8 @@
 
 #include "lcd.h"
 #include "common/util.h"
+#include "common/sw_filter.h"
+#include "common/profiler.h"
 
 /****** LCD Constructor ******/
 SGB_LCD::SGB_LCD()
@@ -217,11 +219,12 @@ bool SGB_LCD::init()
 			}
 		}
 
-		//Set up software rendering
+		//Set up software rendering - Software filters may enlarge the output
 		else
 		{
-			u32 next_w = config::sys_width;
-			u32 next_h = config::sys_height;
+			u32 filter_scale = sw_filter::get_scale();
+			u32 next_w = config::sys_width * filter_scale;
+			u32 next_h = config::sys_height * filter_scale;
 
 			if(config::flags & SDL_WINDOW_FULLSCREEN)
 			{
@@ -244,10 +247,10 @@ bool SGB_LCD::init()
 
 			window = SDL_CreateWindow("GBE+", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, next_w, next_h, config::flags);
 			SDL_GetWindowSize(window, &config::win_width, &config::win_height);
-			config::scaling_factor = 1;
+			config::scaling_factor = filter_scale;
 
 			final_screen = SDL_GetWindowSurface(window);
-			original_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, config::sys_width, config::sys_height, 32, 0, 0, 0, 0);
+			original_screen = SDL_CreateRGBSurface(SDL_SWSURFACE, (config::sys_width * filter_scale), (config::sys_height * filter_scale), 32, 0, 0, 0, 0);
 		}
 
 		if(final_screen == nullptr) { return false; }
@@ -943,7 +946,11 @@ void SGB_LCD::step(int cpu_clock)
 					else { update_obj_render_list(); }
 					
 					//Render scanline when first entering Mode 0
-					if(!config::request_resize) { render_sgb_scanline(); }
+					if(!config::request_resize)
+					{
+						profiler::scope timer(profiler::PROF_PPU);
+						render_sgb_scanline();
+					}
 
 					//HBlank STAT INT
 					if(mem->memory_map[REG_STAT] & 0x08) { mem->memory_map[IF_FLAG] |= 2; }
@@ -1021,9 +1028,14 @@ void SGB_LCD::step(int cpu_clock)
 					draw_osd_msg(config::osd_message, screen_buffer, 0, 0);
 				}
 
+				//Display profiler overlay
+				if(profiler::enabled) { profiler::draw_overlay(screen_buffer); }
+
 				//Render final screen buffer
 				if(lcd_stat.lcd_enable)
 				{
+					profiler::scope timer(profiler::PROF_PRESENT);
+
 					//Use SDL
 					if(config::sdl_render)
 					{
@@ -1034,7 +1046,13 @@ void SGB_LCD::step(int cpu_clock)
 							if(SDL_MUSTLOCK(original_screen)){ SDL_LockSurface(original_screen); }
 							u32* out_pixel_data = (u32*)original_screen->pixels;
 
-							for(int a = 0; a < screen_buffer.size(); a++) { out_pixel_data[a] = screen_buffer[a]; }
+							//Apply software filters
+							if(sw_filter::is_enabled()) { sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, original_screen->pitch >> 2); }
+
+							else
+							{
+								for(int a = 0; a < screen_buffer.size(); a++) { out_pixel_data[a] = screen_buffer[a]; }
+							}
 
 							//Unlock source surface
 							if(SDL_MUSTLOCK(original_screen)){ SDL_UnlockSurface(original_screen); }
@@ -1066,21 +1084,27 @@ void SGB_LCD::step(int cpu_clock)
 						//Otherwise, render normally (SDL 1:1, OpenGL handles its own stretching)
 						else
 						{
-							//Lock source surface
-							if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
-							u32* out_pixel_data = (u32*)final_screen->pixels;
-
-							for(int a = 0; a < screen_buffer.size(); a++) { out_pixel_data[a] = screen_buffer[a]; }
+							//Display final screen buffer - OpenGL, uploaded straight from the screen buffer
+							if(config::use_opengl) { gx_blit_opengl(window, screen_buffer.data()); }
 
-							//Unlock source surface
-							if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
-		
-							//Display final screen buffer - OpenGL
-							if(config::use_opengl) { gx_blit_opengl(window, final_screen); }
-				
 							//Display final screen buffer - SDL
-							else 
+							else
 							{
+								//Lock source surface
+								if(SDL_MUSTLOCK(final_screen)){ SDL_LockSurface(final_screen); }
+								u32* out_pixel_data = (u32*)final_screen->pixels;
+
+								//Apply software filters
+								if(sw_filter::is_enabled()) { sw_filter::apply(screen_buffer.data(), config::sys_width, config::sys_height, out_pixel_data, final_screen->pitch >> 2); }
+
+								else
+								{
+									for(int a = 0; a < screen_buffer.size(); a++) { out_pixel_data[a] = screen_buffer[a]; }
+								}
+
+								//Unlock source surface
+								if(SDL_MUSTLOCK(final_screen)){ SDL_UnlockSurface(final_screen); }
+
 								if(SDL_UpdateWindowSurface(window) != 0)
 								{
 									std::cout<<"LCD::Error - Could not blit\n";
@@ -1123,12 +1147,17 @@ void SGB_LCD::step(int cpu_clock)
 				//Limit framerate
 				if(!config::turbo)
 				{
+					profiler::scope timer(profiler::PROF_IDLE);
+
 					frame_current_time = SDL_GetTicks();
 					int delay = frame_delay[fps_count % 60];
 					if((frame_current_time - frame_start_time) < delay) { SDL_Delay(delay - (frame_current_time - frame_start_time));}
 					frame_start_time = SDL_GetTicks();
 				}
 
+				//Total profiler timers for this frame
+				profiler::end_frame();
+
 				//Update FPS counter + title
 				fps_count++;
 				if(((SDL_GetTicks() - fps_time) >= 1000) && (config::sdl_render)) 